@@ -0,0 +1,65 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/config/Optimizations.h
+//  \brief Configuration of the performance optimizations
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for deterministic parallel reductions.
+// \ingroup config
+//
+// This compilation switch enables/disables the deterministic mode of the parallel (SMP) full
+// reductions of dense tensors and arrays (as for instance \c sum(), \c prod(), \c min(), or
+// \c max()). In case the switch is set to 1 (i.e. in case deterministic reductions are enabled),
+// the elements are split into a fixed number of blocks, which only depends on the size of the
+// operand, and the partial results of the blocks are combined in a fixed tree order. Therefore
+// the result of a reduction is bitwise reproducible from run to run, independent of the number
+// of threads. In case the switch is set to 0, each thread computes a single partial result and
+// the result of floating point reductions may vary with the number of threads.
+//
+// Possible settings for the deterministic reduction switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate deterministic reductions via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_DETERMINISTIC_REDUCTION 1
+   #include <blaze_tensor/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_DETERMINISTIC_REDUCTION
+#define BLAZE_USE_DETERMINISTIC_REDUCTION 0
+#endif
+//*************************************************************************************************
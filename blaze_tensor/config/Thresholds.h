@@ -176,3 +176,61 @@
 #define BLAZE_SMP_DTENSDMATSCHUR_THRESHOLD 36100UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense tensor reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the full reduction of a dense tensor (as for instance \c sum(),
+// \c prod(), \c min(), or \c max()) can be executed in parallel. In case the number of elements
+// of the dense tensor is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 262144 (which corresponds to a tensor size of
+// \f$ 64 \times 64 \times 64 \f$). In case the threshold is set to 0, the operation is
+// unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DTENSREDUCE_THRESHOLD 262144UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DTENSREDUCE_THRESHOLD
+#define BLAZE_SMP_DTENSREDUCE_THRESHOLD 262144UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense array reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the full reduction of a dense array can be executed in parallel.
+// In case the number of elements of the dense array is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+//
+// The default setting for this threshold is 262144. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DARRREDUCE_THRESHOLD 262144UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DARRREDUCE_THRESHOLD
+#define BLAZE_SMP_DARRREDUCE_THRESHOLD 262144UL
+#endif
+//*************************************************************************************************
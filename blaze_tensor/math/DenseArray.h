@@ -118,18 +118,26 @@
 
 #include <blaze_tensor/math/Array.h>
 #include <blaze_tensor/math/dense/DenseArray.h>
+#include <blaze_tensor/math/dense/Einsum.h>
+#include <blaze_tensor/math/dense/Reshape.h>
 // #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
+#include <blaze_tensor/math/expressions/DArrDArrBroadcastExpr.h>
+#include <blaze_tensor/math/expressions/DArrArgReduceExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrEqualExpr.h>
+#include <blaze_tensor/math/expressions/DArrDArrInnerExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrMapExpr.h>
 // #include <blaze_tensor/math/expressions/DTensDTensMultExpr.h>
 // #include <blaze_tensor/math/expressions/DTensDTensSchurExpr.h>
 // #include <blaze_tensor/math/expressions/DTensDTensSubExpr.h>
 // #include <blaze_tensor/math/expressions/DTensEvalExpr.h>
 #include <blaze_tensor/math/expressions/DArrMapExpr.h>
+#include <blaze_tensor/math/expressions/DArrMomentsExpr.h>
 #include <blaze_tensor/math/expressions/DArrNormExpr.h>
 //#include <blaze_tensor/math/expressions/DArrReduceExpr.h>
 #include <blaze_tensor/math/expressions/DArrScalarDivExpr.h>
 #include <blaze_tensor/math/expressions/DArrScalarMultExpr.h>
+#include <blaze_tensor/math/expressions/DArrScanExpr.h>
+#include <blaze_tensor/math/expressions/DArrTransExpr.h>
 // #include <blaze_tensor/math/expressions/DTensSerialExpr.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/math/expressions/DQuatTransExpr.h>
@@ -123,18 +123,25 @@
 
 #include <blaze_tensor/math/Tensor.h>
 #include <blaze_tensor/math/dense/DenseTensor.h>
+#include <blaze_tensor/math/dense/Einsum.h>
+#include <blaze_tensor/math/dense/Reshape.h>
 #include <blaze_tensor/math/expressions/DMatExpandExpr.h>
 #include <blaze_tensor/math/expressions/DMatRavelExpr.h>
+#include <blaze_tensor/math/expressions/DTensArgReduceExpr.h>
 #include <blaze_tensor/math/expressions/DTensDMatSchurExpr.h>
+#include <blaze_tensor/math/expressions/DTensDMatTtmExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensEqualExpr.h>
+#include <blaze_tensor/math/expressions/DTensDTensInnerExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensSchurExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensSubExpr.h>
 #include <blaze_tensor/math/expressions/DTensDVecMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensMapExpr.h>
+#include <blaze_tensor/math/expressions/DTensMomentsExpr.h>
 #include <blaze_tensor/math/expressions/DTensRavelExpr.h>
 #include <blaze_tensor/math/expressions/DTensScalarDivExpr.h>
+#include <blaze_tensor/math/expressions/DTensScanExpr.h>
 #include <blaze_tensor/math/expressions/DTensScalarMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensSerialExpr.h>
 #include <blaze_tensor/math/expressions/DTensTransExpr.h>
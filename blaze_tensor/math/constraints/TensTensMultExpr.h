@@ -99,17 +99,20 @@ namespace blaze {
 // \ingroup math_constraints
 //
 // In case the given data types \a T1 and \a T2 do not form a valid tensor/tensor multiplication,
-// a compilation error is created.
+// a compilation error is created. A valid (batched) multiplication requires the number of columns
+// of \a T1 to match the number of rows of \a T2 and the number of pages of \a T2 to be either 1
+// or to match the number of pages of \a T1.
 */
 #define BLAZE_CONSTRAINT_MUST_FORM_VALID_TENSTENSMULTEXPR(T1,T2) \
    static_assert( ::blaze::IsTensor_v<T1> && \
                   ::blaze::IsTensor_v<T2> && \
-                  ( ( ::blaze::Size_v<T1,1UL> == -1L ) || \
+                  ( ( ::blaze::Size_v<T1,0UL> == -1L ) || \
                     ( ::blaze::Size_v<T2,0UL> == -1L ) || \
-                    ( ::blaze::Size_v<T1,1UL> == ::blaze::Size_v<T2,0UL> ) ) && \
+                    ( ::blaze::Size_v<T2,0UL> == 1L ) || \
+                    ( ::blaze::Size_v<T1,0UL> == ::blaze::Size_v<T2,0UL> ) ) && \
                   ( ( ::blaze::Size_v<T1,2UL> == -1L ) || \
-                    ( ::blaze::Size_v<T2,2UL> == -1L ) || \
-                    ( ::blaze::Size_v<T1,2UL> == ::blaze::Size_v<T2,2UL> ) ) \
+                    ( ::blaze::Size_v<T2,1UL> == -1L ) || \
+                    ( ::blaze::Size_v<T1,2UL> == ::blaze::Size_v<T2,1UL> ) ) \
                 , "Invalid tensor/tensor multiplication expression detected" )
 //*************************************************************************************************
 
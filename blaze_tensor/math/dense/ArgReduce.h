@@ -0,0 +1,327 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/ArgReduce.h
+//  \brief Header file for the index-returning reduction kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_ARGREDUCE_H_
+#define _BLAZE_TENSOR_MATH_DENSE_ARGREDUCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Candidate of an index-returning reduction (see argmin() and argmax()).
+// \ingroup math
+*/
+template< typename T >  // Type of the elements
+struct ArgCandidate
+{
+   T value{};        //!< The extremal element.
+   size_t index{};   //!< The index of the extremal element.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the element \a a takes precedence over the element \a b in an argmin().
+// \ingroup math
+*/
+template< typename T >  // Type of the elements
+inline bool argPrecedes( Min, const T& a, const T& b )
+{
+   return a < b;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the element \a a takes precedence over the element \a b in an argmax().
+// \ingroup math
+*/
+template< typename T >  // Type of the elements
+inline bool argPrecedes( Max, const T& a, const T& b )
+{
+   return a > b;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pairwise merge of two candidates of an index-returning reduction.
+// \ingroup math
+//
+// This functor selects the candidate with the smaller (\a OP is \a blaze::Min) or larger (\a OP
+// is \a blaze::Max) element. In case both elements are equal, the candidate with the smaller
+// index is selected, i.e. the result is the first occurrence of the extremum independent of the
+// order in which the partial results are merged (see smpReduce()).
+*/
+template< typename OP >  // Type of the reduction operation
+struct MergeArgCandidates
+{
+   template< typename T >  // Type of the elements
+   inline ArgCandidate<T>
+      operator()( const ArgCandidate<T>& a, const ArgCandidate<T>& b ) const
+   {
+      if( argPrecedes( OP(), b.value, a.value ) ||
+          ( !argPrecedes( OP(), a.value, b.value ) && b.index < a.index ) ) {
+         return b;
+      }
+      return a;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized argreduce kernels.
+// \ingroup math
+//
+// In case the dense operand \a TT is SIMD-enabled and the reduction operation \a OP can be
+// applied to SIMD vectors of its elements, the variable is set to \a true, otherwise it is
+// \a false.
+*/
+template< typename TT    // Type of the dense operand
+        , typename OP >  // Type of the reduction operation
+constexpr bool UseVectorizedArgReduceKernel_v =
+   ( useOptimizedKernels &&
+     TT::simdEnabled &&
+     OP::template simdEnabled< ElementType_t<TT>, ElementType_t<TT> >() );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARGREDUCE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of elements of a row processed in a single block by the argreduce kernels.
+// \ingroup math
+//
+// The extremum of a block is determined by a SIMD reduction. Only in case it improves on the
+// current candidate, the block (which is still in the L1 cache) is scanned for its position.
+*/
+constexpr size_t ARGREDUCE_BLOCK_SIZE = 1024UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the position of the extremum of a single row of elements.
+// \ingroup math
+//
+// \param n The number of elements of the row (at least 1).
+// \param get The access function for the element with the given index.
+// \param load The SIMD access function for the elements starting at the given index (unused).
+// \return The first extremal element of the row and its index.
+*/
+template< typename OP      // Type of the reduction operation
+        , typename T       // Type of the elements
+        , typename Get     // Type of the element access function
+        , typename Load >  // Type of the SIMD access function
+inline ArgCandidate<T> argreduceRow( size_t n, Get get, Load load, FalseType )
+{
+   UNUSED_PARAMETER( load );
+
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of elements detected" );
+
+   ArgCandidate<T> result{ get( 0UL ), 0UL };
+
+   for( size_t j=1UL; j<n; ++j ) {
+      const T x( get( j ) );
+      if( argPrecedes( OP(), x, result.value ) ) {
+         result.value = x;
+         result.index = j;
+      }
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the position of the extremum of a single row of elements.
+// \ingroup math
+//
+// \param n The number of elements of the row (at least 1).
+// \param get The access function for the element with the given index.
+// \param load The SIMD access function for the elements starting at the given index.
+// \return The first extremal element of the row and its index.
+//
+// The row is processed in blocks of ARGREDUCE_BLOCK_SIZE elements. The extremum of each block
+// is computed by means of SIMD operations. Only in case it takes precedence over the current
+// candidate, the block is scanned for the first position of the extremum. Since the block is
+// still cached at that point, every element is loaded from memory only once.
+*/
+template< typename OP      // Type of the reduction operation
+        , typename T       // Type of the elements
+        , typename Get     // Type of the element access function
+        , typename Load >  // Type of the SIMD access function
+inline ArgCandidate<T> argreduceRow( size_t n, Get get, Load load, TrueType )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of elements detected" );
+
+   ArgCandidate<T> result{ get( 0UL ), 0UL };
+
+   for( size_t jbegin=0UL; jbegin<n; jbegin+=ARGREDUCE_BLOCK_SIZE )
+   {
+      const size_t jend( min( jbegin+ARGREDUCE_BLOCK_SIZE, n ) );
+      const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) );
+
+      T value( get( jbegin ) );
+      size_t j( jbegin );
+
+      if( jpos > jbegin )
+      {
+         SIMDType xmm1( load( j ) );
+
+         for( j+=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+            xmm1 = OP()( xmm1, load( j ) );
+         }
+
+         value = reduce( xmm1, OP() );
+      }
+
+      for( ; j<jend; ++j ) {
+         const T x( get( j ) );
+         if( argPrecedes( OP(), x, value ) ) {
+            value = x;
+         }
+      }
+
+      if( argPrecedes( OP(), value, result.value ) )
+      {
+         for( j=jbegin; j<jend; ++j ) {
+            if( get( j ) == value ) {
+               result.value = value;
+               result.index = j;
+               break;
+            }
+         }
+      }
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Streaming update of a row of independent index-returning reductions.
+// \ingroup math
+//
+// \param best Pointer to the current extremal elements of the columns \f$[jbegin..jend)\f$.
+// \param index Pointer to the row of indices of the extremal elements.
+// \param l The index of the new row of elements along the reduced dimension.
+// \param jbegin The index of the first column to be updated.
+// \param jend The index behind the last column to be updated.
+// \param get The access function for the new element with the given column index.
+// \return void
+//
+// This kernel is used for the reduction along an outer dimension, where each column receives
+// one new element per call. The update is formulated without branches, such that the compiler
+// can translate it into vectorized compare and blend operations.
+*/
+template< typename OP     // Type of the reduction operation
+        , typename T      // Type of the elements
+        , typename Get >  // Type of the element access function
+inline void argreduceUpdate( T* best, size_t* index, size_t l,
+                             size_t jbegin, size_t jend, Get get )
+{
+   if( l == 0UL ) {
+      for( size_t j=jbegin; j<jend; ++j ) {
+         best[j-jbegin] = get( j );
+         index[j] = 0UL;
+      }
+      return;
+   }
+
+   for( size_t j=jbegin; j<jend; ++j ) {
+      const T x( get( j ) );
+      const bool precedes( argPrecedes( OP(), x, best[j-jbegin] ) );
+      best[j-jbegin] = precedes ? x : best[j-jbegin];
+      index[j]       = precedes ? l : index[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,496 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/ArrayBroadcast.h
+//  \brief Header file for the broadcast kernels of dense arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_ARRAYBROADCAST_H_
+#define _BLAZE_TENSOR_MATH_DENSE_ARRAYBROADCAST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasMember.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/smp/ArrayRowAssign.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/util/ArrayForEach.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ARRAY BROADCAST OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic wrapper for the plain assignment of a broadcast array element.
+// \ingroup dense_array
+//
+// The ArrayBroadcastCopy functor discards the current value of the target array and returns
+// the result of the broadcast operation. It is used to evaluate the plain assignment of a
+// broadcast expression via the array broadcast kernels.
+*/
+struct ArrayBroadcastCopy
+{
+   //**********************************************************************************************
+   /*!\brief Returns the given result of the broadcast operation.
+   //
+   // \param a The current value of the target array (ignored).
+   // \param b The result of the broadcast operation.
+   // \return The result of the broadcast operation.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE T2 operator()( const T1& a, const T2& b ) const
+   {
+      MAYBE_UNUSED( a );
+      return b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether SIMD is enabled for the specified data types \a T1 and \a T2.
+   //
+   // \return \a true in case SIMD is enabled for the data types \a T1 and \a T2, \a false if not.
+   */
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return true; }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the broadcast dimensions of two arrays.
+// \ingroup dense_array
+//
+// \param lhs The dimensions of the left-hand side array.
+// \param rhs The dimensions of the right-hand side array.
+// \return The dimensions of the broadcast result.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// This function computes the dimensions of the result of an element-wise operation on two
+// arrays according to the usual broadcasting rules: The dimensions are aligned at the innermost
+// dimension and missing outer dimensions are treated as dimensions of size 1. Two dimensions
+// are compatible if they are equal or if one of them is 1, in which case the according array
+// is broadcast along this dimension (i.e. it is accessed with a stride of 0). In case the
+// dimensions are incompatible, a \a std::invalid_argument exception is thrown.
+*/
+template< size_t N1    // Dimensionality of the left-hand side array
+        , size_t N2 >  // Dimensionality of the right-hand side array
+std::array< size_t, ( N1 < N2 ? N2 : N1 ) >
+   broadcastDimensions( const std::array<size_t,N1>& lhs, const std::array<size_t,N2>& rhs )
+{
+   constexpr size_t N( N1 < N2 ? N2 : N1 );
+
+   std::array<size_t,N> dims;
+
+   for( size_t d=0UL; d<N; ++d )
+   {
+      const size_t l( ( d < N1 )?( lhs[d] ):( 1UL ) );
+      const size_t r( ( d < N2 )?( rhs[d] ):( 1UL ) );
+
+      if( l != r && l != 1UL && r != 1UL ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Array sizes do not match" );
+      }
+
+      dims[d] = ( l == 1UL )?( r ):( l );
+   }
+
+   return dims;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maps the indices of an element of a broadcast result to the indices of an operand.
+// \ingroup dense_array
+//
+// \param indices The indices of the element of the broadcast result (innermost dimension first).
+// \param dims The dimensions of the operand (innermost dimension first).
+// \return The indices of the according element of the operand.
+//
+// Dimensions of size 1 are broadcast, i.e. the according index is multiplied by a stride of 0.
+// Outer dimensions of the result the operand doesn't have are dropped.
+*/
+template< size_t N    // Dimensionality of the broadcast result
+        , size_t M >  // Dimensionality of the operand
+BLAZE_ALWAYS_INLINE std::array<size_t,M>
+   broadcastIndices( const std::array<size_t,N>& indices, const std::array<size_t,M>& dims )
+      noexcept
+{
+   BLAZE_STATIC_ASSERT( M <= N );
+
+   std::array<size_t,M> result;
+   for( size_t d=0UL; d<M; ++d ) {
+      result[d] = indices[d] * size_t( dims[d] != 1UL );
+   }
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY BROADCAST KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized array broadcast kernel.
+// \ingroup dense_array
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT1   // Type of the left-hand side dense array operand
+        , typename MT2   // Type of the right-hand side dense array operand
+        , typename OP    // Type of the element-wise operation
+        , typename UP >  // Type of the (compound) assignment operation
+struct ArrayBroadcastHelper
+{
+   //**Type definitions****************************************************************************
+   using ET  = ElementType_t<TT>;   //!< Element type of the target dense array.
+   using ET1 = ElementType_t<MT1>;  //!< Element type of the left-hand side dense array operand.
+   using ET2 = ElementType_t<MT2>;  //!< Element type of the right-hand side dense array operand.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( useOptimizedKernels &&
+        TT::simdEnabled && MT1::simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v<ET,ET1,ET2> &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET1,ET2>, HasLoad<OP> >::value &&
+        If_t< HasSIMDEnabled_v<UP>, GetSIMDEnabled<UP,ET,ET>, HasLoad<UP> >::value );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the broadcast of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The target left-hand side dense array.
+// \param A The left-hand side dense array operand.
+// \param B The right-hand side dense array operand.
+// \param op The element-wise operation.
+// \param upd The (compound) assignment operation.
+// \param begin The index of the first row to be processed.
+// \param end The index one past the last row to be processed.
+// \return void
+//
+// This function implements the default array broadcast kernel, which evaluates
+// \f$ T = upd(T,op(A,B)) \f$ for the rows \f$[begin..end)\f$ of the target array, where the
+// rows are numbered consecutively in memory order across all outer dimensions. The indices
+// of the operands are computed once per row; broadcast dimensions are accessed with a stride
+// of 0.
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT1   // Type of the left-hand side dense array operand
+        , typename MT2   // Type of the right-hand side dense array operand
+        , typename OP    // Type of the element-wise operation
+        , typename UP >  // Type of the (compound) assignment operation
+inline auto arrayBroadcastRange( DenseArray<TT>& lhs, const DenseArray<MT1>& A
+                               , const DenseArray<MT2>& B, OP op, UP upd, size_t begin, size_t end )
+   -> EnableIf_t< !ArrayBroadcastHelper<TT,MT1,MT2,OP,UP>::value >
+{
+   constexpr size_t N ( TT::num_dimensions  );
+   constexpr size_t N1( MT1::num_dimensions );
+   constexpr size_t N2( MT2::num_dimensions );
+
+   const std::array<size_t,N >& dims ( (~lhs).dimensions() );
+   const std::array<size_t,N1>& ldims( (~A).dimensions() );
+   const std::array<size_t,N2>& rdims( (~B).dimensions() );
+
+   const size_t n( dims[0] );
+
+   if( n == 0UL )
+      return;
+
+   const size_t lstride( ldims[0] != 1UL );
+   const size_t rstride( rdims[0] != 1UL );
+
+   const auto target = [&lhs]( auto... indices ) -> decltype(auto) { return (~lhs)( indices... ); };
+   const auto left   = [&A]( auto... indices ) -> decltype(auto) { return (~A)( indices... ); };
+   const auto right  = [&B]( auto... indices ) -> decltype(auto) { return (~B)( indices... ); };
+
+   ArrayForEachRow( dims, 0UL, begin, end, [&]( size_t, std::array<size_t,N> const& indices )
+   {
+      const std::array<size_t,N1> li( broadcastIndices( indices, ldims ) );
+      const std::array<size_t,N2> ri( broadcastIndices( indices, rdims ) );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         auto& value( ArrayRowApply( target, indices, j ) );
+         value = upd( value, op( ArrayRowApply( left , li, j*lstride ),
+                                 ArrayRowApply( right, ri, j*rstride ) ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized backend of the broadcast of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The target left-hand side dense array.
+// \param A The left-hand side dense array operand.
+// \param B The right-hand side dense array operand.
+// \param op The element-wise operation.
+// \param upd The (compound) assignment operation.
+// \param begin The index of the first row to be processed.
+// \param end The index one past the last row to be processed.
+// \return void
+//
+// This function implements the vectorized array broadcast kernel, which evaluates
+// \f$ T = upd(T,op(A,B)) \f$ for the rows \f$[begin..end)\f$ of the target array. The indices
+// of the operands are computed once per row. An operand that is broadcast along the innermost
+// dimension is read once per row and splatted into a SIMD vector outside of the row loop, such
+// that the row loop itself remains vectorized for all combinations of broadcast operands.
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT1   // Type of the left-hand side dense array operand
+        , typename MT2   // Type of the right-hand side dense array operand
+        , typename OP    // Type of the element-wise operation
+        , typename UP >  // Type of the (compound) assignment operation
+inline auto arrayBroadcastRange( DenseArray<TT>& lhs, const DenseArray<MT1>& A
+                               , const DenseArray<MT2>& B, OP op, UP upd, size_t begin, size_t end )
+   -> EnableIf_t< ArrayBroadcastHelper<TT,MT1,MT2,OP,UP>::value >
+{
+   constexpr size_t N ( TT::num_dimensions  );
+   constexpr size_t N1( MT1::num_dimensions );
+   constexpr size_t N2( MT2::num_dimensions );
+
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT> >::size );
+   constexpr bool remainder( !IsPadded_v<TT> || !IsPadded_v<MT1> || !IsPadded_v<MT2> );
+
+   const std::array<size_t,N >& dims ( (~lhs).dimensions() );
+   const std::array<size_t,N1>& ldims( (~A).dimensions() );
+   const std::array<size_t,N2>& rdims( (~B).dimensions() );
+
+   const size_t n( dims[0] );
+
+   if( n == 0UL )
+      return;
+
+   const size_t jpos( ( remainder )?( n & size_t(-SIMDSIZE) ):( n ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( n - ( n % SIMDSIZE ) ) == jpos,
+                          "Invalid end calculation" );
+
+   const size_t lstride( ldims[0] != 1UL );
+   const size_t rstride( rdims[0] != 1UL );
+
+   const auto target = [&lhs]( auto... indices ) -> decltype(auto) { return (~lhs)( indices... ); };
+   const auto left   = [&A]( auto... indices ) -> decltype(auto) { return (~A)( indices... ); };
+   const auto right  = [&B]( auto... indices ) -> decltype(auto) { return (~B)( indices... ); };
+   const auto lload  = [&A]( auto... indices ) { return (~A).load( indices... ); };
+   const auto rload  = [&B]( auto... indices ) { return (~B).load( indices... ); };
+
+   ArrayForEachRow( dims, 0UL, begin, end, [&]( size_t, std::array<size_t,N> const& indices )
+   {
+      const std::array<size_t,N1> li( broadcastIndices( indices, ldims ) );
+      const std::array<size_t,N2> ri( broadcastIndices( indices, rdims ) );
+
+      const auto kernel = [&]( const auto& xl, const auto& xr )
+      {
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            const auto x( op.load( xl( j ), xr( j ) ) );
+            ArrayRowApply( [&]( auto... is ) {
+               (~lhs).store( upd( (~lhs).load( is... ), x ), is... );
+            }, indices, j );
+         }
+         for( ; remainder && j<n; ++j ) {
+            auto& value( ArrayRowApply( target, indices, j ) );
+            value = upd( value, op( ArrayRowApply( left , li, j*lstride ),
+                                    ArrayRowApply( right, ri, j*rstride ) ) );
+         }
+      };
+
+      const auto lrow = [&]( size_t j ) { return ArrayRowApply( lload, li, j ); };
+      const auto rrow = [&]( size_t j ) { return ArrayRowApply( rload, ri, j ); };
+
+      if( lstride && rstride ) {
+         kernel( lrow, rrow );
+      }
+      else if( lstride ) {
+         const auto xr( set( ArrayRowApply( right, ri, 0UL ) ) );
+         kernel( lrow, [&xr]( size_t ) { return xr; } );
+      }
+      else if( rstride ) {
+         const auto xl( set( ArrayRowApply( left, li, 0UL ) ) );
+         kernel( [&xl]( size_t ) { return xl; }, rrow );
+      }
+      else {
+         const auto xl( set( ArrayRowApply( left , li, 0UL ) ) );
+         const auto xr( set( ArrayRowApply( right, ri, 0UL ) ) );
+         kernel( [&xl]( size_t ) { return xl; }, [&xr]( size_t ) { return xr; } );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial broadcast of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The target left-hand side dense array.
+// \param A The left-hand side dense array operand.
+// \param B The right-hand side dense array operand.
+// \param op The element-wise operation.
+// \param upd The (compound) assignment operation.
+// \return void
+//
+// This function evaluates \f$ T = upd(T,op(A,B)) \f$ for all elements of the target array,
+// broadcasting the operands \a A and \a B to the dimensions of the target array.
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT1   // Type of the left-hand side dense array operand
+        , typename MT2   // Type of the right-hand side dense array operand
+        , typename OP    // Type of the element-wise operation
+        , typename UP >  // Type of the (compound) assignment operation
+inline void arrayBroadcast( DenseArray<TT>& lhs, const DenseArray<MT1>& A
+                          , const DenseArray<MT2>& B, OP op, UP upd )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( broadcastDimensions( (~A).dimensions(), (~B).dimensions() ) ==
+                          (~lhs).dimensions(), "Invalid array sizes" );
+
+   arrayBroadcastRange( ~lhs, ~A, ~B, op, upd, 0UL, arrayRows( ~lhs ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP broadcast of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The target left-hand side dense array.
+// \param A The left-hand side dense array operand.
+// \param B The right-hand side dense array operand.
+// \param op The element-wise operation.
+// \param upd The (compound) assignment operation.
+// \return void
+//
+// This function evaluates \f$ T = upd(T,op(A,B)) \f$ for all elements of the target array in
+// parallel. The rows of the target array are split into contiguous ranges, one per task. In
+// case any of the arrays is not SMP-assignable, the broadcast is performed serially.
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT1   // Type of the left-hand side dense array operand
+        , typename MT2   // Type of the right-hand side dense array operand
+        , typename OP    // Type of the element-wise operation
+        , typename UP >  // Type of the (compound) assignment operation
+inline void smpArrayBroadcast( DenseArray<TT>& lhs, const DenseArray<MT1>& A
+                             , const DenseArray<MT2>& B, OP op, UP upd )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( broadcastDimensions( (~A).dimensions(), (~B).dimensions() ) ==
+                          (~lhs).dimensions(), "Invalid array sizes" );
+
+   constexpr bool parallel( IsSMPAssignable_v<TT> && IsSMPAssignable_v<MT1> &&
+                            IsSMPAssignable_v<MT2> );
+
+   const size_t rows ( arrayRows( ~lhs ) );
+   const size_t tasks( ( parallel )?( min( smpTasks(), rows ) ):( 1UL ) );
+
+   if( tasks < 2UL ) {
+      arrayBroadcastRange( ~lhs, ~A, ~B, op, upd, 0UL, rows );
+      return;
+   }
+
+   const size_t rowsPerTask( ( rows + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( t*rowsPerTask );
+      const size_t end  ( min( begin+rowsPerTask, rows ) );
+
+      if( begin < end ) {
+         arrayBroadcastRange( ~lhs, ~A, ~B, op, upd, begin, end );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
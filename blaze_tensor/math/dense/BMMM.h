@@ -0,0 +1,557 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/BMMM.h
+//  \brief Header file for the batched dense matrix/dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_BMMM_H_
+#define _BLAZE_TENSOR_MATH_DENSE_BMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/views/PageSlice.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLOCKING PARAMETERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of rows of the right-hand side operand packed into a single panel.
+// \ingroup dense_tensor
+*/
+constexpr size_t BMMM_KBLOCK = 256UL;
+
+/*!\brief Number of SIMD vectors per row of a packed panel of the right-hand side operand.
+// \ingroup dense_tensor
+*/
+constexpr size_t BMMM_JVECTORS = 8UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized bmmm() kernel.
+// \ingroup dense_tensor
+//
+// In case the target tensor \a TT1 and the element types of all three tensors are suited for
+// the packed SIMD kernel, the variable is set to \a true, otherwise it is \a false.
+*/
+template< typename TT1, typename TT2, typename TT3 >
+constexpr bool UseVectorizedBmmmKernel_v =
+   ( useOptimizedKernels &&
+     TT1::simdEnabled &&
+     IsSame_v< ElementType_t<TT1>, ElementType_t<TT2> > &&
+     IsSame_v< ElementType_t<TT1>, ElementType_t<TT3> > &&
+     HasSIMDAdd_v< ElementType_t<TT1>, ElementType_t<TT1> > &&
+     HasSIMDMult_v< ElementType_t<TT1>, ElementType_t<TT1> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED PANEL KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of the target of a batched multiplication (\f$ C=\beta C \f$).
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param beta The scaling factor for the target tensor.
+// \return void
+//
+// This function applies the scaling factor \a beta to all elements of the target tensor. In
+// case \a beta is zero, all elements are reset. It is used in case the inner dimension of the
+// multiplication is zero, in which case no panel is processed.
+*/
+template< typename TT    // Type of the target dense tensor
+        , typename ST >  // Type of the scaling factor
+void bmmmScale( TT& C, ST beta )
+{
+   const bool overwrite( isDefault( beta ) );
+
+   for( size_t k=0UL; k<C.pages(); ++k ) {
+      for( size_t i=0UL; i<C.rows(); ++i ) {
+         for( size_t j=0UL; j<C.columns(); ++j ) {
+            if( overwrite )
+               reset( C(k,i,j) );
+            else
+               C(k,i,j) *= beta;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a panel of the right-hand side operand of a batched multiplication.
+// \ingroup dense_tensor
+//
+// \param B The right-hand side dense matrix (a single page of the right-hand side tensor).
+// \param panel Pointer to the first element of the aligned panel buffer.
+// \param ld The (padded) number of elements per row of the panel.
+// \param ll The index of the first row of \a B to be packed.
+// \param lend The index one past the last row of \a B to be packed.
+// \param jj The index of the first column of \a B to be packed.
+// \param jend The index one past the last column of \a B to be packed.
+// \return void
+//
+// This function copies the block \f$ B[ll..lend)[jj..jend) \f$ into the contiguous, aligned
+// panel buffer. The padding elements of each row of the panel are set to zero.
+*/
+template< typename MT    // Type of the right-hand side dense matrix
+        , typename ET >  // Element type of the panel
+void bmmmPack( const MT& B, ET* panel, size_t ld,
+               size_t ll, size_t lend, size_t jj, size_t jend )
+{
+   for( size_t l=ll; l<lend; ++l, panel+=ld )
+   {
+      size_t j( jj );
+
+      for( ; j<jend; ++j ) {
+         panel[j-jj] = B(l,j);
+      }
+      for( ; j<jj+ld; ++j ) {
+         reset( panel[j-jj] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a block of the left-hand side operand with a packed panel.
+// \ingroup dense_tensor
+//
+// \param C The target dense matrix (a single page of the target tensor).
+// \param A The left-hand side dense matrix (a single page of the left-hand side tensor).
+// \param panel Pointer to the first element of the packed panel.
+// \param ld The (padded) number of elements per row of the panel.
+// \param ll The index of the first row of the panel within the right-hand side operand.
+// \param lend The index one past the last row of the panel.
+// \param jj The index of the first column of the panel.
+// \param jend The index one past the last column of the panel.
+// \param alpha The scaling factor for the product.
+// \param beta The scaling factor for the target values.
+// \return void
+//
+// This function computes \f$ C[:][jj..jend) = \alpha A[:][ll..lend) P + \beta C[:][jj..jend) \f$,
+// where \a P is the packed panel. The computation is performed by means of a register blocked
+// SIMD micro kernel that updates 4 rows and two SIMD vectors of columns at a time.
+*/
+template< typename MT1   // Type of the target dense matrix
+        , typename MT2   // Type of the left-hand side dense matrix
+        , typename ET    // Element type of the panel
+        , typename ST >  // Type of the scaling factors
+void bmmmPanel( MT1& C, const MT2& A, const ET* panel, size_t ld,
+                size_t ll, size_t lend, size_t jj, size_t jend, ST alpha, ST beta )
+{
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t M( C.rows() );
+
+   const bool overwrite( isDefault( beta ) );
+
+   const SIMDType factor( set( ET( alpha ) ) );
+   const SIMDType scale ( set( ET( beta  ) ) );
+
+   auto update = [&]( size_t i, size_t j, const SIMDType& xmm )
+   {
+      if( overwrite )
+         C.storeu( i, j, xmm * factor );
+      else
+         C.storeu( i, j, C.loadu(i,j) * scale + xmm * factor );
+   };
+
+   auto updateScalar = [&]( size_t i, size_t j, const ET& value )
+   {
+      if( overwrite )
+         C(i,j) = alpha * value;
+      else
+         C(i,j) = beta * C(i,j) + alpha * value;
+   };
+
+   const size_t jvec( jj + ( ( jend - jj ) & size_t(-SIMDSIZE) ) );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= M; i+=4UL )
+   {
+      size_t j( jj );
+
+      for( ; (j+SIMDSIZE*2UL) <= jvec; j+=SIMDSIZE*2UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+         const ET* p( panel + ( j - jj ) );
+
+         for( size_t l=ll; l<lend; ++l, p+=ld ) {
+            const SIMDType b1( loada( p ) );
+            const SIMDType b2( loada( p + SIMDSIZE ) );
+            const SIMDType a1( set( A(i    ,l) ) );
+            const SIMDType a2( set( A(i+1UL,l) ) );
+            const SIMDType a3( set( A(i+2UL,l) ) );
+            const SIMDType a4( set( A(i+3UL,l) ) );
+            xmm1 += a1 * b1;
+            xmm2 += a1 * b2;
+            xmm3 += a2 * b1;
+            xmm4 += a2 * b2;
+            xmm5 += a3 * b1;
+            xmm6 += a3 * b2;
+            xmm7 += a4 * b1;
+            xmm8 += a4 * b2;
+         }
+
+         update( i    , j         , xmm1 );
+         update( i    , j+SIMDSIZE, xmm2 );
+         update( i+1UL, j         , xmm3 );
+         update( i+1UL, j+SIMDSIZE, xmm4 );
+         update( i+2UL, j         , xmm5 );
+         update( i+2UL, j+SIMDSIZE, xmm6 );
+         update( i+3UL, j         , xmm7 );
+         update( i+3UL, j+SIMDSIZE, xmm8 );
+      }
+
+      for( ; j<jvec; j+=SIMDSIZE )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+
+         const ET* p( panel + ( j - jj ) );
+
+         for( size_t l=ll; l<lend; ++l, p+=ld ) {
+            const SIMDType b1( loada( p ) );
+            xmm1 += set( A(i    ,l) ) * b1;
+            xmm2 += set( A(i+1UL,l) ) * b1;
+            xmm3 += set( A(i+2UL,l) ) * b1;
+            xmm4 += set( A(i+3UL,l) ) * b1;
+         }
+
+         update( i    , j, xmm1 );
+         update( i+1UL, j, xmm2 );
+         update( i+2UL, j, xmm3 );
+         update( i+3UL, j, xmm4 );
+      }
+
+      for( ; j<jend; ++j )
+      {
+         ET value1{}, value2{}, value3{}, value4{};
+
+         const ET* p( panel + ( j - jj ) );
+
+         for( size_t l=ll; l<lend; ++l, p+=ld ) {
+            value1 += A(i    ,l) * (*p);
+            value2 += A(i+1UL,l) * (*p);
+            value3 += A(i+2UL,l) * (*p);
+            value4 += A(i+3UL,l) * (*p);
+         }
+
+         updateScalar( i    , j, value1 );
+         updateScalar( i+1UL, j, value2 );
+         updateScalar( i+2UL, j, value3 );
+         updateScalar( i+3UL, j, value4 );
+      }
+   }
+
+   for( ; i<M; ++i )
+   {
+      size_t j( jj );
+
+      for( ; j<jvec; j+=SIMDSIZE )
+      {
+         SIMDType xmm1;
+
+         const ET* p( panel + ( j - jj ) );
+
+         for( size_t l=ll; l<lend; ++l, p+=ld ) {
+            xmm1 += set( A(i,l) ) * loada( p );
+         }
+
+         update( i, j, xmm1 );
+      }
+
+      for( ; j<jend; ++j )
+      {
+         ET value{};
+
+         const ET* p( panel + ( j - jj ) );
+
+         for( size_t l=ll; l<lend; ++l, p+=ld ) {
+            value += A(i,l) * (*p);
+         }
+
+         updateScalar( i, j, value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHED MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized batched dense matrix/dense matrix multiplication
+//        (\f$ C_k=\alpha A_k B_k+\beta C_k \f$).
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The left-hand side dense tensor operand.
+// \param B The right-hand side dense tensor operand.
+// \param alpha The scaling factor for the product.
+// \param beta The scaling factor for the target tensor.
+// \return void
+//
+// This function performs the page-wise multiplication of the two dense tensors \a A and \a B
+// and stores the scaled result in \a C. The right-hand side operand is processed in panels of
+// at most \a BMMM_KBLOCK rows and \a BMMM_JVECTORS SIMD vectors, which are packed into an
+// aligned, contiguous buffer before they are multiplied by means of a register blocked SIMD
+// micro kernel. In case \a B consists of a single page, this page is used for all pages of
+// \a A. In this case each panel is packed only once and reused for all pages.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the left-hand side dense tensor
+        , typename TT3   // Type of the right-hand side dense tensor
+        , typename ST >  // Type of the scaling factors
+inline EnableIf_t< UseVectorizedBmmmKernel_v<TT1,TT2,TT3> >
+   bmmm( DenseTensor<TT1>& C, const DenseTensor<TT2>& A, const DenseTensor<TT3>& B,
+         ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<TT1>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+   constexpr size_t JBLOCK( SIMDSIZE * BMMM_JVECTORS );
+
+   BLAZE_INTERNAL_ASSERT( (~C).pages()   == (~A).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).pages() == (~A).pages() || (~B).pages() == 1UL, "Invalid number of pages" );
+
+   const size_t O( (~C).pages()   );
+   const size_t N( (~C).columns() );
+   const size_t K( (~A).columns() );
+
+   if( O == 0UL || N == 0UL || (~C).rows() == 0UL ) {
+      return;
+   }
+
+   if( K == 0UL ) {
+      bmmmScale( ~C, beta );
+      return;
+   }
+
+   std::unique_ptr<ET[],Deallocate> panel( allocate<ET>( BMMM_KBLOCK * JBLOCK ) );
+
+   if( (~B).pages() == 1UL && O > 1UL )
+   {
+      const auto Bk( pageslice( ~B, 0UL, unchecked ) );
+
+      for( size_t jj=0UL; jj<N; jj+=JBLOCK )
+      {
+         const size_t jend( min( jj+JBLOCK, N ) );
+         const size_t ld( nextMultiple( jend-jj, SIMDSIZE ) );
+
+         for( size_t ll=0UL; ll<K; ll+=BMMM_KBLOCK )
+         {
+            const size_t lend( min( ll+BMMM_KBLOCK, K ) );
+
+            bmmmPack( Bk, panel.get(), ld, ll, lend, jj, jend );
+
+            for( size_t k=0UL; k<O; ++k ) {
+               auto       Ck( pageslice( ~C, k, unchecked ) );
+               const auto Ak( pageslice( ~A, k, unchecked ) );
+               bmmmPanel( Ck, Ak, panel.get(), ld, ll, lend, jj, jend,
+                          alpha, ( ll == 0UL )?( beta ):( ST(1) ) );
+            }
+         }
+      }
+   }
+   else
+   {
+      for( size_t k=0UL; k<O; ++k )
+      {
+         auto       Ck( pageslice( ~C, k, unchecked ) );
+         const auto Ak( pageslice( ~A, k, unchecked ) );
+         const auto Bk( pageslice( ~B, ( (~B).pages() == 1UL )?( 0UL ):( k ), unchecked ) );
+
+         for( size_t jj=0UL; jj<N; jj+=JBLOCK )
+         {
+            const size_t jend( min( jj+JBLOCK, N ) );
+            const size_t ld( nextMultiple( jend-jj, SIMDSIZE ) );
+
+            for( size_t ll=0UL; ll<K; ll+=BMMM_KBLOCK )
+            {
+               const size_t lend( min( ll+BMMM_KBLOCK, K ) );
+
+               bmmmPack( Bk, panel.get(), ld, ll, lend, jj, jend );
+               bmmmPanel( Ck, Ak, panel.get(), ld, ll, lend, jj, jend,
+                          alpha, ( ll == 0UL )?( beta ):( ST(1) ) );
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default batched dense matrix/dense matrix multiplication
+//        (\f$ C_k=\alpha A_k B_k+\beta C_k \f$).
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The left-hand side dense tensor operand.
+// \param B The right-hand side dense tensor operand.
+// \param alpha The scaling factor for the product.
+// \param beta The scaling factor for the target tensor.
+// \return void
+//
+// This function performs the page-wise multiplication of the two dense tensors \a A and \a B
+// for element types that are not suited for the vectorized kernel. In case \a B consists of a
+// single page, this page is used for all pages of \a A.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the left-hand side dense tensor
+        , typename TT3   // Type of the right-hand side dense tensor
+        , typename ST >  // Type of the scaling factors
+inline DisableIf_t< UseVectorizedBmmmKernel_v<TT1,TT2,TT3> >
+   bmmm( DenseTensor<TT1>& C, const DenseTensor<TT2>& A, const DenseTensor<TT3>& B,
+         ST alpha, ST beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~C).pages()   == (~A).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~B).pages() == (~A).pages() || (~B).pages() == 1UL, "Invalid number of pages" );
+
+   const size_t O( (~C).pages()   );
+   const size_t M( (~C).rows()    );
+   const size_t N( (~C).columns() );
+   const size_t K( (~A).columns() );
+
+   const bool overwrite( isDefault( beta ) );
+
+   for( size_t k=0UL; k<O; ++k )
+   {
+      const size_t kb( ( (~B).pages() == 1UL )?( 0UL ):( k ) );
+
+      for( size_t i=0UL; i<M; ++i )
+      {
+         for( size_t j=0UL; j<N; ++j ) {
+            if( overwrite )
+               reset( (~C)(k,i,j) );
+            else
+               (~C)(k,i,j) *= beta;
+         }
+
+         for( size_t l=0UL; l<K; ++l ) {
+            const auto a( alpha * (~A)(k,i,l) );
+            for( size_t j=0UL; j<N; ++j ) {
+               (~C)(k,i,j) += a * (~B)(kb,l,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,116 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/ContiguousNorm.h
+//  \brief Header file for the norm kernel for contiguously stored elements
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_CONTIGUOUSNORM_H_
+#define _BLAZE_TENSOR_MATH_DENSE_CONTIGUOUSNORM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/SIMD.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONTIGUOUS NORM KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD kernel for the accumulation of a norm over contiguously stored elements.
+// \ingroup dense_tensor
+//
+// \param ptr Pointer to the first element.
+// \param n The total number of elements.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \return The sum of \a power( \a abs( x ) ) over all given elements (without the root).
+//
+// This kernel is shared by the dense tensor and dense array norms. In contrast to a row-wise
+// traversal, a single range of \a n elements is processed with four independent accumulators,
+// which keeps the SIMD units busy even in case the rows of the operand are short. The kernel
+// may only be used in case \a abs and \a power can be applied to SIMD elements of type
+// \a Type.
+*/
+template< typename Type     // Type of the elements
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline Type contiguousNorm( const Type* ptr, size_t n, Abs abs, Power power )
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t ipos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   SIMDType xmm1, xmm2, xmm3, xmm4;
+   size_t i( 0UL );
+
+   for( ; ( i + SIMDSIZE * 3UL ) < ipos; i += SIMDSIZE * 4UL ) {
+      xmm1 += power( abs( loadu( ptr + i ) ) );
+      xmm2 += power( abs( loadu( ptr + i + SIMDSIZE ) ) );
+      xmm3 += power( abs( loadu( ptr + i + SIMDSIZE * 2UL ) ) );
+      xmm4 += power( abs( loadu( ptr + i + SIMDSIZE * 3UL ) ) );
+   }
+   for( ; ( i + SIMDSIZE ) < ipos; i += SIMDSIZE * 2UL ) {
+      xmm1 += power( abs( loadu( ptr + i ) ) );
+      xmm2 += power( abs( loadu( ptr + i + SIMDSIZE ) ) );
+   }
+   for( ; i < ipos; i += SIMDSIZE ) {
+      xmm1 += power( abs( loadu( ptr + i ) ) );
+   }
+
+   Type norm( sum( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+   for( ; i < n; ++i ) {
+      norm += power( abs( ptr[i] ) );
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
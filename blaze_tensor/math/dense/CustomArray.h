@@ -44,6 +44,9 @@
 #include <algorithm>
 #include <utility>
 #include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 
 #include <blaze_tensor/math/Array.h>
@@ -54,6 +57,7 @@
 #include <blaze_tensor/math/traits/QuatSliceTrait.h>
 #include <blaze_tensor/math/typetraits/IsDenseArray.h>
 #include <blaze_tensor/math/typetraits/IsNdArray.h>
+#include <blaze_tensor/util/ArrayForEach.h>
 
 namespace blaze {
 
@@ -659,28 +663,28 @@ class CustomArray
    BLAZE_ALWAYS_INLINE void stream( const SIMDType& value, Dims... dims ) noexcept;
 
    template< typename MT >
-   inline auto assign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedAssign_v<MT> >*/;
+   inline auto assign( const DenseArray<MT>& rhs ) -> DisableIf_t< VectorizedAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto assign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
+   template< typename MT >
+   inline auto assign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
    template< typename MT >
-   inline auto addAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedAddAssign_v<MT> >*/;
+   inline auto addAssign( const DenseArray<MT>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto addAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT> >;
+   template< typename MT >
+   inline auto addAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT> >;
 
    template< typename MT >
-   inline auto subAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedSubAssign_v<MT> >*/;
+   inline auto subAssign( const DenseArray<MT>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto subAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT> >;
+   template< typename MT >
+   inline auto subAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT> >;
 
    template< typename MT >
-   inline auto schurAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedSchurAssign_v<MT> >*/;
+   inline auto schurAssign( const DenseArray<MT>& rhs ) -> DisableIf_t< VectorizedSchurAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto schurAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT> >;
+   template< typename MT >
+   inline auto schurAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT> >;
    //@}
    //**********************************************************************************************
 
@@ -3100,7 +3104,7 @@ template< size_t N       // Dimensionality of the array
         , typename RT >  // Result type
 template< typename MT >  // Type of the right-hand side dense array
 inline auto CustomArray<N,Type,AF,PF,RT>::assign( const DenseArray<MT>& rhs )
-   /*-> EnableIf_t< !VectorizedAssign_v<MT> >*/
+   -> DisableIf_t< VectorizedAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3126,67 +3130,63 @@ inline auto CustomArray<N,Type,AF,PF,RT>::assign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N       // Dimensionality of the array
-//        , typename Type  // Data type of the array
-//        , AlignmentFlag AF        // Alignment flag
-//        , PaddingFlag PF    // Padding flag
-//        , typename RT >  // Result type
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto CustomArray<N,Type,AF,PF,RT>::assign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//    constexpr bool remainder( !PF || !IsPadded_v<MT> );
-//
-//    const size_t jpos( ( remainder )?( n_ & size_t(-SIMDSIZE) ):( n_ ) );
-//    BLAZE_INTERNAL_ASSERT( !remainder || ( n_ - ( n_ % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-//
-//    if( AF && PF && useStreaming &&
-//        ( m_*n_*o_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
-//    {
-//       for (size_t k=0UL; k<o_; ++k) {
-//          for (size_t i=0UL; i<m_; ++i) {
-//             size_t j(0UL);
-//             Iterator left(begin(i, k));
-//             ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//             for (; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE, right+=SIMDSIZE) {
-//                left.stream(right.load());
-//             }
-//             for (; remainder && j<n_; ++j, ++left, ++right) {
-//                *left = *right;
-//             }
-//          }
-//       }
-//    }
-//    else
-//    {
-//       for (size_t k=0UL; k<o_; ++k) {
-//          for (size_t i=0UL; i<m_; ++i)
-//          {
-//             size_t j(0UL);
-//             Iterator left(begin(i, k));
-//             ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//             for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             }
-//             for (; j<jpos; j+=SIMDSIZE) {
-//                left.store(right.load()); left+=SIMDSIZE, right+=SIMDSIZE;
-//             }
-//             for (; remainder && j<n_; ++j) {
-//                *left = *right; ++left; ++right;
-//             }
-//          }
-//       }
-//    }
-//}
+template< size_t N       // Dimensionality of the array
+        , typename Type  // Data type of the array
+        , AlignmentFlag AF        // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , typename RT >  // Result type
+template< typename MT >  // Type of the right-hand side dense array
+inline auto CustomArray<N,Type,AF,PF,RT>::assign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !PF || !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   const auto load = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto elem = [&rhs]( auto... indices ) { return (~rhs)( indices... ); };
+
+   if( AF && PF && useStreaming &&
+       ( capacity() > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
+   {
+      ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+         size_t j( 0UL );
+         Iterator left( v_ + i );
+
+         for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+            left.stream( ArrayRowApply( load, dims, j ) );
+         }
+         for( ; remainder && j<dims_[0]; ++j, ++left ) {
+            *left = ArrayRowApply( elem, dims, j );
+         }
+      } );
+   }
+   else
+   {
+      ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+         size_t j( 0UL );
+         Iterator left( v_ + i );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            left.store( ArrayRowApply( load, dims, j              ) ); left += SIMDSIZE;
+            left.store( ArrayRowApply( load, dims, j+SIMDSIZE     ) ); left += SIMDSIZE;
+            left.store( ArrayRowApply( load, dims, j+SIMDSIZE*2UL ) ); left += SIMDSIZE;
+            left.store( ArrayRowApply( load, dims, j+SIMDSIZE*3UL ) ); left += SIMDSIZE;
+         }
+         for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+            left.store( ArrayRowApply( load, dims, j ) );
+         }
+         for( ; remainder && j<dims_[0]; ++j, ++left ) {
+            *left = ArrayRowApply( elem, dims, j );
+         }
+      } );
+   }
+}
 //*************************************************************************************************
 
 
@@ -3208,7 +3208,7 @@ template< size_t N       // Dimensionality of the array
         , typename RT >  // Result type
 template< typename MT >  // Type of the right-hand side dense array
 inline auto CustomArray<N,Type,AF,PF,RT>::addAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedAddAssign_v<MT> >
+   -> DisableIf_t< VectorizedAddAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3234,50 +3234,45 @@ inline auto CustomArray<N,Type,AF,PF,RT>::addAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N       // Dimensionality of the array
-//        , typename Type  // Data type of the array
-//        , AlignmentFlag AF        // Alignment flag
-//        , PaddingFlag PF    // Padding flag
-//        , typename RT >  // Result type
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto CustomArray<N,Type,AF,PF,RT>::addAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedAddAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//    constexpr bool remainder( !PF || !IsPadded_v<MT> );
-//
-//    for (size_t k=0UL; k<o_; ++k) {
-//       for (size_t i=0UL; i<m_; ++i)
-//       {
-//          const size_t jbegin(0UL);
-//          const size_t jend  (n_);
-//          BLAZE_INTERNAL_ASSERT(jbegin <= jend, "Invalid loop indices detected");
-//
-//          const size_t jpos((remainder)?(jend & size_t(-SIMDSIZE)):(jend));
-//          BLAZE_INTERNAL_ASSERT(!remainder || (jend - (jend % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//          size_t j(jbegin);
-//          Iterator left(begin(i, k) + jbegin);
-//          ConstIterator_t<MT> right((~rhs).begin(i, k) + jbegin);
-//
-//          for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//             left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//          }
-//          for (; j<jpos; j+=SIMDSIZE) {
-//             left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//          }
-//          for (; remainder && j<jend; ++j) {
-//             *left += *right; ++left; ++right;
-//          }
-//       }
-//    }
-//}
+template< size_t N       // Dimensionality of the array
+        , typename Type  // Data type of the array
+        , AlignmentFlag AF        // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , typename RT >  // Result type
+template< typename MT >  // Type of the right-hand side dense array
+inline auto CustomArray<N,Type,AF,PF,RT>::addAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !PF || !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   const auto load = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto elem = [&rhs]( auto... indices ) { return (~rhs)( indices... ); };
+
+   ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+      size_t j( 0UL );
+      Iterator left( v_ + i );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() + ArrayRowApply( load, dims, j              ) ); left += SIMDSIZE;
+         left.store( left.load() + ArrayRowApply( load, dims, j+SIMDSIZE     ) ); left += SIMDSIZE;
+         left.store( left.load() + ArrayRowApply( load, dims, j+SIMDSIZE*2UL ) ); left += SIMDSIZE;
+         left.store( left.load() + ArrayRowApply( load, dims, j+SIMDSIZE*3UL ) ); left += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+         left.store( left.load() + ArrayRowApply( load, dims, j ) );
+      }
+      for( ; remainder && j<dims_[0]; ++j, ++left ) {
+         *left += ArrayRowApply( elem, dims, j );
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -3299,7 +3294,7 @@ template< size_t N       // Dimensionality of the array
         , typename RT >  // Result type
 template< typename MT >  // Type of the right-hand side dense array
 inline auto CustomArray<N,Type,AF,PF,RT>::subAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedSubAssign_v<MT> >
+   -> DisableIf_t< VectorizedSubAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3325,50 +3320,45 @@ inline auto CustomArray<N,Type,AF,PF,RT>::subAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N       // Dimensionality of the array
-//        , typename Type  // Data type of the array
-//        , AlignmentFlag AF        // Alignment flag
-//        , PaddingFlag PF    // Padding flag
-//        , typename RT >  // Result type
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto CustomArray<N,Type,AF,PF,RT>::subAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedSubAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-
-//    constexpr bool remainder( !PF || !IsPadded_v<MT> );
-//
-//    for (size_t k=0UL; k<o_; ++k) {
-//       for (size_t i=0UL; i<m_; ++i)
-//       {
-//          const size_t jbegin(0UL);
-//          const size_t jend  (n_);
-//          BLAZE_INTERNAL_ASSERT(jbegin <= jend, "Invalid loop indices detected");
-//
-//          const size_t jpos((remainder)?(jend & size_t(-SIMDSIZE)):(jend));
-//          BLAZE_INTERNAL_ASSERT(!remainder || (jend - (jend % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//          size_t j(jbegin);
-//          Iterator left(begin(i, k) + jbegin);
-//          ConstIterator_t<MT> right((~rhs).begin(i, k) + jbegin);
-//
-//          for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//             left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//          }
-//          for (; j<jpos; j+=SIMDSIZE) {
-//             left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//          }
-//          for (; remainder && j<jend; ++j) {
-//             *left -= *right; ++left; ++right;
-//          }
-//       }
-//    }
-//}
+template< size_t N       // Dimensionality of the array
+        , typename Type  // Data type of the array
+        , AlignmentFlag AF        // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , typename RT >  // Result type
+template< typename MT >  // Type of the right-hand side dense array
+inline auto CustomArray<N,Type,AF,PF,RT>::subAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !PF || !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   const auto load = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto elem = [&rhs]( auto... indices ) { return (~rhs)( indices... ); };
+
+   ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+      size_t j( 0UL );
+      Iterator left( v_ + i );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() - ArrayRowApply( load, dims, j              ) ); left += SIMDSIZE;
+         left.store( left.load() - ArrayRowApply( load, dims, j+SIMDSIZE     ) ); left += SIMDSIZE;
+         left.store( left.load() - ArrayRowApply( load, dims, j+SIMDSIZE*2UL ) ); left += SIMDSIZE;
+         left.store( left.load() - ArrayRowApply( load, dims, j+SIMDSIZE*3UL ) ); left += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+         left.store( left.load() - ArrayRowApply( load, dims, j ) );
+      }
+      for( ; remainder && j<dims_[0]; ++j, ++left ) {
+         *left -= ArrayRowApply( elem, dims, j );
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -3390,7 +3380,7 @@ template< size_t N       // Dimensionality of the array
         , typename RT >  // Result type
 template< typename MT >  // Type of the right-hand side dense array
 inline auto CustomArray<N,Type,AF,PF,RT>::schurAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedSchurAssign_v<MT> >
+   -> DisableIf_t< VectorizedSchurAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3408,7 +3398,7 @@ inline auto CustomArray<N,Type,AF,PF,RT>::schurAssign( const DenseArray<MT>& rhs
 //*************************************************************************************************
 /*!\brief SIMD optimized implementation of the Schur product assignment of a dense array.
 //
-// \param rhs The right-hand side dense array for the Schur product.
+// \param rhs The right-hand side dense array to be multiplied.
 // \return void
 //
 // This function must \b NOT be called explicitly! It is used internally for the performance
@@ -3416,46 +3406,45 @@ inline auto CustomArray<N,Type,AF,PF,RT>::schurAssign( const DenseArray<MT>& rhs
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N       // Dimensionality of the array
-//        , typename Type  // Data type of the array
-//        , AlignmentFlag AF        // Alignment flag
-//        , PaddingFlag PF    // Padding flag
-//        , typename RT >  // Result type
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto CustomArray<N,Type,AF,PF,RT>::schurAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedSchurAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-
-//    constexpr bool remainder( !PF || !IsPadded_v<MT> );
-//
-//    for (size_t k=0UL; k<o_; ++k) {
-//       for (size_t i=0UL; i<m_; ++i)
-//       {
-//          const size_t jpos((remainder)?(n_ & size_t(-SIMDSIZE)):(n_));
-//          BLAZE_INTERNAL_ASSERT(!remainder || (n_ - (n_ % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//          size_t j(0UL);
-//          Iterator left(begin(i, k));
-//          ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//          for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//             left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//          }
-//          for (; j<jpos; j+=SIMDSIZE) {
-//             left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//          }
-//          for (; remainder && j<n_; ++j) {
-//             *left *= *right; ++left; ++right;
-//          }
-//       }
-//    }
-//}
+template< size_t N       // Dimensionality of the array
+        , typename Type  // Data type of the array
+        , AlignmentFlag AF        // Alignment flag
+        , PaddingFlag PF    // Padding flag
+        , typename RT >  // Result type
+template< typename MT >  // Type of the right-hand side dense array
+inline auto CustomArray<N,Type,AF,PF,RT>::schurAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !PF || !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   const auto load = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto elem = [&rhs]( auto... indices ) { return (~rhs)( indices... ); };
+
+   ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+      size_t j( 0UL );
+      Iterator left( v_ + i );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() * ArrayRowApply( load, dims, j              ) ); left += SIMDSIZE;
+         left.store( left.load() * ArrayRowApply( load, dims, j+SIMDSIZE     ) ); left += SIMDSIZE;
+         left.store( left.load() * ArrayRowApply( load, dims, j+SIMDSIZE*2UL ) ); left += SIMDSIZE;
+         left.store( left.load() * ArrayRowApply( load, dims, j+SIMDSIZE*3UL ) ); left += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+         left.store( left.load() * ArrayRowApply( load, dims, j ) );
+      }
+      for( ; remainder && j<dims_[0]; ++j, ++left ) {
+         *left *= ArrayRowApply( elem, dims, j );
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -62,17 +62,21 @@
 #include <blaze/util/typetraits/RemoveReference.h>
 
 // #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
+#include <blaze_tensor/math/expressions/DArrArgReduceExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrEqualExpr.h>
+#include <blaze_tensor/math/expressions/DArrDArrInnerExpr.h>
 #include <blaze_tensor/math/expressions/DArrDArrMapExpr.h>
 // #include <blaze_tensor/math/expressions/DTensDTensMultExpr.h>
 // #include <blaze_tensor/math/expressions/DTensDTensSchurExpr.h>
 // #include <blaze_tensor/math/expressions/DTensDTensSubExpr.h>
 // #include <blaze_tensor/math/expressions/DTensEvalExpr.h>
 #include <blaze_tensor/math/expressions/DArrMapExpr.h>
+#include <blaze_tensor/math/expressions/DArrMomentsExpr.h>
 #include <blaze_tensor/math/expressions/DTensNormExpr.h>
 #include <blaze_tensor/math/expressions/DArrReduceExpr.h>
 #include <blaze_tensor/math/expressions/DArrScalarDivExpr.h>
 #include <blaze_tensor/math/expressions/DArrScalarMultExpr.h>
+#include <blaze_tensor/math/expressions/DArrScanExpr.h>
 // #include <blaze_tensor/math/expressions/DTensSerialExpr.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/util/ArrayForEach.h>
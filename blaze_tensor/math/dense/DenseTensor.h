@@ -59,17 +59,21 @@
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
+#include <blaze_tensor/math/expressions/DTensArgReduceExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensAddExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensEqualExpr.h>
+#include <blaze_tensor/math/expressions/DTensDTensInnerExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensMapExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensSchurExpr.h>
 #include <blaze_tensor/math/expressions/DTensDTensSubExpr.h>
 #include <blaze_tensor/math/expressions/DTensEvalExpr.h>
 #include <blaze_tensor/math/expressions/DTensMapExpr.h>
+#include <blaze_tensor/math/expressions/DTensMomentsExpr.h>
 #include <blaze_tensor/math/expressions/DTensNormExpr.h>
 #include <blaze_tensor/math/expressions/DTensReduceExpr.h>
 #include <blaze_tensor/math/expressions/DTensScalarDivExpr.h>
+#include <blaze_tensor/math/expressions/DTensScanExpr.h>
 #include <blaze_tensor/math/expressions/DTensScalarMultExpr.h>
 #include <blaze_tensor/math/expressions/DTensSerialExpr.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
@@ -42,19 +42,24 @@
 //*************************************************************************************************
 
 #include <array>
+#include <utility>
 
 #include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/traits/DivTrait.h>
 #include <blaze/math/traits/ExpandTrait.h>
 #include <blaze/math/traits/MapTrait.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/system/CacheSize.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/IntegerSequence.h>
 #include <blaze/util/StaticAssert.h>
@@ -445,28 +450,28 @@ class DynamicArray
    BLAZE_ALWAYS_INLINE void stream( const SIMDType& value, Dims... dims ) noexcept;
 
    template< typename MT >
-   inline auto assign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedAssign_v<MT> >*/;
+   inline auto assign( const DenseArray<MT>& rhs ) -> DisableIf_t< VectorizedAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto assign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
+   template< typename MT >
+   inline auto assign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
    template< typename MT >
-   inline auto addAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedAddAssign_v<MT> >*/;
+   inline auto addAssign( const DenseArray<MT>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto addAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT> >;
+   template< typename MT >
+   inline auto addAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT> >;
 
    template< typename MT >
-   inline auto subAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedSubAssign_v<MT> >*/;
+   inline auto subAssign( const DenseArray<MT>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto subAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT> >;
+   template< typename MT >
+   inline auto subAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT> >;
 
    template< typename MT >
-   inline auto schurAssign( const DenseArray<MT>& rhs ) /*-> EnableIf_t< !VectorizedSchurAssign_v<MT> >*/;
+   inline auto schurAssign( const DenseArray<MT>& rhs ) -> DisableIf_t< VectorizedSchurAssign_v<MT> >;
 
-   //template< typename MT >
-   //inline auto schurAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT> >;
+   template< typename MT >
+   inline auto schurAssign( const DenseArray<MT>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT> >;
    //@}
    //**********************************************************************************************
 
@@ -2642,23 +2647,22 @@ inline size_t DynamicArray< N, Type >::columns() const noexcept
 /*!\brief In-place transpose of the array.
 //
 // \return Reference to the transposed array.
+//
+// This function reverses the order of the dimensions of the array. The array is transposed
+// within its current memory; a temporary array is only required in case the padding of the
+// new rows does not fit into the capacity of the array.
 */
 template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 inline DynamicArray<N, Type>& DynamicArray<N, Type>::transpose()
 {
-   using std::swap;
-//    if( l_ == n_ && o_ == n_ && m_ == n_ )
-//    {
-//       transposeGeneral( *this );
-//    }
-//    else
-//    {
-       DynamicArray tmp( trans( *this ) );
-       this->swap( tmp );
-//    }
+   std::array<size_t,N> indices;
 
-   return *this;
+   for( size_t d=0UL; d<N; ++d ) {
+      indices[d] = N-1UL-d;
+   }
+
+   return transpose( indices.data(), N );
 }
 //*************************************************************************************************
 
@@ -2666,23 +2670,41 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::transpose()
 //*************************************************************************************************
 /*!\brief In-place transpose of the array.
 //
+// \param indices Pointer to the first index of the axis mapping.
+// \param n The total number of indices.
 // \return Reference to the transposed array.
+// \exception std::invalid_argument Invalid transposition indices.
+//
+// This function permutes the dimensions of the array according to the given axis mapping,
+// where index 0 denotes the outermost dimension. The array is transposed within its current
+// memory by a cycle-following permutation (see transposeInPlace()). Only in case the padding
+// of the new rows does not fit into the capacity of the array, a temporary array is created.
 */
 template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 template< typename T >     // Type of the mapping indices
 inline DynamicArray<N, Type>& DynamicArray<N, Type>::transpose( const T* indices, size_t n )
 {
-   using std::swap;
-//    if( l_ == n_ && o_ == n_ && m_ == n_ )
-//    {
-//       transposeGeneral( *this, indices, n );
-//    }
-//    else
-//    {
-       DynamicArray tmp( trans(*this, indices, n ) );
-       this->swap( tmp );
-//    }
+   const std::array<size_t,N> perm( transpositionIndices<N>( indices, n ) );
+
+   std::array<size_t,N> dims;
+
+   for( size_t d=0UL; d<N; ++d ) {
+      dims[d] = dims_[N-1UL-d];
+   }
+
+   if( transposeInPlace( v_, capacity_, dims, nn_, perm,
+                         []( size_t value ){ return addPadding( value ); } ) )
+   {
+      for( size_t d=0UL; d<N; ++d ) {
+         dims_[N-1UL-d] = dims[d];
+      }
+   }
+   else
+   {
+      DynamicArray tmp( trans( *this, indices, n ) );
+      this->swap( tmp );
+   }
 
    return *this;
 }
@@ -2698,34 +2720,12 @@ template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 inline DynamicArray<N, Type>& DynamicArray<N, Type>::ctranspose()
 {
-   using std::swap;
-//    constexpr size_t block( BLOCK_SIZE );
-//
-//    if( o_ == n_ && m_ == n_ )
-//    {
-//       for( size_t ii=0UL; ii<m_; ii+=block ) {
-//          const size_t iend( min( ii+block, m_ ) );
-//          for( size_t jj=0UL; jj<ii; jj+=block ) {
-//             const size_t jend( min( jj+block, n_ ) );
-//             for( size_t i=ii; i<iend; ++i ) {
-//                for( size_t j=jj; j<jend; ++j ) {
-//                   cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//                }
-//             }
-//          }
-//          for( size_t i=ii; i<iend; ++i ) {
-//             for( size_t j=ii; j<i; ++j ) {
-//                cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//             }
-//             conjugate( v_[i*nn_+i] );
-//          }
-//       }
-//    }
-//    else
-//    {
-       DynamicArray tmp( ctrans( *this ) );
-       swap( tmp );
-//    }
+   transpose();
+
+   const size_t elements( calcCapacity() );
+   for( size_t i=0UL; i<elements; ++i ) {
+      conjugate( v_[i] );
+   }
 
    return *this;
 }
@@ -2735,41 +2735,22 @@ inline DynamicArray<N, Type>& DynamicArray<N, Type>::ctranspose()
 //*************************************************************************************************
 /*!\brief In-place conjugate transpose of the array.
 //
+// \param indices Pointer to the first index of the axis mapping.
+// \param n The total number of indices.
 // \return Reference to the transposed array.
+// \exception std::invalid_argument Invalid transposition indices.
 */
 template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 template< typename T >     // Type of the mapping indices
 inline DynamicArray<N, Type>& DynamicArray<N, Type>::ctranspose( const T* indices, size_t n )
 {
-   using std::swap;
-//    constexpr size_t block( BLOCK_SIZE );
-//
-//    if( o_ == n_ && m_ == n_ )
-//    {
-//       for( size_t ii=0UL; ii<m_; ii+=block ) {
-//          const size_t iend( min( ii+block, m_ ) );
-//          for( size_t jj=0UL; jj<ii; jj+=block ) {
-//             const size_t jend( min( jj+block, n_ ) );
-//             for( size_t i=ii; i<iend; ++i ) {
-//                for( size_t j=jj; j<jend; ++j ) {
-//                   cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//                }
-//             }
-//          }
-//          for( size_t i=ii; i<iend; ++i ) {
-//             for( size_t j=ii; j<i; ++j ) {
-//                cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//             }
-//             conjugate( v_[i*nn_+i] );
-//          }
-//       }
-//    }
-//    else
-//    {
-       DynamicArray tmp( ctrans(*this, indices, n ) );
-       swap( tmp );
-//    }
+   transpose( indices, n );
+
+   const size_t elements( calcCapacity() );
+   for( size_t i=0UL; i<elements; ++i ) {
+      conjugate( v_[i] );
+   }
 
    return *this;
 }
@@ -3194,7 +3175,7 @@ template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 template< typename MT >  // Type of the right-hand side dense array
 inline auto DynamicArray<N, Type>::assign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedAssign_v<MT> >
+   -> DisableIf_t< VectorizedAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3220,63 +3201,60 @@ inline auto DynamicArray<N, Type>::assign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N         // The dimensionality of the array
-//        , typename Type >  // Data type of the array
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto DynamicArray<N, Type>::assign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//   constexpr bool remainder( !IsPadded_v<MT> );
-//
-//   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
-//   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
-
-//    if( useStreaming &&
-//        ( o_*m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
-//    {
-//       for (size_t k=0UL; k<o_; ++k) {
-//          for (size_t i=0UL; i<m_; ++i) {
-//             size_t j(0UL);
-//             Iterator left(begin(i, k));
-//             ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//             for (; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE, right+=SIMDSIZE) {
-//                left.stream(right.load());
-//             }
-//             for (; remainder && j<n_; ++j, ++left, ++right) {
-//                *left = *right;
-//             }
-//          }
-//       }
-//    }
-//    else
-//    {
-//       for (size_t k=0UL; k<o_; ++k) {
-//          for (size_t i=0UL; i<m_; ++i) {
-//             size_t j(0UL);
-//             Iterator left(begin(i, k));
-//             ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//             for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//                left.store(right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//             }
-//             for (; j<jpos; j+=SIMDSIZE) {
-//                left.store(right.load()); left+=SIMDSIZE, right+=SIMDSIZE;
-//             }
-//             for (; remainder && j<n_; ++j) {
-//                *left = *right; ++left; ++right;
-//             }
-//          }
-//       }
-//    }
-//}
+template< size_t N         // The dimensionality of the array
+        , typename Type >  // Data type of the array
+template< typename MT >  // Type of the right-hand side dense array
+inline auto DynamicArray<N, Type>::assign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   const auto load = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto elem = [&rhs]( auto... indices ) { return (~rhs)( indices... ); };
+
+   if( useStreaming &&
+       ( capacity() > ( cacheSize / ( sizeof(Type) * 3UL ) ) ) && !(~rhs).isAliased( this ) )
+   {
+      ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+         size_t j( 0UL );
+         Iterator left( v_ + i );
+
+         for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+            left.stream( ArrayRowApply( load, dims, j ) );
+         }
+         for( ; remainder && j<dims_[0]; ++j, ++left ) {
+            *left = ArrayRowApply( elem, dims, j );
+         }
+      } );
+   }
+   else
+   {
+      ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+         size_t j( 0UL );
+         Iterator left( v_ + i );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            left.store( ArrayRowApply( load, dims, j              ) ); left += SIMDSIZE;
+            left.store( ArrayRowApply( load, dims, j+SIMDSIZE     ) ); left += SIMDSIZE;
+            left.store( ArrayRowApply( load, dims, j+SIMDSIZE*2UL ) ); left += SIMDSIZE;
+            left.store( ArrayRowApply( load, dims, j+SIMDSIZE*3UL ) ); left += SIMDSIZE;
+         }
+         for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+            left.store( ArrayRowApply( load, dims, j ) );
+         }
+         for( ; remainder && j<dims_[0]; ++j, ++left ) {
+            *left = ArrayRowApply( elem, dims, j );
+         }
+      } );
+   }
+}
 //*************************************************************************************************
 
 
@@ -3295,7 +3273,7 @@ template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 template< typename MT >  // Type of the right-hand side dense array
 inline auto DynamicArray<N, Type>::addAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedAddAssign_v<MT> >
+   -> DisableIf_t< VectorizedAddAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3321,46 +3299,42 @@ inline auto DynamicArray<N, Type>::addAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N         // The dimensionality of the array
-//        , typename Type >  // Data type of the array
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto DynamicArray<N, Type>::addAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedAddAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//   constexpr bool remainder( !IsPadded_v<MT> );
-//
-//   for (size_t k=0UL; k<o_; ++k) {
-//      for (size_t i=0UL; i<m_; ++i) {
-//         const size_t jbegin(0UL);
-//         const size_t jend  (n_);
-//         BLAZE_INTERNAL_ASSERT(jbegin <= jend, "Invalid loop indices detected");
-//
-//         const size_t jpos((remainder)?(jend & size_t(-SIMDSIZE)):(jend));
-//         BLAZE_INTERNAL_ASSERT(!remainder || (jend - (jend % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//         size_t j(jbegin);
-//         Iterator left(begin(i, k) + jbegin);
-//         ConstIterator_t<MT> right((~rhs).begin(i, k) + jbegin);
-//
-//         for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; j<jpos; j+=SIMDSIZE) {
-//            left.store(left.load() + right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; remainder && j<jend; ++j) {
-//            *left += *right; ++left; ++right;
-//         }
-//      }
-//   }
-//}
+template< size_t N         // The dimensionality of the array
+        , typename Type >  // Data type of the array
+template< typename MT >  // Type of the right-hand side dense array
+inline auto DynamicArray<N, Type>::addAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   const auto load = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto elem = [&rhs]( auto... indices ) { return (~rhs)( indices... ); };
+
+   ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+      size_t j( 0UL );
+      Iterator left( v_ + i );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() + ArrayRowApply( load, dims, j              ) ); left += SIMDSIZE;
+         left.store( left.load() + ArrayRowApply( load, dims, j+SIMDSIZE     ) ); left += SIMDSIZE;
+         left.store( left.load() + ArrayRowApply( load, dims, j+SIMDSIZE*2UL ) ); left += SIMDSIZE;
+         left.store( left.load() + ArrayRowApply( load, dims, j+SIMDSIZE*3UL ) ); left += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+         left.store( left.load() + ArrayRowApply( load, dims, j ) );
+      }
+      for( ; remainder && j<dims_[0]; ++j, ++left ) {
+         *left += ArrayRowApply( elem, dims, j );
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -3379,7 +3353,7 @@ template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 template< typename MT >  // Type of the right-hand side dense array
 inline auto DynamicArray<N, Type>::subAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedSubAssign_v<MT> >
+   -> DisableIf_t< VectorizedSubAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3405,47 +3379,42 @@ inline auto DynamicArray<N, Type>::subAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N         // The dimensionality of the array
-//        , typename Type >  // Data type of the array
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto DynamicArray<N, Type>::subAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedSubAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//   constexpr bool remainder( !IsPadded_v<MT> );
-//
-//   for (size_t k=0UL; k<o_; ++k) {
-//      for (size_t i=0UL; i<m_; ++i)
-//      {
-//         const size_t jbegin(0UL);
-//         const size_t jend  (n_);
-//         BLAZE_INTERNAL_ASSERT(jbegin <= jend, "Invalid loop indices detected");
-//
-//         const size_t jpos((remainder)?(jend & size_t(-SIMDSIZE)):(jend));
-//         BLAZE_INTERNAL_ASSERT(!remainder || (jend - (jend % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//         size_t j(jbegin);
-//         Iterator left(begin(i, k) + jbegin);
-//         ConstIterator_t<MT> right((~rhs).begin(i, k) + jbegin);
-//
-//         for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; j<jpos; j+=SIMDSIZE) {
-//            left.store(left.load() - right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; remainder && j<jend; ++j) {
-//            *left -= *right; ++left; ++right;
-//         }
-//      }
-//   }
-//}
+template< size_t N         // The dimensionality of the array
+        , typename Type >  // Data type of the array
+template< typename MT >  // Type of the right-hand side dense array
+inline auto DynamicArray<N, Type>::subAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   const auto load = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto elem = [&rhs]( auto... indices ) { return (~rhs)( indices... ); };
+
+   ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+      size_t j( 0UL );
+      Iterator left( v_ + i );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() - ArrayRowApply( load, dims, j              ) ); left += SIMDSIZE;
+         left.store( left.load() - ArrayRowApply( load, dims, j+SIMDSIZE     ) ); left += SIMDSIZE;
+         left.store( left.load() - ArrayRowApply( load, dims, j+SIMDSIZE*2UL ) ); left += SIMDSIZE;
+         left.store( left.load() - ArrayRowApply( load, dims, j+SIMDSIZE*3UL ) ); left += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+         left.store( left.load() - ArrayRowApply( load, dims, j ) );
+      }
+      for( ; remainder && j<dims_[0]; ++j, ++left ) {
+         *left -= ArrayRowApply( elem, dims, j );
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -3464,7 +3433,7 @@ template< size_t N         // The dimensionality of the array
         , typename Type >  // Data type of the array
 template< typename MT >  // Type of the right-hand side dense array
 inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
-   //-> EnableIf_t< !VectorizedSchurAssign_v<MT> >
+   -> DisableIf_t< VectorizedSchurAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
 
@@ -3482,7 +3451,7 @@ inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
 //*************************************************************************************************
 /*!\brief SIMD optimized implementation of the Schur product assignment of a dense array.
 //
-// \param rhs The right-hand side dense array for the Schur product.
+// \param rhs The right-hand side dense array to be multiplied.
 // \return void
 //
 // This function must \b NOT be called explicitly! It is used internally for the performance
@@ -3490,43 +3459,42 @@ inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-//template< size_t N         // The dimensionality of the array
-//        , typename Type >  // Data type of the array
-//template< typename MT >  // Type of the right-hand side dense array
-//inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
-//   -> EnableIf_t< VectorizedSchurAssign_v<MT> >
-//{
-//   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
-//
-//   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
-//
-//   constexpr bool remainder( !IsPadded_v<MT> );
-//
-//   for (size_t k=0UL; k<o_; ++k) {
-//      for (size_t i=0UL; i<m_; ++i)
-//      {
-//         const size_t jpos((remainder)?(n_ & size_t(-SIMDSIZE)):(n_));
-//         BLAZE_INTERNAL_ASSERT(!remainder || (n_ - (n_ % (SIMDSIZE))) == jpos, "Invalid end calculation");
-//
-//         size_t j(0UL);
-//         Iterator left(begin(i, k));
-//         ConstIterator_t<MT> right((~rhs).begin(i, k));
-//
-//         for (; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL) {
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; j<jpos; j+=SIMDSIZE) {
-//            left.store(left.load() * right.load()); left += SIMDSIZE; right += SIMDSIZE;
-//         }
-//         for (; remainder && j<n_; ++j) {
-//            *left *= *right; ++left; ++right;
-//         }
-//      }
-//   }
-//}
+template< size_t N         // The dimensionality of the array
+        , typename Type >  // Data type of the array
+template< typename MT >  // Type of the right-hand side dense array
+inline auto DynamicArray<N, Type>::schurAssign( const DenseArray<MT>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( dims_ == (~rhs).dimensions()   , "Invalid array access index"    );
+
+   constexpr bool remainder( !IsPadded_v<MT> );
+
+   const size_t jpos( ( remainder )?( dims_[0] & size_t(-SIMDSIZE) ):( dims_[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims_[0] - ( dims_[0] % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
+
+   const auto load = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto elem = [&rhs]( auto... indices ) { return (~rhs)( indices... ); };
+
+   ArrayForEachRow( dims_, nn_, [&]( size_t i, std::array< size_t, N > const& dims ) {
+      size_t j( 0UL );
+      Iterator left( v_ + i );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+         left.store( left.load() * ArrayRowApply( load, dims, j              ) ); left += SIMDSIZE;
+         left.store( left.load() * ArrayRowApply( load, dims, j+SIMDSIZE     ) ); left += SIMDSIZE;
+         left.store( left.load() * ArrayRowApply( load, dims, j+SIMDSIZE*2UL ) ); left += SIMDSIZE;
+         left.store( left.load() * ArrayRowApply( load, dims, j+SIMDSIZE*3UL ) ); left += SIMDSIZE;
+      }
+      for( ; j<jpos; j+=SIMDSIZE, left+=SIMDSIZE ) {
+         left.store( left.load() * ArrayRowApply( load, dims, j ) );
+      }
+      for( ; remainder && j<dims_[0]; ++j, ++left ) {
+         *left *= ArrayRowApply( elem, dims, j );
+      }
+   } );
+}
 //*************************************************************************************************
 
 
@@ -4070,6 +4038,45 @@ struct BinaryMapTraitEval2< DynamicArray< N, ET1 > , DynamicArray< N, ET2 >, OP
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< size_t N1, typename ET1, size_t N2, typename ET2, typename OP >
+struct BinaryMapTraitEval2< DynamicArray< N1, ET1 >, DynamicArray< N2, ET2 >, OP
+                          , EnableIf_t< N1 != N2 > >
+{
+   using Type = DynamicArray< ( N1 < N2 ? N2 : N1 ), MapTrait_t<ET1,ET2,OP> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCETRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T   // Type of the array to be reduced
+        , typename OP  // Type of the reduction operation
+        , size_t RF >  // Reduction flag
+struct PartialReduceTraitEval2< T, OP, RF
+                              , EnableIf_t< IsDenseArray_v<T> &&
+                                            ( T::num_dimensions >= 2UL ) &&
+                                            ( RF < T::num_dimensions ) > >
+{
+   using ET = ElementType_t<T>;
+
+   using Type = DynamicArray< T::num_dimensions - 1UL
+                            , decltype( std::declval<OP>()( std::declval<ET>(), std::declval<ET>() ) ) >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
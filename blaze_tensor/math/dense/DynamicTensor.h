@@ -41,6 +41,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
+#include <utility>
+
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 
 #include <blaze_tensor/math/Forward.h>
@@ -57,6 +62,7 @@
 #include <blaze_tensor/math/traits/RavelTrait.h>
 #include <blaze_tensor/math/traits/RowSliceTrait.h>
 #include <blaze_tensor/math/traits/SubtensorTrait.h>
+#include <blaze_tensor/math/traits/TtmTrait.h>
 #include <blaze_tensor/math/typetraits/IsDenseArray.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/typetraits/IsRowMajorTensor.h>
@@ -1803,21 +1809,17 @@ inline size_t DynamicTensor<Type>::addPadding( size_t value ) const noexcept
 /*!\brief In-place transpose of the tensor.
 //
 // \return Reference to the transposed tensor.
+//
+// This function reverses the order of the pages, rows, and columns of the tensor. The tensor is
+// transposed within its current memory; a temporary tensor is only required in case the padding
+// of the new rows does not fit into the capacity of the tensor.
 */
 template< typename Type >  // Data type of the tensor
 inline DynamicTensor<Type>& DynamicTensor<Type>::transpose()
 {
-   if( o_ == n_ && m_ == n_ )
-   {
-      transposeGeneral( *this );
-   }
-   else
-   {
-      DynamicTensor tmp( trans( *this ) );
-      this->swap( tmp );
-   }
+   constexpr size_t indices[] = { 2UL, 1UL, 0UL };
 
-   return *this;
+   return transpose( indices, 3UL );
 }
 //*************************************************************************************************
 
@@ -1825,19 +1827,41 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::transpose()
 //*************************************************************************************************
 /*!\brief In-place transpose of the tensor.
 //
+// \param indices Pointer to the first index of the axis mapping.
+// \param n The total number of indices.
 // \return Reference to the transposed tensor.
+// \exception std::invalid_argument Invalid transposition indices.
+//
+// This function permutes the pages, rows, and columns of the tensor according to the given axis
+// mapping. Cubic tensors are transposed by swapping elements; all other tensors are transposed
+// within their current memory by a cycle-following permutation (see transposeInPlace()). Only in
+// case the padding of the new rows does not fit into the capacity of the tensor, a temporary
+// tensor is created.
 */
 template< typename Type >  // Data type of the tensor
 template< typename T >     // Type of the mapping indices
 inline DynamicTensor<Type>& DynamicTensor<Type>::transpose( const T* indices, size_t n )
 {
+   const std::array<size_t,3UL> perm( transpositionIndices<3UL>( indices, n ) );
+
    if( o_ == n_ && m_ == n_ )
    {
       transposeGeneral( *this, indices, n );
+      return *this;
+   }
+
+   std::array<size_t,3UL> dims{ { o_, m_, n_ } };
+
+   if( transposeInPlace( v_, capacity_, dims, nn_, perm,
+                         [this]( size_t value ){ return addPadding( value ); } ) )
+   {
+      o_ = dims[0];
+      m_ = dims[1];
+      n_ = dims[2];
    }
    else
    {
-      DynamicTensor tmp( trans(*this, indices, n ) );
+      DynamicTensor tmp( trans( *this, indices, n ) );
       this->swap( tmp );
    }
 
@@ -1854,35 +1878,9 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::transpose( const T* indices, si
 template< typename Type >  // Data type of the tensor
 inline DynamicTensor<Type>& DynamicTensor<Type>::ctranspose()
 {
-//    constexpr size_t block( BLOCK_SIZE );
-//
-//    if( o_ == n_ && m_ == n_ )
-//    {
-//       for( size_t ii=0UL; ii<m_; ii+=block ) {
-//          const size_t iend( min( ii+block, m_ ) );
-//          for( size_t jj=0UL; jj<ii; jj+=block ) {
-//             const size_t jend( min( jj+block, n_ ) );
-//             for( size_t i=ii; i<iend; ++i ) {
-//                for( size_t j=jj; j<jend; ++j ) {
-//                   cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//                }
-//             }
-//          }
-//          for( size_t i=ii; i<iend; ++i ) {
-//             for( size_t j=ii; j<i; ++j ) {
-//                cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//             }
-//             conjugate( v_[i*nn_+i] );
-//          }
-//       }
-//    }
-//    else
-//    {
-      DynamicTensor tmp( ctrans( *this ) );
-      swap( tmp );
-//    }
+   constexpr size_t indices[] = { 2UL, 1UL, 0UL };
 
-   return *this;
+   return ctranspose( indices, 3UL );
 }
 //*************************************************************************************************
 
@@ -1890,39 +1888,20 @@ inline DynamicTensor<Type>& DynamicTensor<Type>::ctranspose()
 //*************************************************************************************************
 /*!\brief In-place conjugate transpose of the tensor.
 //
+// \param indices Pointer to the first index of the axis mapping.
+// \param n The total number of indices.
 // \return Reference to the transposed tensor.
+// \exception std::invalid_argument Invalid transposition indices.
 */
 template< typename Type >  // Data type of the tensor
 template< typename T >     // Type of the mapping indices
 inline DynamicTensor<Type>& DynamicTensor<Type>::ctranspose( const T* indices, size_t n )
 {
-//    constexpr size_t block( BLOCK_SIZE );
-//
-//    if( o_ == n_ && m_ == n_ )
-//    {
-//       for( size_t ii=0UL; ii<m_; ii+=block ) {
-//          const size_t iend( min( ii+block, m_ ) );
-//          for( size_t jj=0UL; jj<ii; jj+=block ) {
-//             const size_t jend( min( jj+block, n_ ) );
-//             for( size_t i=ii; i<iend; ++i ) {
-//                for( size_t j=jj; j<jend; ++j ) {
-//                   cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//                }
-//             }
-//          }
-//          for( size_t i=ii; i<iend; ++i ) {
-//             for( size_t j=ii; j<i; ++j ) {
-//                cswap( v_[i*nn_+j], v_[j*nn_+i] );
-//             }
-//             conjugate( v_[i*nn_+i] );
-//          }
-//       }
-//    }
-//    else
-//    {
-      DynamicTensor tmp( ctrans(*this, indices, n ) );
-      swap( tmp );
-//    }
+   transpose( indices, n );
+
+   for( size_t i=0UL; i<o_*m_*nn_; ++i ) {
+      conjugate( v_[i] );
+   }
 
    return *this;
 }
@@ -3303,6 +3282,58 @@ struct BinaryMapTraitEval2< T1, T2, OP
 
 
 
+//=================================================================================================
+//
+//  REDUCETRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T   // Type of the tensor to be reduced
+        , typename OP  // Type of the reduction operation
+        , size_t RF >  // Reduction flag
+struct PartialReduceTraitEval2< T, OP, RF
+                              , EnableIf_t< IsDenseTensor_v<T> && ( RF < 3UL ) > >
+{
+   using ET = ElementType_t<T>;
+
+   using Type = DynamicMatrix< decltype( std::declval<OP>()( std::declval<ET>(), std::declval<ET>() ) )
+                             , rowMajor >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TTMTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2, size_t MODE >
+struct TtmTraitEval2< T1, T2, MODE
+                    , EnableIf_t< IsDenseTensor_v<T1> &&
+                                  IsDenseMatrix_v<T2> &&
+                                  ( ( MODE == 0UL ? Size_v<T2,0UL> : Size_v<T1,0UL> ) == DefaultSize_v ||
+                                    ( MODE == 1UL ? Size_v<T2,0UL> : Size_v<T1,1UL> ) == DefaultSize_v ||
+                                    ( MODE == 2UL ? Size_v<T2,0UL> : Size_v<T1,2UL> ) == DefaultSize_v ) > >
+{
+   using ET1 = ElementType_t<T1>;
+   using ET2 = ElementType_t<T2>;
+
+   using Type = DynamicTensor< MultTrait_t<ET1,ET2> >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  RAVELTRAIT SPECIALIZATIONS
@@ -0,0 +1,1266 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Einsum.h
+//  \brief Header file for the dense tensor and array contraction (einsum) functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_EINSUM_H_
+#define _BLAZE_TENSOR_MATH_DENSE_EINSUM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemovePointer.h>
+
+#include <blaze_tensor/math/dense/Permutation.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/typetraits/IsDenseArray.h>
+#include <blaze_tensor/math/typetraits/IsDenseTensor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  EINSUM SPECIFICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The parsed index specification of a contraction of two operands.
+// \ingroup dense_tensor
+//
+// Each index (label) is a single letter. The labels of an operand are given in the order of the
+// indices of its function call operator, i.e. starting with the outermost dimension. A label
+// may appear repeatedly within an operand, which refers to the diagonal of the corresponding
+// dimensions.
+*/
+struct EinsumSpec
+{
+   std::string a;  //!< The labels of the left-hand side operand.
+   std::string b;  //!< The labels of the right-hand side operand.
+   std::string c;  //!< The labels of the result.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses the given einsum index specification.
+// \ingroup dense_tensor
+//
+// \param spec The index specification of the form \c "kil,lj->kij".
+// \return The parsed index specification.
+// \exception std::invalid_argument Invalid einsum specification.
+//
+// Each label must be a letter. A label may appear repeatedly within an operand (diagonal), but
+// at most once within the result. Every label of the result must appear in at least one of the
+// operands. Labels that do not appear in the result are summed over.
+*/
+inline EinsumSpec parseEinsumSpec( const std::string& spec )
+{
+   const size_t comma( spec.find( ',' ) );
+   const size_t arrow( spec.find( "->" ) );
+
+   if( comma == std::string::npos || arrow == std::string::npos || arrow < comma ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+   }
+
+   EinsumSpec s{ spec.substr( 0UL, comma ),
+                 spec.substr( comma+1UL, arrow-comma-1UL ),
+                 spec.substr( arrow+2UL ) };
+
+   const auto isValid = []( const std::string& labels, bool unique ) {
+      for( size_t i=0UL; i<labels.size(); ++i ) {
+         if( !std::isalpha( static_cast<unsigned char>( labels[i] ) ) ||
+             ( unique && labels.find( labels[i], i+1UL ) != std::string::npos ) )
+            return false;
+      }
+      return true;
+   };
+
+   if( !isValid( s.a, false ) || !isValid( s.b, false ) || !isValid( s.c, true ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+   }
+
+   for( char l : s.c ) {
+      if( s.a.find( l ) == std::string::npos && s.b.find( l ) == std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum specification" );
+      }
+   }
+
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERAND LAYOUTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The memory layout of an operand of a contraction.
+// \ingroup dense_tensor
+//
+// The extents and strides (in elements) of all dimensions of an operand, starting with the
+// outermost dimension.
+*/
+struct EinsumLayout
+{
+   std::vector<size_t> dims;     //!< The extents of the dimensions.
+   std::vector<size_t> strides;  //!< The strides of the dimensions.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory layout of the given dense matrix.
+// \ingroup dense_tensor
+//
+// \param A The given dense matrix with low-level data access.
+// \return The layout of the rows and columns of the matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+EinsumLayout einsumLayout( const DenseMatrix<MT,SO>& A )
+{
+   const size_t spacing( (~A).spacing() );
+
+   return EinsumLayout{ { (~A).rows(), (~A).columns() },
+                        { ( SO == rowMajor )?( spacing ):( 1UL ),
+                          ( SO == rowMajor )?( 1UL ):( spacing ) } };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory layout of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The given dense tensor with low-level data access.
+// \return The layout of the pages, rows, and columns of the tensor.
+*/
+template< typename TT >  // Type of the dense tensor
+EinsumLayout einsumLayout( const DenseTensor<TT>& A )
+{
+   return EinsumLayout{ { (~A).pages(), (~A).rows(), (~A).columns() },
+                        { pageSpacing( ~A ), (~A).spacing(), 1UL } };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory layout of the given dense array.
+// \ingroup dense_tensor
+//
+// \param A The given dense array with low-level data access.
+// \return The layout of the dimensions of the array (outermost dimension first).
+*/
+template< typename AT >  // Type of the dense array
+EinsumLayout einsumLayout( const DenseArray<AT>& A )
+{
+   constexpr size_t N( AT::num_dimensions );
+
+   const auto& dims( (~A).dimensions() );
+
+   EinsumLayout layout{ std::vector<size_t>( N ), std::vector<size_t>( N ) };
+
+   size_t stride( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      layout.dims   [N-1UL-d] = dims[d];
+      layout.strides[N-1UL-d] = stride;
+      stride *= ( d == 0UL )?( (~A).spacing() ):( dims[d] );
+   }
+
+   return layout;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given operand of a contraction in case it provides low-level data access.
+// \ingroup dense_tensor
+//
+// \param A The given operand.
+// \return Reference to the operand.
+*/
+template< typename T >  // Type of the operand
+auto einsumOperand( const T& A ) -> EnableIf_t< HasConstDataAccess_v<T>, const T& >
+{
+   return A;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluates the given operand of a contraction that does not provide data access.
+// \ingroup dense_tensor
+//
+// \param A The given operand.
+// \return The evaluated operand.
+*/
+template< typename T >  // Type of the operand
+auto einsumOperand( const T& A ) -> DisableIf_t< HasConstDataAccess_v<T>, ResultType_t<T> >
+{
+   return A;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the resize of a resizable result array of a contraction.
+// \ingroup dense_tensor
+*/
+template< typename AT  // Type of the dense array
+        , size_t N >   // Number of dimensions
+void einsumResizeArray( AT& C, const std::array<size_t,N>& extents, TrueType )
+{
+   C.resize( extents, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the resize of a non-resizable result array of a contraction.
+// \ingroup dense_tensor
+*/
+template< typename AT  // Type of the dense array
+        , size_t N >   // Number of dimensions
+void einsumResizeArray( AT& C, const std::array<size_t,N>& extents, FalseType )
+{
+   if( C.dimensions() != extents ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Array cannot be resized" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the given result matrix of a contraction.
+// \ingroup dense_tensor
+//
+// \param C The result matrix.
+// \param dims The required extents of the rows and columns.
+// \return void
+// \exception std::invalid_argument Invalid number of einsum indices.
+// \exception std::invalid_argument Matrix cannot be resized.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void einsumResize( DenseMatrix<MT,SO>& C, const std::vector<size_t>& dims )
+{
+   if( dims.size() != 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of einsum indices" );
+   }
+
+   resize( ~C, dims[0], dims[1], false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the given result tensor of a contraction.
+// \ingroup dense_tensor
+//
+// \param C The result tensor.
+// \param dims The required extents of the pages, rows, and columns.
+// \return void
+// \exception std::invalid_argument Invalid number of einsum indices.
+// \exception std::invalid_argument Tensor cannot be resized.
+*/
+template< typename TT >  // Type of the dense tensor
+void einsumResize( DenseTensor<TT>& C, const std::vector<size_t>& dims )
+{
+   if( dims.size() != 3UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of einsum indices" );
+   }
+
+   resize( ~C, dims[0], dims[1], dims[2], false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resizes the given result array of a contraction.
+// \ingroup dense_tensor
+//
+// \param C The result array.
+// \param dims The required extents of the dimensions (outermost dimension first).
+// \return void
+// \exception std::invalid_argument Invalid number of einsum indices.
+// \exception std::invalid_argument Array cannot be resized.
+*/
+template< typename AT >  // Type of the dense array
+void einsumResize( DenseArray<AT>& C, const std::vector<size_t>& dims )
+{
+   constexpr size_t N( AT::num_dimensions );
+
+   if( dims.size() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of einsum indices" );
+   }
+
+   std::array<size_t,N> extents;
+   for( size_t d=0UL; d<N; ++d ) {
+      extents[d] = dims[N-1UL-d];
+   }
+
+   einsumResizeArray( ~C, extents, BoolConstant< IsResizable_v<AT> >() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LAYOUT ANALYSIS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief A group of dimensions of an operand fused into a single dimension.
+// \ingroup dense_tensor
+*/
+struct EinsumGroup
+{
+   size_t extent;  //!< The product of the extents of all dimensions of the group.
+   size_t stride;  //!< The stride of the fused dimension (0 in case all extents are 1).
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tries to fuse the given group of dimensions of an operand into a single dimension.
+// \ingroup dense_tensor
+//
+// \param layout The layout of the operand.
+// \param labels The labels of the operand.
+// \param group The labels of the group (outermost first).
+// \param g The resulting fused dimension.
+// \return \a true in case the group can be fused without a copy, \a false if not.
+//
+// A group can be fused in case the stride of each dimension is the stride of the following
+// dimension times its extent. Dimensions with an extent of 1 are ignored.
+*/
+inline bool einsumFuse( const EinsumLayout& layout, const std::string& labels,
+                        const std::string& group, EinsumGroup& g )
+{
+   g.extent = 1UL;
+   g.stride = 0UL;
+
+   bool fused( true );
+   bool first( true );
+
+   for( char l : group )
+   {
+      const size_t p( labels.find( l ) );
+      const size_t n( layout.dims[p] );
+      const size_t s( layout.strides[p] );
+
+      g.extent *= n;
+
+      if( n == 1UL )
+         continue;
+
+      if( !first && g.stride != s*n )
+         fused = false;
+
+      g.stride = s;
+      first = false;
+   }
+
+   return fused;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tries to view the given fused row and column dimensions as a dense matrix.
+// \ingroup dense_tensor
+//
+// \param r The fused row dimension.
+// \param c The fused column dimension.
+// \param so The storage order of the matrix view.
+// \param spacing The spacing between two consecutive rows (columns) of the matrix view.
+// \return \a true in case the dimensions can be viewed as a matrix, \a false if not.
+*/
+inline bool einsumMatrixView( const EinsumGroup& r, const EinsumGroup& c,
+                              bool& so, size_t& spacing )
+{
+   if( ( c.extent <= 1UL || c.stride == 1UL ) && ( r.extent <= 1UL || r.stride >= c.extent ) ) {
+      so = rowMajor;
+      spacing = ( r.extent <= 1UL )?( c.extent ):( r.stride );
+      return true;
+   }
+
+   if( ( r.extent <= 1UL || r.stride == 1UL ) && ( c.extent <= 1UL || c.stride >= r.extent ) ) {
+      so = columnMajor;
+      spacing = ( c.extent <= 1UL )?( r.extent ):( c.stride );
+      return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of elements of an operand with the given layout.
+// \ingroup dense_tensor
+*/
+inline size_t einsumSize( const EinsumLayout& layout )
+{
+   size_t size( 1UL );
+   for( size_t n : layout.dims ) {
+      size *= n;
+   }
+   return size;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the contiguous layout of an operand relabeled in the given order.
+// \ingroup dense_tensor
+//
+// \param layout The layout of the operand.
+// \param labels The labels of the operand.
+// \param order The new order of the labels (outermost first).
+// \return The dense, row-major layout of the labels in the given order.
+*/
+inline EinsumLayout einsumPackedLayout( const EinsumLayout& layout, const std::string& labels,
+                                        const std::string& order )
+{
+   const size_t n( order.size() );
+
+   EinsumLayout packed{ std::vector<size_t>( n ), std::vector<size_t>( n ) };
+
+   size_t stride( 1UL );
+   for( size_t d=n; d-- > 0UL; ) {
+      packed.dims   [d] = layout.dims[ labels.find( order[d] ) ];
+      packed.strides[d] = stride;
+      stride *= packed.dims[d];
+   }
+
+   return packed;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the strides of the given labels within an operand.
+// \ingroup dense_tensor
+*/
+inline std::vector<size_t> einsumStrides( const EinsumLayout& layout, const std::string& labels,
+                                          const std::string& order )
+{
+   std::vector<size_t> strides( order.size() );
+   for( size_t d=0UL; d<order.size(); ++d ) {
+      strides[d] = layout.strides[ labels.find( order[d] ) ];
+   }
+   return strides;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PERMUTATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calls the given function for all multi-indices of the given extents.
+// \ingroup dense_tensor
+//
+// \param dims The extents of the dimensions (outermost first).
+// \param strides The strides of the dimensions for each of the \a K operands.
+// \param f The function to be called with the offsets of the current multi-index.
+// \return void
+*/
+template< size_t K     // Number of operands
+        , typename F > // Type of the function
+void einsumForEach( const std::vector<size_t>& dims,
+                    const std::array< std::vector<size_t>, K >& strides, F f )
+{
+   const size_t n( dims.size() );
+
+   size_t total( 1UL );
+   for( size_t d : dims ) {
+      total *= d;
+   }
+
+   std::vector<size_t> index( n, 0UL );
+   std::array<size_t,K> offsets{};
+
+   for( size_t t=0UL; t<total; ++t )
+   {
+      f( offsets );
+
+      for( size_t d=n; d-- > 0UL; )
+      {
+         for( size_t o=0UL; o<K; ++o )
+            offsets[o] += strides[o][d];
+
+         if( ++index[d] < dims[d] )
+            break;
+
+         for( size_t o=0UL; o<K; ++o )
+            offsets[o] -= strides[o][d] * dims[d];
+         index[d] = 0UL;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Strided N-dimensional copy between two operands of a contraction.
+// \ingroup dense_tensor
+//
+// \param dst Pointer to the first element of the target.
+// \param dstStrides The strides of the target.
+// \param src Pointer to the first element of the source.
+// \param srcStrides The strides of the source.
+// \param dims The common extents of all dimensions.
+// \return void
+//
+// In case the unit-stride dimensions of source and target differ, the copy is performed by
+// means of the cache-blocked transposition kernel of the tensor permutations, otherwise by
+// means of a plain copy along the innermost dimension of the target.
+*/
+template< typename Type >  // Type of the elements
+void einsumCopy( Type* dst, const std::vector<size_t>& dstStrides,
+                 const Type* src, const std::vector<size_t>& srcStrides,
+                 const std::vector<size_t>& dims )
+{
+   std::vector<size_t> extents, ds, ss;
+
+   for( size_t d=0UL; d<dims.size(); ++d ) {
+      if( dims[d] == 0UL )
+         return;
+      if( dims[d] == 1UL )
+         continue;
+      extents.push_back( dims[d] );
+      ds.push_back( dstStrides[d] );
+      ss.push_back( srcStrides[d] );
+   }
+
+   size_t q( extents.size() );
+   size_t p( extents.size() );
+
+   for( size_t d=0UL; d<extents.size(); ++d ) {
+      if( ds[d] == 1UL ) q = d;
+      if( ss[d] == 1UL ) p = d;
+   }
+
+   if( q < extents.size() && p < extents.size() && p != q )
+   {
+      const size_t m( extents[q] ), n( extents[p] );
+      const size_t ldd( ds[p] ), lds( ss[q] );
+
+      for( size_t d : { std::max( p, q ), std::min( p, q ) } ) {
+         extents.erase( extents.begin()+d );
+         ds.erase( ds.begin()+d );
+         ss.erase( ss.begin()+d );
+      }
+
+      einsumForEach<2UL>( extents, { ds, ss }, [=]( const std::array<size_t,2UL>& o ) {
+         permuteBlock( dst+o[0], ldd, src+o[1], lds, m, n, false );
+      } );
+   }
+   else if( !extents.empty() )
+   {
+      const size_t last( ( q < extents.size() )?( q ):( extents.size()-1UL ) );
+      const size_t n( extents[last] ), sd( ds[last] ), sr( ss[last] );
+
+      extents.erase( extents.begin()+last );
+      ds.erase( ds.begin()+last );
+      ss.erase( ss.begin()+last );
+
+      einsumForEach<2UL>( extents, { ds, ss }, [=]( const std::array<size_t,2UL>& o ) {
+         Type* const       target( dst+o[0] );
+         const Type* const source( src+o[1] );
+         for( size_t j=0UL; j<n; ++j ) {
+            target[j*sd] = source[j*sr];
+         }
+      } );
+   }
+   else
+   {
+      *dst = *src;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERAND PREPARATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Folds the repeated labels of an operand of a contraction into diagonal dimensions.
+// \ingroup dense_tensor
+//
+// \param labels The labels of the operand.
+// \param layout The layout of the operand.
+// \return void
+// \exception std::invalid_argument Invalid einsum operand sizes.
+//
+// All occurrences of a label are replaced by its first occurrence. The stride of the resulting
+// dimension is the sum of the strides of all occurrences, i.e. the dimension walks along the
+// diagonal. All occurrences of a label must have the same extent.
+*/
+inline void einsumDiagonal( std::string& labels, EinsumLayout& layout )
+{
+   std::string diagonal;
+   EinsumLayout folded;
+
+   for( size_t i=0UL; i<labels.size(); ++i )
+   {
+      const size_t p( diagonal.find( labels[i] ) );
+
+      if( p == std::string::npos ) {
+         diagonal += labels[i];
+         folded.dims.push_back( layout.dims[i] );
+         folded.strides.push_back( layout.strides[i] );
+      }
+      else if( folded.dims[p] != layout.dims[i] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum operand sizes" );
+      }
+      else {
+         folded.strides[p] += layout.strides[i];
+      }
+   }
+
+   labels = std::move( diagonal );
+   layout = std::move( folded );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sums over the labels of an operand of a contraction that appear in no other operand.
+// \ingroup dense_tensor
+//
+// \param A Pointer to the first element of the operand.
+// \param labels The labels of the operand.
+// \param layout The layout of the operand.
+// \param other The labels of the other operand.
+// \param result The labels of the result.
+// \param buffer The buffer for the reduced operand.
+// \return Pointer to the first element of the (possibly reduced) operand.
+//
+// Labels that neither appear in the other operand nor in the result cannot be handled by the
+// matrix multiplication. In case the operand has such labels, they are summed over in advance
+// and the reduced operand is stored in a contiguous buffer. The labels and the layout of the
+// operand are updated accordingly.
+*/
+template< typename Type >  // Type of the elements
+const Type* einsumSum( const Type* A, std::string& labels, EinsumLayout& layout,
+                       const std::string& other, const std::string& result,
+                       std::unique_ptr<Type[]>& buffer )
+{
+   std::string keep, sum;
+
+   for( char l : labels ) {
+      if( other.find( l ) == std::string::npos && result.find( l ) == std::string::npos )
+         sum += l;
+      else
+         keep += l;
+   }
+
+   if( sum.empty() )
+      return A;
+
+   const EinsumLayout packed( einsumPackedLayout( layout, labels, keep ) );
+
+   std::vector<size_t> sumDims( sum.size() );
+   for( size_t d=0UL; d<sum.size(); ++d ) {
+      sumDims[d] = layout.dims[ labels.find( sum[d] ) ];
+   }
+
+   const std::array< std::vector<size_t>, 2UL > strides{
+      packed.strides, einsumStrides( layout, labels, keep ) };
+   const std::array< std::vector<size_t>, 1UL > sumStrides{
+      einsumStrides( layout, labels, sum ) };
+
+   buffer.reset( new Type[ einsumSize( packed ) ] );
+   Type* const target( buffer.get() );
+
+   einsumForEach<2UL>( packed.dims, strides, [&]( const std::array<size_t,2UL>& o ) {
+      Type value{};
+      einsumForEach<1UL>( sumDims, sumStrides, [&]( const std::array<size_t,1UL>& q ) {
+         value += A[ o[1] + q[0] ];
+      } );
+      target[ o[0] ] = value;
+   } );
+
+   labels = std::move( keep );
+   layout = packed;
+
+   return target;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GEMM KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a single row-major matrix product of a contraction.
+// \ingroup dense_tensor
+//
+// The matrices are wrapped into unaligned, unpadded custom matrices and multiplied by means of
+// the dense matrix multiplication of Blaze (which in turn uses the BLAS \c gemm() or the Blaze
+// \c mmm() kernels).
+*/
+template< bool SOA        // Storage order of the left-hand side matrix
+        , bool SOB        // Storage order of the right-hand side matrix
+        , typename ET1    // Element type of the left-hand side matrix
+        , typename ET2    // Element type of the right-hand side matrix
+        , typename ET3 >  // Element type of the result matrix
+void einsumGemmKernel( ET3* C, size_t ldc, const ET1* A, size_t lda, const ET2* B, size_t ldb,
+                       size_t m, size_t n, size_t k )
+{
+   using AT = CustomMatrix<const ET1,unaligned,unpadded,SOA>;
+   using BT = CustomMatrix<const ET2,unaligned,unpadded,SOB>;
+   using CT = CustomMatrix<ET3,unaligned,unpadded,rowMajor>;
+
+   CT Cv( C, m, n, ldc );
+
+   if( k == 0UL ) {
+      reset( Cv );
+      return;
+   }
+
+   const AT Av( A, m, k, lda );
+   const BT Bv( B, k, n, ldb );
+
+   Cv = Av * Bv;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a single matrix product \f$ C = A B \f$ of a contraction.
+// \ingroup dense_tensor
+//
+// A column-major result is computed as the row-major product \f$ C^T = B^T A^T \f$, where the
+// transposes are obtained for free by flipping the storage order of the operands.
+*/
+template< typename ET1    // Element type of the left-hand side matrix
+        , typename ET2    // Element type of the right-hand side matrix
+        , typename ET3 >  // Element type of the result matrix
+void einsumGemm( ET3* Cp, bool soC, size_t ldc,
+                 const ET1* A, bool soA, size_t lda,
+                 const ET2* B, bool soB, size_t ldb,
+                 size_t m, size_t n, size_t k )
+{
+   constexpr bool R( rowMajor );
+   constexpr bool C( columnMajor );
+
+   if( soC == columnMajor ) {
+      if( soB == rowMajor ) {
+         if( soA == rowMajor ) einsumGemmKernel<C,C>( Cp, ldc, B, ldb, A, lda, n, m, k );
+         else                  einsumGemmKernel<C,R>( Cp, ldc, B, ldb, A, lda, n, m, k );
+      }
+      else {
+         if( soA == rowMajor ) einsumGemmKernel<R,C>( Cp, ldc, B, ldb, A, lda, n, m, k );
+         else                  einsumGemmKernel<R,R>( Cp, ldc, B, ldb, A, lda, n, m, k );
+      }
+   }
+   else {
+      if( soA == rowMajor ) {
+         if( soB == rowMajor ) einsumGemmKernel<R,R>( Cp, ldc, A, lda, B, ldb, m, n, k );
+         else                  einsumGemmKernel<R,C>( Cp, ldc, A, lda, B, ldb, m, n, k );
+      }
+      else {
+         if( soB == rowMajor ) einsumGemmKernel<C,R>( Cp, ldc, A, lda, B, ldb, m, n, k );
+         else                  einsumGemmKernel<C,C>( Cp, ldc, A, lda, B, ldb, m, n, k );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONTRACTION ENGINE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief An operand of a contraction viewed as a batch of matrices.
+// \ingroup dense_tensor
+*/
+struct EinsumMatrixOperand
+{
+   bool        direct;   //!< \a true if the operand can be used without a copy.
+   bool        so;       //!< The storage order of the matrix view.
+   size_t      spacing;  //!< The spacing of the matrix view.
+   std::string labels;   //!< The labels of the (possibly packed) operand.
+   EinsumLayout layout;  //!< The layout of the (possibly packed) operand.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the matrix view of an operand of a contraction.
+// \ingroup dense_tensor
+//
+// \param layout The layout of the operand.
+// \param labels The labels of the operand.
+// \param batch The batch labels.
+// \param rows The labels of the rows of the matrix view.
+// \param cols The labels of the columns of the matrix view.
+// \return The matrix view, which in case the operand cannot be viewed directly refers to the
+//         packed layout \a batch + \a rows + \a cols.
+*/
+inline EinsumMatrixOperand
+   einsumMatrixOperand( const EinsumLayout& layout, const std::string& labels,
+                        const std::string& batch, const std::string& rows, const std::string& cols )
+{
+   EinsumMatrixOperand op{ false, rowMajor, 0UL, labels, layout };
+
+   EinsumGroup r, c;
+
+   if( einsumFuse( layout, labels, rows, r ) && einsumFuse( layout, labels, cols, c ) &&
+       einsumMatrixView( r, c, op.so, op.spacing ) ) {
+      op.direct = true;
+      return op;
+   }
+
+   op.labels  = batch + rows + cols;
+   op.layout  = einsumPackedLayout( layout, labels, op.labels );
+   op.so      = rowMajor;
+   einsumFuse( op.layout, op.labels, cols, c );
+   op.spacing = c.extent;
+
+   return op;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the copy volume of the given contraction plan.
+// \ingroup dense_tensor
+*/
+inline size_t einsumCost( const EinsumMatrixOperand& a, const EinsumMatrixOperand& b,
+                          const EinsumMatrixOperand& c )
+{
+   return ( a.direct ? 0UL : einsumSize( a.layout ) ) +
+          ( b.direct ? 0UL : einsumSize( b.layout ) ) +
+          ( c.direct ? 0UL : einsumSize( c.layout ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given labels in the order in which they appear in the reference labels.
+// \ingroup dense_tensor
+*/
+inline std::string einsumOrder( const std::string& labels, const std::string& reference )
+{
+   std::string order;
+   for( char l : reference ) {
+      if( labels.find( l ) != std::string::npos )
+         order += l;
+   }
+   return order;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the contraction of two operands (transpose-transpose-GEMM-transpose).
+// \ingroup dense_tensor
+//
+// \param s The index specification.
+// \param A Pointer to the first element of the left-hand side operand.
+// \param la The layout of the left-hand side operand.
+// \param B Pointer to the first element of the right-hand side operand.
+// \param lb The layout of the right-hand side operand.
+// \param C Pointer to the first element of the result.
+// \param lc The layout of the result.
+// \return void
+//
+// The labels are classified as batch labels (in \a A, \a B, and \a C), free labels of \a A and
+// \a B (in \a C and only one operand), and contracted labels (in \a A and \a B only). For each
+// batch, the contraction is computed as the matrix product of \a A viewed as (free \a A labels)
+// x (contracted labels) and \a B viewed as (contracted labels) x (free \a B labels). For all
+// candidate orderings of the label groups, the plan requiring the least amount of copies is
+// chosen. Operands that cannot be viewed as matrices are packed (transposed) into contiguous
+// buffers in advance, a result that cannot be viewed as a matrix is computed into a buffer that
+// is transposed into the result afterwards.
+*/
+template< typename ET1    // Element type of the left-hand side operand
+        , typename ET2    // Element type of the right-hand side operand
+        , typename ET3 >  // Element type of the result
+void einsumContract( const EinsumSpec& s,
+                     const ET1* A, const EinsumLayout& la,
+                     const ET2* B, const EinsumLayout& lb,
+                     ET3* C, const EinsumLayout& lc )
+{
+   std::string batch, fa, fb, k;
+
+   for( char l : s.c ) {
+      const bool inA( s.a.find( l ) != std::string::npos );
+      const bool inB( s.b.find( l ) != std::string::npos );
+      if( inA && inB ) batch += l;
+      else if( inA )   fa += l;
+      else             fb += l;
+   }
+   for( char l : s.a ) {
+      if( s.c.find( l ) == std::string::npos )
+         k += l;
+   }
+
+   // Selection of the plan with the smallest copy volume
+   const std::string faOrders[2] = { fa, einsumOrder( fa, s.a ) };
+   const std::string fbOrders[2] = { fb, einsumOrder( fb, s.b ) };
+   const std::string kOrders [2] = { k,  einsumOrder( k,  s.b ) };
+
+   EinsumMatrixOperand opA, opB, opC;
+   size_t cost( 0UL );
+   bool first( true );
+
+   for( const std::string& ko : kOrders ) {
+      for( const std::string& fao : faOrders ) {
+         for( const std::string& fbo : fbOrders ) {
+            EinsumMatrixOperand a( einsumMatrixOperand( la, s.a, batch, fao, ko  ) );
+            EinsumMatrixOperand b( einsumMatrixOperand( lb, s.b, batch, ko,  fbo ) );
+            EinsumMatrixOperand c( einsumMatrixOperand( lc, s.c, batch, fao, fbo ) );
+            const size_t current( einsumCost( a, b, c ) );
+            if( first || current < cost ) {
+               opA = std::move( a ); opB = std::move( b ); opC = std::move( c );
+               cost = current; first = false;
+               fa = fao; fb = fbo; k = ko;
+            }
+         }
+      }
+   }
+
+   size_t m( 1UL ), n( 1UL ), l( 1UL );
+   for( char c : fa ) m *= lc.dims[ s.c.find( c ) ];
+   for( char c : fb ) n *= lc.dims[ s.c.find( c ) ];
+   for( char c : k  ) l *= la.dims[ s.a.find( c ) ];
+
+   if( einsumSize( lc ) == 0UL )
+      return;
+
+   // Transposition of the operands
+   std::unique_ptr<ET1[]> bufferA;
+   std::unique_ptr<ET2[]> bufferB;
+   std::unique_ptr<ET3[]> bufferC;
+
+   const ET1* a( A );
+   const ET2* b( B );
+   ET3*       c( C );
+
+   if( !opA.direct ) {
+      bufferA.reset( new ET1[ einsumSize( opA.layout ) ] );
+      einsumCopy( bufferA.get(), opA.layout.strides,
+                  A, einsumStrides( la, s.a, opA.labels ), opA.layout.dims );
+      a = bufferA.get();
+   }
+   if( !opB.direct ) {
+      bufferB.reset( new ET2[ einsumSize( opB.layout ) ] );
+      einsumCopy( bufferB.get(), opB.layout.strides,
+                  B, einsumStrides( lb, s.b, opB.labels ), opB.layout.dims );
+      b = bufferB.get();
+   }
+   if( !opC.direct ) {
+      bufferC.reset( new ET3[ einsumSize( opC.layout ) ] );
+      c = bufferC.get();
+   }
+
+   // Batched GEMM
+   std::vector<size_t> batchDims( batch.size() );
+   for( size_t d=0UL; d<batch.size(); ++d ) {
+      batchDims[d] = lc.dims[ s.c.find( batch[d] ) ];
+   }
+
+   const std::array< std::vector<size_t>, 3UL > batchStrides{
+      einsumStrides( opA.layout, opA.labels, batch ),
+      einsumStrides( opB.layout, opB.labels, batch ),
+      einsumStrides( opC.layout, opC.labels, batch ) };
+
+   einsumForEach<3UL>( batchDims, batchStrides, [&]( const std::array<size_t,3UL>& o ) {
+      einsumGemm( c+o[2], opC.so, opC.spacing,
+                  a+o[0], opA.so, opA.spacing,
+                  b+o[1], opB.so, opB.spacing, m, n, l );
+   } );
+
+   // Back-transposition of the result
+   if( !opC.direct ) {
+      einsumCopy( C, einsumStrides( lc, s.c, opC.labels ), c, opC.layout.strides, opC.layout.dims );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EINSUM FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the operands of a contraction.
+// \ingroup dense_tensor
+*/
+template< typename T >  // Type of the operand
+constexpr bool IsEinsumOperand_v =
+   ( IsDenseMatrix_v<T> || IsDenseTensor_v<T> || IsDenseArray_v<T> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the contraction of two dense matrices, tensors, or arrays.
+// \ingroup dense_tensor
+//
+// \param spec The index specification of the contraction.
+// \param A The left-hand side dense matrix, tensor, or array.
+// \param B The right-hand side dense matrix, tensor, or array.
+// \param C The resulting dense matrix, tensor, or array.
+// \return void
+// \exception std::invalid_argument Invalid einsum specification.
+// \exception std::invalid_argument Invalid number of einsum indices.
+// \exception std::invalid_argument Invalid einsum operand sizes.
+//
+// This function computes the contraction of the two operands \a A and \a B according to the
+// given index specification in Einstein notation and assigns the result to \a C, which is
+// resized accordingly (if possible). The specification names each index of \a A, \a B, and
+// \a C with a single letter in the order of the function call operator of the operand (i.e.
+// \c (k,i,j) for a tensor, \c (i,j) for a matrix). All indices that do not appear in the
+// result are summed over:
+
+   \code
+   blaze::DynamicTensor<double> A( 100UL, 64UL, 32UL ), C;
+   blaze::DynamicMatrix<double> B( 32UL, 48UL ), D;
+
+   // C(k,i,j) = sum_l A(k,i,l) * B(l,j)
+   blaze::einsum( "kil,lj->kij", A, B, C );
+
+   // D(a,b) = sum_{k,i} A(k,i,a) * C(k,i,b)
+   blaze::einsum( "kia,kib->ab", A, C, D );
+   \endcode
+
+// An index that appears repeatedly within an operand refers to the diagonal of the according
+// dimensions, which must have the same extent. Indices that appear in a single operand only
+// and not in the result are summed over before the contraction:
+
+   \code
+   blaze::DynamicTensor<double> T( 100UL, 32UL, 32UL );
+   blaze::DynamicMatrix<double> E( 100UL, 48UL ), F;
+
+   // F(k,j) = trace(T(k,:,:)) * E(k,j)
+   blaze::einsum( "kii,kj->kj", T, E, F );
+   \endcode
+
+// Indices that appear in both operands and in the result are treated as batch indices. The
+// contraction is evaluated via the transpose-transpose-GEMM-transpose scheme: Both operands
+// are viewed as (batches of) matrices and multiplied by means of the optimized dense matrix
+// multiplication. Operands that are already laid out suitably are used in place, all other
+// operands are transposed into a contiguous buffer in advance. The order of the indices within
+// the fused row and column dimensions is chosen such that the number of copies is minimized.
+// The result \a C must provide low-level data access.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2    // Type of the right-hand side operand
+        , typename T3 >  // Type of the result
+inline auto einsum( const std::string& spec, const T1& A, const T2& B, T3& C )
+   -> EnableIf_t< IsEinsumOperand_v<T1> && IsEinsumOperand_v<T2> && IsEinsumOperand_v<T3> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( HasMutableDataAccess_v<T3>,
+                            "Einsum result without data access detected" );
+
+   const EinsumSpec s( parseEinsumSpec( spec ) );
+
+   const auto& a( einsumOperand( A ) );
+   const auto& b( einsumOperand( B ) );
+
+   EinsumLayout la( einsumLayout( a ) );
+   EinsumLayout lb( einsumLayout( b ) );
+
+   if( la.dims.size() != s.a.size() || lb.dims.size() != s.b.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of einsum indices" );
+   }
+
+   EinsumSpec t( s );
+
+   einsumDiagonal( t.a, la );
+   einsumDiagonal( t.b, lb );
+
+   for( size_t i=0UL; i<t.a.size(); ++i ) {
+      const size_t j( t.b.find( t.a[i] ) );
+      if( j != std::string::npos && la.dims[i] != lb.dims[j] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid einsum operand sizes" );
+      }
+   }
+
+   std::vector<size_t> dims( t.c.size() );
+   for( size_t i=0UL; i<t.c.size(); ++i ) {
+      const size_t j( t.a.find( t.c[i] ) );
+      dims[i] = ( j != std::string::npos )?( la.dims[j] ):( lb.dims[ t.b.find( t.c[i] ) ] );
+   }
+
+   einsumResize( C, dims );
+
+   using ET1 = RemoveCV_t< RemovePointer_t< decltype( a.data() ) > >;
+   using ET2 = RemoveCV_t< RemovePointer_t< decltype( b.data() ) > >;
+
+   std::unique_ptr<ET1[]> bufferA;
+   std::unique_ptr<ET2[]> bufferB;
+
+   const ET1* pa( einsumSum<ET1>( a.data(), t.a, la, t.b, t.c, bufferA ) );
+   const ET2* pb( einsumSum<ET2>( b.data(), t.b, lb, t.a, t.c, bufferB ) );
+
+   einsumContract( t, pa, la, pb, lb, C.data(), einsumLayout( C ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,538 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Moments.h
+//  \brief Header file for the single pass moments kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_MOMENTS_H_
+#define _BLAZE_TENSOR_MATH_DENSE_MOMENTS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sub.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Statistics of a dense tensor or dense array computed in a single pass.
+// \ingroup math
+//
+// The Moments class template holds the result of the moments() functions for dense tensors and
+// dense arrays. In case of a total reduction the statistics are scalars, in case of a partial
+// reduction \a T is a dense matrix or dense array holding the statistics of each reduced slice:
+
+   \code
+   blaze::DynamicTensor<float> A;
+   // ... Resizing and initialization
+
+   const blaze::Moments<float> s( moments( A ) );
+   const blaze::Moments< blaze::DynamicMatrix<float> > p( moments<blaze::pagewise>( A ) );
+   \endcode
+
+// The variance is the sample variance (normalized by \f$ count-1 \f$), consistent with the
+// \c var() function of vectors and matrices.
+*/
+template< typename T >  // Type of the statistics
+struct Moments
+{
+   size_t count;  //!< The number of elements each statistic is computed from.
+   T mean;        //!< The arithmetic mean.
+   T variance;    //!< The sample variance.
+   T min;         //!< The smallest element.
+   T max;         //!< The largest element.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the type of the statistics of the given element type.
+// \ingroup math
+//
+// Floating point elements are reduced in their own precision, all other elements (as for
+// instance integral elements) in double precision.
+*/
+template< typename ET >  // Element type of the dense operand
+using MomentsType_t = If_t< IsFloatingPoint_v<ET>, ET, double >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partial result of a moments computation.
+// \ingroup math
+//
+// In contrast to the Moments class template, the accumulator stores the sum of the squared
+// deviations from the mean (\a m2) instead of the variance, which allows to merge partial
+// results without loss of precision.
+*/
+template< typename T >  // Type of the statistics
+struct MomentsAccumulator
+{
+   size_t count{};  //!< The number of accumulated elements.
+   T mean{};        //!< The arithmetic mean of the accumulated elements.
+   T m2{};          //!< The sum of the squared deviations from the mean.
+   T min{};         //!< The smallest accumulated element.
+   T max{};         //!< The largest accumulated element.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pairwise merge of two partial moments computations.
+// \ingroup math
+//
+// This functor combines two partial results by means of the parallel update formula of Chan,
+// Golub, and LeVeque. In contrast to the accumulation of the sum of squares, the merge does not
+// suffer from catastrophic cancellation and can therefore be used as the combine operation of
+// a parallel reduction (see smpReduce()).
+*/
+struct MergeMoments
+{
+   template< typename T >  // Type of the statistics
+   inline MomentsAccumulator<T>
+      operator()( const MomentsAccumulator<T>& a, const MomentsAccumulator<T>& b ) const
+   {
+      if( a.count == 0UL ) return b;
+      if( b.count == 0UL ) return a;
+
+      const size_t n( a.count + b.count );
+      const T delta( b.mean - a.mean );
+      const T ratio( T( b.count ) / T( n ) );
+
+      MomentsAccumulator<T> result;
+      result.count = n;
+      result.mean  = a.mean + delta * ratio;
+      result.m2    = a.m2 + b.m2 + delta * delta * T( a.count ) * ratio;
+      result.min   = min( a.min, b.min );
+      result.max   = max( a.max, b.max );
+      return result;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized moments kernels.
+// \ingroup math
+//
+// In case the dense operand \a TT is SIMD-enabled and has floating point elements, for which
+// all operations of the moments kernels are vectorized, the variable is set to \a true,
+// otherwise it is \a false.
+*/
+template< typename TT >  // Type of the dense operand
+constexpr bool UseVectorizedMomentsKernel_v =
+   ( useOptimizedKernels &&
+     TT::simdEnabled &&
+     IsFloatingPoint_v< ElementType_t<TT> > &&
+     Add::simdEnabled < ElementType_t<TT>, ElementType_t<TT> >() &&
+     Sub::simdEnabled < ElementType_t<TT>, ElementType_t<TT> >() &&
+     Mult::simdEnabled< ElementType_t<TT>, ElementType_t<TT> >() &&
+     Min::simdEnabled < ElementType_t<TT>, ElementType_t<TT> >() &&
+     Max::simdEnabled < ElementType_t<TT>, ElementType_t<TT> >() );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MOMENTS KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of elements of a row processed in a single block by the moments kernels.
+// \ingroup math
+//
+// Each block is traversed twice (once for the mean and once for the squared deviations), but
+// stays in the L1 cache in between. Thus every element is loaded from memory only once.
+*/
+constexpr size_t MOMENTS_BLOCK_SIZE = 1024UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the moments of a single row of elements.
+// \ingroup math
+//
+// \param n The number of elements of the row.
+// \param get The access function for the element with the given index.
+// \param load The SIMD access function for the elements starting at the given index (unused).
+// \return The moments of the row.
+//
+// The row is processed in blocks of MOMENTS_BLOCK_SIZE elements. The mean of each block is
+// computed first, then the squared deviations from this mean are accumulated, and finally the
+// block is merged into the result (see MergeMoments).
+*/
+template< typename T       // Type of the statistics
+        , typename Get     // Type of the element access function
+        , typename Load >  // Type of the SIMD access function
+inline MomentsAccumulator<T> momentsRow( size_t n, Get get, Load load, FalseType )
+{
+   UNUSED_PARAMETER( load );
+
+   MomentsAccumulator<T> result;
+
+   for( size_t jbegin=0UL; jbegin<n; jbegin+=MOMENTS_BLOCK_SIZE )
+   {
+      const size_t jend( min( jbegin+MOMENTS_BLOCK_SIZE, n ) );
+
+      MomentsAccumulator<T> block;
+      block.count = jend - jbegin;
+      block.min   = T( get( jbegin ) );
+      block.max   = block.min;
+
+      T total{};
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         const T x( get( j ) );
+         total += x;
+         block.min = min( block.min, x );
+         block.max = max( block.max, x );
+      }
+
+      block.mean = total / T( block.count );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         const T delta( T( get( j ) ) - block.mean );
+         block.m2 += delta * delta;
+      }
+
+      result = MergeMoments()( result, block );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the moments of a single row of elements.
+// \ingroup math
+//
+// \param n The number of elements of the row.
+// \param get The access function for the element with the given index.
+// \param load The SIMD access function for the elements starting at the given index.
+// \return The moments of the row.
+//
+// The row is processed in blocks of MOMENTS_BLOCK_SIZE elements. The sum, the minimum, and the
+// maximum of each block are accumulated in SIMD registers in a first sweep, the squared
+// deviations from the mean of the block in a second sweep. The block is then merged into the
+// result (see MergeMoments).
+*/
+template< typename T       // Type of the statistics
+        , typename Get     // Type of the element access function
+        , typename Load >  // Type of the SIMD access function
+inline MomentsAccumulator<T> momentsRow( size_t n, Get get, Load load, TrueType )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   MomentsAccumulator<T> result;
+
+   for( size_t jbegin=0UL; jbegin<n; jbegin+=MOMENTS_BLOCK_SIZE )
+   {
+      const size_t jend( min( jbegin+MOMENTS_BLOCK_SIZE, n ) );
+      const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) );
+
+      MomentsAccumulator<T> block;
+      block.count = jend - jbegin;
+
+      T total{};
+      size_t j( jbegin );
+
+      if( jpos > jbegin )
+      {
+         SIMDType xmm1( load( j ) );
+         SIMDType xmin( xmm1 );
+         SIMDType xmax( xmm1 );
+
+         for( j+=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+            const SIMDType xmm2( load( j ) );
+            xmm1 += xmm2;
+            xmin = min( xmin, xmm2 );
+            xmax = max( xmax, xmm2 );
+         }
+
+         total     = sum( xmm1 );
+         block.min = reduce( xmin, Min() );
+         block.max = reduce( xmax, Max() );
+      }
+      else {
+         block.min = get( j );
+         block.max = block.min;
+      }
+
+      for( ; j<jend; ++j ) {
+         const T x( get( j ) );
+         total += x;
+         block.min = min( block.min, x );
+         block.max = max( block.max, x );
+      }
+
+      block.mean = total / T( block.count );
+
+      const SIMDType mean( set( block.mean ) );
+      SIMDType xmm1;
+
+      for( j=jbegin; j<jpos; j+=SIMDSIZE ) {
+         const SIMDType delta( load( j ) - mean );
+         xmm1 += delta * delta;
+      }
+
+      block.m2 = sum( xmm1 );
+
+      for( ; j<jend; ++j ) {
+         const T delta( get( j ) - block.mean );
+         block.m2 += delta * delta;
+      }
+
+      result = MergeMoments()( result, block );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default streaming update of the moments of a row of independent statistics.
+// \ingroup math
+//
+// \param mean Pointer to the means of the row.
+// \param m2 Pointer to the sums of the squared deviations of the row.
+// \param mn Pointer to the minima of the row.
+// \param mx Pointer to the maxima of the row.
+// \param l The number of elements already accumulated into the row of statistics.
+// \param jbegin The index of the first statistic to be updated.
+// \param jend The index behind the last statistic to be updated.
+// \param get The access function for the new element with the given index.
+// \param load The SIMD access function for the new elements starting at the given index (unused).
+// \return void
+//
+// This kernel is used for the reduction along an outer dimension, where each statistic of the
+// row receives one new element per call. The new elements are accumulated by means of the
+// update formula of Welford, which only requires a single pass over the reduced dimension.
+*/
+template< typename T       // Type of the statistics
+        , typename Get     // Type of the element access function
+        , typename Load >  // Type of the SIMD access function
+inline void momentsUpdate( T* mean, T* m2, T* mn, T* mx, size_t l,
+                           size_t jbegin, size_t jend, Get get, Load load, FalseType )
+{
+   UNUSED_PARAMETER( load );
+
+   if( l == 0UL ) {
+      for( size_t j=jbegin; j<jend; ++j ) {
+         mean[j] = mn[j] = mx[j] = get( j );
+         m2[j] = T();
+      }
+      return;
+   }
+
+   const T scale( T( 1 ) / T( l+1UL ) );
+
+   for( size_t j=jbegin; j<jend; ++j ) {
+      const T x( get( j ) );
+      const T delta( x - mean[j] );
+      mean[j] += delta * scale;
+      m2[j]   += delta * ( x - mean[j] );
+      mn[j]    = min( mn[j], x );
+      mx[j]    = max( mx[j], x );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized streaming update of the moments of a row of independent statistics.
+// \ingroup math
+//
+// \param mean Pointer to the means of the row.
+// \param m2 Pointer to the sums of the squared deviations of the row.
+// \param mn Pointer to the minima of the row.
+// \param mx Pointer to the maxima of the row.
+// \param l The number of elements already accumulated into the row of statistics.
+// \param jbegin The index of the first statistic to be updated (a multiple of the SIMD size).
+// \param jend The index behind the last statistic to be updated.
+// \param get The access function for the new element with the given index.
+// \param load The SIMD access function for the new elements starting at the given index.
+// \return void
+//
+// This kernel applies the update formula of Welford to a full SIMD vector of statistics at
+// once. The statistics are accessed via unaligned loads and stores.
+*/
+template< typename T       // Type of the statistics
+        , typename Get     // Type of the element access function
+        , typename Load >  // Type of the SIMD access function
+inline void momentsUpdate( T* mean, T* m2, T* mn, T* mx, size_t l,
+                           size_t jbegin, size_t jend, Get get, Load load, TrueType )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   BLAZE_INTERNAL_ASSERT( jbegin % SIMDSIZE == 0UL, "Invalid column range detected" );
+
+   if( l == 0UL ) {
+      momentsUpdate( mean, m2, mn, mx, l, jbegin, jend, get, load, FalseType() );
+      return;
+   }
+
+   const T scale( T( 1 ) / T( l+1UL ) );
+   const SIMDType factor( set( scale ) );
+
+   const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) );
+
+   size_t j( jbegin );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      const SIMDType xmm1( load( j ) );
+      const SIMDType xmm2( loadu( mean+j ) );
+      const SIMDType delta( xmm1 - xmm2 );
+      const SIMDType xmm3( xmm2 + delta * factor );
+      storeu( mean+j, xmm3 );
+      storeu( m2+j, loadu( m2+j ) + delta * ( xmm1 - xmm3 ) );
+      storeu( mn+j, min( loadu( mn+j ), xmm1 ) );
+      storeu( mx+j, max( loadu( mx+j ), xmm1 ) );
+   }
+
+   for( ; j<jend; ++j ) {
+      const T x( get( j ) );
+      const T delta( x - mean[j] );
+      mean[j] += delta * scale;
+      m2[j]   += delta * ( x - mean[j] );
+      mn[j]    = min( mn[j], x );
+      mx[j]    = max( mx[j], x );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of a row of accumulated squared deviations into sample variances.
+// \ingroup math
+//
+// \param m2 Pointer to the sums of the squared deviations of the row.
+// \param jbegin The index of the first statistic to be converted.
+// \param jend The index behind the last statistic to be converted.
+// \param count The number of elements accumulated into each statistic (at least 2).
+// \return void
+*/
+template< typename T >  // Type of the statistics
+inline void momentsVariance( T* m2, size_t jbegin, size_t jend, size_t count )
+{
+   BLAZE_INTERNAL_ASSERT( count > 1UL, "Invalid number of elements detected" );
+
+   const T scale( T( 1 ) / T( count-1UL ) );
+
+   for( size_t j=jbegin; j<jend; ++j ) {
+      m2[j] *= scale;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion of the result of a total moments computation.
+// \ingroup math
+//
+// \param acc The accumulated moments (of at least 2 elements).
+// \return The corresponding statistics.
+*/
+template< typename T >  // Type of the statistics
+inline Moments<T> momentsResult( const MomentsAccumulator<T>& acc )
+{
+   BLAZE_INTERNAL_ASSERT( acc.count > 1UL, "Invalid number of elements detected" );
+
+   return Moments<T>{ acc.count, acc.mean, acc.m2 / T( acc.count-1UL ), acc.min, acc.max };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,469 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/PageBroadcast.h
+//  \brief Header file for the kernels broadcasting a dense matrix across tensor pages
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_PAGEBROADCAST_H_
+#define _BLAZE_TENSOR_MATH_DENSE_PAGEBROADCAST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasMember.h>
+
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PAGE BROADCAST OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic wrapper for the plain assignment of a broadcast matrix element.
+// \ingroup dense_tensor
+//
+// The PageBroadcastCopy functor discards the tensor operand and returns the matrix operand.
+// It is used to evaluate the plain assignment of a matrix expansion via the page broadcast
+// kernels.
+*/
+struct PageBroadcastCopy
+{
+   //**********************************************************************************************
+   /*!\brief Returns the given matrix operand.
+   //
+   // \param a The tensor operand (ignored).
+   // \param b The matrix operand.
+   // \return The matrix operand.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE T2 operator()( const T1& a, const T2& b ) const
+   {
+      MAYBE_UNUSED( a );
+      return b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether SIMD is enabled for the specified data types \a T1 and \a T2.
+   //
+   // \return \a true in case SIMD is enabled for the data types \a T1 and \a T2, \a false if not.
+   */
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return true; }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic wrapper for a broadcast operation with swapped operands.
+// \ingroup dense_tensor
+//
+// The PageBroadcastSwap functor applies the given binary operation with the tensor operand as
+// second and the matrix operand as first argument. It is used to evaluate operations in which
+// the matrix expansion is the left-hand side operand, such as \f$ expand(M)-T \f$, via the page
+// broadcast kernels without changing the order of the operands.
+*/
+template< typename OP >  // Type of the binary operation
+struct PageBroadcastSwap
+{
+   //**********************************************************************************************
+   /*!\brief Constructor of the PageBroadcastSwap functor.
+   //
+   // \param op The binary operation.
+   */
+   explicit inline PageBroadcastSwap( OP op = OP() )
+      : op_( op )  // The binary operation
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Applies the binary operation with swapped operands.
+   //
+   // \param a The tensor operand.
+   // \param b The matrix operand.
+   // \return The result of the binary operation for \a b and \a a.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE decltype(auto) operator()( const T1& a, const T2& b ) const
+   {
+      return op_( b, a );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether SIMD is enabled for the specified data types \a T1 and \a T2.
+   //
+   // \return \a true in case SIMD is enabled for the data types \a T1 and \a T2, \a false if not.
+   */
+   template< typename T1, typename T2 >
+   static constexpr bool simdEnabled() { return GetSIMDEnabled<OP,T2,T1>::value; }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   OP op_;  //!< The binary operation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PAGE BROADCAST KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized page broadcast kernel.
+// \ingroup dense_tensor
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the dense tensor operand
+        , typename MT    // Type of the broadcast dense matrix
+        , bool SO        // Storage order of the broadcast dense matrix
+        , typename OP >  // Type of the element-wise operation
+struct PageBroadcastHelper
+{
+   //**Type definitions****************************************************************************
+   using ET1 = ElementType_t<TT1>;  //!< Element type of the target dense tensor.
+   using ET2 = ElementType_t<TT2>;  //!< Element type of the dense tensor operand.
+   using ET3 = ElementType_t<MT>;   //!< Element type of the broadcast dense matrix.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( useOptimizedKernels && SO == rowMajor &&
+        TT1::simdEnabled && TT2::simdEnabled && MT::simdEnabled &&
+        IsSIMDCombinable_v<ET1,ET2,ET3> &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET2,ET3>, HasLoad<OP> >::value );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of matrix rows processed per block of the page broadcast kernels.
+// \ingroup dense_tensor
+//
+// \param columns The number of columns of the broadcast matrix.
+// \return The number of matrix rows per block.
+//
+// The block is chosen such that the according rows of the broadcast matrix occupy at most half
+// of the cache and thus remain cached while they are applied to all pages of the tensor.
+*/
+template< typename ET >  // Element type of the broadcast matrix
+inline size_t pageBroadcastBlock( size_t columns ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( columns > 0UL, "Invalid number of columns detected" );
+
+   return max( ( cacheSize / 2UL ) / ( columns * sizeof( ET ) ), 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend of the page broadcast of a dense matrix.
+// \ingroup dense_tensor
+//
+// \param lhs The target left-hand side dense tensor.
+// \param src The dense tensor operand (may be the target tensor itself).
+// \param mat The dense matrix broadcast across the pages.
+// \param op The element-wise operation.
+// \param kbegin The first page to be processed.
+// \param kend The index one past the last page to be processed.
+// \return void
+//
+// This function implements the default page broadcast kernel, which evaluates
+// \f$ A(k,i,j)=op(B(k,i,j),C(i,j)) \f$ for all pages in the range \f$[kbegin..kend)\f$. The
+// rows of the matrix are processed in cache-sized blocks, each of which is applied to all pages
+// of the range before the next block is loaded.
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the dense tensor operand
+        , typename MT    // Type of the broadcast dense matrix
+        , bool SO        // Storage order of the broadcast dense matrix
+        , typename OP >  // Type of the element-wise operation
+inline auto pageBroadcastRange( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& src
+                              , const DenseMatrix<MT,SO>& mat, OP op, size_t kbegin, size_t kend )
+   -> EnableIf_t< !PageBroadcastHelper<TT1,TT2,MT,SO,OP>::value >
+{
+   const size_t M( (~mat).rows()    );
+   const size_t N( (~mat).columns() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   const size_t block( pageBroadcastBlock< ElementType_t<MT> >( N ) );
+
+   for( size_t ii=0UL; ii<M; ii+=block )
+   {
+      const size_t iend( min( ii+block, M ) );
+
+      for( size_t k=kbegin; k<kend; ++k ) {
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               (~lhs)(k,i,j) = op( (~src)(k,i,j), (~mat)(i,j) );
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized backend of the page broadcast of a dense matrix.
+// \ingroup dense_tensor
+//
+// \param lhs The target left-hand side dense tensor.
+// \param src The dense tensor operand (may be the target tensor itself).
+// \param mat The row-major dense matrix broadcast across the pages.
+// \param op The element-wise operation.
+// \param kbegin The first page to be processed.
+// \param kend The index one past the last page to be processed.
+// \return void
+//
+// This function implements the vectorized page broadcast kernel, which evaluates
+// \f$ A(k,i,j)=op(B(k,i,j),C(i,j)) \f$ for all pages in the range \f$[kbegin..kend)\f$. The
+// rows of the matrix are processed in cache-sized blocks, each of which is applied to all pages
+// of the range before the next block is loaded. Thus every element of the tensor is
+// streamed exactly once, whereas the matrix is read from memory only once per page range.
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the dense tensor operand
+        , typename MT    // Type of the broadcast dense matrix
+        , bool SO        // Storage order of the broadcast dense matrix
+        , typename OP >  // Type of the element-wise operation
+inline auto pageBroadcastRange( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& src
+                              , const DenseMatrix<MT,SO>& mat, OP op, size_t kbegin, size_t kend )
+   -> EnableIf_t< PageBroadcastHelper<TT1,TT2,MT,SO,OP>::value >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT1> >::size );
+   constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<TT2> || !IsPadded_v<MT> );
+
+   const size_t M( (~mat).rows()    );
+   const size_t N( (~mat).columns() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   const size_t jpos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const size_t block( pageBroadcastBlock< ElementType_t<MT> >( N ) );
+
+   for( size_t ii=0UL; ii<M; ii+=block )
+   {
+      const size_t iend( min( ii+block, M ) );
+
+      for( size_t k=kbegin; k<kend; ++k ) {
+         for( size_t i=ii; i<iend; ++i )
+         {
+            size_t j( 0UL );
+
+            for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+               (~lhs).store( k, i, j             ,
+                  op( (~src).load( k, i, j              ), (~mat).load( i, j              ) ) );
+               (~lhs).store( k, i, j+SIMDSIZE    ,
+                  op( (~src).load( k, i, j+SIMDSIZE     ), (~mat).load( i, j+SIMDSIZE     ) ) );
+               (~lhs).store( k, i, j+SIMDSIZE*2UL,
+                  op( (~src).load( k, i, j+SIMDSIZE*2UL ), (~mat).load( i, j+SIMDSIZE*2UL ) ) );
+               (~lhs).store( k, i, j+SIMDSIZE*3UL,
+                  op( (~src).load( k, i, j+SIMDSIZE*3UL ), (~mat).load( i, j+SIMDSIZE*3UL ) ) );
+            }
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               (~lhs).store( k, i, j, op( (~src).load( k, i, j ), (~mat).load( i, j ) ) );
+            }
+            for( ; remainder && j<N; ++j ) {
+               (~lhs)(k,i,j) = op( (~src)(k,i,j), (~mat)(i,j) );
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Broadcast of a dense matrix across the pages of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The target left-hand side dense tensor.
+// \param src The dense tensor operand (may be the target tensor itself).
+// \param mat The dense matrix broadcast across the pages.
+// \param op The element-wise operation.
+// \return void
+//
+// This function evaluates the given element-wise operation between all pages of the tensor
+// operand \a src and the dense matrix \a mat and stores the result in the target tensor \a lhs.
+// It is the common backend of the assignments of matrix expansions and of tensor-matrix Schur
+// products.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the dense tensor operand
+        , typename MT    // Type of the broadcast dense matrix
+        , bool SO        // Storage order of the broadcast dense matrix
+        , typename OP >  // Type of the element-wise operation
+inline void pageBroadcast( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& src
+                         , const DenseMatrix<MT,SO>& mat, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == (~src).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~src).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~src).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~mat).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~mat).columns(), "Invalid number of columns" );
+
+   pageBroadcastRange( ~lhs, ~src, ~mat, op, 0UL, (~lhs).pages() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP broadcast of a dense matrix across the pages of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The target left-hand side dense tensor.
+// \param src The dense tensor operand (may be the target tensor itself).
+// \param mat The dense matrix broadcast across the pages.
+// \param op The element-wise operation.
+// \return void
+//
+// This function is the parallel counterpart of the pageBroadcast() function. The pages of the
+// target tensor are split into contiguous ranges, one per task, such that every task streams
+// its own part of the tensor while sharing the read-only broadcast matrix. In case any of the
+// operands is not SMP assignable or in case no parallel execution is possible, the broadcast
+// is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the dense tensor operand
+        , typename MT    // Type of the broadcast dense matrix
+        , bool SO        // Storage order of the broadcast dense matrix
+        , typename OP >  // Type of the element-wise operation
+inline void smpPageBroadcast( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& src
+                            , const DenseMatrix<MT,SO>& mat, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == (~src).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~src).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~src).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~mat).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~mat).columns(), "Invalid number of columns" );
+
+   constexpr bool parallel( IsSMPAssignable_v<TT1> && IsSMPAssignable_v<TT2> &&
+                            IsSMPAssignable_v<MT> );
+
+   const size_t O    ( (~lhs).pages() );
+   const size_t tasks( ( parallel )?( min( smpTasks(), O ) ):( 1UL ) );
+
+   if( tasks < 2UL ) {
+      pageBroadcastRange( ~lhs, ~src, ~mat, op, 0UL, O );
+      return;
+   }
+
+   const size_t pagesPerTask( ( O + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t kbegin( t*pagesPerTask );
+      const size_t kend  ( min( kbegin+pagesPerTask, O ) );
+
+      if( kbegin < kend ) {
+         pageBroadcastRange( ~lhs, ~src, ~mat, op, kbegin, kend );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1253 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Permutation.h
+//  \brief Header file for the out-of-place permutation kernels for dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_PERMUTATION_H_
+#define _BLAZE_TENSOR_MATH_DENSE_PERMUTATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsTransExpr.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLOCKING PARAMETERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Edge length of the square cache blocks processed by the permutation kernels.
+// \ingroup dense_tensor
+//
+// The value must be a multiple of the size of all micro tiles (see PermutationTile).
+*/
+constexpr size_t PERMUTATION_BLOCK_SIZE = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the permutation kernels.
+// \ingroup dense_tensor
+//
+// In case the target tensor \a TT1 provides mutable and the source tensor \a TT2 provides
+// constant low-level data access and both tensors have the same element type, the variable
+// is set to \a true, otherwise it is \a false. Transposition expressions forward the data
+// access of their operand without reordering it and are therefore never used as source.
+*/
+template< typename TT1, typename TT2 >
+constexpr bool UsePermutationKernel_v =
+   ( HasMutableDataAccess_v<TT1> &&
+     HasConstDataAccess_v<TT2> && !IsTransExpr_v<TT2> &&
+     IsSame_v< ElementType_t<TT1>, ElementType_t<TT2> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO TILES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Square micro tile for the transposition of small matrix blocks.
+// \ingroup dense_tensor
+//
+// The PermutationTile class template transposes a \a size x \a size block of elements. The
+// general implementation performs an element-wise copy, specializations for the vectorizable
+// floating point types perform the transposition within SIMD registers.
+*/
+template< typename Type >  // Type of the elements
+struct PermutationTile
+{
+   //! Number of rows and columns of the micro tile.
+   static constexpr size_t size = 4UL;
+
+   //! Returns whether streaming stores can be used for the target block \a dst.
+   static inline bool canStream( const Type* dst, size_t ldd ) noexcept
+   {
+      MAYBE_UNUSED( dst, ldd );
+      return false;
+   }
+
+   //! Transposes the tile at \a src (row stride \a lds) into the tile at \a dst (row stride \a ldd).
+   static BLAZE_ALWAYS_INLINE void
+      transpose( Type* dst, size_t ldd, const Type* src, size_t lds, bool streaming )
+   {
+      MAYBE_UNUSED( streaming );
+
+      for( size_t i=0UL; i<size; ++i ) {
+         for( size_t j=0UL; j<size; ++j ) {
+            dst[j*ldd+i] = src[i*lds+j];
+         }
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_AVX_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the PermutationTile class template for 4x4 blocks of double values.
+// \ingroup dense_tensor
+*/
+template<>
+struct PermutationTile<double>
+{
+   static constexpr size_t size = 4UL;
+
+   static inline bool canStream( const double* dst, size_t ldd ) noexcept
+   {
+      return ( reinterpret_cast<std::uintptr_t>( dst ) % 32UL == 0UL ) && ( ldd % size == 0UL );
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( double* dst, __m256d value, bool streaming ) noexcept
+   {
+      if( streaming ) _mm256_stream_pd ( dst, value );
+      else            _mm256_storeu_pd( dst, value );
+   }
+
+   static BLAZE_ALWAYS_INLINE void
+      transpose( double* dst, size_t ldd, const double* src, size_t lds, bool streaming ) noexcept
+   {
+      const __m256d r0( _mm256_loadu_pd( src       ) );
+      const __m256d r1( _mm256_loadu_pd( src+  lds ) );
+      const __m256d r2( _mm256_loadu_pd( src+2*lds ) );
+      const __m256d r3( _mm256_loadu_pd( src+3*lds ) );
+
+      const __m256d t0( _mm256_unpacklo_pd( r0, r1 ) );
+      const __m256d t1( _mm256_unpackhi_pd( r0, r1 ) );
+      const __m256d t2( _mm256_unpacklo_pd( r2, r3 ) );
+      const __m256d t3( _mm256_unpackhi_pd( r2, r3 ) );
+
+      store( dst      , _mm256_permute2f128_pd( t0, t2, 0x20 ), streaming );
+      store( dst+  ldd, _mm256_permute2f128_pd( t1, t3, 0x20 ), streaming );
+      store( dst+2*ldd, _mm256_permute2f128_pd( t0, t2, 0x31 ), streaming );
+      store( dst+3*ldd, _mm256_permute2f128_pd( t1, t3, 0x31 ), streaming );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the PermutationTile class template for 8x8 blocks of float values.
+// \ingroup dense_tensor
+*/
+template<>
+struct PermutationTile<float>
+{
+   static constexpr size_t size = 8UL;
+
+   static inline bool canStream( const float* dst, size_t ldd ) noexcept
+   {
+      return ( reinterpret_cast<std::uintptr_t>( dst ) % 32UL == 0UL ) && ( ldd % size == 0UL );
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( float* dst, __m256 value, bool streaming ) noexcept
+   {
+      if( streaming ) _mm256_stream_ps ( dst, value );
+      else            _mm256_storeu_ps( dst, value );
+   }
+
+   static BLAZE_ALWAYS_INLINE void
+      transpose( float* dst, size_t ldd, const float* src, size_t lds, bool streaming ) noexcept
+   {
+      const __m256 r0( _mm256_loadu_ps( src       ) );
+      const __m256 r1( _mm256_loadu_ps( src+  lds ) );
+      const __m256 r2( _mm256_loadu_ps( src+2*lds ) );
+      const __m256 r3( _mm256_loadu_ps( src+3*lds ) );
+      const __m256 r4( _mm256_loadu_ps( src+4*lds ) );
+      const __m256 r5( _mm256_loadu_ps( src+5*lds ) );
+      const __m256 r6( _mm256_loadu_ps( src+6*lds ) );
+      const __m256 r7( _mm256_loadu_ps( src+7*lds ) );
+
+      const __m256 t0( _mm256_unpacklo_ps( r0, r1 ) );
+      const __m256 t1( _mm256_unpackhi_ps( r0, r1 ) );
+      const __m256 t2( _mm256_unpacklo_ps( r2, r3 ) );
+      const __m256 t3( _mm256_unpackhi_ps( r2, r3 ) );
+      const __m256 t4( _mm256_unpacklo_ps( r4, r5 ) );
+      const __m256 t5( _mm256_unpackhi_ps( r4, r5 ) );
+      const __m256 t6( _mm256_unpacklo_ps( r6, r7 ) );
+      const __m256 t7( _mm256_unpackhi_ps( r6, r7 ) );
+
+      const __m256 s0( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+      const __m256 s1( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+      const __m256 s2( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+      const __m256 s3( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+      const __m256 s4( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+      const __m256 s5( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+      const __m256 s6( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+      const __m256 s7( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+
+      store( dst      , _mm256_permute2f128_ps( s0, s4, 0x20 ), streaming );
+      store( dst+  ldd, _mm256_permute2f128_ps( s1, s5, 0x20 ), streaming );
+      store( dst+2*ldd, _mm256_permute2f128_ps( s2, s6, 0x20 ), streaming );
+      store( dst+3*ldd, _mm256_permute2f128_ps( s3, s7, 0x20 ), streaming );
+      store( dst+4*ldd, _mm256_permute2f128_ps( s0, s4, 0x31 ), streaming );
+      store( dst+5*ldd, _mm256_permute2f128_ps( s1, s5, 0x31 ), streaming );
+      store( dst+6*ldd, _mm256_permute2f128_ps( s2, s6, 0x31 ), streaming );
+      store( dst+7*ldd, _mm256_permute2f128_ps( s3, s7, 0x31 ), streaming );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#elif BLAZE_SSE2_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the PermutationTile class template for 2x2 blocks of double values.
+// \ingroup dense_tensor
+*/
+template<>
+struct PermutationTile<double>
+{
+   static constexpr size_t size = 2UL;
+
+   static inline bool canStream( const double* dst, size_t ldd ) noexcept
+   {
+      return ( reinterpret_cast<std::uintptr_t>( dst ) % 16UL == 0UL ) && ( ldd % size == 0UL );
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( double* dst, __m128d value, bool streaming ) noexcept
+   {
+      if( streaming ) _mm_stream_pd ( dst, value );
+      else            _mm_storeu_pd( dst, value );
+   }
+
+   static BLAZE_ALWAYS_INLINE void
+      transpose( double* dst, size_t ldd, const double* src, size_t lds, bool streaming ) noexcept
+   {
+      const __m128d r0( _mm_loadu_pd( src     ) );
+      const __m128d r1( _mm_loadu_pd( src+lds ) );
+
+      store( dst    , _mm_unpacklo_pd( r0, r1 ), streaming );
+      store( dst+ldd, _mm_unpackhi_pd( r0, r1 ), streaming );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the PermutationTile class template for 4x4 blocks of float values.
+// \ingroup dense_tensor
+*/
+template<>
+struct PermutationTile<float>
+{
+   static constexpr size_t size = 4UL;
+
+   static inline bool canStream( const float* dst, size_t ldd ) noexcept
+   {
+      return ( reinterpret_cast<std::uintptr_t>( dst ) % 16UL == 0UL ) && ( ldd % size == 0UL );
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( float* dst, __m128 value, bool streaming ) noexcept
+   {
+      if( streaming ) _mm_stream_ps ( dst, value );
+      else            _mm_storeu_ps( dst, value );
+   }
+
+   static BLAZE_ALWAYS_INLINE void
+      transpose( float* dst, size_t ldd, const float* src, size_t lds, bool streaming ) noexcept
+   {
+      __m128 r0( _mm_loadu_ps( src       ) );
+      __m128 r1( _mm_loadu_ps( src+  lds ) );
+      __m128 r2( _mm_loadu_ps( src+2*lds ) );
+      __m128 r3( _mm_loadu_ps( src+3*lds ) );
+
+      _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+      store( dst      , r0, streaming );
+      store( dst+  ldd, r1, streaming );
+      store( dst+2*ldd, r2, streaming );
+      store( dst+3*ldd, r3, streaming );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Validation of the given axis mapping of an \a N-dimensional transposition.
+// \ingroup dense_tensor
+//
+// \param indices Pointer to the first index of the axis mapping.
+// \param n The total number of indices.
+// \return The validated axis mapping.
+// \exception std::invalid_argument Invalid number of transposition indices.
+// \exception std::invalid_argument Invalid transposition indices.
+//
+// Axis \a d of the transposed tensor or array corresponds to axis \a indices[d] of the original
+// one, where axis 0 denotes the outermost dimension (e.g. the pages of a tensor).
+*/
+template< size_t N      // Number of dimensions
+        , typename T >  // Type of the mapping indices
+std::array<size_t,N> transpositionIndices( const T* indices, size_t n )
+{
+   if( n != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of transposition indices" );
+   }
+
+   std::array<size_t,N> perm;
+   std::array<bool,N> used{};
+
+   for( size_t d=0UL; d<N; ++d )
+   {
+      const size_t axis( static_cast<size_t>( indices[d] ) );
+
+      if( axis >= N || used[axis] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid transposition indices" );
+      }
+
+      used[axis] = true;
+      perm[d]    = axis;
+   }
+
+   return perm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-blocked transposition of a strided matrix block.
+// \ingroup dense_tensor
+//
+// \param dst Pointer to the first element of the \f$ n \times m \f$ target block.
+// \param ldd The row stride of the target block.
+// \param src Pointer to the first element of the \f$ m \times n \f$ source block.
+// \param lds The row stride of the source block.
+// \param m The number of rows of the source block.
+// \param n The number of columns of the source block.
+// \param streaming \a true in case streaming stores should be used for the target block.
+// \return void
+//
+// The block is traversed in square cache blocks of PERMUTATION_BLOCK_SIZE elements, each of
+// which is transposed by means of the micro tiles of the PermutationTile class template.
+*/
+template< typename Type >  // Type of the elements
+void permuteBlock( Type* dst, size_t ldd, const Type* src, size_t lds,
+                   size_t m, size_t n, bool streaming )
+{
+   using Tile = PermutationTile<Type>;
+
+   constexpr size_t TS( Tile::size );
+   constexpr size_t BS( PERMUTATION_BLOCK_SIZE );
+
+   static_assert( BS % TS == 0UL, "Invalid micro tile size detected" );
+
+   const bool stream( streaming && Tile::canStream( dst, ldd ) );
+
+   for( size_t ii=0UL; ii<m; ii+=BS )
+   {
+      const size_t iend( min( ii+BS, m ) );
+
+      for( size_t jj=0UL; jj<n; jj+=BS )
+      {
+         const size_t jend( min( jj+BS, n ) );
+
+         size_t i( ii );
+
+         for( ; (i+TS) <= iend; i+=TS )
+         {
+            size_t j( jj );
+
+            for( ; (j+TS) <= jend; j+=TS ) {
+               Tile::transpose( dst+j*ldd+i, ldd, src+i*lds+j, lds, stream );
+            }
+            for( ; j<jend; ++j ) {
+               for( size_t l=0UL; l<TS; ++l ) {
+                  dst[j*ldd+i+l] = src[(i+l)*lds+j];
+               }
+            }
+         }
+
+         for( ; i<iend; ++i ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               dst[j*ldd+i] = src[i*lds+j];
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the distance between two consecutive pages of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor with low-level data access.
+// \return The number of elements between the first elements of two consecutive pages.
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t pageSpacing( const DenseTensor<TT>& dt ) noexcept
+{
+   if( (~dt).pages() < 2UL )
+      return (~dt).rows() * (~dt).spacing();
+
+   return static_cast<size_t>( (~dt).data( 0UL, 1UL ) - (~dt).data( 0UL, 0UL ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the extent of the outermost loop of the permutation of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The dense tensor to be permuted.
+// \param indices The permutation of the page, row, and column axes.
+// \return The number of independent slices of the permutation.
+*/
+template< typename TT    // Type of the dense tensor
+        , typename IT >  // Type of the permutation indices
+inline size_t permutationExtent( const DenseTensor<TT>& dt, const IT& indices ) noexcept
+{
+   // The permutations 012, 021, and 201 are processed page-wise, the permutations 102, 120,
+   // and 210 row-wise with respect to the source tensor
+   return ( indices[0] == 0UL || ( indices[0] == 2UL && indices[1] == 0UL ) )
+          ? (~dt).pages()
+          : (~dt).rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the permutation into the given dense tensor should use streaming stores.
+// \ingroup dense_tensor
+//
+// \param dt The target dense tensor.
+// \return \a true in case the target tensor exceeds the cache, \a false if not.
+*/
+template< typename TT >  // Type of the dense tensor
+inline bool usePermutationStreaming( const DenseTensor<TT>& dt ) noexcept
+{
+   return useStreaming &&
+          ( (~dt).pages() * (~dt).rows() * (~dt).columns() >
+            ( cacheSize / ( sizeof( ElementType_t<TT> ) * 3UL ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Permutation of a range of slices of a dense tensor for a fixed axis mapping.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The source dense tensor.
+// \param begin The first slice of the source tensor to be permuted.
+// \param end The slice behind the last slice of the source tensor to be permuted.
+// \param streaming \a true in case streaming stores should be used for the target tensor.
+// \return void
+//
+// The template argument \a P encodes the axis mapping as \f$ 3 \cdot indices[0] + indices[1]
+// \f$, such that the kernel is selected at compile time. The two permutations that preserve the
+// column axis are reduced to contiguous row copies, the remaining four permutations to a sequence
+// of cache-blocked 2D transpositions of strided matrix blocks. The range \f$[begin..end)\f$
+// refers to the slices as defined by the permutationExtent() function.
+*/
+template< size_t P       // Code of the axis mapping
+        , typename TT1   // Type of the target dense tensor
+        , typename TT2 > // Type of the source dense tensor
+void permuteSlices( DenseTensor<TT1>& C, const DenseTensor<TT2>& A,
+                    size_t begin, size_t end, bool streaming )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t M( (~A).rows()    );
+   const size_t N( (~A).columns() );
+   const size_t O( (~A).pages()   );
+
+   const size_t rsA( (~A).spacing() );
+   const size_t psA( pageSpacing( ~A ) );
+   const size_t rsC( (~C).spacing() );
+   const size_t psC( pageSpacing( ~C ) );
+
+   switch( P )
+   {
+      // {0,1,2}: C(k,i,j) = A(k,i,j)
+      case 1UL:
+         for( size_t k=begin; k<end; ++k ) {
+            for( size_t i=0UL; i<M; ++i ) {
+               std::copy( (~A).data( i, k ), (~A).data( i, k )+N, (~C).data( i, k ) );
+            }
+         }
+         break;
+
+      // {0,2,1}: C(k,i,j) = A(k,j,i)
+      case 2UL:
+         for( size_t k=begin; k<end; ++k ) {
+            permuteBlock( (~C).data( 0UL, k ), rsC, (~A).data( 0UL, k ), rsA, M, N, streaming );
+         }
+         break;
+
+      // {1,0,2}: C(k,i,j) = A(i,k,j)
+      case 3UL:
+         for( size_t k=begin; k<end; ++k ) {
+            for( size_t i=0UL; i<O; ++i ) {
+               std::copy( (~A).data( k, i ), (~A).data( k, i )+N, (~C).data( i, k ) );
+            }
+         }
+         break;
+
+      // {1,2,0}: C(k,i,j) = A(j,k,i)
+      case 5UL:
+         for( size_t k=begin; k<end; ++k ) {
+            permuteBlock( (~C).data( 0UL, k ), rsC, (~A).data( k, 0UL ), psA, O, N, streaming );
+         }
+         break;
+
+      // {2,0,1}: C(k,i,j) = A(i,j,k)
+      case 6UL:
+         for( size_t i=begin; i<end; ++i ) {
+            permuteBlock( (~C).data( i, 0UL ), psC, (~A).data( 0UL, i ), rsA, M, N, streaming );
+         }
+         break;
+
+      // {2,1,0}: C(k,i,j) = A(j,i,k)
+      case 7UL:
+         for( size_t i=begin; i<end; ++i ) {
+            permuteBlock( (~C).data( i, 0UL ), psC, (~A).data( i, 0UL ), psA, O, N, streaming );
+         }
+         break;
+
+      default:
+         BLAZE_INTERNAL_ASSERT( false, "Invalid tensor permutation detected" );
+         break;
+   }
+
+#if BLAZE_SSE_MODE
+   if( streaming ) {
+      _mm_sfence();
+   }
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Permutation of a range of slices of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The source dense tensor.
+// \param indices The permutation of the page, row, and column axes.
+// \param begin The first slice of the source tensor to be permuted.
+// \param end The slice behind the last slice of the source tensor to be permuted.
+// \param streaming \a true in case streaming stores should be used for the target tensor.
+// \return void
+//
+// This function selects the kernel for the given runtime axis mapping (see permuteSlices()).
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the source dense tensor
+        , typename IT >  // Type of the permutation indices
+void permuteRange( DenseTensor<TT1>& C, const DenseTensor<TT2>& A, const IT& indices,
+                   size_t begin, size_t end, bool streaming )
+{
+   switch( indices[0]*3UL + indices[1] )
+   {
+      case 1UL: permuteSlices<1UL>( ~C, ~A, begin, end, streaming ); break;
+      case 2UL: permuteSlices<2UL>( ~C, ~A, begin, end, streaming ); break;
+      case 3UL: permuteSlices<3UL>( ~C, ~A, begin, end, streaming ); break;
+      case 5UL: permuteSlices<5UL>( ~C, ~A, begin, end, streaming ); break;
+      case 6UL: permuteSlices<6UL>( ~C, ~A, begin, end, streaming ); break;
+      case 7UL: permuteSlices<7UL>( ~C, ~A, begin, end, streaming ); break;
+
+      default:
+         BLAZE_INTERNAL_ASSERT( false, "Invalid tensor permutation detected" );
+         break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Permutation of a range of slices of a dense tensor for a compile time axis mapping.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The source dense tensor.
+// \param begin The first slice of the source tensor to be permuted.
+// \param end The slice behind the last slice of the source tensor to be permuted.
+// \param streaming \a true in case streaming stores should be used for the target tensor.
+// \return void
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the source dense tensor
+        , size_t O       // Mapping index for the page dimension
+        , size_t M       // Mapping index for the row dimension
+        , size_t N >     // Mapping index for the column dimension
+inline void permuteRange( DenseTensor<TT1>& C, const DenseTensor<TT2>& A,
+                          std::index_sequence<O,M,N>, size_t begin, size_t end, bool streaming )
+{
+   permuteSlices<O*3UL+M>( ~C, ~A, begin, end, streaming );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the extent of the outermost loop of a compile time tensor permutation.
+// \ingroup dense_tensor
+//
+// \param dt The dense tensor to be permuted.
+// \return The number of independent slices of the permutation.
+*/
+template< typename TT  // Type of the dense tensor
+        , size_t O     // Mapping index for the page dimension
+        , size_t M     // Mapping index for the row dimension
+        , size_t N >   // Mapping index for the column dimension
+inline size_t permutationExtent( const DenseTensor<TT>& dt, std::index_sequence<O,M,N> ) noexcept
+{
+   return ( O == 0UL || ( O == 2UL && M == 0UL ) ) ? (~dt).pages() : (~dt).rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the extent of the given axis of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The given dense tensor.
+// \param axis The axis (0 for the pages, 1 for the rows, and 2 for the columns).
+// \return The extent of the axis.
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t axisExtent( const DenseTensor<TT>& dt, size_t axis ) noexcept
+{
+   return ( axis == 0UL ) ? (~dt).pages() : ( axis == 1UL ) ? (~dt).rows() : (~dt).columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the axis mapping of a tensor permutation as an array.
+// \ingroup dense_tensor
+//
+// \param indices The permutation of the page, row, and column axes.
+// \return The axis mapping.
+*/
+template< typename IT >  // Type of the permutation indices
+inline std::array<size_t,3UL> permutationAxes( const IT& indices ) noexcept
+{
+   return {{ indices[0], indices[1], indices[2] }};
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the compile time axis mapping of a tensor permutation as an array.
+// \ingroup dense_tensor
+//
+// \return The axis mapping.
+*/
+template< size_t O     // Mapping index for the page dimension
+        , size_t M     // Mapping index for the row dimension
+        , size_t N >   // Mapping index for the column dimension
+inline constexpr std::array<size_t,3UL> permutationAxes( std::index_sequence<O,M,N> ) noexcept
+{
+   return {{ O, M, N }};
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PERMUTATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Out-of-place permutation of the axes of a dense tensor (\f$ C=trans(A,indices) \f$).
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The source dense tensor.
+// \param indices The permutation of the page, row, and column axes.
+// \return void
+//
+// This function assigns the permutation of the dense tensor \a A to the dense tensor \a C,
+// i.e. the axis \a d of \a C corresponds to the axis \a indices[d] of \a A. Both tensors
+// must provide low-level data access, have the same element type, and must not overlap in
+// memory. Large targets are written by means of streaming stores.
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the source dense tensor
+        , typename IT >  // Type of the permutation indices
+inline void permute( DenseTensor<TT1>& C, const DenseTensor<TT2>& A, const IT& indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~C).pages()   == axisExtent( ~A, permutationAxes( indices )[0] ), "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == axisExtent( ~A, permutationAxes( indices )[1] ), "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == axisExtent( ~A, permutationAxes( indices )[2] ), "Invalid number of columns" );
+
+   permuteRange( ~C, ~A, indices, 0UL, permutationExtent( ~A, indices ),
+                 usePermutationStreaming( ~C ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel out-of-place permutation of the axes of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The source dense tensor.
+// \param indices The permutation of the page, row, and column axes.
+// \return void
+//
+// This function is the SMP counterpart of the permute() function. The independent slices of
+// the permutation are distributed in contiguous ranges among the available threads.
+*/
+template< typename TT1   // Type of the target dense tensor
+        , typename TT2   // Type of the source dense tensor
+        , typename IT >  // Type of the permutation indices
+void smpPermute( DenseTensor<TT1>& C, const DenseTensor<TT2>& A, const IT& indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t extent( permutationExtent( ~A, indices ) );
+   const size_t tasks ( min( smpTasks(), extent ) );
+
+   if( tasks < 2UL ) {
+      permute( ~C, ~A, indices );
+      return;
+   }
+
+   const bool streaming( usePermutationStreaming( ~C ) );
+   const size_t slices( ( extent + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( t*slices );
+      const size_t end  ( min( begin+slices, extent ) );
+
+      if( begin < end ) {
+         permuteRange( ~C, ~A, indices, begin, end, streaming );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY PERMUTATION PLANS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution plan for the out-of-place permutation of the axes of a dense array.
+// \ingroup dense_array
+//
+// The plan describes the permutation as a loop nest over \a rank merged axes in the order of
+// the target array. Consecutive target axes that are also consecutive in the source array are
+// merged into a single axis and axes of extent 1 are dropped. The innermost merged axis is
+// always contiguous in the target array. In case the source array is contiguous along another
+// axis (\a inner), each iteration of the outer loops transposes a 2D block by means of the
+// vectorized micro tiles of the permuteBlock() function, otherwise it copies a row.
+*/
+template< size_t N >  // Number of dimensions
+struct ArrayPermutationPlan
+{
+   size_t rank;                //!< The number of merged axes.
+   size_t inner;               //!< The merged axis along which the source is contiguous.
+   std::array<size_t,N> size;  //!< The extents of the merged axes.
+   std::array<size_t,N> lda;   //!< The source strides of the merged axes.
+   std::array<size_t,N> ldc;   //!< The target strides of the merged axes.
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the plan transposes 2D blocks.
+   //
+   // \return \a true in case the innermost loop is a 2D transposition, \a false if not.
+   */
+   inline bool transposes() const noexcept {
+      return inner+1UL < rank && lda[inner] == 1UL && ldc[rank-1UL] == 1UL;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the number of independent iterations of the outer loops.
+   //
+   // \return The number of 2D blocks or rows processed by the plan.
+   */
+   inline size_t outer() const noexcept {
+      size_t count( 1UL );
+      for( size_t d=0UL; d+1UL<rank; ++d ) {
+         if( !transposes() || d != inner ) count *= size[d];
+      }
+      return count;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the total number of elements moved by the plan.
+   //
+   // \return The number of elements of the target array.
+   */
+   inline size_t elements() const noexcept {
+      return outer() * size[rank-1UL] * ( transposes() ? size[inner] : 1UL );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the strides of the axes (outermost first) of a row-major dense array.
+// \ingroup dense_array
+//
+// \param dims The extents of the axes (outermost first).
+// \param spacing The padded length of the innermost axis.
+// \return The strides of the axes.
+*/
+template< size_t N >  // Number of dimensions
+std::array<size_t,N> arrayStrides( const std::array<size_t,N>& dims, size_t spacing ) noexcept
+{
+   std::array<size_t,N> strides;
+
+   strides[N-1UL] = 1UL;
+
+   for( size_t d=N-1UL; d-->0UL; ) {
+      strides[d] = ( d+2UL == N ) ? spacing : strides[d+1UL]*dims[d+1UL];
+   }
+
+   return strides;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the execution plan for the permutation of the axes of a dense array.
+// \ingroup dense_array
+//
+// \param dims The extents of the source axes (outermost first).
+// \param spacingA The padded length of the innermost axis of the source array.
+// \param spacingC The padded length of the innermost axis of the target array.
+// \param perm The axis mapping: target axis \a d corresponds to source axis \a perm[d].
+// \return The execution plan.
+*/
+template< size_t N >  // Number of dimensions
+ArrayPermutationPlan<N>
+   arrayPermutationPlan( const std::array<size_t,N>& dims, size_t spacingA, size_t spacingC,
+                         const std::array<size_t,N>& perm ) noexcept
+{
+   std::array<size_t,N> tdims;
+   for( size_t d=0UL; d<N; ++d ) {
+      tdims[d] = dims[perm[d]];
+   }
+
+   const std::array<size_t,N> sa( arrayStrides( dims , spacingA ) );
+   const std::array<size_t,N> sc( arrayStrides( tdims, spacingC ) );
+
+   ArrayPermutationPlan<N> plan;
+   plan.rank = 0UL;
+
+   for( size_t d=0UL; d<N; ++d )
+   {
+      if( tdims[d] == 1UL )
+         continue;
+
+      const size_t r( plan.rank );
+
+      if( r > 0UL && plan.lda[r-1UL] == sa[perm[d]]*tdims[d] &&
+                     plan.ldc[r-1UL] == sc[d]*tdims[d] ) {
+         plan.size[r-1UL] *= tdims[d];
+         plan.lda [r-1UL]  = sa[perm[d]];
+         plan.ldc [r-1UL]  = sc[d];
+         continue;
+      }
+
+      plan.size[r] = tdims[d];
+      plan.lda [r] = sa[perm[d]];
+      plan.ldc [r] = sc[d];
+      ++plan.rank;
+   }
+
+   if( plan.rank == 0UL ) {
+      plan.size[0] = plan.lda[0] = plan.ldc[0] = 1UL;
+      plan.rank = 1UL;
+   }
+
+   plan.inner = plan.rank-1UL;
+   for( size_t r=0UL; r<plan.rank; ++r ) {
+      if( plan.lda[r] == 1UL ) plan.inner = r;
+   }
+
+   return plan;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given array permutation plan should use streaming stores.
+// \ingroup dense_array
+//
+// \param plan The execution plan.
+// \return \a true in case the target array exceeds the cache, \a false if not.
+*/
+template< typename Type  // Type of the elements
+        , size_t N >     // Number of dimensions
+inline bool usePermutationStreaming( const ArrayPermutationPlan<N>& plan ) noexcept
+{
+   return useStreaming && ( plan.elements() > ( cacheSize / ( sizeof( Type ) * 3UL ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY PERMUTATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes a range of the outer iterations of an array permutation plan.
+// \ingroup dense_array
+//
+// \param C Pointer to the first element of the target array.
+// \param A Pointer to the first element of the source array.
+// \param plan The execution plan.
+// \param begin The first outer iteration.
+// \param end The outer iteration behind the last iteration to be executed.
+// \param splits The number of parts the innermost loop of each outer iteration is split into.
+// \param streaming \a true in case streaming stores should be used for the target array.
+// \return void
+//
+// Each of the units in the range \f$[begin..end)\f$ refers to one part of an outer iteration.
+// Splitting the innermost loop allows the parallelization of plans with few outer iterations.
+*/
+template< typename Type  // Type of the elements
+        , size_t N >     // Number of dimensions
+void permuteArrayRange( Type* C, const Type* A, const ArrayPermutationPlan<N>& plan,
+                        size_t begin, size_t end, size_t splits, bool streaming )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t R( plan.rank );
+   const size_t J( R-1UL );
+   const bool transposes( plan.transposes() );
+
+   const size_t rows ( plan.size[J] );
+   const size_t chunk( ( rows + splits - 1UL ) / splits );
+
+   std::array<size_t,N> idx;
+   size_t unit( begin / splits );
+
+   for( size_t d=J; d-->0UL; ) {
+      if( transposes && d == plan.inner ) {
+         idx[d] = 0UL;
+         continue;
+      }
+      idx[d] = unit % plan.size[d];
+      unit  /= plan.size[d];
+   }
+
+   for( size_t u=begin; u<end; ++u )
+   {
+      const size_t part( u % splits );
+      const size_t i0( min( part*chunk, rows ) );
+      const size_t i1( min( i0+chunk, rows ) );
+
+      size_t offA( i0*plan.lda[J] );
+      size_t offC( i0*plan.ldc[J] );
+
+      for( size_t d=0UL; d<J; ++d ) {
+         offA += idx[d]*plan.lda[d];
+         offC += idx[d]*plan.ldc[d];
+      }
+
+      if( transposes ) {
+         permuteBlock( C+offC, plan.ldc[plan.inner], A+offA, plan.lda[J],
+                       i1-i0, plan.size[plan.inner], streaming );
+      }
+      else if( plan.lda[J] == 1UL && plan.ldc[J] == 1UL ) {
+         std::copy( A+offA, A+offA+( i1-i0 ), C+offC );
+      }
+      else {
+         for( size_t i=i0; i<i1; ++i ) {
+            C[offC] = A[offA];
+            offA += plan.lda[J];
+            offC += plan.ldc[J];
+         }
+      }
+
+      if( part+1UL < splits )
+         continue;
+
+      for( size_t d=J; d-->0UL; ) {
+         if( transposes && d == plan.inner )
+            continue;
+         if( ++idx[d] < plan.size[d] )
+            break;
+         idx[d] = 0UL;
+      }
+   }
+
+#if BLAZE_SSE_MODE
+   if( streaming ) {
+      _mm_sfence();
+   }
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARRAY PERMUTATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the execution plan for the permutation of the given dense array.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The source dense array.
+// \param perm The axis mapping (outermost axis first).
+// \return The execution plan.
+*/
+template< typename AT1   // Type of the target dense array
+        , typename AT2   // Type of the source dense array
+        , size_t N >     // Number of dimensions
+ArrayPermutationPlan<N>
+   arrayPermutationPlan( const DenseArray<AT1>& C, const DenseArray<AT2>& A,
+                         const std::array<size_t,N>& perm ) noexcept
+{
+   std::array<size_t,N> dims;
+   for( size_t d=0UL; d<N; ++d ) {
+      dims[d] = (~A).dimensions()[N-1UL-d];
+   }
+
+   return arrayPermutationPlan( dims, (~A).spacing(), (~C).spacing(), perm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Out-of-place permutation of the axes of a dense array (\f$ C=trans(A,perm) \f$).
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The source dense array.
+// \param perm The axis mapping: axis \a d of \a C corresponds to axis \a perm[d] of \a A,
+//             where axis 0 denotes the outermost dimension.
+// \return void
+//
+// Both arrays must provide low-level data access, have the same element type, and must not
+// overlap in memory. Large targets are written by means of streaming stores.
+*/
+template< typename AT1   // Type of the target dense array
+        , typename AT2   // Type of the source dense array
+        , size_t N >     // Number of dimensions
+void permuteArray( DenseArray<AT1>& C, const DenseArray<AT2>& A,
+                   const std::array<size_t,N>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const ArrayPermutationPlan<N> plan( arrayPermutationPlan( ~C, ~A, perm ) );
+
+   permuteArrayRange( (~C).data(), (~A).data(), plan, 0UL, plan.outer(), 1UL,
+                      usePermutationStreaming<ElementType_t<AT1>>( plan ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel out-of-place permutation of the axes of a dense array.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The source dense array.
+// \param perm The axis mapping (outermost axis first).
+// \return void
+//
+// This function is the SMP counterpart of the permuteArray() function. The outer iterations of
+// the execution plan are distributed in contiguous ranges among the available threads. In case
+// there are fewer outer iterations than threads, the innermost loop is split in addition.
+*/
+template< typename AT1   // Type of the target dense array
+        , typename AT2   // Type of the source dense array
+        , size_t N >     // Number of dimensions
+void smpPermuteArray( DenseArray<AT1>& C, const DenseArray<AT2>& A,
+                      const std::array<size_t,N>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const ArrayPermutationPlan<N> plan( arrayPermutationPlan( ~C, ~A, perm ) );
+
+   const size_t outer( plan.outer() );
+   const size_t rows ( plan.size[plan.rank-1UL] );
+
+   const size_t splits( outer < smpTasks()
+                        ? min( ( smpTasks() + outer - 1UL ) / outer, rows )
+                        : 1UL );
+   const size_t units ( outer * splits );
+   const size_t tasks ( min( smpTasks(), units ) );
+
+   const bool streaming( usePermutationStreaming<ElementType_t<AT1>>( plan ) );
+
+   const size_t share( ( units + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( min( t*share, units ) );
+      const size_t end  ( min( begin+share, units ) );
+
+      if( begin < end ) {
+         permuteArrayRange( (~C).data(), (~A).data(), plan, begin, end, splits, streaming );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,556 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Reshape.h
+//  \brief Header file for the reshape functions of dense vectors, matrices, tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_RESHAPE_H_
+#define _BLAZE_TENSOR_MATH_DENSE_RESHAPE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/dense/CustomArray.h>
+#include <blaze_tensor/math/dense/CustomTensor.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RESHAPE VIEW TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the view type of a reshape operation.
+// \ingroup dense
+//
+// The ReshapeViewType class template selects the custom data structure used to represent an
+// \a N-dimensional view on contiguously stored elements of type \a ET: a row vector for
+// \a N == 1, a row-major matrix for \a N == 2, a tensor for \a N == 3, and an array for all
+// higher dimensionalities. None of the views makes any assumption about the alignment or
+// padding of the viewed elements.
+*/
+template< size_t N       // Dimensionality of the view
+        , typename ET >  // Element type of the view
+struct ReshapeViewType
+{
+   using Type = CustomArray<N,ET,unaligned,unpadded>;
+};
+
+template< typename ET >  // Element type of the view
+struct ReshapeViewType<1UL,ET>
+{
+   using Type = CustomVector<ET,unaligned,unpadded,rowVector>;
+};
+
+template< typename ET >  // Element type of the view
+struct ReshapeViewType<2UL,ET>
+{
+   using Type = CustomMatrix<ET,unaligned,unpadded,rowMajor>;
+};
+
+template< typename ET >  // Element type of the view
+struct ReshapeViewType<3UL,ET>
+{
+   using Type = CustomTensor<ET,unaligned,unpadded>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the ReshapeViewType class template.
+// \ingroup dense
+*/
+template< size_t N, typename ET >
+using ReshapeViewType_t = typename ReshapeViewType<N,ET>::Type;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RESHAPE UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an \a N-dimensional view on the given contiguously stored elements.
+// \ingroup dense
+//
+// \param ptr Pointer to the first of the contiguously stored elements.
+// \param size The total number of elements.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return The \a N-dimensional view on the given elements.
+// \exception std::invalid_argument Invalid reshape dimensions.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename ET         // Element type of the view
+        , typename... Dims >  // Types of the dimension arguments
+inline ReshapeViewType_t<N,ET> reshapeView( ET* ptr, size_t size, Dims... dims )
+{
+   BLAZE_STATIC_ASSERT_MSG( N > 0UL, "Invalid number of dimensions" );
+   BLAZE_STATIC_ASSERT_MSG( sizeof...( Dims ) == N, "Invalid number of dimensions" );
+
+   const size_t extents[] = { static_cast<size_t>( dims )... };
+
+   size_t total( 1UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      total *= extents[i];
+   }
+
+   if( total != size ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape dimensions" );
+   }
+
+   return ReshapeViewType_t<N,ET>( ptr, static_cast<size_t>( dims )... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the elements of the given row-major dense matrix are stored contiguously.
+// \ingroup dense
+//
+// \param dm The dense matrix to be checked.
+// \return \a true in case the rows of the matrix are not padded, \a false if they are.
+*/
+template< typename MT >  // Type of the dense matrix
+inline bool isContiguousStorage( const DenseMatrix<MT,rowMajor>& dm ) noexcept
+{
+   return ( (~dm).rows() <= 1UL || (~dm).spacing() == (~dm).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the elements of the given dense tensor are stored contiguously.
+// \ingroup dense
+//
+// \param dt The dense tensor to be checked.
+// \return \a true in case the rows of the tensor are not padded, \a false if they are.
+*/
+template< typename TT >  // Type of the dense tensor
+inline bool isContiguousStorage( const DenseTensor<TT>& dt ) noexcept
+{
+   return ( (~dt).pages() * (~dt).rows() <= 1UL || (~dt).spacing() == (~dt).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the elements of the given dense array are stored contiguously.
+// \ingroup dense
+//
+// \param da The dense array to be checked.
+// \return \a true in case the rows of the array are not padded, \a false if they are.
+*/
+template< typename AT >  // Type of the dense array
+inline bool isContiguousStorage( const DenseArray<AT>& da ) noexcept
+{
+   const auto& dims( (~da).dimensions() );
+
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<dims.size(); ++d ) {
+      rows *= dims[d];
+   }
+
+   return ( rows <= 1UL || (~da).spacing() == dims[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of elements of the given dense array.
+// \ingroup dense
+//
+// \param da The dense array.
+// \return The total number of elements of the array.
+*/
+template< typename AT >  // Type of the dense array
+inline size_t totalSize( const DenseArray<AT>& da ) noexcept
+{
+   size_t total( 1UL );
+   for( size_t dim : (~da).dimensions() ) {
+      total *= dim;
+   }
+   return total;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RESHAPE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating an \a N-dimensional view on the elements of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The dense vector to be reshaped.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return View on the elements of the vector with the given dimensions.
+// \exception std::invalid_argument Invalid reshape dimensions.
+//
+// This function returns a custom data structure that directly refers to the elements of the
+// given dense vector, i.e. no element is copied. For \a N == 1 the result is a CustomVector,
+// for \a N == 2 a row-major CustomMatrix, for \a N == 3 a CustomTensor and for all higher
+// dimensionalities a CustomArray:
+
+   \code
+   blaze::DynamicVector<double> v( 24UL );
+   // ... Initialization
+
+   auto A = blaze::reshape<2>( v, 4UL, 6UL );       // 4x6 matrix view on 'v'
+   auto T = blaze::reshape<3>( v, 2UL, 3UL, 4UL );  // 2x3x4 tensor view on 'v'
+   \endcode
+
+// The product of the given dimensions must match the size of the vector. In case it doesn't,
+// a \a std::invalid_argument exception is thrown. Note that the view does not extend the
+// lifetime of the vector and is invalidated by any operation that reallocates its elements.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename VT         // Type of the dense vector
+        , bool TF             // Transpose flag
+        , typename... Dims >  // Types of the dimension arguments
+inline auto reshape( DenseVector<VT,TF>& dv, Dims... dims )
+   -> EnableIf_t< HasMutableDataAccess_v<VT> && IsContiguous_v<VT>
+                , ReshapeViewType_t< N, ElementType_t<VT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reshapeView<N>( (~dv).data(), (~dv).size(), dims... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an \a N-dimensional view on the elements of the given constant dense vector.
+// \ingroup dense_vector
+//
+// \param dv The dense vector to be reshaped.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return View on the elements of the vector with the given dimensions.
+// \exception std::invalid_argument Invalid reshape dimensions.
+//
+// This function returns a custom data structure that directly refers to the elements of the
+// given dense vector. In contrast to the view on a non-constant vector, the elements cannot
+// be modified via the returned view.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename VT         // Type of the dense vector
+        , bool TF             // Transpose flag
+        , typename... Dims >  // Types of the dimension arguments
+inline auto reshape( const DenseVector<VT,TF>& dv, Dims... dims )
+   -> EnableIf_t< HasConstDataAccess_v<VT> && IsContiguous_v<VT>
+                , ReshapeViewType_t< N, const ElementType_t<VT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reshapeView<N>( (~dv).data(), (~dv).size(), dims... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an \a N-dimensional view on the elements of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be reshaped.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return View on the elements of the matrix with the given dimensions.
+// \exception std::invalid_argument Invalid reshape of non-contiguous matrix.
+// \exception std::invalid_argument Invalid reshape dimensions.
+//
+// This function returns a custom data structure that directly refers to the elements of the
+// given row-major dense matrix, i.e. no element is copied. The elements are viewed in row-major
+// order, i.e. \c reshape<1>( A, A.rows()*A.columns() ) is a zero-copy ravel of \a A:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 8UL );
+   // ... Initialization
+
+   auto v = blaze::reshape<1>( A, 32UL );            // Flat vector view on 'A'
+   auto T = blaze::reshape<3>( A, 2UL, 2UL, 8UL );   // 2x2x8 tensor view on 'A'
+   \endcode
+
+// A view can only be created in case the rows of the matrix are stored without padding, i.e.
+// in case the spacing of the matrix equals its number of columns. In case the rows are padded
+// or the product of the given dimensions doesn't match the number of matrix elements, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename MT         // Type of the dense matrix
+        , typename... Dims >  // Types of the dimension arguments
+inline auto reshape( DenseMatrix<MT,rowMajor>& dm, Dims... dims )
+   -> EnableIf_t< HasMutableDataAccess_v<MT>, ReshapeViewType_t< N, ElementType_t<MT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isContiguousStorage( ~dm ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape of non-contiguous matrix" );
+   }
+
+   return reshapeView<N>( (~dm).data(), (~dm).rows() * (~dm).columns(), dims... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an \a N-dimensional view on the elements of the given constant row-major
+//        dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be reshaped.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return View on the elements of the matrix with the given dimensions.
+// \exception std::invalid_argument Invalid reshape of non-contiguous matrix.
+// \exception std::invalid_argument Invalid reshape dimensions.
+//
+// This function returns a custom data structure that directly refers to the elements of the
+// given row-major dense matrix. In contrast to the view on a non-constant matrix, the elements
+// cannot be modified via the returned view.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename MT         // Type of the dense matrix
+        , typename... Dims >  // Types of the dimension arguments
+inline auto reshape( const DenseMatrix<MT,rowMajor>& dm, Dims... dims )
+   -> EnableIf_t< HasConstDataAccess_v<MT>, ReshapeViewType_t< N, const ElementType_t<MT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isContiguousStorage( ~dm ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape of non-contiguous matrix" );
+   }
+
+   return reshapeView<N>( (~dm).data(), (~dm).rows() * (~dm).columns(), dims... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an \a N-dimensional view on the elements of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The dense tensor to be reshaped.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return View on the elements of the tensor with the given dimensions.
+// \exception std::invalid_argument Invalid reshape of non-contiguous tensor.
+// \exception std::invalid_argument Invalid reshape dimensions.
+//
+// This function returns a custom data structure that directly refers to the elements of the
+// given dense tensor, i.e. no element is copied:
+
+   \code
+   blaze::DynamicTensor<double> T( 2UL, 3UL, 8UL );
+   // ... Initialization
+
+   auto v = blaze::reshape<1>( T, 48UL );       // Flat vector view on 'T'
+   auto A = blaze::reshape<2>( T, 6UL, 8UL );   // 6x8 matrix view on 'T'
+   \endcode
+
+// A view can only be created for tensors owning their elements (i.e. not for views) and only
+// in case the rows of the tensor are stored without padding. In case the rows are padded or
+// the product of the given dimensions doesn't match the number of tensor elements, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename TT         // Type of the dense tensor
+        , typename... Dims >  // Types of the dimension arguments
+inline auto reshape( DenseTensor<TT>& dt, Dims... dims )
+   -> EnableIf_t< HasMutableDataAccess_v<TT> && !IsView_v<TT>
+                , ReshapeViewType_t< N, ElementType_t<TT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isContiguousStorage( ~dt ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape of non-contiguous tensor" );
+   }
+
+   return reshapeView<N>( (~dt).data(), (~dt).pages() * (~dt).rows() * (~dt).columns(), dims... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an \a N-dimensional view on the elements of the given constant dense tensor.
+// \ingroup dense_tensor
+//
+// \param dt The dense tensor to be reshaped.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return View on the elements of the tensor with the given dimensions.
+// \exception std::invalid_argument Invalid reshape of non-contiguous tensor.
+// \exception std::invalid_argument Invalid reshape dimensions.
+//
+// This function returns a custom data structure that directly refers to the elements of the
+// given dense tensor. In contrast to the view on a non-constant tensor, the elements cannot be
+// modified via the returned view.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename TT         // Type of the dense tensor
+        , typename... Dims >  // Types of the dimension arguments
+inline auto reshape( const DenseTensor<TT>& dt, Dims... dims )
+   -> EnableIf_t< HasConstDataAccess_v<TT> && !IsView_v<TT>
+                , ReshapeViewType_t< N, const ElementType_t<TT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isContiguousStorage( ~dt ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape of non-contiguous tensor" );
+   }
+
+   return reshapeView<N>( (~dt).data(), (~dt).pages() * (~dt).rows() * (~dt).columns(), dims... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an \a N-dimensional view on the elements of the given dense array.
+// \ingroup dense_array
+//
+// \param da The dense array to be reshaped.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return View on the elements of the array with the given dimensions.
+// \exception std::invalid_argument Invalid reshape of non-contiguous array.
+// \exception std::invalid_argument Invalid reshape dimensions.
+//
+// This function returns a custom data structure that directly refers to the elements of the
+// given dense array, i.e. no element is copied:
+
+   \code
+   blaze::DynamicArray<4,double> A( 2UL, 3UL, 4UL, 8UL );
+   // ... Initialization
+
+   auto v = blaze::reshape<1>( A, 192UL );           // Flat vector view on 'A'
+   auto T = blaze::reshape<3>( A, 6UL, 4UL, 8UL );   // 6x4x8 tensor view on 'A'
+   \endcode
+
+// A view can only be created for arrays owning their elements (i.e. not for views) and only
+// in case the rows of the array are stored without padding. In case the rows are padded or
+// the product of the given dimensions doesn't match the number of array elements, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename AT         // Type of the dense array
+        , typename... Dims >  // Types of the dimension arguments
+inline auto reshape( DenseArray<AT>& da, Dims... dims )
+   -> EnableIf_t< HasMutableDataAccess_v<AT> && !IsView_v<AT>
+                , ReshapeViewType_t< N, ElementType_t<AT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isContiguousStorage( ~da ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape of non-contiguous array" );
+   }
+
+   return reshapeView<N>( (~da).data(), totalSize( ~da ), dims... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an \a N-dimensional view on the elements of the given constant dense array.
+// \ingroup dense_array
+//
+// \param da The dense array to be reshaped.
+// \param dims The dimensions of the resulting view (from the outermost to the innermost).
+// \return View on the elements of the array with the given dimensions.
+// \exception std::invalid_argument Invalid reshape of non-contiguous array.
+// \exception std::invalid_argument Invalid reshape dimensions.
+//
+// This function returns a custom data structure that directly refers to the elements of the
+// given dense array. In contrast to the view on a non-constant array, the elements cannot be
+// modified via the returned view.
+*/
+template< size_t N            // Dimensionality of the view
+        , typename AT         // Type of the dense array
+        , typename... Dims >  // Types of the dimension arguments
+inline auto reshape( const DenseArray<AT>& da, Dims... dims )
+   -> EnableIf_t< HasConstDataAccess_v<AT> && !IsView_v<AT>
+                , ReshapeViewType_t< N, const ElementType_t<AT> > >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isContiguousStorage( ~da ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid reshape of non-contiguous array" );
+   }
+
+   return reshapeView<N>( (~da).data(), totalSize( ~da ), dims... );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
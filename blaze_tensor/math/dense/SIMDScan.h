@@ -0,0 +1,404 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/SIMDScan.h
+//  \brief Header file for the in-register SIMD prefix scan functions
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_SIMDSCAN_H_
+#define _BLAZE_TENSOR_MATH_DENSE_SIMDSCAN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SCAN UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the identity element of an addition scan.
+// \ingroup simd
+*/
+template< typename T >  // Type of the elements
+constexpr T scanIdentity( Add ) noexcept
+{
+   return T( 0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the identity element of a multiplication scan.
+// \ingroup simd
+*/
+template< typename T >  // Type of the elements
+constexpr T scanIdentity( Mult ) noexcept
+{
+   return T( 1 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the availability of the in-register SIMD scan.
+// \ingroup simd
+//
+// The in-register scan (see simdScan()) is available for additions and multiplications of single
+// and double precision values in case SSE2, AVX, or AVX-512 is enabled.
+*/
+template< typename T     // Type of the elements
+        , typename OP >  // Type of the scan operation
+constexpr bool HasSIMDScan_v =
+   ( ( IsSame_v<OP,Add> || IsSame_v<OP,Mult> ) &&
+     ( IsSame_v<T,float> || IsSame_v<T,double> ) &&
+     ( BLAZE_SSE2_MODE || BLAZE_AVX_MODE || BLAZE_AVX512F_MODE ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the last element of a SIMD element.
+// \ingroup simd
+//
+// \param value The given SIMD element.
+// \return The element with the highest index.
+*/
+template< typename Type     // Type of the elements
+        , typename SIMDT >  // Type of the SIMD element
+BLAZE_ALWAYS_INLINE Type simdLast( const SIMDT& value ) noexcept
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   alignas( AlignmentOf_v<Type> ) Type buffer[SIMDSIZE];
+
+   storea( buffer, value );
+
+   return buffer[SIMDSIZE-1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  IN-REGISTER SCAN FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_AVX512F_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inclusive prefix scan of the double precision values of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element \f$ (a_0,...,a_7) \f$.
+// \param op The scan operation (\a blaze::Add or \a blaze::Mult).
+// \return The SIMD element \f$ (a_0,a_0 \circ a_1,...,a_0 \circ ... \circ a_7) \f$.
+//
+// The scan is computed in three steps, each of which combines the element with a copy that is
+// shifted by 1, 2, and 4 elements, respectively, and filled with the identity of \a op.
+*/
+template< typename OP >  // Type of the scan operation
+BLAZE_ALWAYS_INLINE const SIMDdouble simdScan( const SIMDdouble& a, OP op ) noexcept
+{
+   const __m512d id( _mm512_set1_pd( scanIdentity<double>( op ) ) );
+
+   SIMDdouble x( a );
+   x = op( x, SIMDdouble( _mm512_mask_permutexvar_pd(
+          id, 0xFE, _mm512_set_epi64( 6, 5, 4, 3, 2, 1, 0, 0 ), x.value ) ) );
+   x = op( x, SIMDdouble( _mm512_mask_permutexvar_pd(
+          id, 0xFC, _mm512_set_epi64( 5, 4, 3, 2, 1, 0, 0, 0 ), x.value ) ) );
+   x = op( x, SIMDdouble( _mm512_mask_permutexvar_pd(
+          id, 0xF0, _mm512_set_epi64( 3, 2, 1, 0, 0, 0, 0, 0 ), x.value ) ) );
+   return x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inclusive prefix scan of the single precision values of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element \f$ (a_0,...,a_{15}) \f$.
+// \param op The scan operation (\a blaze::Add or \a blaze::Mult).
+// \return The SIMD element \f$ (a_0,a_0 \circ a_1,...,a_0 \circ ... \circ a_{15}) \f$.
+*/
+template< typename OP >  // Type of the scan operation
+BLAZE_ALWAYS_INLINE const SIMDfloat simdScan( const SIMDfloat& a, OP op ) noexcept
+{
+   const __m512 id( _mm512_set1_ps( scanIdentity<float>( op ) ) );
+
+   SIMDfloat x( a );
+   x = op( x, SIMDfloat( _mm512_mask_permutexvar_ps( id, 0xFFFE,
+          _mm512_set_epi32( 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0 ), x.value ) ) );
+   x = op( x, SIMDfloat( _mm512_mask_permutexvar_ps( id, 0xFFFC,
+          _mm512_set_epi32( 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0, 0 ), x.value ) ) );
+   x = op( x, SIMDfloat( _mm512_mask_permutexvar_ps( id, 0xFFF0,
+          _mm512_set_epi32( 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0, 0, 0, 0 ), x.value ) ) );
+   x = op( x, SIMDfloat( _mm512_mask_permutexvar_ps( id, 0xFF00,
+          _mm512_set_epi32( 7, 6, 5, 4, 3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0 ), x.value ) ) );
+   return x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Broadcast of the last double precision value of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element.
+// \return The SIMD element containing the last element of \a a in all elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdBroadcastLast( const SIMDdouble& a ) noexcept
+{
+   return _mm512_permutexvar_pd( _mm512_set1_epi64( 7 ), a.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Broadcast of the last single precision value of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element.
+// \return The SIMD element containing the last element of \a a in all elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdBroadcastLast( const SIMDfloat& a ) noexcept
+{
+   return _mm512_permutexvar_ps( _mm512_set1_epi32( 15 ), a.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#elif BLAZE_AVX_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inclusive prefix scan of the double precision values of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element \f$ (a_0,...,a_3) \f$.
+// \param op The scan operation (\a blaze::Add or \a blaze::Mult).
+// \return The SIMD element \f$ (a_0,a_0 \circ a_1,...,a_0 \circ ... \circ a_3) \f$.
+//
+// Both 128-bit lanes are scanned independently, afterwards the last element of the lower lane
+// is combined with the upper lane.
+*/
+template< typename OP >  // Type of the scan operation
+BLAZE_ALWAYS_INLINE const SIMDdouble simdScan( const SIMDdouble& a, OP op ) noexcept
+{
+   const __m256d id( _mm256_set1_pd( scanIdentity<double>( op ) ) );
+
+   SIMDdouble x( a );
+   x = op( x, SIMDdouble( _mm256_unpacklo_pd( id, x.value ) ) );
+   x = op( x, SIMDdouble( _mm256_permute2f128_pd( id, _mm256_permute_pd( x.value, 0xF ), 0x20 ) ) );
+   return x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inclusive prefix scan of the single precision values of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element \f$ (a_0,...,a_7) \f$.
+// \param op The scan operation (\a blaze::Add or \a blaze::Mult).
+// \return The SIMD element \f$ (a_0,a_0 \circ a_1,...,a_0 \circ ... \circ a_7) \f$.
+//
+// Both 128-bit lanes are scanned independently, afterwards the last element of the lower lane
+// is combined with the upper lane.
+*/
+template< typename OP >  // Type of the scan operation
+BLAZE_ALWAYS_INLINE const SIMDfloat simdScan( const SIMDfloat& a, OP op ) noexcept
+{
+   const __m256 id( _mm256_set1_ps( scanIdentity<float>( op ) ) );
+
+   SIMDfloat x( a );
+   x = op( x, SIMDfloat( _mm256_blend_ps(
+          _mm256_permute_ps( x.value, _MM_SHUFFLE( 2, 1, 0, 0 ) ), id, 0x11 ) ) );
+   x = op( x, SIMDfloat( _mm256_blend_ps(
+          _mm256_permute_ps( x.value, _MM_SHUFFLE( 1, 0, 0, 0 ) ), id, 0x33 ) ) );
+   x = op( x, SIMDfloat( _mm256_permute2f128_ps( id, _mm256_permute_ps( x.value, 0xFF ), 0x20 ) ) );
+   return x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Broadcast of the last double precision value of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element.
+// \return The SIMD element containing the last element of \a a in all elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdBroadcastLast( const SIMDdouble& a ) noexcept
+{
+   return _mm256_permute_pd( _mm256_permute2f128_pd( a.value, a.value, 0x11 ), 0xF );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Broadcast of the last single precision value of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element.
+// \return The SIMD element containing the last element of \a a in all elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdBroadcastLast( const SIMDfloat& a ) noexcept
+{
+   return _mm256_permute_ps( _mm256_permute2f128_ps( a.value, a.value, 0x11 ), 0xFF );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#elif BLAZE_SSE2_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inclusive prefix scan of the double precision values of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element \f$ (a_0,a_1) \f$.
+// \param op The scan operation (\a blaze::Add or \a blaze::Mult).
+// \return The SIMD element \f$ (a_0,a_0 \circ a_1) \f$.
+*/
+template< typename OP >  // Type of the scan operation
+BLAZE_ALWAYS_INLINE const SIMDdouble simdScan( const SIMDdouble& a, OP op ) noexcept
+{
+   const __m128d id( _mm_set1_pd( scanIdentity<double>( op ) ) );
+
+   return op( a, SIMDdouble( _mm_unpacklo_pd( id, a.value ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inclusive prefix scan of the single precision values of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element \f$ (a_0,...,a_3) \f$.
+// \param op The scan operation (\a blaze::Add or \a blaze::Mult).
+// \return The SIMD element \f$ (a_0,a_0 \circ a_1,...,a_0 \circ ... \circ a_3) \f$.
+*/
+template< typename OP >  // Type of the scan operation
+BLAZE_ALWAYS_INLINE const SIMDfloat simdScan( const SIMDfloat& a, OP op ) noexcept
+{
+   const __m128 id( _mm_set1_ps( scanIdentity<float>( op ) ) );
+
+   SIMDfloat x( a );
+   x = op( x, SIMDfloat( _mm_move_ss(
+          _mm_castsi128_ps( _mm_slli_si128( _mm_castps_si128( x.value ), 4 ) ), id ) ) );
+   x = op( x, SIMDfloat( _mm_shuffle_ps(
+          id, _mm_castsi128_ps( _mm_slli_si128( _mm_castps_si128( x.value ), 8 ) ),
+          _MM_SHUFFLE( 3, 2, 1, 0 ) ) ) );
+   return x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Broadcast of the last double precision value of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element.
+// \return The SIMD element containing the last element of \a a in all elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble simdBroadcastLast( const SIMDdouble& a ) noexcept
+{
+   return _mm_unpackhi_pd( a.value, a.value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Broadcast of the last single precision value of a SIMD element.
+// \ingroup simd
+//
+// \param a The given SIMD element.
+// \return The SIMD element containing the last element of \a a in all elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat simdBroadcastLast( const SIMDfloat& a ) noexcept
+{
+   return _mm_shuffle_ps( a.value, a.value, 0xFF );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
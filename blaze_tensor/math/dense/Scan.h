@@ -0,0 +1,494 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/Scan.h
+//  \brief Header file for the prefix scan kernels of dense tensors and arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_SCAN_H_
+#define _BLAZE_TENSOR_MATH_DENSE_SCAN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
+
+#include <blaze_tensor/math/dense/SIMDScan.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY VARIABLE TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized scan kernel along an
+//        outer dimension.
+// \ingroup math
+//
+// In case the target \a MT and the dense operand \a TT are SIMD-enabled, have the same element
+// type, and the scan operation \a OP can be applied to SIMD vectors, the variable is set to
+// \a true, otherwise it is \a false.
+*/
+template< typename MT    // Type of the target
+        , typename TT    // Type of the dense operand
+        , typename OP >  // Type of the scan operation
+constexpr bool UseVectorizedOuterScanKernel_v =
+   ( useOptimizedKernels &&
+     MT::simdEnabled && TT::simdEnabled &&
+     IsSame_v< ElementType_t<MT>, ElementType_t<TT> > &&
+     IsSIMDEnabled_v< OP, ElementType_t<TT>, ElementType_t<TT> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized scan kernel along the
+//        innermost dimension.
+// \ingroup math
+//
+// In case the target \a MT and the dense operand \a TT are SIMD-enabled, have the same element
+// type, and an in-register scan is available for the scan operation \a OP (see simdScan()), the
+// variable is set to \a true, otherwise it is \a false.
+*/
+template< typename MT    // Type of the target
+        , typename TT    // Type of the dense operand
+        , typename OP >  // Type of the scan operation
+constexpr bool UseVectorizedInnerScanKernel_v =
+   ( useOptimizedKernels &&
+     MT::simdEnabled && TT::simdEnabled &&
+     IsSame_v< ElementType_t<MT>, ElementType_t<TT> > &&
+     HasSIMDScan_v< ElementType_t<TT>, OP > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCAN KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the scan of a block of columns along an outer dimension.
+// \ingroup math
+//
+// \param L The size of the scanned dimension.
+// \param jbegin The first column to be computed.
+// \param jend The column behind the last column to be computed.
+// \param op The scan operation.
+// \param get The access function for element \a j of the operand row \a l.
+// \param load The SIMD access function for the operand (unused).
+// \param target The access function for element \a j of the target row \a l.
+// \param store The SIMD store function for the target (unused).
+// \return void
+//
+// Each target row is computed by combining the previous target row with the next operand row.
+*/
+template< typename T        // Type of the elements
+        , typename OP       // Type of the scan operation
+        , typename Get      // Type of the element access function
+        , typename Load     // Type of the SIMD access function
+        , typename Target   // Type of the target access function
+        , typename Store >  // Type of the SIMD store function
+inline void scanOuter( size_t L, size_t jbegin, size_t jend, OP op,
+                       Get get, Load load, Target target, Store store, FalseType )
+{
+   UNUSED_PARAMETER( load, store );
+
+   for( size_t j=jbegin; j<jend; ++j ) {
+      target( 0UL, j ) = get( 0UL, j );
+   }
+
+   for( size_t l=1UL; l<L; ++l ) {
+      for( size_t j=jbegin; j<jend; ++j ) {
+         target( l, j ) = op( target( l-1UL, j ), get( l, j ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the scan of a block of columns along an outer dimension.
+// \ingroup math
+//
+// \param L The size of the scanned dimension.
+// \param jbegin The first column to be computed (a multiple of the SIMD size).
+// \param jend The column behind the last column to be computed.
+// \param op The scan operation.
+// \param get The access function for element \a j of the operand row \a l.
+// \param load The SIMD access function for the elements of the operand row \a l.
+// \param target The access function for element \a j of the target row \a l.
+// \param store The SIMD store function for the elements of the target row \a l.
+// \return void
+//
+// The running results of four SIMD vectors of columns are kept in registers while the rows of
+// the operand are streamed along the scanned dimension. Every element of the operand is loaded
+// once and every element of the target is stored once.
+*/
+template< typename T        // Type of the elements
+        , typename OP       // Type of the scan operation
+        , typename Get      // Type of the element access function
+        , typename Load     // Type of the SIMD access function
+        , typename Target   // Type of the target access function
+        , typename Store >  // Type of the SIMD store function
+inline void scanOuter( size_t L, size_t jbegin, size_t jend, OP op,
+                       Get get, Load load, Target target, Store store, TrueType )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   BLAZE_INTERNAL_ASSERT( jbegin % SIMDSIZE == 0UL, "Invalid column range detected" );
+
+   const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) );
+
+   size_t j( jbegin );
+
+   for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+   {
+      SIMDType xmm1( load( 0UL, j              ) );
+      SIMDType xmm2( load( 0UL, j+SIMDSIZE     ) );
+      SIMDType xmm3( load( 0UL, j+SIMDSIZE*2UL ) );
+      SIMDType xmm4( load( 0UL, j+SIMDSIZE*3UL ) );
+
+      for( size_t l=0UL; ; )
+      {
+         store( l, j             , xmm1 );
+         store( l, j+SIMDSIZE    , xmm2 );
+         store( l, j+SIMDSIZE*2UL, xmm3 );
+         store( l, j+SIMDSIZE*3UL, xmm4 );
+
+         if( ++l == L ) break;
+
+         xmm1 = op( xmm1, load( l, j              ) );
+         xmm2 = op( xmm2, load( l, j+SIMDSIZE     ) );
+         xmm3 = op( xmm3, load( l, j+SIMDSIZE*2UL ) );
+         xmm4 = op( xmm4, load( l, j+SIMDSIZE*3UL ) );
+      }
+   }
+
+   for( ; j<jpos; j+=SIMDSIZE )
+   {
+      SIMDType xmm1( load( 0UL, j ) );
+      store( 0UL, j, xmm1 );
+
+      for( size_t l=1UL; l<L; ++l ) {
+         xmm1 = op( xmm1, load( l, j ) );
+         store( l, j, xmm1 );
+      }
+   }
+
+   for( ; j<jend; ++j )
+   {
+      T value( get( 0UL, j ) );
+      target( 0UL, j ) = value;
+
+      for( size_t l=1UL; l<L; ++l ) {
+         value = op( value, get( l, j ) );
+         target( l, j ) = value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the scan of a range of a single row.
+// \ingroup math
+//
+// \param jbegin The first element to be computed.
+// \param jend The element behind the last element to be computed (\a jend > \a jbegin).
+// \param init Pointer to the combined value of all elements in front of \a jbegin (or \a nullptr).
+// \param op The scan operation.
+// \param get The access function for element \a j of the operand row.
+// \param load The SIMD access function for the operand row (unused).
+// \param target The access function for element \a j of the target row.
+// \param store The SIMD store function for the target row (unused).
+// \return The last computed element.
+*/
+template< typename T        // Type of the elements
+        , typename OP       // Type of the scan operation
+        , typename Get      // Type of the element access function
+        , typename Load     // Type of the SIMD access function
+        , typename Target   // Type of the target access function
+        , typename Store >  // Type of the SIMD store function
+inline T scanRow( size_t jbegin, size_t jend, const T* init, OP op,
+                  Get get, Load load, Target target, Store store, FalseType )
+{
+   UNUSED_PARAMETER( load, store );
+
+   BLAZE_INTERNAL_ASSERT( jbegin < jend, "Invalid range of elements detected" );
+
+   T value( init != nullptr ? T( op( *init, get( jbegin ) ) ) : T( get( jbegin ) ) );
+   target( jbegin ) = value;
+
+   for( size_t j=jbegin+1UL; j<jend; ++j ) {
+      value = op( value, get( j ) );
+      target( j ) = value;
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the scan of a range of a single row.
+// \ingroup math
+//
+// \param jbegin The first element to be computed (a multiple of the SIMD size).
+// \param jend The element behind the last element to be computed (\a jend > \a jbegin).
+// \param init Pointer to the combined value of all elements in front of \a jbegin (or \a nullptr).
+// \param op The scan operation.
+// \param get The access function for element \a j of the operand row.
+// \param load The SIMD access function for the elements of the operand row.
+// \param target The access function for element \a j of the target row.
+// \param store The SIMD store function for the elements of the target row.
+// \return The last computed element.
+//
+// Each SIMD vector of the row is scanned in-register (see simdScan()) and combined with the
+// broadcast last element of the previous vector.
+*/
+template< typename T        // Type of the elements
+        , typename OP       // Type of the scan operation
+        , typename Get      // Type of the element access function
+        , typename Load     // Type of the SIMD access function
+        , typename Target   // Type of the target access function
+        , typename Store >  // Type of the SIMD store function
+inline T scanRow( size_t jbegin, size_t jend, const T* init, OP op,
+                  Get get, Load load, Target target, Store store, TrueType )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   BLAZE_INTERNAL_ASSERT( jbegin < jend, "Invalid range of elements detected" );
+   BLAZE_INTERNAL_ASSERT( jbegin % SIMDSIZE == 0UL, "Invalid range of elements detected" );
+
+   const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) );
+
+   T value( init != nullptr ? *init : scanIdentity<T>( op ) );
+   SIMDType carry( set( value ) );
+
+   size_t j( jbegin );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      const SIMDType xmm( op( carry, simdScan( SIMDType( load( j ) ), op ) ) );
+      store( j, xmm );
+      carry = simdBroadcastLast( xmm );
+   }
+
+   if( jpos > jbegin ) {
+      value = simdLast<T>( carry );
+   }
+
+   for( ; j<jend; ++j ) {
+      value = op( value, get( j ) );
+      target( j ) = value;
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the combination of all elements of a range of a single row.
+// \ingroup math
+//
+// \param jbegin The first element to be combined.
+// \param jend The element behind the last element to be combined (\a jend > \a jbegin).
+// \param op The scan operation.
+// \param get The access function for element \a j of the operand row.
+// \param load The SIMD access function for the operand row (unused).
+// \return The combination of all elements of the range.
+*/
+template< typename T        // Type of the elements
+        , typename OP       // Type of the scan operation
+        , typename Get      // Type of the element access function
+        , typename Load >   // Type of the SIMD access function
+inline T scanTotal( size_t jbegin, size_t jend, OP op, Get get, Load load, FalseType )
+{
+   UNUSED_PARAMETER( load );
+
+   BLAZE_INTERNAL_ASSERT( jbegin < jend, "Invalid range of elements detected" );
+
+   T value( get( jbegin ) );
+
+   for( size_t j=jbegin+1UL; j<jend; ++j ) {
+      value = op( value, get( j ) );
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the combination of all elements of a range of a single row.
+// \ingroup math
+//
+// \param jbegin The first element to be combined (a multiple of the SIMD size).
+// \param jend The element behind the last element to be combined (\a jend > \a jbegin).
+// \param op The scan operation.
+// \param get The access function for element \a j of the operand row.
+// \param load The SIMD access function for the elements of the operand row.
+// \return The combination of all elements of the range.
+*/
+template< typename T        // Type of the elements
+        , typename OP       // Type of the scan operation
+        , typename Get      // Type of the element access function
+        , typename Load >   // Type of the SIMD access function
+inline T scanTotal( size_t jbegin, size_t jend, OP op, Get get, Load load, TrueType )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   BLAZE_INTERNAL_ASSERT( jbegin < jend, "Invalid range of elements detected" );
+
+   const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) );
+
+   SIMDType xmm1( set( scanIdentity<T>( op ) ) );
+   SIMDType xmm2( xmm1 );
+
+   size_t j( jbegin );
+
+   for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+      xmm1 = op( xmm1, load( j          ) );
+      xmm2 = op( xmm2, load( j+SIMDSIZE ) );
+   }
+
+   if( j < jpos ) {
+      xmm1 = op( xmm1, load( j ) );
+      j += SIMDSIZE;
+   }
+
+   T value( reduce( op( xmm1, xmm2 ), op ) );
+
+   for( ; j<jend; ++j ) {
+      value = op( value, get( j ) );
+   }
+
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Two-pass parallel scan of a single long row.
+// \ingroup math
+//
+// \param n The number of elements of the row.
+// \param tasks The number of parallel tasks.
+// \param alignment The alignment of the block boundaries (typically the SIMD size).
+// \param op The scan operation (required to be associative).
+// \param total The function for the combination of all elements of a block \f$[begin..end)\f$.
+// \param kernel The function for the scan of a block \f$[begin..end)\f$ given a pointer to the
+//               combination of all elements in front of the block (or \a nullptr).
+// \return void
+//
+// The row is split into (at most) \a tasks blocks. In the first pass the combinations of all but
+// the last block are computed in parallel and combined into an exclusive prefix. In the second
+// pass all blocks are scanned in parallel, starting from their prefix.
+*/
+template< typename T         // Type of the elements
+        , typename OP        // Type of the scan operation
+        , typename Total     // Type of the block combination function
+        , typename Kernel >  // Type of the block scan function
+inline void blockScan( size_t n, size_t tasks, size_t alignment, OP op, Total total, Kernel kernel )
+{
+   const size_t chunk ( nextMultiple( ( n + tasks - 1UL ) / tasks, alignment ) );
+   const size_t blocks( ( n + chunk - 1UL ) / chunk );
+
+   if( blocks < 2UL ) {
+      kernel( 0UL, n, static_cast<const T*>( nullptr ) );
+      return;
+   }
+
+   std::unique_ptr<T[]> prefix( new T[blocks-1UL] );
+
+   smpFor( blocks-1UL, [&]( size_t b ) {
+      prefix[b] = total( b*chunk, ( b+1UL )*chunk );
+   } );
+
+   for( size_t b=1UL; b<blocks-1UL; ++b ) {
+      prefix[b] = op( prefix[b-1UL], prefix[b] );
+   }
+
+   smpFor( blocks, [&]( size_t b ) {
+      kernel( b*chunk, min( ( b+1UL )*chunk, n ),
+              b == 0UL ? static_cast<const T*>( nullptr ) : &prefix[b-1UL] );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -127,6 +127,7 @@
 #include <blaze_tensor/math/traits/RavelTrait.h>
 #include <blaze_tensor/math/traits/RowSliceTrait.h>
 #include <blaze_tensor/math/traits/SubtensorTrait.h>
+#include <blaze_tensor/math/traits/TtmTrait.h>
 #include <blaze_tensor/math/typetraits/IsColumnMajorTensor.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
 #include <blaze_tensor/math/typetraits/IsRowMajorTensor.h>
@@ -3670,6 +3671,37 @@ struct BinaryMapTraitEval2< T1, T2, OP
 
 
 
+//=================================================================================================
+//
+//  TTMTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2, size_t MODE >
+struct TtmTraitEval2< T1, T2, MODE
+                    , EnableIf_t< IsDenseTensor_v<T1> &&
+                                  IsDenseMatrix_v<T2> &&
+                                  ( MODE == 0UL ? Size_v<T2,0UL> : Size_v<T1,0UL> ) != DefaultSize_v &&
+                                  ( MODE == 1UL ? Size_v<T2,0UL> : Size_v<T1,1UL> ) != DefaultSize_v &&
+                                  ( MODE == 2UL ? Size_v<T2,0UL> : Size_v<T1,2UL> ) != DefaultSize_v > >
+{
+   using ET1 = ElementType_t<T1>;
+   using ET2 = ElementType_t<T2>;
+
+   static constexpr size_t O = ( MODE == 0UL ? Size_v<T2,0UL> : Size_v<T1,0UL> );
+   static constexpr size_t M = ( MODE == 1UL ? Size_v<T2,0UL> : Size_v<T1,1UL> );
+   static constexpr size_t N = ( MODE == 2UL ? Size_v<T2,0UL> : Size_v<T1,2UL> );
+
+   using Type = StaticTensor< MultTrait_t<ET1,ET2>, O, M, N >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  RAVELTRAIT SPECIALIZATIONS
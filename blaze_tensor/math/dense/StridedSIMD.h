@@ -0,0 +1,274 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/dense/StridedSIMD.h
+//  \brief Header file for the strided SIMD load and store functions
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_DENSE_STRIDEDSIMD_H_
+#define _BLAZE_TENSOR_MATH_DENSE_STRIDEDSIMD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  STRIDED SIMD LOAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a SIMD element from equally spaced elements in memory.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \return The SIMD element containing the elements \a address[0], \a address[stride], ...
+//
+// The general implementation collects the elements in an aligned buffer and performs a single
+// aligned load. Overloads for the floating point types make use of the gather instructions of
+// AVX2 and AVX-512.
+*/
+template< typename Type >  // Type of the elements
+BLAZE_ALWAYS_INLINE auto loadStrided( const Type* address, size_t stride ) noexcept
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   alignas( AlignmentOf_v<Type> ) Type buffer[SIMDSIZE];
+
+   for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+      buffer[k] = address[k*stride];
+   }
+
+   return loada( buffer );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_AVX512F_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a SIMD element from equally spaced double precision values in memory.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \return The SIMD element containing the gathered elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble loadStrided( const double* address, size_t stride ) noexcept
+{
+   const long long s( static_cast<long long>( stride ) );
+   const __m512i index( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   return _mm512_i64gather_pd( index, address, 8 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a SIMD element from equally spaced single precision values in memory.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \return The SIMD element containing the gathered elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat loadStrided( const float* address, size_t stride ) noexcept
+{
+   if( stride > size_t( std::numeric_limits<int>::max() / 15 ) ) {
+      return loadStrided<float>( address, stride );
+   }
+
+   const int s( static_cast<int>( stride ) );
+   const __m512i index( _mm512_set_epi32( 15*s, 14*s, 13*s, 12*s, 11*s, 10*s, 9*s, 8*s,
+                                          7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   return _mm512_i32gather_ps( index, address, 4 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#elif BLAZE_AVX2_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a SIMD element from equally spaced double precision values in memory.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \return The SIMD element containing the gathered elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble loadStrided( const double* address, size_t stride ) noexcept
+{
+   const long long s( static_cast<long long>( stride ) );
+   const __m256i index( _mm256_set_epi64x( 3*s, 2*s, s, 0 ) );
+   return _mm256_i64gather_pd( address, index, 8 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a SIMD element from equally spaced single precision values in memory.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \return The SIMD element containing the gathered elements.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat loadStrided( const float* address, size_t stride ) noexcept
+{
+   if( stride > size_t( std::numeric_limits<int>::max() / 7 ) ) {
+      return loadStrided<float>( address, stride );
+   }
+
+   const int s( static_cast<int>( stride ) );
+   const __m256i index( _mm256_set_epi32( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   return _mm256_i32gather_ps( address, index, 4 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  STRIDED SIMD STORE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores a SIMD element to equally spaced elements in memory.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// The general implementation stores the SIMD element to an aligned buffer and distributes the
+// elements from there. Overloads for the floating point types make use of the scatter
+// instructions of AVX-512.
+*/
+template< typename Type     // Type of the elements
+        , typename SIMDT >  // Type of the SIMD element
+BLAZE_ALWAYS_INLINE void storeStrided( Type* address, size_t stride, const SIMDT& value ) noexcept
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   alignas( AlignmentOf_v<Type> ) Type buffer[SIMDSIZE];
+
+   storea( buffer, value );
+
+   for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+      address[k*stride] = buffer[k];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_AVX512F_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores a SIMD element to equally spaced double precision values in memory.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \param value The SIMD element to be stored.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void
+   storeStrided( double* address, size_t stride, const SIMDdouble& value ) noexcept
+{
+   const long long s( static_cast<long long>( stride ) );
+   const __m512i index( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   _mm512_i64scatter_pd( address, index, value.value, 8 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores a SIMD element to equally spaced single precision values in memory.
+// \ingroup simd
+//
+// \param address The address of the first element.
+// \param stride The distance between two consecutive elements.
+// \param value The SIMD element to be stored.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void
+   storeStrided( float* address, size_t stride, const SIMDfloat& value ) noexcept
+{
+   if( stride > size_t( std::numeric_limits<int>::max() / 15 ) ) {
+      storeStrided<float,SIMDfloat>( address, stride, value );
+      return;
+   }
+
+   const int s( static_cast<int>( stride ) );
+   const __m512i index( _mm512_set_epi32( 15*s, 14*s, 13*s, 12*s, 11*s, 10*s, 9*s, 8*s,
+                                          7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   _mm512_i32scatter_ps( address, index, value.value, 4 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -40,14 +40,22 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Exception.h>
 #include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 
 #include <blaze_tensor/math/Forward.h>
 #include <blaze_tensor/math/dense/DenseTensor.h>
+#include <blaze_tensor/math/dense/Permutation.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
 
 #include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace blaze {
 
@@ -407,6 +415,376 @@ inline void transposeGeneral210( DenseTensor<TT>& dt )
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  IN-PLACE PERMUTATION OF CONTIGUOUS STORAGE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Size (in bytes) of the scratch buffer of each task of an in-place permutation.
+// \ingroup dense_tensor
+//
+// Slabs that fit into the scratch buffer are permuted out-of-place via the buffer, larger
+// slabs are permuted by cycle-following, which moves at most this many bytes at once.
+*/
+constexpr size_t PERMUTATION_SCRATCH_SIZE = 262144UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maximum number of cycles collected before they are moved in parallel.
+// \ingroup dense_tensor
+*/
+constexpr size_t PERMUTATION_CYCLE_BATCH = 4096UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a batch of slabs that fit into the scratch buffer.
+// \ingroup dense_tensor
+//
+// \param v Pointer to the first element of the first slab.
+// \param p The number of slabs.
+// \param a The number of block rows of each slab.
+// \param b The number of block columns of each slab.
+// \param c The number of elements of each block.
+// \return void
+//
+// Each slab is moved into the scratch buffer of the task and copied back in transposed order.
+// Single-element blocks are transposed by means of the vectorized micro tiles.
+*/
+template< typename Type >  // Type of the elements
+void transposeSlabs( Type* v, size_t p, size_t a, size_t b, size_t c )
+{
+   const size_t slab ( a*b*c );
+   const size_t tasks( min( smpTasks(), p ) );
+
+   smpFor( tasks, [=]( size_t t )
+   {
+      std::unique_ptr<Type[]> scratch( new Type[slab] );
+
+      for( size_t k=t; k<p; k+=tasks )
+      {
+         Type* s( v + k*slab );
+
+         std::move( s, s+slab, scratch.get() );
+
+         if( c == 1UL ) {
+            permuteBlock( s, a, scratch.get(), b, a, b, false );
+            continue;
+         }
+
+         for( size_t i=0UL; i<a; ++i ) {
+            for( size_t j=0UL; j<b; ++j ) {
+               const Type* src( scratch.get() + ( i*b+j )*c );
+               std::move( src, src+c, s + ( j*a+i )*c );
+            }
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a batch of square slabs.
+// \ingroup dense_tensor
+//
+// \param v Pointer to the first element of the first slab.
+// \param p The number of slabs.
+// \param a The number of block rows and block columns of each slab.
+// \param c The number of elements of each block.
+// \return void
+//
+// The blocks are swapped across the diagonal in square tiles. The block rows of tiles of all
+// slabs are distributed round-robin among the tasks to balance the triangular workload.
+*/
+template< typename Type >  // Type of the elements
+void transposeSquareSlabs( Type* v, size_t p, size_t a, size_t c )
+{
+   const size_t BS    ( max( PERMUTATION_BLOCK_SIZE / c, 1UL ) );
+   const size_t tiles ( ( a + BS - 1UL ) / BS );
+   const size_t units ( p * tiles );
+   const size_t tasks ( min( smpTasks(), units ) );
+
+   smpFor( tasks, [=]( size_t t )
+   {
+      for( size_t u=t; u<units; u+=tasks )
+      {
+         Type* s( v + ( u / tiles )*a*a*c );
+
+         const size_t ii  ( ( u % tiles )*BS );
+         const size_t iend( min( ii+BS, a ) );
+
+         for( size_t jj=0UL; jj<=ii; jj+=BS ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               const size_t jend( min( jj+BS, i ) );
+               for( size_t j=jj; j<jend; ++j ) {
+                  std::swap_ranges( s+( i*a+j )*c, s+( i*a+j+1UL )*c, s+( j*a+i )*c );
+               }
+            }
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a batch of rectangular slabs by cycle-following.
+// \ingroup dense_tensor
+//
+// \param v Pointer to the first element of the first slab.
+// \param p The number of slabs.
+// \param a The number of block rows of each slab.
+// \param b The number of block columns of each slab.
+// \param c The number of elements of each block.
+// \return void
+//
+// Transposing an \f$ a \times b \f$ slab of blocks moves the block at position \f$ s \f$ to
+// position \f$ s*a \bmod (a*b-1) \f$. The cycles of this permutation are identical for all
+// slabs. They are enumerated once by means of a bitmap with one bit per block and moved in
+// batches of up to PERMUTATION_CYCLE_BATCH cycles, where the cycles of all slabs are distributed
+// among the tasks. Each cycle is moved in chunks of at most PERMUTATION_SCRATCH_SIZE bytes.
+*/
+template< typename Type >  // Type of the elements
+void transposeCycles( Type* v, size_t p, size_t a, size_t b, size_t c )
+{
+   const size_t L( a*b );
+   const size_t K( min( max( PERMUTATION_SCRATCH_SIZE / sizeof( Type ), 1UL ), c ) );
+
+   const auto source = [a,b]( size_t d ) { return ( d % a )*b + d / a; };
+
+   std::vector<bool> visited( L, false );
+   std::vector<size_t> leaders;
+   leaders.reserve( PERMUTATION_CYCLE_BATCH );
+
+   const auto flush = [&]()
+   {
+      const size_t cycles( leaders.size() );
+      const size_t units ( p * cycles );
+      const size_t tasks ( min( smpTasks(), units ) );
+
+      smpFor( tasks, [&]( size_t t )
+      {
+         std::unique_ptr<Type[]> scratch( new Type[K] );
+
+         for( size_t u=t; u<units; u+=tasks )
+         {
+            Type* s( v + ( u / cycles )*L*c );
+
+            const size_t leader( leaders[u % cycles] );
+
+            for( size_t c0=0UL; c0<c; c0+=K )
+            {
+               const size_t cn( min( K, c-c0 ) );
+
+               std::move( s+leader*c+c0, s+leader*c+c0+cn, scratch.get() );
+
+               size_t d( leader );
+               for( size_t from=source( d ); from!=leader; d=from, from=source( d ) ) {
+                  std::move( s+from*c+c0, s+from*c+c0+cn, s+d*c+c0 );
+               }
+
+               std::move( scratch.get(), scratch.get()+cn, s+d*c+c0 );
+            }
+         }
+      } );
+
+      leaders.clear();
+   };
+
+   for( size_t s=1UL; s<L-1UL; ++s )
+   {
+      if( visited[s] )
+         continue;
+
+      size_t d( s );
+      size_t length( 0UL );
+
+      do {
+         visited[d] = true;
+         d = source( d );
+         ++length;
+      } while( d != s );
+
+      if( length > 1UL )
+         leaders.push_back( s );
+
+      if( leaders.size() == PERMUTATION_CYCLE_BATCH )
+         flush();
+   }
+
+   if( !leaders.empty() )
+      flush();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a batch of slabs of blocks.
+// \ingroup dense_tensor
+//
+// \param v Pointer to the first element of the first slab.
+// \param p The number of slabs.
+// \param a The number of block rows of each slab.
+// \param b The number of block columns of each slab.
+// \param c The number of elements of each block.
+// \return void
+//
+// This function transforms the contiguous \f$ p \times a \times b \times c \f$ storage into
+// \f$ p \times b \times a \times c \f$ storage.
+*/
+template< typename Type >  // Type of the elements
+void transposeBlocks( Type* v, size_t p, size_t a, size_t b, size_t c )
+{
+   if( a == 1UL || b == 1UL )
+      return;
+
+   if( a*b*c*sizeof( Type ) <= PERMUTATION_SCRATCH_SIZE )
+      transposeSlabs( v, p, a, b, c );
+   else if( a == b )
+      transposeSquareSlabs( v, p, a, c );
+   else
+      transposeCycles( v, p, a, b, c );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place permutation of the axes of contiguous \a N-dimensional storage.
+// \ingroup dense_tensor
+//
+// \param v Pointer to the first element of the storage.
+// \param dims The dimensions of the storage (outermost first), on return the permuted dimensions.
+// \param perm The axis mapping (see transpositionIndices()).
+// \return void
+//
+// The permutation is performed by at most \a N-1 passes, each of which moves a single axis in
+// front of a group of axes and thus is a batched transposition of a matrix of contiguous blocks.
+*/
+template< typename Type  // Type of the elements
+        , size_t N >     // Number of dimensions
+void permuteInPlace( Type* v, std::array<size_t,N>& dims, const std::array<size_t,N>& perm )
+{
+   std::array<size_t,N> axes;
+
+   for( size_t d=0UL; d<N; ++d ) {
+      axes[d] = d;
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      size_t j( i );
+      while( axes[j] != perm[i] ) ++j;
+
+      if( j == i )
+         continue;
+
+      size_t p( 1UL ), a( 1UL ), c( 1UL );
+      for( size_t d=0UL; d<i; ++d ) p *= dims[d];
+      for( size_t d=i; d<j; ++d ) a *= dims[d];
+      for( size_t d=j+1UL; d<N; ++d ) c *= dims[d];
+
+      transposeBlocks( v, p, a, dims[j], c );
+
+      std::rotate( axes.begin()+i, axes.begin()+j, axes.begin()+j+1UL );
+      std::rotate( dims.begin()+i, dims.begin()+j, dims.begin()+j+1UL );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of the padded row-major storage of a dense tensor or array.
+// \ingroup dense_tensor
+//
+// \param v Pointer to the first element of the storage.
+// \param capacity The capacity of the storage.
+// \param dims The dimensions (outermost first), on return the transposed dimensions.
+// \param nn The padded length of the innermost dimension, on return the new padded length.
+// \param perm The axis mapping (see transpositionIndices()).
+// \param padding Function object returning the padded length for a given innermost dimension.
+// \return \a true in case the storage was transposed, \a false if the capacity is insufficient.
+//
+// In case the innermost axis is not moved, the padded rows are permuted as a whole. Otherwise
+// the padding is removed, the packed storage is permuted and the rows are re-padded to the new
+// innermost dimension. In case the re-padded storage would exceed the capacity, the function
+// returns \a false without modifying the storage.
+*/
+template< typename Type  // Type of the elements
+        , size_t N       // Number of dimensions
+        , typename PT >  // Type of the padding function
+bool transposeInPlace( Type* v, size_t capacity, std::array<size_t,N>& dims, size_t& nn,
+                       const std::array<size_t,N>& perm, PT padding )
+{
+   size_t total( 1UL );
+   for( size_t d=0UL; d<N; ++d ) total *= dims[d];
+
+   const size_t n ( dims[N-1UL] );
+   const size_t n2( dims[perm[N-1UL]] );
+   const size_t nn2( padding( n2 ) );
+
+   if( total == 0UL || perm[N-1UL] == N-1UL )
+   {
+      std::array<size_t,N> padded( dims );
+      padded[N-1UL] = nn;
+
+      if( total != 0UL )
+         permuteInPlace( v, padded, perm );
+
+      std::array<size_t,N> tmp( dims );
+      for( size_t d=0UL; d<N; ++d ) dims[d] = tmp[perm[d]];
+      nn = nn2;
+      return true;
+   }
+
+   const size_t rows ( total / n  );
+   const size_t rows2( total / n2 );
+
+   if( rows2*nn2 > capacity )
+      return false;
+
+   if( nn != n ) {
+      for( size_t r=1UL; r<rows; ++r ) {
+         std::move( v+r*nn, v+r*nn+n, v+r*n );
+      }
+   }
+
+   permuteInPlace( v, dims, perm );
+
+   if( nn2 != n2 ) {
+      for( size_t r=rows2; r-->0UL; ) {
+         std::move_backward( v+r*n2, v+( r+1UL )*n2, v+r*nn2+n2 );
+         std::fill( v+r*nn2+n2, v+( r+1UL )*nn2, Type() );
+      }
+   }
+
+   nn = nn2;
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,570 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DArrArgReduceExpr.h
+//  \brief Header file for the dense array argmin() and argmax() functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRARGREDUCEEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRARGREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+#include <blaze_tensor/math/dense/ArgReduce.h>
+#include <blaze_tensor/math/dense/Forward.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/smp/ParallelReduce.h>
+#include <blaze_tensor/system/Thresholds.h>
+#include <blaze_tensor/util/ArrayForEach.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ARGREDUCE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Position of the extremum of a range of rows of a dense array.
+// \ingroup dense_array
+//
+// \param A The dense array operand.
+// \param begin The first row to be reduced.
+// \param end The row behind the last row to be reduced (\a end > \a begin).
+// \return The first extremal element of the given rows and its flat index.
+//
+// The rows are numbered consecutively in memory order across all outer dimensions. The returned
+// index is the flat index of the element in memory order.
+*/
+template< typename OP    // Type of the reduction operation
+        , typename TT >  // Type of the dense array operand
+inline ArgCandidate< ElementType_t<TT> >
+   darrayargreduceRows( const TT& A, size_t begin, size_t end )
+{
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N( TT::num_dimensions );
+
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
+
+   const size_t n( A.dimensions()[0] );
+
+   const auto get  = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load = [&A]( auto... indices ) { return A.load( indices... ); };
+
+   ArgCandidate<ET> result;
+
+   ArrayForEachRow( A.dimensions(), n, begin, end,
+                    [&]( size_t offset, const std::array<size_t,N>& indices )
+   {
+      ArgCandidate<ET> row( argreduceRow<OP,ET>( n,
+         [&]( auto j ) { return ArrayRowApply( get, indices, j ); },
+         [&]( auto j ) { return ArrayRowApply( load, indices, j ); },
+         BoolConstant< UseVectorizedArgReduceKernel_v<TT,OP> >() ) );
+
+      row.index += offset;
+
+      result = ( offset == begin*n ) ? row : MergeArgCandidates<OP>()( result, row );
+   } );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Position of the extrema of a block of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target array of indices.
+// \param A The dense array operand.
+// \param rbegin The first row of the target array to be computed.
+// \param rend The row behind the last row of the target array to be computed.
+// \param jbegin The first column of the target array to be computed.
+// \param jend The column behind the last column of the target array to be computed.
+// \return void
+//
+// The rows of the target array are numbered consecutively in memory order across all outer
+// dimensions. Each row is computed by streaming the rows of the operand along dimension \a R
+// through argreduceUpdate(). The columns are processed in blocks of ARGREDUCE_BLOCK_SIZE, such
+// that the current extrema of a block stay in the cache.
+*/
+template< size_t R       // Reduction flag
+        , typename OP    // Type of the reduction operation
+        , size_t M       // Number of dimensions of the target array
+        , typename TT >  // Type of the dense array operand
+inline auto darrayargreduceOuter( DynamicArray<M,size_t>& C, const TT& A,
+                                  size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> EnableIf_t< R != 0UL >
+{
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N( TT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT( R > 0UL && R < N && M+1UL == N );
+
+   const size_t L( A.dimensions()[R] );
+
+   const auto get = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+
+   std::unique_ptr<ET[]> best( new ET[ min( ARGREDUCE_BLOCK_SIZE, jend-jbegin ) ] );
+
+   ArrayForEachRow( C.dimensions(), 0UL, rbegin, rend,
+                    [&]( size_t, const std::array<size_t,M>& indices )
+   {
+      size_t* index( &ArrayRowApply(
+         [&C]( auto... is ) -> size_t& { return C( is... ); }, indices, 0UL ) );
+
+      std::array<size_t,N> ai( mergeDims<R>( indices, 0UL ) );
+
+      for( size_t jj=jbegin; jj<jend; jj+=ARGREDUCE_BLOCK_SIZE )
+      {
+         const size_t jjend( min( jj+ARGREDUCE_BLOCK_SIZE, jend ) );
+
+         for( size_t l=0UL; l<L; ++l )
+         {
+            ai[R] = l;
+
+            argreduceUpdate<OP>( best.get(), index, l, jj, jjend,
+                                 [&]( size_t j ) { return ArrayRowApply( get, ai, j ); } );
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Position of the extrema of a range of rows of a dense array along the innermost
+//        dimension.
+// \ingroup dense_array
+//
+// \param C The target array of indices.
+// \param A The dense array operand.
+// \param begin The first row of the operand to be reduced.
+// \param end The row behind the last row of the operand to be reduced.
+// \return void
+//
+// The position of the extremum of each row of the operand is computed by means of
+// argreduceRow().
+*/
+template< size_t R       // Reduction flag
+        , typename OP    // Type of the reduction operation
+        , size_t M       // Number of dimensions of the target array
+        , typename TT >  // Type of the dense array operand
+inline auto darrayargreduceInner( DynamicArray<M,size_t>& C, const TT& A, size_t begin, size_t end )
+   -> EnableIf_t< R == 0UL >
+{
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N( TT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT( M+1UL == N );
+
+   const size_t n( A.dimensions()[0] );
+
+   const auto get  = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load = [&A]( auto... indices ) { return A.load( indices... ); };
+
+   ArrayForEachRow( A.dimensions(), 0UL, begin, end,
+                    [&]( size_t, const std::array<size_t,N>& indices )
+   {
+      std::array<size_t,M> ci;
+      for( size_t d=1UL; d<N; ++d ) {
+         ci[d-1UL] = indices[d];
+      }
+
+      ArrayRowApply( [&C]( auto... is ) -> size_t& { return C( is... ); }, ci, ci[0] ) =
+         argreduceRow<OP,ET>( n,
+            [&]( auto j ) { return ArrayRowApply( get, indices, j ); },
+            [&]( auto j ) { return ArrayRowApply( load, indices, j ); },
+            BoolConstant< UseVectorizedArgReduceKernel_v<TT,OP> >() ).index;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP position of the extrema of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target array of indices.
+// \param A The dense array operand (with a non-empty reduced dimension).
+// \return void
+//
+// The rows of the target array (i.e. all non-reduced outer dimensions) are distributed among
+// the available threads. In case there are fewer rows than threads, the columns are distributed
+// in chunks of full SIMD vectors.
+*/
+template< size_t R       // Reduction flag
+        , typename OP    // Type of the reduction operation
+        , size_t M       // Number of dimensions of the target array
+        , typename TT >  // Type of the dense array operand
+inline auto smpDArrArgReduceAssign( DynamicArray<M,size_t>& C, const TT& A )
+   -> EnableIf_t< R != 0UL >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT> >::size );
+
+   const size_t rows( ArrayRows( C.dimensions() ) );
+   const size_t N( C.dimensions()[0] );
+   const size_t elements( ArrayRows( A.dimensions() ) * A.dimensions()[0] );
+   const size_t tasks( elements >= SMP_DARRREDUCE_THRESHOLD ? smpTasks() : 1UL );
+
+   if( tasks < 2UL || rows*N < 2UL ) {
+      darrayargreduceOuter<R,OP>( C, A, 0UL, rows, 0UL, N );
+   }
+   else if( rows >= tasks ) {
+      const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*chunk );
+         const size_t end  ( min( begin+chunk, rows ) );
+         if( begin < end )
+            darrayargreduceOuter<R,OP>( C, A, begin, end, 0UL, N );
+      } );
+   }
+   else {
+      const size_t columns( nextMultiple( ( N + tasks - 1UL ) / tasks, SIMDSIZE ) );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*columns );
+         const size_t end  ( min( begin+columns, N ) );
+         if( begin < end )
+            darrayargreduceOuter<R,OP>( C, A, 0UL, rows, begin, end );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP position of the extrema of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param C The target array of indices.
+// \param A The dense array operand (with at least one column).
+// \return void
+//
+// The rows of the operand are distributed in contiguous ranges among the available threads.
+*/
+template< size_t R       // Reduction flag
+        , typename OP    // Type of the reduction operation
+        , size_t M       // Number of dimensions of the target array
+        , typename TT >  // Type of the dense array operand
+inline auto smpDArrArgReduceAssign( DynamicArray<M,size_t>& C, const TT& A )
+   -> EnableIf_t< R == 0UL >
+{
+   const size_t rows( ArrayRows( A.dimensions() ) );
+   const bool parallel( rows * A.dimensions()[0] >= SMP_DARRREDUCE_THRESHOLD );
+   const size_t tasks( parallel ? min( smpTasks(), rows ) : 1UL );
+
+   if( tasks < 2UL ) {
+      darrayargreduceInner<R,OP>( C, A, 0UL, rows );
+      return;
+   }
+
+   const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( t*chunk );
+      const size_t end  ( min( begin+chunk, rows ) );
+
+      if( begin < end ) {
+         darrayargreduceInner<R,OP>( C, A, begin, end );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the total argmin() and argmax() functions for dense arrays.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param op The reduction operation (\a blaze::Min or \a blaze::Max).
+// \return The flat index of the first extremal element.
+// \exception std::invalid_argument Invalid input array.
+*/
+template< typename MT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+inline size_t darrayargreduce( const DenseArray<MT>& dm, OP op )
+{
+   UNUSED_PARAMETER( op );
+
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   const size_t rows( ArrayRows( (~dm).dimensions() ) );
+   const size_t n( (~dm).dimensions()[0] );
+
+   if( rows * n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   CT tmp( ~dm );
+
+   const bool parallel( rows * n >= SMP_DARRREDUCE_THRESHOLD );
+
+   return smpReduce< ArgCandidate<ET> >( rows, parallel, MergeArgCandidates<OP>(),
+      [&]( size_t begin, size_t end ) {
+         return darrayargreduceRows<OP>( tmp, begin, end );
+      } ).index;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the partial argmin() and argmax() functions for dense arrays.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param op The reduction operation (\a blaze::Min or \a blaze::Max).
+// \return The array of the indices of the first extremal elements along dimension \a RF.
+// \exception std::invalid_argument Invalid input array.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+inline DynamicArray< MT::num_dimensions-1UL, size_t >
+   darrayargreduce( const DenseArray<MT>& dm, OP op )
+{
+   UNUSED_PARAMETER( op );
+
+   constexpr size_t N( MT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT_MSG( N >= 2UL && RF < N, "Invalid reduction flag" );
+
+   using CT = CompositeType_t<MT>;
+
+   const std::array<size_t,N>& dims( (~dm).dimensions() );
+
+   std::array<size_t,N-1UL> rdims;
+   for( size_t d=0UL, r=0UL; d<N; ++d ) {
+      if( d != RF ) rdims[r++] = dims[d];
+   }
+
+   if( dims[RF] == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   DynamicArray< N-1UL, size_t > C( rdims );
+
+   if( ArrayRows( rdims ) * rdims[0] == 0UL ) {
+      return C;
+   }
+
+   CT tmp( ~dm );
+
+   smpDArrArgReduceAssign<RF,OP>( C, tmp );
+
+   return C;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the flat index of the smallest element of the given dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The flat index of the first smallest element.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function returns the index of the smallest element of the given dense array \a dm in a
+// single pass over the elements. The index is the flat index of the element in memory order,
+// i.e. the innermost dimension 0 has unit stride. In case the minimum occurs several times, the
+// index of the first occurrence is returned:
+
+   \code
+   blaze::DynamicArray<3,int> A{ { { 1, -4 }, { 3, 4 } }, { { -4, 2 }, { 0, 1 } } };
+
+   const size_t index = argmin( A );  // Results in 1
+   \endcode
+
+// The rows of the array are reduced by means of SIMD operations and, in case the array has at
+// least SMP_DARRREDUCE_THRESHOLD elements, in parallel. In case the array is empty, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the dense array
+inline size_t argmin( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return darrayargreduce( ~dm, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the smallest elements of the given dense array along the given
+//        dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The indices of the first smallest elements along dimension \a RF.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function returns the indices of the smallest elements of the given dense array \a dm
+// along the dimension \a RF, where dimension 0 is the innermost dimension. The result is an
+// array of indices with one dimension less than \a dm:
+
+   \code
+   blaze::DynamicArray<4,float> A;
+   // ... Resizing and initialization
+
+   const blaze::DynamicArray<3,size_t> indices( argmin<2>( A ) );
+   \endcode
+
+// In case the reduced dimension is empty, a \a std::invalid_argument exception is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense array
+inline DynamicArray< MT::num_dimensions-1UL, size_t > argmin( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return darrayargreduce<RF>( ~dm, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the flat index of the largest element of the given dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The flat index of the first largest element.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function returns the index of the largest element of the given dense array \a dm in a
+// single pass over the elements. The index is the flat index of the element in memory order,
+// i.e. the innermost dimension 0 has unit stride. In case the maximum occurs several times, the
+// index of the first occurrence is returned:
+
+   \code
+   blaze::DynamicArray<3,int> A{ { { 1, -4 }, { 3, 4 } }, { { -4, 2 }, { 0, 4 } } };
+
+   const size_t index = argmax( A );  // Results in 3
+   \endcode
+
+// The rows of the array are reduced by means of SIMD operations and, in case the array has at
+// least SMP_DARRREDUCE_THRESHOLD elements, in parallel. In case the array is empty, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the dense array
+inline size_t argmax( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return darrayargreduce( ~dm, Max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the largest elements of the given dense array along the given
+//        dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The indices of the first largest elements along dimension \a RF.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function returns the indices of the largest elements of the given dense array \a dm
+// along the dimension \a RF, where dimension 0 is the innermost dimension. The result is an
+// array of indices with one dimension less than \a dm:
+
+   \code
+   blaze::DynamicArray<4,float> A;
+   // ... Resizing and initialization
+
+   const blaze::DynamicArray<3,size_t> indices( argmax<0>( A ) );
+   \endcode
+
+// In case the reduced dimension is empty, a \a std::invalid_argument exception is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense array
+inline DynamicArray< MT::num_dimensions-1UL, size_t > argmax( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return darrayargreduce<RF>( ~dm, Max() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
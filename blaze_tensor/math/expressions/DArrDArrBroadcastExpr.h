@@ -0,0 +1,840 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DArrDArrBroadcastExpr.h
+//  \brief Header file for the dense array/dense array broadcast expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRDARRBROADCASTEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRDARRBROADCASTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <utility>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/DMatDMatMapExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sub.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+#include <blaze_tensor/math/constraints/DenseArray.h>
+#include <blaze_tensor/math/dense/ArrayBroadcast.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/ArrArrMapExpr.h>
+#include <blaze_tensor/util/ArrayForEach.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DARRDARRBROADCASTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the broadcast evaluation of a binary operation on two dense arrays.
+// \ingroup dense_array_expression
+//
+// The DArrDArrBroadcastExpr class represents the compile time expression for the pairwise
+// evaluation of a binary custom operation on the elements of two dense arrays of compatible
+// (but not necessarily identical) dimensions. The dimensions of the two arrays are aligned at
+// the innermost dimension. Missing outer dimensions and dimensions of size 1 are broadcast,
+// i.e. the according operand is accessed with a stride of 0 along these dimensions.
+*/
+template< typename MT1  // Type of the left-hand side dense array
+        , typename MT2  // Type of the right-hand side dense array
+        , typename OP >  // Type of the custom operation
+class DArrDArrBroadcastExpr
+   : public ArrArrMapExpr< DenseArray< DArrDArrBroadcastExpr<MT1,MT2,OP> > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT1 = ResultType_t<MT1>;     //!< Result type of the left-hand side dense array expression.
+   using RT2 = ResultType_t<MT2>;     //!< Result type of the right-hand side dense array expression.
+   using ET1 = ElementType_t<MT1>;    //!< Element type of the left-hand side dense array expression.
+   using ET2 = ElementType_t<MT2>;    //!< Element type of the right-hand side dense array expression.
+   using RN1 = ReturnType_t<MT1>;     //!< Return type of the left-hand side dense array expression.
+   using RN2 = ReturnType_t<MT2>;     //!< Return type of the right-hand side dense array expression.
+   using CT1 = CompositeType_t<MT1>;  //!< Composite type of the left-hand side dense array expression.
+   using CT2 = CompositeType_t<MT2>;  //!< Composite type of the right-hand side dense array expression.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**Dimensionality******************************************************************************
+   static constexpr size_t N1 = MT1::num_dimensions;  //!< Dimensionality of the left-hand side array.
+   static constexpr size_t N2 = MT2::num_dimensions;  //!< Dimensionality of the right-hand side array.
+   static constexpr size_t N  = ( N1 < N2 ? N2 : N1 );  //!< Dimensionality of the result.
+   //**********************************************************************************************
+
+   //**Serial evaluation strategy******************************************************************
+   //! Compilation switch for the serial evaluation strategy of the broadcast expression.
+   /*! The \a useAssign compile time constant expression represents a compilation switch for
+       the serial evaluation strategy of the broadcast expression. In case either of the two
+       dense array operands requires an intermediate evaluation, \a useAssign will be set to 1
+       and the broadcast expression will be evaluated via the \a assign function family.
+       Otherwise \a useAssign will be set to 0 and the expression will be evaluated via the
+       subscript operator. */
+   static constexpr bool useAssign = ( RequiresEvaluation_v<MT1> || RequiresEvaluation_v<MT2> );
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the broadcast evaluation strategy.
+       In case the target array has at least two dimensions, the variable is set to 1 and the
+       expression is evaluated row by row via the array broadcast kernels (see arrayBroadcast()),
+       which compute the operand indices once per row and hoist operands broadcast along the
+       innermost dimension out of the row loop. Otherwise the variable is set to 0 and the
+       expression is evaluated via the subscript operator. */
+   template< typename TT >
+   static constexpr bool UseBroadcastAssign_v = ( TT::num_dimensions >= 2UL );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DArrDArrBroadcastExpr<MT1,MT2,OP>;  //!< Type of this DArrDArrBroadcastExpr instance.
+   using ResultType    = MapTrait_t<RT1,RT2,OP>;              //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;          //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;         //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;           //!< Resulting element type.
+
+   //! Return type for expression template evaluations.
+   using ReturnType = decltype( std::declval<OP>()( std::declval<RN1>(), std::declval<RN2>() ) );
+
+   //! Data type for composite expression templates.
+   using CompositeType = If_t< useAssign, const ResultType, const DArrDArrBroadcastExpr& >;
+
+   //! Composite type of the left-hand side dense array expression.
+   using LeftOperand = If_t< IsExpression_v<MT1>, const MT1, const MT1& >;
+
+   //! Composite type of the right-hand side dense array expression.
+   using RightOperand = If_t< IsExpression_v<MT2>, const MT2, const MT2& >;
+
+   //! Data type of the custom binary operation.
+   using Operation = OP;
+
+   //! Type for the assignment of the left-hand side dense array operand.
+   using LT = If_t< RequiresEvaluation_v<MT1>, const RT1, CT1 >;
+
+   //! Type for the assignment of the right-hand side dense array operand.
+   using RT = If_t< RequiresEvaluation_v<MT2>, const RT2, CT2 >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled =
+      ( MT1::simdEnabled && MT2::simdEnabled &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET1,ET2>, HasLoad<OP> >::value );
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = ( MT1::smpAssignable && MT2::smpAssignable );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DArrDArrBroadcastExpr class.
+   //
+   // \param lhs The left-hand side dense array operand of the broadcast expression.
+   // \param rhs The right-hand side dense array operand of the broadcast expression.
+   // \param op The custom binary operation.
+   // \exception std::invalid_argument Array sizes do not match.
+   //
+   // The dimensions of the two operands are checked for compatibility on construction. In case
+   // they cannot be broadcast to common dimensions, a \a std::invalid_argument exception is
+   // thrown.
+   */
+   explicit inline DArrDArrBroadcastExpr( const MT1& lhs, const MT2& rhs, OP op )
+      : lhs_ ( lhs )  // Left-hand side dense array of the broadcast expression
+      , rhs_ ( rhs )  // Right-hand side dense array of the broadcast expression
+      , op_  ( op  )  // The custom binary operation
+      , dims_( broadcastDimensions( lhs.dimensions(), rhs.dimensions() ) )  // Result dimensions
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Multi-dimensional access to the array elements.
+   //
+   // \param dims Access indices (outermost dimension first).
+   // \return The resulting value.
+   */
+   template< typename... Dims >
+   inline ReturnType operator()( Dims... dims ) const {
+      BLAZE_STATIC_ASSERT( sizeof...( Dims ) == N );
+      const std::array<size_t,N> outer{ { size_t( dims )... } };
+      std::array<size_t,N> indices;
+      for( size_t d=0UL; d<N; ++d ) {
+         indices[d] = outer[N-1UL-d];
+      }
+      return (*this)( indices );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Multi-dimensional access to the array elements.
+   //
+   // \param indices Access indices (innermost dimension first).
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( const std::array<size_t,N>& indices ) const {
+      const auto left  = [this]( auto... is ) -> decltype(auto) { return lhs_( is... ); };
+      const auto right = [this]( auto... is ) -> decltype(auto) { return rhs_( is... ); };
+      const std::array<size_t,N1> li( broadcastIndices( indices, lhs_.dimensions() ) );
+      const std::array<size_t,N2> ri( broadcastIndices( indices, rhs_.dimensions() ) );
+      return op_( ArrayRowApply( left, li, li[0] ), ArrayRowApply( right, ri, ri[0] ) );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the array elements.
+   //
+   // \param dims Access indices (outermost dimension first).
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid array access index.
+   */
+   template< typename... Dims >
+   inline ReturnType at( Dims... dims ) const {
+      const std::array<size_t,N> indices{ { size_t( dims )... } };
+      for( size_t d=0UL; d<N; ++d ) {
+         if( indices[d] >= dims_[N-1UL-d] ) {
+            BLAZE_THROW_OUT_OF_RANGE( "Invalid array access index" );
+         }
+      }
+      return (*this)( dims... );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the array.
+   //
+   // \param dims Access indices (outermost dimension first).
+   // \return Reference to the accessed values.
+   //
+   // An operand that is broadcast along the innermost dimension is splatted into a SIMD vector.
+   */
+   template< typename... Dims >
+   BLAZE_ALWAYS_INLINE auto load( Dims... dims ) const noexcept {
+      BLAZE_STATIC_ASSERT( sizeof...( Dims ) == N );
+      const std::array<size_t,N> outer{ { size_t( dims )... } };
+      std::array<size_t,N> indices;
+      for( size_t d=0UL; d<N; ++d ) {
+         indices[d] = outer[N-1UL-d];
+      }
+
+      const auto left  = [this]( auto... is ) -> decltype(auto) { return lhs_( is... ); };
+      const auto right = [this]( auto... is ) -> decltype(auto) { return rhs_( is... ); };
+      const auto lload = [this]( auto... is ) { return lhs_.load( is... ); };
+      const auto rload = [this]( auto... is ) { return rhs_.load( is... ); };
+      const std::array<size_t,N1> li( broadcastIndices( indices, lhs_.dimensions() ) );
+      const std::array<size_t,N2> ri( broadcastIndices( indices, rhs_.dimensions() ) );
+
+      const size_t j( indices[0] );
+      const bool lrow( lhs_.dimensions()[0] != 1UL );
+      const bool rrow( rhs_.dimensions()[0] != 1UL );
+
+      if( lrow && rrow )
+         return op_.load( ArrayRowApply( lload, li, j ), ArrayRowApply( rload, ri, j ) );
+      else if( lrow )
+         return op_.load( ArrayRowApply( lload, li, j ), set( ArrayRowApply( right, ri, 0UL ) ) );
+      else if( rrow )
+         return op_.load( set( ArrayRowApply( left, li, 0UL ) ), ArrayRowApply( rload, ri, j ) );
+      else
+         return op_.load( set( ArrayRowApply( left , li, 0UL ) ),
+                          set( ArrayRowApply( right, ri, 0UL ) ) );
+   }
+   //**********************************************************************************************
+
+   //**Num_dimensions******************************************************************************
+   //! The dimensionality of the broadcast result.
+   static constexpr size_t num_dimensions = N;
+   //**********************************************************************************************
+
+   //**Dimensions function*************************************************************************
+   /*!\brief Returns the current dimensions of the array.
+   //
+   // \return The dimensions of the array.
+   */
+   inline const std::array<size_t,N>& dimensions() const noexcept {
+      return dims_;
+   }
+   //**********************************************************************************************
+
+   //**Dimension function**************************************************************************
+   /*!\brief Returns the current number of elements in the given dimension of the array.
+   //
+   // \return The number of elements in the given dimension of the array.
+   */
+   template < size_t Dim >
+   inline size_t dimension() const noexcept {
+      return dims_[Dim];
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side dense array operand.
+   //
+   // \return The left-hand side dense array operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense array operand.
+   //
+   // \return The right-hand side dense array operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( IsExpression_v<MT1> && lhs_.canAlias( alias ) ) ||
+             ( IsExpression_v<MT2> && rhs_.canAlias( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return lhs_.isAligned() && rhs_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   //
+   // Since a broadcast operand may be much smaller than the result, the decision is based on
+   // the total number of elements of the result.
+   */
+   inline bool canSMPAssign() const noexcept {
+      size_t size( 1UL );
+      for( size_t d=0UL; d<N; ++d ) {
+         size *= dims_[d];
+      }
+      return size >= SMP_DMATASSIGN_THRESHOLD;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand          lhs_;   //!< Left-hand side dense array of the broadcast expression.
+   RightOperand         rhs_;   //!< Right-hand side dense array of the broadcast expression.
+   Operation            op_;    //!< The custom binary operation.
+   std::array<size_t,N> dims_;  //!< The dimensions of the broadcast result.
+   //**********************************************************************************************
+
+   //**Assignment to dense arrays*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense array-dense array broadcast expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side broadcast expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense array-dense array
+   // broadcast expression to a dense array. The operands are evaluated (if necessary) and the
+   // result is computed row by row via the array broadcast kernels.
+   */
+   template< typename TT > // Type of the target dense array
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT> >
+      assign( DenseArray<TT>& lhs, const DArrDArrBroadcastExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense array operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense array operand
+
+      arrayBroadcast( ~lhs, A, B, rhs.op_, ArrayBroadcastCopy() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense arrays**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense array-dense array broadcast expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side broadcast expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense array-dense
+   // array broadcast expression to a dense array. The operands are evaluated (if necessary) and the
+   // result is computed row by row via the array broadcast kernels.
+   */
+   template< typename TT > // Type of the target dense array
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT> >
+      addAssign( DenseArray<TT>& lhs, const DArrDArrBroadcastExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense array operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense array operand
+
+      arrayBroadcast( ~lhs, A, B, rhs.op_, Add() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense arrays*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense array-dense array broadcast expression to a
+   //        dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side broadcast expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // array-dense array broadcast expression to a dense array. The operands are evaluated (if
+   // necessary) and the result is computed row by row via the array broadcast kernels.
+   */
+   template< typename TT > // Type of the target dense array
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT> >
+      subAssign( DenseArray<TT>& lhs, const DArrDArrBroadcastExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense array operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense array operand
+
+      arrayBroadcast( ~lhs, A, B, rhs.op_, Sub() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense arrays*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense array-dense array broadcast expression to a
+   //        dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side broadcast expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a dense
+   // array-dense array broadcast expression to a dense array. The operands are evaluated (if
+   // necessary) and the result is computed row by row via the array broadcast kernels.
+   */
+   template< typename TT > // Type of the target dense array
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT> >
+      schurAssign( DenseArray<TT>& lhs, const DArrDArrBroadcastExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense array operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense array operand
+
+      arrayBroadcast( ~lhs, A, B, rhs.op_, Mult() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense arrays***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense array-dense array broadcast expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side broadcast expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense array-dense array
+   // broadcast expression to a dense array. The rows of the target array are split among the
+   // available threads, each of which evaluates its range of rows via the array broadcast kernels.
+   */
+   template< typename TT > // Type of the target dense array
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT> >
+      smpAssign( DenseArray<TT>& lhs, const DArrDArrBroadcastExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense array operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense array operand
+
+      if( rhs.canSMPAssign() )
+         smpArrayBroadcast( ~lhs, A, B, rhs.op_, ArrayBroadcastCopy() );
+      else
+         arrayBroadcast( ~lhs, A, B, rhs.op_, ArrayBroadcastCopy() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense arrays******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense array-dense array broadcast expression to a
+   //        dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side broadcast expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // array-dense array broadcast expression to a dense array. The rows of the target array are
+   // split among the available threads, each of which evaluates its range of rows via the array
+   // broadcast kernels.
+   */
+   template< typename TT > // Type of the target dense array
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT> >
+      smpAddAssign( DenseArray<TT>& lhs, const DArrDArrBroadcastExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense array operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense array operand
+
+      if( rhs.canSMPAssign() )
+         smpArrayBroadcast( ~lhs, A, B, rhs.op_, Add() );
+      else
+         arrayBroadcast( ~lhs, A, B, rhs.op_, Add() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense arrays***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense array-dense array broadcast expression to a
+   //        dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side broadcast expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // array-dense array broadcast expression to a dense array. The rows of the target array are
+   // split among the available threads, each of which evaluates its range of rows via the array
+   // broadcast kernels.
+   */
+   template< typename TT > // Type of the target dense array
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT> >
+      smpSubAssign( DenseArray<TT>& lhs, const DArrDArrBroadcastExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense array operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense array operand
+
+      if( rhs.canSMPAssign() )
+         smpArrayBroadcast( ~lhs, A, B, rhs.op_, Sub() );
+      else
+         arrayBroadcast( ~lhs, A, B, rhs.op_, Sub() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense arrays*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a dense array-dense array broadcast expression to a
+   //        dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side broadcast expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a dense
+   // array-dense array broadcast expression to a dense array. The rows of the target array are
+   // split among the available threads, each of which evaluates its range of rows via the array
+   // broadcast kernels.
+   */
+   template< typename TT > // Type of the target dense array
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT> >
+      smpSchurAssign( DenseArray<TT>& lhs, const DArrDArrBroadcastExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense array operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense array operand
+
+      if( rhs.canSMPAssign() )
+         smpArrayBroadcast( ~lhs, A, B, rhs.op_, Mult() );
+      else
+         arrayBroadcast( ~lhs, A, B, rhs.op_, Mult() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluates the given binary operation on the broadcast elements of the dense arrays
+//        \a lhs and \a rhs.
+// \ingroup dense_array
+//
+// \param lhs The left-hand side dense array operand.
+// \param rhs The right-hand side dense array operand.
+// \param op The custom, binary operation.
+// \return The binary operation applied to the broadcast elements of \a lhs and \a rhs.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// In contrast to the \a map() function, the \a broadcast() function does not require the two
+// arrays to have identical dimensions. Instead, the dimensions are aligned at the innermost
+// dimension and each dimension of size 1 (or missing outer dimension) of one operand is
+// broadcast to the according dimension of the other operand, without creating a copy of the
+// broadcast operand. In case the dimensions are incompatible, a \a std::invalid_argument
+// exception is thrown. The following example scales every channel of a 4-dimensional array:
+
+   \code
+   blaze::DynamicArray<4,double> A, C;
+   blaze::DynamicArray<1,double> s;
+   // ... Resizing and initialization (s has as many elements as the innermost dimension of A)
+   C = broadcast( A, s, []( double x, double y ){ return x * y; } );
+   \endcode
+*/
+template< typename MT1   // Type of the left-hand side dense array
+        , typename MT2   // Type of the right-hand side dense array
+        , typename OP >  // Type of the custom operation
+inline decltype(auto)
+   broadcast( const DenseArray<MT1>& lhs, const DenseArray<MT2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ReturnType = const DArrDArrBroadcastExpr<MT1,MT2,OP>;
+   return ReturnType( ~lhs, ~rhs, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition operator for the broadcast addition of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The left-hand side dense array for the addition.
+// \param rhs The right-hand side dense array for the addition.
+// \return The broadcast sum of the two arrays.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// This operator represents the addition of two dense arrays with broadcasting semantics (see
+// the broadcast() function):
+
+   \code
+   blaze::DynamicArray<3,double> A, C;
+   blaze::DynamicArray<2,double> B;
+   // ... Resizing and initialization
+   C = A + B;  // B is added to every page of A
+   \endcode
+*/
+template< typename MT1  // Type of the left-hand side dense array
+        , typename MT2 > // Type of the right-hand side dense array
+inline decltype(auto)
+   operator+( const DenseArray<MT1>& lhs, const DenseArray<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return broadcast( ~lhs, ~rhs, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction operator for the broadcast subtraction of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The left-hand side dense array for the subtraction.
+// \param rhs The right-hand side dense array to be subtracted.
+// \return The broadcast difference of the two arrays.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// This operator represents the subtraction of two dense arrays with broadcasting semantics
+// (see the broadcast() function).
+*/
+template< typename MT1  // Type of the left-hand side dense array
+        , typename MT2 > // Type of the right-hand side dense array
+inline decltype(auto)
+   operator-( const DenseArray<MT1>& lhs, const DenseArray<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return broadcast( ~lhs, ~rhs, Sub() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Operator for the broadcast Schur product of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The left-hand side dense array for the Schur product.
+// \param rhs The right-hand side dense array for the Schur product.
+// \return The broadcast Schur product of the two arrays.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// This operator represents the element-wise multiplication of two dense arrays with
+// broadcasting semantics (see the broadcast() function):
+
+   \code
+   blaze::DynamicArray<4,double> A, C;
+   blaze::DynamicArray<1,double> s;
+   // ... Resizing and initialization
+   C = A % s;  // Per-channel scaling without materializing a full-size copy of s
+   \endcode
+*/
+template< typename MT1  // Type of the left-hand side dense array
+        , typename MT2 > // Type of the right-hand side dense array
+inline decltype(auto)
+   operator%( const DenseArray<MT1>& lhs, const DenseArray<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return broadcast( ~lhs, ~rhs, Mult() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, typename OP >
+struct IsAligned< DArrDArrBroadcastExpr<MT1,MT2,OP> >
+   : public BoolConstant< IsAligned_v<MT1> && IsAligned_v<MT2> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, typename OP >
+struct IsPadded< DArrDArrBroadcastExpr<MT1,MT2,OP> >
+   : public BoolConstant< IsPadded_v<MT1> && IsPadded_v<MT2> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,126 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DArrDArrInnerExpr.h
+//  \brief Header file for the dense array/dense array inner product
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRDARRINNEREXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRDARRINNEREXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/util/FunctionTrace.h>
+
+#include <blaze_tensor/math/expressions/DArrDArrMapExpr.h>
+#include <blaze_tensor/math/expressions/DArrReduceExpr.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scalar product (inner product) of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The left-hand side dense array for the inner product.
+// \param rhs The right-hand side dense array for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// This function computes the scalar product of the two dense arrays \a lhs and \a rhs, i.e.
+// the sum of the element-wise products of both arrays:
+
+   \code
+   blaze::DynamicArray<4,double> A, B;
+   // ... Resizing and initialization
+   const double s = inner( A, B );
+   \endcode
+
+// The element-wise products are not stored in a temporary array, but are computed and summed
+// up in a single pass (vectorized and, for large arrays, in parallel). In case the dimensions
+// of the two arrays don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side dense array
+        , typename MT2 >  // Type of the right-hand side dense array
+inline decltype(auto) inner( const DenseArray<MT1>& lhs, const DenseArray<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).dimensions() != (~rhs).dimensions() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Array sizes do not match" );
+   }
+
+   return sum( map( ~lhs, ~rhs, Mult() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar product (dot product) of two dense arrays.
+// \ingroup dense_array
+//
+// \param lhs The left-hand side dense array for the dot product.
+// \param rhs The right-hand side dense array for the dot product.
+// \return The scalar product.
+// \exception std::invalid_argument Array sizes do not match.
+//
+// This function is a synonym for the inner() function for dense arrays:
+
+   \code
+   blaze::DynamicArray<4,double> A, B;
+   // ... Resizing and initialization
+   const double s = dot( A, B );
+   \endcode
+*/
+template< typename MT1    // Type of the left-hand side dense array
+        , typename MT2 >  // Type of the right-hand side dense array
+inline decltype(auto) dot( const DenseArray<MT1>& lhs, const DenseArray<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return inner( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
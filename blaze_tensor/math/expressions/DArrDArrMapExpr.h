@@ -539,6 +539,16 @@ class DArrDArrMapExpr
    }
    //**********************************************************************************************
 
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side dense array operand.
+   //
+   // \return The left-hand side dense array operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
    //**Right operand access************************************************************************
    /*!\brief Returns the right-hand side dense array operand.
    //
@@ -0,0 +1,472 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DArrMomentsExpr.h
+//  \brief Header file for the dense array moments functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRMOMENTSEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRMOMENTSEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/dense/Forward.h>
+#include <blaze_tensor/math/dense/Moments.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/smp/ParallelReduce.h>
+#include <blaze_tensor/system/Thresholds.h>
+#include <blaze_tensor/util/ArrayForEach.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MOMENTS KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moments of a range of rows of a dense array.
+// \ingroup dense_array
+//
+// \param A The dense array operand.
+// \param begin The first row to be accumulated.
+// \param end The row behind the last row to be accumulated.
+// \return The moments of all elements of the given rows.
+//
+// The rows are numbered consecutively in memory order across all outer dimensions. The moments
+// of each row are computed by means of momentsRow() and merged into the result.
+*/
+template< typename TT >  // Type of the dense array operand
+inline MomentsAccumulator< MomentsType_t< ElementType_t<TT> > >
+   darraymomentsRows( const TT& A, size_t begin, size_t end )
+{
+   using T = MomentsType_t< ElementType_t<TT> >;
+
+   constexpr size_t N( TT::num_dimensions );
+
+   const size_t n( A.dimensions()[0] );
+
+   const auto get  = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load = [&A]( auto... indices ) { return A.load( indices... ); };
+
+   MomentsAccumulator<T> result;
+
+   ArrayForEachRow( A.dimensions(), 0UL, begin, end,
+                    [&]( size_t, const std::array<size_t,N>& indices )
+   {
+      result = MergeMoments()( result, momentsRow<T>( n,
+         [&]( auto j ) { return ArrayRowApply( get, indices, j ); },
+         [&]( auto j ) { return ArrayRowApply( load, indices, j ); },
+         BoolConstant< UseVectorizedMomentsKernel_v<TT> >() ) );
+   } );
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moments of a block of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param res The statistics of the partial reduction.
+// \param A The dense array operand.
+// \param rbegin The first row of the statistics to be computed.
+// \param rend The row behind the last row of the statistics to be computed.
+// \param jbegin The first column of the statistics to be computed (a multiple of the SIMD size).
+// \param jend The column behind the last column of the statistics to be computed.
+// \return void
+//
+// The rows of the statistics are numbered consecutively in memory order across all outer
+// dimensions. Each row is computed by streaming the rows of the operand along dimension \a R
+// through momentsUpdate(). The columns are processed in blocks of MOMENTS_BLOCK_SIZE, such that
+// the statistics of a block stay in the cache while the reduced dimension is traversed.
+*/
+template< size_t R       // Reduction flag
+        , size_t M       // Number of dimensions of the statistics
+        , typename T     // Type of the statistics
+        , typename TT >  // Type of the dense array operand
+inline auto darraymomentsOuter( Moments< DynamicArray<M,T> >& res, const TT& A,
+                                size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> EnableIf_t< R != 0UL >
+{
+   constexpr size_t N( TT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT( R > 0UL && R < N && M+1UL == N );
+
+   const size_t L( A.dimensions()[R] );
+
+   const auto get  = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load = [&A]( auto... indices ) { return A.load( indices... ); };
+
+   ArrayForEachRow( res.mean.dimensions(), 0UL, rbegin, rend,
+                    [&]( size_t, const std::array<size_t,M>& indices )
+   {
+      const auto row = [&indices]( DynamicArray<M,T>& C ) {
+         return &ArrayRowApply( [&C]( auto... is ) -> T& { return C( is... ); }, indices, 0UL );
+      };
+
+      T* mean( row( res.mean ) );
+      T* m2  ( row( res.variance ) );
+      T* mn  ( row( res.min ) );
+      T* mx  ( row( res.max ) );
+
+      std::array<size_t,N> ai( mergeDims<R>( indices, 0UL ) );
+
+      for( size_t jj=jbegin; jj<jend; jj+=MOMENTS_BLOCK_SIZE )
+      {
+         const size_t jjend( min( jj+MOMENTS_BLOCK_SIZE, jend ) );
+
+         for( size_t l=0UL; l<L; ++l )
+         {
+            ai[R] = l;
+
+            momentsUpdate( mean, m2, mn, mx, l, jj, jjend,
+               [&]( auto j ) { return ArrayRowApply( get, ai, j ); },
+               [&]( auto j ) { return ArrayRowApply( load, ai, j ); },
+               BoolConstant< UseVectorizedMomentsKernel_v<TT> >() );
+         }
+
+         momentsVariance( m2, jj, jjend, L );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moments of a range of rows of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param res The statistics of the partial reduction.
+// \param A The dense array operand.
+// \param begin The first row of the operand to be reduced.
+// \param end The row behind the last row of the operand to be reduced.
+// \return void
+//
+// Each row of the operand is reduced to a single element of the statistics by means of
+// momentsRow().
+*/
+template< size_t R       // Reduction flag
+        , size_t M       // Number of dimensions of the statistics
+        , typename T     // Type of the statistics
+        , typename TT >  // Type of the dense array operand
+inline auto darraymomentsInner( Moments< DynamicArray<M,T> >& res, const TT& A,
+                                size_t begin, size_t end )
+   -> EnableIf_t< R == 0UL >
+{
+   constexpr size_t N( TT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT( M+1UL == N );
+
+   const size_t n( A.dimensions()[0] );
+
+   const auto get  = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load = [&A]( auto... indices ) { return A.load( indices... ); };
+
+   ArrayForEachRow( A.dimensions(), 0UL, begin, end,
+                    [&]( size_t, const std::array<size_t,N>& indices )
+   {
+      std::array<size_t,M> ci;
+      for( size_t d=1UL; d<N; ++d ) {
+         ci[d-1UL] = indices[d];
+      }
+
+      const auto target = [&ci]( DynamicArray<M,T>& C ) -> T& {
+         return ArrayRowApply( [&C]( auto... is ) -> T& { return C( is... ); }, ci, ci[0] );
+      };
+
+      const MomentsAccumulator<T> acc( momentsRow<T>( n,
+         [&]( auto j ) { return ArrayRowApply( get, indices, j ); },
+         [&]( auto j ) { return ArrayRowApply( load, indices, j ); },
+         BoolConstant< UseVectorizedMomentsKernel_v<TT> >() ) );
+
+      target( res.mean     ) = acc.mean;
+      target( res.variance ) = acc.m2 / T( n-1UL );
+      target( res.min      ) = acc.min;
+      target( res.max      ) = acc.max;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP moments of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param res The statistics of the partial reduction.
+// \param A The dense array operand (with at least two elements along the reduced dimension).
+// \return void
+//
+// The rows of the statistics (i.e. all non-reduced outer dimensions) are distributed among the
+// available threads. In case there are fewer rows than threads, the columns are distributed in
+// chunks of full SIMD vectors.
+*/
+template< size_t R       // Reduction flag
+        , size_t M       // Number of dimensions of the statistics
+        , typename T     // Type of the statistics
+        , typename TT >  // Type of the dense array operand
+inline auto smpDArrMomentsAssign( Moments< DynamicArray<M,T> >& res, const TT& A )
+   -> EnableIf_t< R != 0UL >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   const size_t rows( ArrayRows( res.mean.dimensions() ) );
+   const size_t N( res.mean.dimensions()[0] );
+   const size_t elements( ArrayRows( A.dimensions() ) * A.dimensions()[0] );
+   const size_t tasks( elements >= SMP_DARRREDUCE_THRESHOLD ? smpTasks() : 1UL );
+
+   if( tasks < 2UL || rows*N < 2UL ) {
+      darraymomentsOuter<R>( res, A, 0UL, rows, 0UL, N );
+   }
+   else if( rows >= tasks ) {
+      const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*chunk );
+         const size_t end  ( min( begin+chunk, rows ) );
+         if( begin < end )
+            darraymomentsOuter<R>( res, A, begin, end, 0UL, N );
+      } );
+   }
+   else {
+      const size_t columns( nextMultiple( ( N + tasks - 1UL ) / tasks, SIMDSIZE ) );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*columns );
+         const size_t end  ( min( begin+columns, N ) );
+         if( begin < end )
+            darraymomentsOuter<R>( res, A, 0UL, rows, begin, end );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP moments of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param res The statistics of the partial reduction.
+// \param A The dense array operand (with at least two columns).
+// \return void
+//
+// The rows of the operand are distributed in contiguous ranges among the available threads.
+*/
+template< size_t R       // Reduction flag
+        , size_t M       // Number of dimensions of the statistics
+        , typename T     // Type of the statistics
+        , typename TT >  // Type of the dense array operand
+inline auto smpDArrMomentsAssign( Moments< DynamicArray<M,T> >& res, const TT& A )
+   -> EnableIf_t< R == 0UL >
+{
+   const size_t rows( ArrayRows( A.dimensions() ) );
+   const bool parallel( rows * A.dimensions()[0] >= SMP_DARRREDUCE_THRESHOLD );
+   const size_t tasks( parallel ? min( smpTasks(), rows ) : 1UL );
+
+   if( tasks < 2UL ) {
+      darraymomentsInner<R>( res, A, 0UL, rows );
+      return;
+   }
+
+   const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( t*chunk );
+      const size_t end  ( min( begin+chunk, rows ) );
+
+      if( begin < end ) {
+         darraymomentsInner<R>( res, A, begin, end );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the mean, the variance, the minimum, and the maximum of the given dense array.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the computation.
+// \return The statistics of all elements of the given dense array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes several statistics of all elements of the given dense array \a dm in
+// a single pass over the elements:
+
+   \code
+   blaze::DynamicArray<4,double> A;
+   // ... Resizing and initialization
+
+   const blaze::Moments<double> stats( moments( A ) );
+   // stats.mean, stats.variance, stats.min, stats.max
+   \endcode
+
+// The rows of the array are processed in vectorized blocks, whose partial results are merged
+// pairwise (see MergeMoments). In case the array has at least SMP_DARRREDUCE_THRESHOLD elements,
+// the rows are processed in parallel. Arrays with floating point elements are reduced in their
+// own precision, all other arrays in double precision. In case the array has less than two
+// elements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the dense array
+inline Moments< MomentsType_t< ElementType_t<MT> > > moments( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+   using T  = MomentsType_t< ElementType_t<MT> >;
+
+   const size_t rows( ArrayRows( (~dm).dimensions() ) );
+   const size_t n( (~dm).dimensions()[0] );
+
+   if( rows * n < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   CT tmp( ~dm );
+
+   const bool parallel( rows * n >= SMP_DARRREDUCE_THRESHOLD );
+
+   return momentsResult( smpReduce< MomentsAccumulator<T> >( rows, parallel, MergeMoments(),
+      [&]( size_t begin, size_t end ) {
+         return darraymomentsRows( tmp, begin, end );
+      } ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the mean, the variance, the minimum, and the maximum of the given dense array
+//        along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array for the computation.
+// \return The statistics of each reduced slice of the given dense array.
+// \exception std::invalid_argument Invalid input array.
+//
+// This function computes several statistics of the given dense array \a dm along the dimension
+// \a RF in a single pass over the elements, where dimension 0 is the innermost dimension. The
+// statistics are arrays with one dimension less than \a dm:
+
+   \code
+   blaze::DynamicArray<4,float> A;
+   // ... Resizing and initialization
+
+   const blaze::Moments< blaze::DynamicArray<3,float> > stats( moments<3>( A ) );
+   // stats.mean, stats.variance, stats.min, stats.max
+   \endcode
+
+// For a reduction along an outer dimension the rows of the operand are streamed along the
+// reduced dimension by means of the update formula of Welford, for a reduction along the
+// innermost dimension each row is reduced in blocks (see moments()). The computation is
+// vectorized and, in case the array has at least SMP_DARRREDUCE_THRESHOLD elements,
+// parallelized over the independent statistics. In case the reduced dimension has less than
+// two elements, a \a std::invalid_argument exception is thrown.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT >  // Type of the dense array
+inline Moments< DynamicArray< MT::num_dimensions-1UL, MomentsType_t< ElementType_t<MT> > > >
+   moments( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t N( MT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT_MSG( N >= 2UL && RF < N, "Invalid reduction flag" );
+
+   using CT = CompositeType_t<MT>;
+   using T  = MomentsType_t< ElementType_t<MT> >;
+   using RT = DynamicArray< N-1UL, T >;
+
+   const std::array<size_t,N>& dims( (~dm).dimensions() );
+
+   std::array<size_t,N-1UL> rdims;
+   for( size_t d=0UL, r=0UL; d<N; ++d ) {
+      if( d != RF ) rdims[r++] = dims[d];
+   }
+
+   if( dims[RF] < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input array" );
+   }
+
+   Moments<RT> res{ dims[RF], RT( rdims ), RT( rdims ), RT( rdims ), RT( rdims ) };
+
+   if( ArrayRows( rdims ) * rdims[0] == 0UL ) {
+      return res;
+   }
+
+   CT tmp( ~dm );
+
+   smpDArrMomentsAssign<RF>( res, tmp );
+
+   return res;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,11 +41,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
 #include <utility>
 
 #include <blaze/math/Aliases.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -64,6 +66,7 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
@@ -71,6 +74,8 @@
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
@@ -82,7 +87,10 @@
 #include <blaze/util/typetraits/RemoveConst.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
+#include <blaze_tensor/math/dense/ContiguousNorm.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/smp/ParallelReduce.h>
+#include <blaze_tensor/system/Thresholds.h>
 #include <blaze_tensor/util/ArrayForEach.h>
 
 namespace blaze {
@@ -133,6 +141,130 @@ struct DArrNormHelper
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized array norm kernel.
+// \ingroup dense_array
+//
+// In case the dense array operand \a TT provides direct access to its elements and the norm
+// can be computed by means of the vectorized \a Abs and \a Power operations, the variable is
+// set to \a true. Otherwise it is set to \a false.
+*/
+template< typename TT       // Type of the dense array operand
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+constexpr bool UseVectorizedDArrNormKernel_v =
+   ( DArrNormHelper<TT,Abs,Power>::value && HasConstDataAccess_v<TT> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the norm of a range of rows of a dense array.
+// \ingroup dense_array
+//
+// \param A The dense array operand.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param begin The first row to be processed (counting all rows of the array consecutively).
+// \param end The row behind the last row to be processed.
+// \return The accumulated powers of the given range of rows (without the root).
+//
+// This function accumulates the powers of the elements of the non-empty range \f$[begin..end)\f$
+// of rows of the given dense array. Due to the explicit application of the SFINAE principle,
+// this function can only be selected by the compiler in case vectorization cannot be applied.
+*/
+template< typename TT       // Type of the dense array operand
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline auto darraynormRows( const TT& A, Abs abs, Power power, size_t begin, size_t end )
+   -> DisableIf_t< UseVectorizedDArrNormKernel_v<TT,Abs,Power>, ElementType_t<TT> >
+{
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N = TT::num_dimensions;
+
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
+
+   const std::array< size_t, N >& dims( A.dimensions() );
+
+   std::array< size_t, N > indices{};
+   for( size_t d=1UL, r=begin; d<N; ++d ) {
+      indices[d] = r % dims[d];
+      r /= dims[d];
+   }
+
+   ET norm( power( abs( A( indices ) ) ) );
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      for( indices[0]=( r == begin ? 1UL : 0UL ); indices[0]<dims[0]; ++indices[0] ) {
+         norm += power( abs( A( indices ) ) );
+      }
+
+      for( size_t d=1UL; d<N; ++d ) {
+         if( ++indices[d] < dims[d] ) break;
+         indices[d] = 0UL;
+      }
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized kernel for the norm of a range of rows of a dense array.
+// \ingroup dense_array
+//
+// \param A The dense array operand.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param begin The first row to be processed (counting all rows of the array consecutively).
+// \param end The row behind the last row to be processed.
+// \return The accumulated powers of the given range of rows (without the root).
+//
+// This function accumulates the powers of the elements of the non-empty range \f$[begin..end)\f$
+// of rows of the given dense array via its data pointer. It shares the contiguous kernel of the
+// dense tensor norms: in case the array is padded or its rows are not separated by any gap, the
+// complete range is traversed as a single block, independent of the length of the rows. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization can be applied.
+*/
+template< typename TT       // Type of the dense array operand
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline auto darraynormRows( const TT& A, Abs abs, Power power, size_t begin, size_t end )
+   -> EnableIf_t< UseVectorizedDArrNormKernel_v<TT,Abs,Power>, ElementType_t<TT> >
+{
+   using ET = ElementType_t<TT>;
+
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
+
+   const size_t N ( A.dimensions()[0] );
+   const size_t nn( A.spacing() );
+
+   const ET* row( A.data() + begin*nn );
+
+   if( IsPadded_v<TT> || nn == N ) {
+      return contiguousNorm( row, ( end - begin ) * nn, abs, power );
+   }
+
+   ET norm( contiguousNorm( row, N, abs, power ) );
+
+   for( size_t r=begin+1UL; r<end; ++r ) {
+      row += nn;
+      norm += contiguousNorm( row, N, abs, power );
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
@@ -146,7 +278,9 @@ struct DArrNormHelper
 // \return The norm of the given dense array.
 //
 // This function computes a custom norm of the given dense array by means of the given functors.
-// The following example demonstrates the computation of the L2 norm by means of the blaze::Pow2
+// In case the array has at least SMP_DARRREDUCE_THRESHOLD elements, the rows of the array are
+// split into blocks, which are processed in parallel by means of the active SMP backend. The
+// following example demonstrates the computation of the L2 norm by means of the blaze::Pow2
 // and blaze::Sqrt functors:
 
    \code
@@ -165,8 +299,11 @@ decltype(auto) norm_backend( const DenseArray<MT>& dm, Abs abs, Power power, Roo
    using ET = ElementType_t<MT>;
    using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
 
+   constexpr size_t N =
+      RemoveCV_t< RemoveReference_t< decltype( ~dm ) > >::num_dimensions;
+
    if( ArrayDimAnyOf( ( ~dm ).dimensions(),
-          []( size_t i, size_t dim ) { return dim == 0; } ) ) {
+          []( size_t, size_t dim ) { return dim == 0; } ) ) {
       return RT{};
    }
 
@@ -174,16 +311,16 @@ decltype(auto) norm_backend( const DenseArray<MT>& dm, Abs abs, Power power, Roo
 
    BLAZE_INTERNAL_ASSERT( tmp.dimensions() == (~dm).dimensions(), "Invalid number of elements" );
 
-   using AT = RemoveCV_t<RemoveReference_t< decltype( ~dm ) > >;
-   constexpr size_t N = AT::num_dimensions;
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= tmp.dimensions()[d];
+   }
 
-   std::array< size_t, N > dims{};
-   ET norm( power( abs( tmp( dims ) ) ) );
+   const bool parallel( rows * tmp.dimensions()[0] >= SMP_DARRREDUCE_THRESHOLD );
 
-   ArrayForEachGrouped( ( ~dm ).dimensions(),
-      [&]( std::array< size_t, N > const& ds ) {
-         norm += power( abs( tmp( ds ) ) );
-      } );
+   const ET norm( smpReduce<ET>( rows, parallel, Add(), [&]( size_t begin, size_t end ) {
+      return darraynormRows( tmp, abs, power, begin, end );
+   } ) );
 
    return evaluate( root( norm ) );
 }
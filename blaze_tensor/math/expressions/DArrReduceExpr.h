@@ -41,7 +41,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
 #include <iterator>
+#include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/Exception.h>
@@ -52,20 +54,28 @@
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/ReduceTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveCV.h>
@@ -75,7 +85,12 @@
 #include <blaze_tensor/math/constraints/DenseArray.h>
 #include <blaze_tensor/math/constraints/Array.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/Forward.h>
 #include <blaze_tensor/math/expressions/ArrReduceExpr.h>
+#include <blaze_tensor/math/smp/ArrayRowAssign.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/smp/ParallelReduce.h>
+#include <blaze_tensor/system/Thresholds.h>
 #include <blaze_tensor/util/ArrayForEach.h>
 
 namespace blaze {
@@ -100,399 +115,1472 @@ class ReducedArray;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense array reduction operation.
+// \ingroup dense_array
+*/
+template< typename MT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+struct ArrayHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense array expression.
+   using CT = RemoveReference_t< CompositeType_t<MT> >;
+
+   //! Element type of the dense array expression.
+   using ET = ElementType_t<CT>;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( CT::simdEnabled &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET,ET>, HasLoad<OP> >::value );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
 //
-//  CLASS TEMPLATE SPECIALIZATION FOR ARBITRARY REDUCTION OPERATIONS OF ARRAYS
+//  PARTIAL REDUCTION KERNELS
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Expression object for arbitrary dense array reduction operations.
-// \ingroup dense_array_expression
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized partial reduction kernels.
+// \ingroup dense_array
 //
-// This specialization of the ReducedArray class template represents the compile time expression
-// for row-wise reduction operations of dense matrices.
+// In case the target array \a TT is SIMD-enabled and the dense array operand \a MT can be
+// reduced by means of the vectorized reduction operation \a OP, the variable is set to \a true,
+// otherwise it is \a false.
 */
-template< typename MT    // Type of the dense array
-        , typename OP    // Type of the reduction operation
-        , ReductionFlag R >     // Dimension along which to perform reduction
-class ReducedArray
-   : public ArrReduceExpr< DenseArray< ReducedArray<MT,OP,R> >, R >
-   , private Computation
+template< typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+constexpr bool UseVectorizedDArrReduceAccumulate_v =
+   ( useOptimizedKernels &&
+     TT::simdEnabled &&
+     ArrayHelper<MT,OP>::value &&
+     IsSame_v< ElementType_t<TT>, ElementType_t<MT> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the use of the padding elements in the partial
+//        reduction kernels.
+// \ingroup dense_array
+//
+// The padding elements of both the target array \a TT and the dense array operand \a MT can
+// be processed in case both are padded and the reduction operation \a OP maps zeros to zero.
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+constexpr bool UsePaddedDArrReduceAccumulate_v =
+   ( IsPadded_v<TT> && IsPadded_v<MT> &&
+     ( IsSame_v<OP,Add> || IsSame_v<OP,Mult> || IsSame_v<OP,Min> || IsSame_v<OP,Max> ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial evaluation of the dense array operand of a partial reduction.
+// \ingroup dense_array
+//
+// \param dm The dense array operand.
+// \return The evaluated dense array operand.
+//
+// This function evaluates an operand that requires an intermediate evaluation into a temporary.
+// All other operands are directly passed on to the reduction kernels.
+*/
+template< typename MT >  // Type of the dense array operand
+inline auto darrayreduceOperand( const DenseArray<MT>& dm )
+   -> EnableIf_t< RequiresEvaluation_v<MT>, const ResultType_t<MT> >
 {
- private:
-   //**Type definitions****************************************************************************
-   using RT = ResultType_t<MT>;   //!< Result type of the dense array expression.
-   using ET = ElementType_t<MT>;  //!< Element type of the dense array expression.
-   //**********************************************************************************************
+   return ResultType_t<MT>( serial( ~dm ) );
+}
 
-   //**Serial evaluation strategy******************************************************************
-   //! Compilation switch for the serial evaluation strategy of the reduction expression.
-   /*! The \a useAssign compile time constant expression represents a compilation switch for
-       the serial evaluation strategy of the reduction expression. In case the dense array
-       operand requires an intermediate evaluation, \a useAssign will be set to 1 and the
-       reduction expression will be evaluated via the \a assign function family. Otherwise
-       \a useAssign will be set to 0 and the expression will be evaluated via the subscript
-       operator. */
-   static constexpr bool useAssign = RequiresEvaluation_v<MT>;
+template< typename MT >  // Type of the dense array operand
+inline auto darrayreduceOperand( const DenseArray<MT>& dm )
+   -> DisableIf_t< RequiresEvaluation_v<MT>, const MT& >
+{
+   return ~dm;
+}
+/*! \endcond */
+//*************************************************************************************************
 
-   /*! \cond BLAZE_INTERNAL */
-   //! Helper variable template for the explicit application of the SFINAE principle.
-   template< typename VT >
-   static constexpr bool UseAssign_v = useAssign;
-   /*! \endcond */
-   //**********************************************************************************************
 
-   //**Parallel evaluation strategy****************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   //! Helper variable template for the explicit application of the SFINAE principle.
-   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case the dense array operand is not SMP assignable and requires an intermediate
-       evaluation, the variable is set to 1 and the expression specific evaluation strategy
-       is selected. Otherwise the variable is set to 0 and the default strategy is chosen. */
-   template< typename VT >
-   static constexpr bool UseSMPAssign_v = ( !MT::smpAssignable && useAssign );
-   /*! \endcond */
-   //**********************************************************************************************
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP evaluation of the dense array operand of a partial reduction.
+// \ingroup dense_array
+//
+// \param dm The dense array operand.
+// \return The evaluated dense array operand.
+//
+// This function evaluates an operand that requires an intermediate evaluation into a temporary
+// by means of the parallel evaluation strategy. All other operands are directly passed on to
+// the reduction kernels.
+*/
+template< typename MT >  // Type of the dense array operand
+inline auto smpDArrReduceOperand( const DenseArray<MT>& dm )
+   -> EnableIf_t< RequiresEvaluation_v<MT>, const ResultType_t<MT> >
+{
+   return ResultType_t<MT>( ~dm );
+}
 
- public:
-   //**Type definitions****************************************************************************
-   using This          = ReducedArray<MT,OP,R>;          //!< Type of this ReducedArray instance.
-   using ResultType    = ReduceTrait_t<RT,OP,R>;         //!< Result type for expression template evaluations.
-   using TransposeType = TransposeType_t<ResultType>;    //!< Transpose type for expression template evaluations.
-   using ElementType   = ElementType_t<ResultType>;      //!< Resulting element type.
-   using SIMDType      = SIMDTrait_t<ElementType>;       //!< Resulting SIMD element type.
-   using ReturnType    = const ElementType;              //!< Return type for expression template evaluations.
+template< typename MT >  // Type of the dense array operand
+inline auto smpDArrReduceOperand( const DenseArray<MT>& dm )
+   -> DisableIf_t< RequiresEvaluation_v<MT>, const MT& >
+{
+   return ~dm;
+}
+/*! \endcond */
+//*************************************************************************************************
 
-   //! Data type for composite expression templates.
-   using CompositeType = If_t< useAssign, const ResultType, const ReducedArray& >;
 
-   //! Composite type of the left-hand side dense array expression.
-   using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized reduction of a block of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The reduction operation.
+// \param rbegin The first row of the target array to be computed.
+// \param rend The row behind the last row of the target array to be computed.
+// \param jbegin The first column of the target array to be computed (a multiple of the SIMD size).
+// \param jend The column behind the last column of the target array to be computed.
+// \return void
+//
+// The rows of the target array are numbered consecutively in memory order across all outer
+// dimensions. Each row of the result is computed by accumulating the rows of the operand along
+// dimension \a R in a block of four SIMD registers, which are stored only once per block of
+// columns.
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto darrayreduceAccumulate( DenseArray<TT>& C, const MT& A, OP op,
+                                    size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> EnableIf_t< UseVectorizedDArrReduceAccumulate_v<TT,MT,OP> >
+{
+   using ET       = ElementType_t<TT>;
+   using SIMDType = SIMDTrait_t<ET>;
 
-   //! Data type of the custom unary operation.
-   using Operation = OP;
-   //**********************************************************************************************
+   constexpr size_t N( MT::num_dimensions );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
 
-   //**ConstIterator class definition**************************************************************
-   /*!\brief Iterator over the elements of the dense array.
-   */
-   class ConstIterator
+   BLAZE_STATIC_ASSERT( R > 0UL && R < N );
+   BLAZE_INTERNAL_ASSERT( jbegin % SIMDSIZE == 0UL, "Invalid column range detected" );
+
+   const size_t L( A.dimensions()[R] );
+
+   const bool remainder( !UsePaddedDArrReduceAccumulate_v<TT,MT,OP> || jend < A.dimensions()[0] );
+   const size_t jpos( remainder ? ( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) ) : jend );
+
+   const auto get    = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load   = [&A]( auto... indices ) { return A.load( indices... ); };
+   const auto target = [&C]( auto... indices ) -> decltype(auto) { return (~C)( indices... ); };
+
+   ArrayForEachRow( (~C).dimensions(), 0UL, rbegin, rend,
+                    [&]( size_t, const std::array<size_t,N-1UL>& indices )
    {
-    public:
-      //**Type definitions*************************************************************************
-      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
-      using ValueType        = ElementType;                      //!< Type of the underlying elements.
-      using PointerType      = ElementType*;                     //!< Pointer return type.
-      using ReferenceType    = ElementType&;                     //!< Reference return type.
-      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+      std::array<size_t,N> ai( mergeDims<R>( indices, 0UL ) );
 
-      // STL iterator requirements
-      using iterator_category = IteratorCategory;  //!< The iterator category.
-      using value_type        = ValueType;         //!< Type of the underlying elements.
-      using pointer           = PointerType;       //!< Pointer return type.
-      using reference         = ReferenceType;     //!< Reference return type.
-      using difference_type   = DifferenceType;    //!< Difference between two iterators.
-      //*******************************************************************************************
+      const auto store = [&]( size_t j, const SIMDType& xmm ) {
+         ArrayRowApply( [&]( auto... is ) { (~C).store( xmm, is... ); }, indices, j );
+      };
 
-      //**Constructor******************************************************************************
-      /*!\brief Constructor for the ConstIterator class.
-      //
-      // \param dm The dense array operand of the reduction expression.
-      // \param i Index to the initial array page.
-      // \param i Index to the array row.
-      // \param op The reduction operation.
-      */
-      explicit inline ConstIterator( Operand dm, size_t k, OP op )
-         : dm_   ( dm    )  // Dense array of the reduction expression
-         , k_    ( k )      // Index to the current array page
-         , op_   ( op    )  // The reduction operation
-      {}
-      //*******************************************************************************************
+      size_t j( jbegin );
 
-      //**Addition assignment operator*************************************************************
-      /*!\brief Addition assignment operator.
-      //
-      // \param inc The increment of the iterator.
-      // \return The incremented iterator.
-      */
-      inline ConstIterator& operator+=( size_t inc ) {
-         k_ += inc;
-         return *this;
-      }
-      //*******************************************************************************************
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+      {
+         ai[R] = 0UL;
 
-      //**Subtraction assignment operator**********************************************************
-      /*!\brief Subtraction assignment operator.
-      //
-      // \param dec The decrement of the iterator.
-      // \return The decremented iterator.
-      */
-      inline ConstIterator& operator-=( size_t dec ) {
-         k_ -= dec;
-         return *this;
-      }
-      //*******************************************************************************************
+         SIMDType xmm1( ArrayRowApply( load, ai, j              ) );
+         SIMDType xmm2( ArrayRowApply( load, ai, j+SIMDSIZE     ) );
+         SIMDType xmm3( ArrayRowApply( load, ai, j+SIMDSIZE*2UL ) );
+         SIMDType xmm4( ArrayRowApply( load, ai, j+SIMDSIZE*3UL ) );
 
-      //**Prefix increment operator****************************************************************
-      /*!\brief Pre-increment operator.
-      //
-      // \return Reference to the incremented iterator.
-      */
-      inline ConstIterator& operator++() {
-         ++k_;
-         return *this;
-      }
-      //*******************************************************************************************
+         for( size_t l=1UL; l<L; ++l ) {
+            ai[R] = l;
+            xmm1 = op( xmm1, ArrayRowApply( load, ai, j              ) );
+            xmm2 = op( xmm2, ArrayRowApply( load, ai, j+SIMDSIZE     ) );
+            xmm3 = op( xmm3, ArrayRowApply( load, ai, j+SIMDSIZE*2UL ) );
+            xmm4 = op( xmm4, ArrayRowApply( load, ai, j+SIMDSIZE*3UL ) );
+         }
 
-      //**Postfix increment operator***************************************************************
-      /*!\brief Post-increment operator.
-      //
-      // \return The previous position of the iterator.
-      */
-      inline const ConstIterator operator++( int ) {
-         return ConstIterator( k_++ );
+         store( j             , xmm1 );
+         store( j+SIMDSIZE    , xmm2 );
+         store( j+SIMDSIZE*2UL, xmm3 );
+         store( j+SIMDSIZE*3UL, xmm4 );
       }
-      //*******************************************************************************************
 
-      //**Prefix decrement operator****************************************************************
-      /*!\brief Pre-decrement operator.
-      //
-      // \return Reference to the decremented iterator.
-      */
-      inline ConstIterator& operator--() {
-         --k_;
-         return *this;
-      }
-      //*******************************************************************************************
+      for( ; j<jpos; j+=SIMDSIZE )
+      {
+         ai[R] = 0UL;
 
-      //**Postfix decrement operator***************************************************************
-      /*!\brief Post-decrement operator.
-      //
-      // \return The previous position of the iterator.
-      */
-      inline const ConstIterator operator--( int ) {
-         return ConstIterator( k_-- );
-      }
-      //*******************************************************************************************
+         SIMDType xmm1( ArrayRowApply( load, ai, j ) );
 
-      //**Element access operator******************************************************************
-      /*!\brief Direct access to the element at the current iterator position.
-      //
-      // \return The resulting value.
-      */
-      //inline ReturnType operator*() const {
-      //   return reduce( arrayslice< R >( dm_, k_, unchecked ), op_ );
-      //}
-      //*******************************************************************************************
+         for( size_t l=1UL; l<L; ++l ) {
+            ai[R] = l;
+            xmm1 = op( xmm1, ArrayRowApply( load, ai, j ) );
+         }
 
-      //**Equality operator************************************************************************
-      /*!\brief Equality comparison between two ConstIterator objects.
-      //
-      // \param rhs The right-hand side iterator.
-      // \return \a true if the iterators refer to the same element, \a false if not.
-      */
-      inline bool operator==( const ConstIterator& rhs ) const {
-         return k_ == rhs.k_;
+         store( j, xmm1 );
       }
-      //*******************************************************************************************
 
-      //**Inequality operator**********************************************************************
-      /*!\brief Inequality comparison between two ConstIterator objects.
-      //
-      // \param rhs The right-hand side iterator.
-      // \return \a true if the iterators don't refer to the same element, \a false if they do.
-      */
-      inline bool operator!=( const ConstIterator& rhs ) const {
-         return k_ != rhs.k_;
-      }
-      //*******************************************************************************************
+      for( ; remainder && j<jend; ++j )
+      {
+         ai[R] = 0UL;
 
-      //**Less-than operator***********************************************************************
-      /*!\brief Less-than comparison between two ConstIterator objects.
-      //
-      // \param rhs The right-hand side iterator.
-      // \return \a true if the left-hand side iterator is smaller, \a false if not.
-      */
-      inline bool operator<( const ConstIterator& rhs ) const {
-         return k_ < rhs.k_;
-      }
-      //*******************************************************************************************
+         ET value( ArrayRowApply( get, ai, j ) );
 
-      //**Greater-than operator********************************************************************
-      /*!\brief Greater-than comparison between two ConstIterator objects.
-      //
-      // \param rhs The right-hand side iterator.
-      // \return \a true if the left-hand side iterator is greater, \a false if not.
-      */
-      inline bool operator>( const ConstIterator& rhs ) const {
-         return !(*this <= rhs);
+         for( size_t l=1UL; l<L; ++l ) {
+            ai[R] = l;
+            value = op( value, ArrayRowApply( get, ai, j ) );
+         }
+
+         ArrayRowApply( target, indices, j ) = value;
       }
-      //*******************************************************************************************
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-      //**Less-or-equal-than operator**************************************************************
-      /*!\brief Less-than comparison between two ConstIterator objects.
-      //
-      // \param rhs The right-hand side iterator.
-      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
-      */
-      inline bool operator<=( const ConstIterator& rhs ) const {
-         return k_ <= rhs.k_;
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction of a block of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The reduction operation.
+// \param rbegin The first row of the target array to be computed.
+// \param rend The row behind the last row of the target array to be computed.
+// \param jbegin The first column of the target array to be computed.
+// \param jend The column behind the last column of the target array to be computed.
+// \return void
+//
+// Each row of the result is computed by accumulating entire rows of the operand element-wise.
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto darrayreduceAccumulate( DenseArray<TT>& C, const MT& A, OP op,
+                                    size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> DisableIf_t< UseVectorizedDArrReduceAccumulate_v<TT,MT,OP> >
+{
+   constexpr size_t N( MT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT( R > 0UL && R < N );
+
+   const size_t L( A.dimensions()[R] );
+
+   const auto get    = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto target = [&C]( auto... indices ) -> decltype(auto) { return (~C)( indices... ); };
+
+   ArrayForEachRow( (~C).dimensions(), 0UL, rbegin, rend,
+                    [&]( size_t, const std::array<size_t,N-1UL>& indices )
+   {
+      std::array<size_t,N> ai( mergeDims<R>( indices, 0UL ) );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         ArrayRowApply( target, indices, j ) = ArrayRowApply( get, ai, j );
       }
-      //*******************************************************************************************
 
-      //**Greater-or-equal-than operator***********************************************************
-      /*!\brief Greater-than comparison between two ConstIterator objects.
-      //
-      // \param rhs The right-hand side iterator.
-      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
-      */
-      inline bool operator>=( const ConstIterator& rhs ) const {
-         return !(*this < rhs);
+      for( size_t l=1UL; l<L; ++l ) {
+         ai[R] = l;
+         for( size_t j=jbegin; j<jend; ++j ) {
+            auto&& value( ArrayRowApply( target, indices, j ) );
+            value = op( value, ArrayRowApply( get, ai, j ) );
+         }
       }
-      //*******************************************************************************************
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-      //**Subtraction operator*********************************************************************
-      /*!\brief Calculating the number of elements between two iterators.
-      //
-      // \param rhs The right-hand side iterator.
-      // \return The number of elements between the two iterators.
-      */
-      inline DifferenceType operator-( const ConstIterator& rhs ) const {
-         return k_ - rhs.k_;
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized reduction of a range of rows of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The reduction operation.
+// \param begin The first row of the operand to be reduced.
+// \param end The row behind the last row of the operand to be reduced.
+// \return void
+//
+// Each row of the operand is reduced to a single element of the target array. The row is
+// accumulated in four independent SIMD registers, which are combined and reduced horizontally
+// once the row has been traversed.
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto darrayreduceHorizontal( DenseArray<TT>& C, const MT& A, OP op,
+                                    size_t begin, size_t end )
+   -> EnableIf_t< ArrayHelper<MT,OP>::value >
+{
+   using ET       = ElementType_t<MT>;
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t N( MT::num_dimensions );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t n( A.dimensions()[0] );
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+
+   const auto get    = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load   = [&A]( auto... indices ) { return A.load( indices... ); };
+   const auto target = [&C]( auto... indices ) -> decltype(auto) { return (~C)( indices... ); };
+
+   ArrayForEachRow( A.dimensions(), 0UL, begin, end,
+                    [&]( size_t, const std::array<size_t,N>& indices )
+   {
+      std::array<size_t,N-1UL> ci;
+      for( size_t d=1UL; d<N; ++d ) {
+         ci[d-1UL] = indices[d];
       }
-      //*******************************************************************************************
 
-      //**Addition operator************************************************************************
-      /*!\brief Addition between a ConstIterator and an integral value.
-      //
-      // \param it The iterator to be incremented.
-      // \param inc The number of elements the iterator is incremented.
-      // \return The incremented iterator.
-      */
-      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
-         return ConstIterator( it.k_ + inc );
+      if( jpos == 0UL )
+      {
+         ET value( ArrayRowApply( get, indices, 0UL ) );
+
+         for( size_t j=1UL; j<n; ++j ) {
+            value = op( value, ArrayRowApply( get, indices, j ) );
+         }
+
+         ArrayRowApply( target, ci, ci[0] ) = value;
+         return;
       }
-      //*******************************************************************************************
 
-      //**Addition operator************************************************************************
-      /*!\brief Addition between an integral value and a ConstIterator.
-      //
-      // \param inc The number of elements the iterator is incremented.
-      // \param it The iterator to be incremented.
-      // \return The incremented iterator.
-      */
-      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
-         return ConstIterator( it.k_ + inc );
+      size_t j( SIMDSIZE );
+
+      SIMDType xmm1( ArrayRowApply( load, indices, 0UL ) );
+
+      if( jpos >= SIMDSIZE*4UL )
+      {
+         SIMDType xmm2( ArrayRowApply( load, indices, SIMDSIZE     ) );
+         SIMDType xmm3( ArrayRowApply( load, indices, SIMDSIZE*2UL ) );
+         SIMDType xmm4( ArrayRowApply( load, indices, SIMDSIZE*3UL ) );
+
+         for( j=SIMDSIZE*4UL; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            xmm1 = op( xmm1, ArrayRowApply( load, indices, j              ) );
+            xmm2 = op( xmm2, ArrayRowApply( load, indices, j+SIMDSIZE     ) );
+            xmm3 = op( xmm3, ArrayRowApply( load, indices, j+SIMDSIZE*2UL ) );
+            xmm4 = op( xmm4, ArrayRowApply( load, indices, j+SIMDSIZE*3UL ) );
+         }
+
+         xmm1 = op( op( xmm1, xmm2 ), op( xmm3, xmm4 ) );
       }
-      //*******************************************************************************************
 
-      //**Subtraction operator*********************************************************************
-      /*!\brief Subtraction between a ConstIterator and an integral value.
-      //
-      // \param it The iterator to be decremented.
-      // \param dec The number of elements the iterator is decremented.
-      // \return The decremented iterator.
-      */
-      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
-         return ConstIterator( it.k_ - dec );
-      }
-      //*******************************************************************************************
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         xmm1 = op( xmm1, ArrayRowApply( load, indices, j ) );
+      }
+
+      ET value( reduce( xmm1, op ) );
+
+      for( j=jpos; j<n; ++j ) {
+         value = op( value, ArrayRowApply( get, indices, j ) );
+      }
+
+      ArrayRowApply( target, ci, ci[0] ) = value;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction of a range of rows of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The reduction operation.
+// \param begin The first row of the operand to be reduced.
+// \param end The row behind the last row of the operand to be reduced.
+// \return void
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto darrayreduceHorizontal( DenseArray<TT>& C, const MT& A, OP op,
+                                    size_t begin, size_t end )
+   -> DisableIf_t< ArrayHelper<MT,OP>::value >
+{
+   constexpr size_t N( MT::num_dimensions );
+
+   const size_t n( A.dimensions()[0] );
+
+   const auto get    = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto target = [&C]( auto... indices ) -> decltype(auto) { return (~C)( indices... ); };
+
+   ArrayForEachRow( A.dimensions(), 0UL, begin, end,
+                    [&]( size_t, const std::array<size_t,N>& indices )
+   {
+      std::array<size_t,N-1UL> ci;
+      for( size_t d=1UL; d<N; ++d ) {
+         ci[d-1UL] = indices[d];
+      }
+
+      ElementType_t<TT> value( ArrayRowApply( get, indices, 0UL ) );
+
+      for( size_t j=1UL; j<n; ++j ) {
+         value = op( value, ArrayRowApply( get, indices, j ) );
+      }
+
+      ArrayRowApply( target, ci, ci[0] ) = value;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial reduction of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand (with a non-empty reduced dimension).
+// \param op The reduction operation.
+// \return void
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto darrayreduceAssign( DenseArray<TT>& C, const MT& A, OP op )
+   -> EnableIf_t< R != 0UL >
+{
+   darrayreduceAccumulate<R>( ~C, A, op, 0UL, arrayRows( ~C ), 0UL, (~C).dimensions()[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial reduction of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand (with a non-empty reduced dimension).
+// \param op The reduction operation.
+// \return void
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto darrayreduceAssign( DenseArray<TT>& C, const MT& A, OP op )
+   -> EnableIf_t< R == 0UL >
+{
+   darrayreduceHorizontal( ~C, A, op, 0UL, arrayRows( A ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP reduction of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand (with a non-empty reduced dimension).
+// \param op The reduction operation.
+// \return void
+//
+// The rows of the target array (i.e. all non-reduced outer dimensions) are distributed among
+// the available threads. In case there are fewer rows than threads, the columns are
+// distributed in chunks of full SIMD vectors.
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto smpDArrReduceAssign( DenseArray<TT>& C, const MT& A, OP op )
+   -> EnableIf_t< R != 0UL >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT> >::size );
+
+   const size_t M( arrayRows( ~C ) );
+   const size_t N( (~C).dimensions()[0] );
+   const size_t tasks( smpTasks() );
+
+   if( tasks < 2UL || M*N < 2UL ) {
+      darrayreduceAssign<R>( ~C, A, op );
+   }
+   else if( M >= tasks ) {
+      const size_t rows( ( M + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*rows );
+         const size_t end  ( min( begin+rows, M ) );
+         if( begin < end )
+            darrayreduceAccumulate<R>( ~C, A, op, begin, end, 0UL, N );
+      } );
+   }
+   else {
+      const size_t columns( nextMultiple( ( N + tasks - 1UL ) / tasks, SIMDSIZE ) );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*columns );
+         const size_t end  ( min( begin+columns, N ) );
+         if( begin < end )
+            darrayreduceAccumulate<R>( ~C, A, op, 0UL, M, begin, end );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP reduction of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand (with a non-empty reduced dimension).
+// \param op The reduction operation.
+// \return void
+//
+// The rows of the operand (i.e. the elements of the target array) are distributed in
+// contiguous ranges among the available threads.
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto smpDArrReduceAssign( DenseArray<TT>& C, const MT& A, OP op )
+   -> EnableIf_t< R == 0UL >
+{
+   const size_t rows( arrayRows( A ) );
+   const size_t tasks( min( smpTasks(), rows ) );
+
+   if( tasks < 2UL ) {
+      darrayreduceAssign<R>( ~C, A, op );
+      return;
+   }
+
+   const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( t*chunk );
+      const size_t end  ( min( begin+chunk, rows ) );
+
+      if( begin < end ) {
+         darrayreduceHorizontal( ~C, A, op, begin, end );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR ARBITRARY REDUCTION OPERATIONS OF ARRAYS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for arbitrary dense array reduction operations.
+// \ingroup dense_array_expression
+//
+// This specialization of the ReducedArray class template represents the compile time expression
+// for the reduction of a dense array along dimension \a R, where dimension 0 is the innermost
+// dimension. The resulting array has one dimension less than the operand.
+*/
+template< typename MT    // Type of the dense array
+        , typename OP    // Type of the reduction operation
+        , ReductionFlag R >     // Dimension along which to perform reduction
+class ReducedArray
+   : public ArrReduceExpr< DenseArray< ReducedArray<MT,OP,R> >, R >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT = ResultType_t<MT>;   //!< Result type of the dense array expression.
+   using ET = ElementType_t<MT>;  //!< Element type of the dense array expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Number of dimensions of the dense array operand.
+   static constexpr size_t N = RemoveCV_t< RemoveReference_t<MT> >::num_dimensions;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = ReducedArray<MT,OP,R>;          //!< Type of this ReducedArray instance.
+   using ResultType    = ReduceTrait_t<RT,OP,R>;         //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;    //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;      //!< Resulting element type.
+   using SIMDType      = SIMDTrait_t<ElementType>;       //!< Resulting SIMD element type.
+   using ReturnType    = const ElementType;              //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;               //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side dense array expression.
+   using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+
+   //! Data type of the custom unary operation.
+   using Operation = OP;
+   //**********************************************************************************************
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the dense array.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = ElementType;                      //!< Type of the underlying elements.
+      using PointerType      = ElementType*;                     //!< Pointer return type.
+      using ReferenceType    = ElementType&;                     //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param dm The dense array operand of the reduction expression.
+      // \param i Index to the initial array page.
+      // \param i Index to the array row.
+      // \param op The reduction operation.
+      */
+      explicit inline ConstIterator( Operand dm, size_t k, OP op )
+         : dm_   ( dm    )  // Dense array of the reduction expression
+         , k_    ( k )      // Index to the current array page
+         , op_   ( op    )  // The reduction operation
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) {
+         k_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) {
+         k_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         ++k_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         return ConstIterator( k_++ );
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() {
+         --k_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) {
+         return ConstIterator( k_-- );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      //inline ReturnType operator*() const {
+      //   return reduce( arrayslice< R >( dm_, k_, unchecked ), op_ );
+      //}
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return k_ == rhs.k_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return k_ != rhs.k_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const {
+         return k_ < rhs.k_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const {
+         return !(*this <= rhs);
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const {
+         return k_ <= rhs.k_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const {
+         return !(*this < rhs);
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return k_ - rhs.k_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
+         return ConstIterator( it.k_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
+         return ConstIterator( it.k_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
+         return ConstIterator( it.k_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      Operand dm_;     //!< Dense array of the reduction expression.
+      size_t  k_;      //!< Index to the current array page.
+      OP      op_;     //!< The reduction operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = MT::smpAssignable;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ReducedArray class.
+   //
+   // \param dm The array operand of the reduction expression.
+   // \param op The reduction operation.
+   */
+   explicit inline ReducedArray( const MT& dm, OP op ) noexcept
+      : dm_( dm )  // Dense array of the reduction expression
+      , op_( op )  // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Multi-dimensional access to the array elements.
+   //
+   // \param dims Access indices (outermost dimension first).
+   // \return The resulting value.
+   */
+   template< typename... Dims >
+   inline ReturnType operator()( Dims... dims ) const {
+      BLAZE_STATIC_ASSERT( sizeof...( Dims ) == N-1UL );
+      const std::array<size_t,N-1UL> outer{ { size_t( dims )... } };
+      std::array<size_t,N-1UL> indices;
+      for( size_t d=0UL; d<N-1UL; ++d ) {
+         indices[d] = outer[N-2UL-d];
+      }
+      return (*this)( indices );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Multi-dimensional access to the array elements.
+   //
+   // \param indices Access indices (innermost dimension first).
+   // \return The resulting value.
+   //
+   // The element is computed by reducing the elements of the operand along dimension \a R.
+   */
+   inline ReturnType operator()( const std::array<size_t,N-1UL>& indices ) const {
+      const auto get = [this]( auto... is ) -> decltype(auto) { return dm_( is... ); };
+      const size_t L( dm_.dimensions()[R] );
+      if( L == 0UL ) {
+         return ElementType();
+      }
+      std::array<size_t,N> ai( mergeDims<R>( indices, 0UL ) );
+      ElementType value( ArrayRowApply( get, ai, ai[0] ) );
+      for( size_t l=1UL; l<L; ++l ) {
+         ai[R] = l;
+         value = op_( value, ArrayRowApply( get, ai, ai[0] ) );
+      }
+      return value;
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the array elements.
+   //
+   // \param dims Access indices (outermost dimension first).
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid array access index.
+   */
+   template< typename... Dims >
+   inline ReturnType at( Dims... dims ) const {
+      const std::array<size_t,N-1UL> indices{ { size_t( dims )... } };
+      const std::array<size_t,N-1UL> sizes( dimensions() );
+      for( size_t d=0UL; d<N-1UL; ++d ) {
+         if( indices[d] >= sizes[N-2UL-d] ) {
+            BLAZE_THROW_OUT_OF_RANGE( "Invalid array access index" );
+         }
+      }
+      return (*this)( dims... );
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first element of the dense array.
+   //
+   // \return Iterator to the first element of the dense array.
+   */
+   inline ConstIterator begin( size_t i ) const {
+      return ConstIterator( dm_, i, op_ );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last non-zero element of the dense array.
+   //
+   // \return Iterator just past the last non-zero element of the dense array.
+   */
+   inline ConstIterator end( size_t i ) const {
+      return ConstIterator( dm_, i, op_ );
+   }
+   //**********************************************************************************************
+
+   //**Num_dimensions function*******************************************************************************
+   /*!\brief Returns the current number of dimensions of the array.
+   //
+   // \return The size of the array.
+   */
+   static constexpr size_t num_dimensions = N-1UL;
+
+   //**********************************************************************************************
+
+   //**Dimensions function****************************************************************************
+   /*!\brief Returns the current dimensions of the array.
+   //
+   // \return The dimensions of the array (innermost dimension first).
+   //
+   // The dimensions of the result are the dimensions of the operand without dimension \a R.
+   */
+   inline std::array<size_t,N-1UL> dimensions() const noexcept {
+      const std::array<size_t,N>& dims( dm_.dimensions() );
+      std::array<size_t,N-1UL> result;
+      for( size_t d=0UL; d<N-1UL; ++d ) {
+         result[d] = dims[ d < R ? d : d+1UL ];
+      }
+      return result;
+   }
+   //**********************************************************************************************
+
+   //**Pages function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the array.
+   //
+   // \return The size of the array.
+   */
+   template< size_t Dim >
+   inline size_t dimension() const noexcept {
+      return dm_.template dimension< ( Dim < R ? Dim : Dim+1UL ) >();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense array operand.
+   //
+   // \return The dense array operand.
+   */
+   inline Operand operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return dm_.canSMPAssign() ||
+             ( arrayRows( dm_ ) * dm_.template dimension<0>() >= SMP_DARRREDUCE_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   dm_;  //!< Dense array of the reduction expression.
+   Operation op_;  //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense arrays******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense array reduction operation to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense array reduction
+   // expression to a dense array. A reduction along the innermost dimension reduces each row
+   // of the operand horizontally, a reduction along an outer dimension accumulates entire rows
+   // of the operand. Both are vectorized, if possible.
+   */
+   template< typename VT1 >  // Type of the target dense array
+   friend inline void assign( DenseArray<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      if( rhs.dm_.dimensions()[R] == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      decltype(auto) A( darrayreduceOperand( rhs.dm_ ) );  // Evaluation of the dense array operand
+      darrayreduceAssign<R>( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to arrays***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense array reduction operation to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense array
+   // reduction expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void addAssign( Array<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to arrays************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense array reduction operation to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense array
+   // reduction expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void subAssign( Array<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to arrays*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a dense array reduction operation to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a dense
+   // array reduction expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void multAssign( Array<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to arrays***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a dense array reduction operation to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a dense array
+   // reduction expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void divAssign( Array<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense arrays**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense array reduction operation to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense array
+   // reduction expression to a dense array. The non-reduced dimensions are distributed among
+   // the available threads: In case of a reduction along the innermost dimension the rows of the
+   // operand, otherwise the rows or, in case there are not sufficiently many, the columns of the
+   // target array.
+   */
+   template< typename VT1 >  // Type of the target dense array
+   friend inline void smpAssign( DenseArray<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      if( rhs.dm_.dimensions()[R] == 0UL ) {
+         reset( ~lhs );
+      }
+      else if( !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+      }
+      else {
+         decltype(auto) A( smpDArrReduceOperand( rhs.dm_ ) );  // Evaluation of the dense array operand
+         smpDArrReduceAssign<R>( ~lhs, A, rhs.op_ );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to arrays***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense array reduction operation to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // array reduction expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void smpAddAssign( Array<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to arrays********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense array reduction operation to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // array reduction expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void smpSubAssign( Array<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to arrays*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a dense array reduction operation to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // dense array reduction expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void smpMultAssign( Array<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to arrays***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a dense array reduction operation to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a dense
+   // array reduction expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void smpDivAssign( Array<VT1>& lhs, const ReducedArray& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( MT );
+   BLAZE_STATIC_ASSERT( N >= 2UL && R < N );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED REDUCTION OPERANDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the storage of a leaf operand of a fused reduction.
+// \ingroup dense_array
+//
+// Dense arrays that are no expressions are stored by reference. Expressions are stored by
+// value, which either stores the expression itself (in case it can be evaluated element-wise)
+// or the temporary result of an expression that requires an intermediate evaluation.
+*/
+template< typename MT >  // Type of the dense array operand
+using DArrFusedOperand_t =
+   If_t< IsExpression_v<MT>, RemoveCV_t< RemoveReference_t< CompositeType_t<MT> > >, const MT& >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise unary operation within a fused reduction of a dense array expression.
+// \ingroup dense_array
+//
+// The DArrFusedUnary class template is the dense array counterpart of the DTensFusedUnary class
+// template: it applies a unary element-wise operation on the fly within the reduction kernels,
+// such that only the leaf operands that require an intermediate evaluation are evaluated.
+*/
+template< typename CT    // Storage type of the dense array operand
+        , typename OP >  // Type of the custom unary operation
+class DArrFusedUnary
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MT = RemoveCV_t< RemoveReference_t<CT> >;  //!< Type of the dense array operand.
+   using ET = ElementType_t<MT>;                    //!< Element type of the dense array operand.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
 
-    private:
-      //**Member variables*************************************************************************
-      Operand dm_;     //!< Dense array of the reduction expression.
-      size_t  k_;      //!< Index to the current array page.
-      OP      op_;     //!< The reduction operation.
-      //*******************************************************************************************
-   };
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Resulting element type.
+   using ElementType = RemoveCV_t< RemoveReference_t<
+      decltype( std::declval<OP>()( std::declval<ET>() ) ) > >;
+
+   //! Data type for composite expression templates.
+   using CompositeType = const DArrFusedUnary&;
    //**********************************************************************************************
 
    //**Compilation flags***************************************************************************
-   //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   //! Compilation switch for the vectorized evaluation within the reduction kernels.
+   static constexpr bool simdEnabled =
+      ( MT::simdEnabled &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET>, HasLoad<OP> >::value );
 
-   //! Compilation switch for the expression template assignment strategy.
-   static constexpr bool smpAssignable = MT::smpAssignable;
+   //! The number of dimensions of the array.
+   static constexpr size_t num_dimensions = MT::num_dimensions;
    //**********************************************************************************************
 
    //**Constructor*********************************************************************************
-   /*!\brief Constructor for the ReducedArray class.
+   /*!\brief Constructor for the DArrFusedUnary class.
    //
-   // \param dm The array operand of the reduction expression.
-   // \param op The reduction operation.
+   // \param dm The dense array operand.
+   // \param op The custom unary operation.
    */
-   explicit inline ReducedArray( const MT& dm, OP op ) noexcept
-      : dm_( dm )  // Dense array of the reduction expression
-      , op_( op )  // The reduction operation
+   explicit inline DArrFusedUnary( CT dm, OP op )
+      : dm_( std::forward<CT>( dm ) )  // Dense array operand
+      , op_( op )                      // The custom unary operation
    {}
    //**********************************************************************************************
 
-   //**Subscript operator**************************************************************************
-   /*!\brief Subscript operator for the direct access to the array elements.
-   //
-   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
-   // \return The resulting value.
-   */
-   //template< typename... Dims >
-   //inline ReturnType operator()( Dims... dims ) const {
-   //   return reduce( arrayslice<R>( dm_, dims..., unchecked ), op_ );
-   //}
-   //**********************************************************************************************
-
-   //**At function*********************************************************************************
-   /*!\brief Checked access to the array elements.
+   //**Access operator*****************************************************************************
+   /*!\brief Access to the array elements.
    //
-   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \param dims Access indices of the element (either variadic or as std::array).
    // \return The resulting value.
-   // \exception std::out_of_range Invalid array access index.
    */
    template< typename... Dims >
-   inline ReturnType at( Dims... dims ) const {
-      constexpr size_t indices[] = {dims...};
-
-      ArrayDimForEach( dm_.dimensions(), [&]( size_t i, size_t dim ) {
-         if( indices[i] >= dim ) {
-            BLAZE_THROW_OUT_OF_RANGE( "Invalid array access index" );
-         }
-      } );
-      return (*this)(dims...);
-   }
-   //**********************************************************************************************
-
-   //**Begin function******************************************************************************
-   /*!\brief Returns an iterator to the first element of the dense array.
-   //
-   // \return Iterator to the first element of the dense array.
-   */
-   inline ConstIterator begin( size_t i ) const {
-      return ConstIterator( dm_, i, op_ );
+   inline ElementType operator()( Dims... dims ) const {
+      return op_( dm_(dims...) );
    }
    //**********************************************************************************************
 
-   //**End function********************************************************************************
-   /*!\brief Returns an iterator just past the last non-zero element of the dense array.
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the array.
    //
-   // \return Iterator just past the last non-zero element of the dense array.
+   // \param dims Access indices of the first element of the SIMD element.
+   // \return The resulting SIMD element.
    */
-   inline ConstIterator end( size_t i ) const {
-      return ConstIterator( dm_, i, op_ );
+   template< typename... Dims >
+   BLAZE_ALWAYS_INLINE auto load( Dims... dims ) const noexcept {
+      return op_.load( dm_.load(dims...) );
    }
    //**********************************************************************************************
 
-   //**Num_dimensions function*******************************************************************************
-   /*!\brief Returns the current number of dimensions of the array.
-   //
-   // \return The size of the array.
-   */
-   static constexpr size_t num_dimensions =
-      RemoveCV_t< RemoveReference_t< Operand > >::num_dimensions;
-
-   //**********************************************************************************************
-
-   //**Dimensions function****************************************************************************
+   //**Dimensions function*************************************************************************
    /*!\brief Returns the current dimensions of the array.
    //
    // \return The dimensions of the array.
@@ -502,444 +1590,569 @@ class ReducedArray
    }
    //**********************************************************************************************
 
-   //**Pages function*******************************************************************************
-   /*!\brief Returns the current size/dimension of the array.
-   //
-   // \return The size of the array.
-   */
-   template< size_t Dim >
-   inline size_t dimension() const noexcept {
-      return dm_.template dimension<Dim>();
-   }
+ private:
+   //**Member variables****************************************************************************
+   CT dm_;  //!< Dense array operand of the fused operation.
+   OP op_;  //!< The custom unary operation.
    //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
 
-   //**Operand access******************************************************************************
-   /*!\brief Returns the dense array operand.
-   //
-   // \return The dense array operand.
-   */
-   inline Operand operand() const noexcept {
-      return dm_;
-   }
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise binary operation within a fused reduction of a dense array expression.
+// \ingroup dense_array
+//
+// The DArrFusedBinary class template is the dense array counterpart of the DTensFusedBinary
+// class template: it applies a binary element-wise operation on the fly within the reduction
+// kernels, such that only the leaf operands that require an intermediate evaluation are
+// evaluated.
+*/
+template< typename CT1   // Storage type of the left-hand side dense array operand
+        , typename CT2   // Storage type of the right-hand side dense array operand
+        , typename OP >  // Type of the custom binary operation
+class DArrFusedBinary
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MT1 = RemoveCV_t< RemoveReference_t<CT1> >;  //!< Type of the left-hand side operand.
+   using MT2 = RemoveCV_t< RemoveReference_t<CT2> >;  //!< Type of the right-hand side operand.
+   using ET1 = ElementType_t<MT1>;  //!< Element type of the left-hand side operand.
+   using ET2 = ElementType_t<MT2>;  //!< Element type of the right-hand side operand.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
    //**********************************************************************************************
 
-   //**Operation access****************************************************************************
-   /*!\brief Returns a copy of the reduction operation.
-   //
-   // \return A copy of the reduction operation.
-   */
-   inline Operation operation() const {
-      return op_;
-   }
+ public:
+   //**Type definitions****************************************************************************
+   //! Resulting element type.
+   using ElementType = RemoveCV_t< RemoveReference_t<
+      decltype( std::declval<OP>()( std::declval<ET1>(), std::declval<ET2>() ) ) > >;
+
+   //! Data type for composite expression templates.
+   using CompositeType = const DArrFusedBinary&;
    //**********************************************************************************************
 
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized evaluation within the reduction kernels.
+   static constexpr bool simdEnabled =
+      ( MT1::simdEnabled && MT2::simdEnabled &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET1,ET2>, HasLoad<OP> >::value );
+
+   //! The number of dimensions of the array.
+   static constexpr size_t num_dimensions = MT1::num_dimensions;
    //**********************************************************************************************
-   /*!\brief Returns whether the expression can alias with the given address \a alias.
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DArrFusedBinary class.
    //
-   // \param alias The alias to be checked.
-   // \return \a true in case an aliasing effect is possible, \a false if not.
+   // \param lhs The left-hand side dense array operand.
+   // \param rhs The right-hand side dense array operand.
+   // \param op The custom binary operation.
    */
-   template< typename T >
-   inline bool canAlias( const T* alias ) const noexcept {
-      return ( dm_.isAliased( alias ) );
+   explicit inline DArrFusedBinary( CT1 lhs, CT2 rhs, OP op )
+      : lhs_( std::forward<CT1>( lhs ) )  // Left-hand side dense array operand
+      , rhs_( std::forward<CT2>( rhs ) )  // Right-hand side dense array operand
+      , op_ ( op )                        // The custom binary operation
+   {
+      BLAZE_INTERNAL_ASSERT( lhs_.dimensions() == rhs_.dimensions(), "Invalid number of elements" );
    }
    //**********************************************************************************************
 
-   //**********************************************************************************************
-   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //**Access operator*****************************************************************************
+   /*!\brief Access to the array elements.
    //
-   // \param alias The alias to be checked.
-   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   // \param dims Access indices of the element (either variadic or as std::array).
+   // \return The resulting value.
    */
-   template< typename T >
-   inline bool isAliased( const T* alias ) const noexcept {
-      return ( dm_.isAliased( alias ) );
+   template< typename... Dims >
+   inline ElementType operator()( Dims... dims ) const {
+      return op_( lhs_(dims...), rhs_(dims...) );
    }
    //**********************************************************************************************
 
-   //**********************************************************************************************
-   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the array.
    //
-   // \return \a true in case the operands are aligned, \a false if not.
+   // \param dims Access indices of the first element of the SIMD element.
+   // \return The resulting SIMD element.
    */
-   inline bool isAligned() const noexcept {
-      return false;
+   template< typename... Dims >
+   BLAZE_ALWAYS_INLINE auto load( Dims... dims ) const noexcept {
+      return op_.load( lhs_.load(dims...), rhs_.load(dims...) );
    }
    //**********************************************************************************************
 
-   //**********************************************************************************************
-   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //**Dimensions function*************************************************************************
+   /*!\brief Returns the current dimensions of the array.
    //
-   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   // \return The dimensions of the array.
    */
-   inline bool canSMPAssign() const noexcept {
-      return dm_.canSMPAssign() || ( dimension<1>() * dimension<0>() > SMP_DMATREDUCE_THRESHOLD );
+   inline decltype(auto) dimensions() const noexcept {
+      return lhs_.dimensions();
    }
    //**********************************************************************************************
 
  private:
    //**Member variables****************************************************************************
-   Operand   dm_;  //!< Dense array of the reduction expression.
-   Operation op_;  //!< The reduction operation.
+   CT1 lhs_;  //!< Left-hand side dense array operand of the fused operation.
+   CT2 rhs_;  //!< Right-hand side dense array operand of the fused operation.
+   OP  op_;   //!< The custom binary operation.
    //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
 
-   //**Assignment to tensors***********************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a row-wise dense array reduction operation to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression to be assigned.
-   // \return void
-   //
-   // This function implements the performance optimized assignment of a row-wise row-major
-   // dense array reduction expression to a array. Due to the explicit application of the SFINAE
-   // principle, this function can only be selected by the compiler in case the expression specific
-   // parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto assign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary type trait for the detection of the element-wise dense array expressions
+//        that can be fused into a reduction.
+// \ingroup dense_array
+//
+// In case the given type \a MT is an element-wise dense array map expression, the \a value
+// member constant is set to \a true, otherwise it is set to \a false.
+*/
+template< typename MT >  // Type of the dense array operand
+struct IsFusableDArrReduce
+   : public FalseType
+{};
+
+template< typename MT, typename OP >
+struct IsFusableDArrReduce< DArrMapExpr<MT,OP> >
+   : public TrueType
+{};
+
+template< typename MT1, typename MT2, typename OP >
+struct IsFusableDArrReduce< DArrDArrMapExpr<MT1,MT2,OP> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the fused reduction of a dense array.
+// \ingroup dense_array
+//
+// An element-wise dense array expression is reduced without intermediate evaluation in case
+// the expression itself would require an evaluation into a temporary array.
+*/
+template< typename MT >  // Type of the dense array operand
+constexpr bool UseFusedDArrReduce_v =
+   ( RequiresEvaluation_v<MT> && IsFusableDArrReduce<MT>::value );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the fused representation of a leaf operand of a fused reduction.
+// \ingroup dense_array
+//
+// \param dm The dense array operand.
+// \return The stored dense array operand (see DArrFusedOperand_t).
+*/
+template< typename MT >  // Type of the dense array operand
+inline DArrFusedOperand_t<MT> fuseDArrOperand( const DenseArray<MT>& dm )
+{
+   return DArrFusedOperand_t<MT>( ~dm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the fused representation of element-wise dense array expressions.
+// \ingroup dense_array
+//
+// \param dm The element-wise dense array expression.
+// \return The fused element-wise operation.
+//
+// These overloads recursively replace the element-wise expressions of an expression tree by
+// their fused counterparts. The recursion stops at all other operands (see DArrFusedOperand_t).
+*/
+template< typename MT, typename OP >
+inline auto fuseDArrOperand( const DArrMapExpr<MT,OP>& dm )
+{
+   using CT = decltype( fuseDArrOperand( dm.operand() ) );
+
+   return DArrFusedUnary<CT,OP>( fuseDArrOperand( dm.operand() ), dm.operation() );
+}
+
+template< typename MT1, typename MT2, typename OP >
+inline auto fuseDArrOperand( const DArrDArrMapExpr<MT1,MT2,OP>& dm )
+{
+   using CT1 = decltype( fuseDArrOperand( dm.leftOperand() ) );
+   using CT2 = decltype( fuseDArrOperand( dm.rightOperand() ) );
+
+   return DArrFusedBinary<CT1,CT2,OP>( fuseDArrOperand( dm.leftOperand() )
+                                     , fuseDArrOperand( dm.rightOperand() ), dm.operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the dense array operand of a total reduction.
+// \ingroup dense_array
+//
+// \param dm The dense array operand.
+// \return The evaluated or fused dense array operand.
+//
+// Element-wise expressions that would otherwise be evaluated into a temporary array are
+// replaced by their fused representation, which evaluates the element-wise operations in
+// registers. All other operands are evaluated according to their composite type.
+*/
+template< typename MT >  // Type of the dense array operand
+inline auto darrayreduceTotalOperand( const DenseArray<MT>& dm )
+   -> EnableIf_t< UseFusedDArrReduce_v<MT>, decltype( fuseDArrOperand( ~dm ) ) >
+{
+   return fuseDArrOperand( ~dm );
+}
+
+template< typename MT >  // Type of the dense array operand
+inline auto darrayreduceTotalOperand( const DenseArray<MT>& dm )
+   -> DisableIf_t< UseFusedDArrReduce_v<MT>, CompositeType_t<MT> >
+{
+   return ~dm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized array reduction kernel.
+// \ingroup dense_array
+//
+// In case the dense array operand \a TT provides direct access to its elements and can be
+// reduced by means of the vectorized reduction operation \a OP, the variable is set to \a true.
+// Otherwise it is set to \a false.
+*/
+template< typename TT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+constexpr bool UseVectorizedDArrReduceKernel_v =
+   ( ArrayHelper<TT,OP>::value && HasConstDataAccess_v<TT> );
+/*! \endcond */
+//*************************************************************************************************
+
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense array operand
-      assign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the reduction of a range of rows of a dense array.
+// \ingroup dense_array
+//
+// \param A The dense array operand.
+// \param op The reduction operation.
+// \param begin The first row to be reduced (counting all rows of the array consecutively).
+// \param end The row behind the last row to be reduced.
+// \return The result of the reduction operation.
+//
+// This function implements the reduction of the non-empty range \f$[begin..end)\f$ of rows of
+// the given dense array, where a row is formed by the elements along the innermost dimension.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case vectorization cannot be applied.
+*/
+template< typename TT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto darrayreduceRows( const TT& A, OP op, size_t begin, size_t end )
+   -> DisableIf_t< ArrayHelper<TT,OP>::value, ElementType_t<TT> >
+{
+   using ET = ElementType_t<TT>;
 
-   //**Addition assignment to tensors**************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Addition assignment of a row-wise dense array reduction operation to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression to be added.
-   // \return void
-   //
-   // This function implements the performance optimized addition assignment of a row-wise
-   // dense array reduction expression to a array. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto addAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
+   constexpr size_t N = TT::num_dimensions;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
+
+   const std::array< size_t, N >& dims( A.dimensions() );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense array operand
-      addAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
+   std::array< size_t, N > indices{};
+   for( size_t d=1UL, r=begin; d<N; ++d ) {
+      indices[d] = r % dims[d];
+      r /= dims[d];
    }
-   /*! \endcond */
-   //**********************************************************************************************
 
-   //**Subtraction assignment to tensors***********************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a row-wise dense array reduction operation
-   //        to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression to be subtracted.
-   // \return void
-   //
-   // This function implements the performance optimized subtraction assignment of a row-wise
-   // dense array reduction expression to a array. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto subAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
+   ET redux( A( indices ) );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+   for( size_t r=begin; r<end; ++r )
+   {
+      for( indices[0]=( r == begin ? 1UL : 0UL ); indices[0]<dims[0]; ++indices[0] ) {
+         redux = op( redux, A( indices ) );
+      }
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense array operand
-      subAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
+      for( size_t d=1UL; d<N; ++d ) {
+         if( ++indices[d] < dims[d] ) break;
+         indices[d] = 0UL;
+      }
    }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Multiplication assignment to tensors********************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Multiplication assignment of a row-wise dense array reduction operation
-   //        to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression to be multiplied.
-   // \return void
-   //
-   // This function implements the performance optimized multiplication assignment of a row-wise
-   // dense array reduction expression to a array. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto multAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense array operand
-      multAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
 
-   //**Division assignment to tensors**************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Division assignment of a row-wise dense array reduction operation to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression divisor.
-   // \return void
-   //
-   // This function implements the performance optimized division assignment of a row-wise
-   // dense array reduction expression to a array. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto divAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized kernel for the reduction of a range of rows of a dense array.
+// \ingroup dense_array
+//
+// \param A The dense array operand.
+// \param op The reduction operation.
+// \param begin The first row to be reduced (counting all rows of the array consecutively).
+// \param end The row behind the last row to be reduced.
+// \return The result of the reduction operation.
+//
+// This function implements the vectorized reduction of the non-empty range \f$[begin..end)\f$
+// of rows of the given dense array. Since all rows are stored consecutively with a distance of
+// \a spacing() elements, the rows are accessed directly via the data pointer of the array. The
+// padding elements of a padded array are only included in case of a summation. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case vectorization can be applied.
+*/
+template< typename TT    // Type of the dense array operand
+        , typename OP >  // Type of the reduction operation
+inline auto darrayreduceRows( const TT& A, OP op, size_t begin, size_t end )
+   -> EnableIf_t< UseVectorizedDArrReduceKernel_v<TT,OP>, ElementType_t<TT> >
+{
+   using ET       = ElementType_t<TT>;
+   using SIMDType = SIMDTrait_t<ET>;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense array operand
-      divAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
+   constexpr bool remainder( !IsPadded_v<TT> || !IsSame_v<OP,Add> );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
 
-   //**SMP assignment to tensors*******************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP assignment of a row-wise dense array reduction operation to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression to be assigned.
-   // \return void
-   //
-   // This function implements the performance optimized SMP assignment of a row-wise row-major
-   // dense array reduction expression to a array. Due to the explicit application of the SFINAE
-   // principle, this function can only be selected by the compiler in case the expression specific
-   // parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto smpAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
+   const size_t N ( A.dimensions()[0] );
+   const size_t nn( A.spacing() );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+   const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense array operand
-      smpAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
+   const ET* row( A.data() + begin*nn );
 
-   //**SMP addition assignment to tensors**********************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP addition assignment of a row-wise dense array reduction operation
-   //        to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression to be added.
-   // \return void
-   //
-   // This function implements the performance optimized SMP addition assignment of a row-wise
-   // dense array reduction expression to a array. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto smpAddAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   if( jpos == 0UL )
    {
-      BLAZE_FUNCTION_TRACE;
+      ET redux( row[0UL] );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+      for( size_t j=1UL; j<N; ++j ) {
+         redux = op( redux, row[j] );
+      }
+
+      for( size_t r=begin+1UL; r<end; ++r ) {
+         row += nn;
+         for( size_t j=0UL; j<N; ++j ) {
+            redux = op( redux, row[j] );
+         }
+      }
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense array operand
-      smpAddAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
+      return redux;
    }
-   /*! \endcond */
-   //**********************************************************************************************
 
-   //**SMP subtraction assignment to tensors*******************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP subtraction assignment of a row-wise dense array reduction operation
-   //        to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression to be subtracted.
-   // \return void
-   //
-   // This function implements the performance optimized SMP subtraction assignment of a row-wise
-   // dense array reduction expression to a array. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto smpSubAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   alignas( AlignmentOf_v<ET> ) ET array[SIMDSIZE];
+
+   // Accumulation of the remaining (non-vectorizable) elements of a row into the first lane
+   const auto tail = [&]( SIMDType& xmm, const ET* ptr )
    {
-      BLAZE_FUNCTION_TRACE;
+      if( remainder && jpos < N ) {
+         storea( array, xmm );
+         for( size_t j=jpos; j<N; ++j ) {
+            array[0UL] = op( array[0UL], ptr[j] );
+         }
+         xmm = loada( array );
+      }
+   };
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+   SIMDType xmm1( loadu( row ) );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense array operand
-      smpSubAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
+   for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+      xmm1 = op( xmm1, loadu( row+j ) );
    }
-   /*! \endcond */
-   //**********************************************************************************************
 
-   //**SMP multiplication assignment to tensors****************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP multiplication assignment of a row-wise dense array reduction operation
-   //        to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression to be multiplied.
-   // \return void
-   //
-   // This function implements the performance optimized SMP multiplication assignment of a
-   // row-wise dense array reduction expression to a array. Due to the explicit
-   // application of the SFINAE principle, this function can only be selected by the compiler
-   // in case the expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto smpMultAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   tail( xmm1, row );
+
+   size_t r( begin+1UL );
+   row += nn;
+
+   for( ; (r+4UL) <= end; r+=4UL, row+=4UL*nn )
    {
-      BLAZE_FUNCTION_TRACE;
+      const ET* row1( row );
+      const ET* row2( row+nn );
+      const ET* row3( row+2UL*nn );
+      const ET* row4( row+3UL*nn );
+
+      SIMDType xmm2( loadu( row1 ) );
+      SIMDType xmm3( loadu( row2 ) );
+      SIMDType xmm4( loadu( row3 ) );
+      SIMDType xmm5( loadu( row4 ) );
+
+      for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+         xmm2 = op( xmm2, loadu( row1+j ) );
+         xmm3 = op( xmm3, loadu( row2+j ) );
+         xmm4 = op( xmm4, loadu( row3+j ) );
+         xmm5 = op( xmm5, loadu( row4+j ) );
+      }
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+      tail( xmm2, row1 );
+      tail( xmm3, row2 );
+      tail( xmm4, row3 );
+      tail( xmm5, row4 );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense array operand
-      smpMultAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
+      xmm1 = op( xmm1, op( op( xmm2, xmm3 ), op( xmm4, xmm5 ) ) );
    }
-   /*! \endcond */
-   //**********************************************************************************************
 
-   //**SMP division assignment to tensors**********************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP division assignment of a row-wise dense array reduction operation
-   //        to a array.
-   // \ingroup dense_array
-   //
-   // \param lhs The target left-hand side array.
-   // \param rhs The right-hand side reduction expression divisor.
-   // \return void
-   //
-   // This function implements the performance optimized SMP division assignment of a row-wise
-   // dense array reduction expression to a array. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1 >  // Type of the target dense array
-   friend inline auto smpDivAssign( Array<VT1>& lhs, const ReducedArray& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   for( ; r<end; ++r, row+=nn )
    {
-      BLAZE_FUNCTION_TRACE;
+      SIMDType xmm2( loadu( row ) );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+      for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+         xmm2 = op( xmm2, loadu( row+j ) );
+      }
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense array operand
-      smpDivAssign( ~lhs, reduce<R>( tmp, rhs.op_ ) );
+      tail( xmm2, row );
+
+      xmm1 = op( xmm1, xmm2 );
    }
-   /*! \endcond */
-   //**********************************************************************************************
 
-   //**Compile time checks*************************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( MT );
-   /*! \endcond */
-   //**********************************************************************************************
-};
-//=================================================================================================
-//
-//  CLASS DEFINITION
-//
-//=================================================================================================
+   return reduce( xmm1, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Auxiliary helper struct for the dense array reduction operation.
+/*!\brief SIMD optimized kernel for the reduction of a range of rows of a dense array expression.
 // \ingroup dense_array
+//
+// \param A The dense array operand.
+// \param op The reduction operation.
+// \param begin The first row to be reduced (counting all rows of the array consecutively).
+// \param end The row behind the last row to be reduced.
+// \return The result of the reduction operation.
+//
+// This function implements the vectorized reduction of the non-empty range \f$[begin..end)\f$
+// of rows of a dense array operand without direct access to its elements (as for instance an
+// element-wise expression). The SIMD elements are accessed via the \c load() function of the
+// operand. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case vectorization can be applied.
 */
-template< typename MT    // Type of the dense array
+template< typename TT    // Type of the dense array operand
         , typename OP >  // Type of the reduction operation
-struct ArrayHelper
+inline auto darrayreduceRows( const TT& A, OP op, size_t begin, size_t end )
+   -> EnableIf_t< ArrayHelper<TT,OP>::value && !HasConstDataAccess_v<TT>, ElementType_t<TT> >
 {
-   //**Type definitions****************************************************************************
-   //! Composite type of the dense array expression.
-   using CT = RemoveReference_t< CompositeType_t<MT> >;
+   using ET       = ElementType_t<TT>;
+   using SIMDType = SIMDTrait_t<ET>;
 
-   //! Element type of the dense array expression.
-   using ET = ElementType_t<CT>;
+   constexpr size_t N = TT::num_dimensions;
 
-   //! Definition of the HasSIMDEnabled type trait.
-   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
 
-   //! Definition of the HasLoad type trait.
-   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
-   //**********************************************************************************************
+   constexpr bool remainder( !IsPadded_v<TT> || !IsSame_v<OP,Add> );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
 
-   //**********************************************************************************************
-   static constexpr bool value =
-      ( CT::simdEnabled &&
-        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET,ET>, HasLoad<OP> >::value );
-   //**********************************************************************************************
-};
-/*! \endcond */
-//*************************************************************************************************
+   const std::array< size_t, N >& dims( A.dimensions() );
 
+   const size_t jpos( remainder ? ( dims[0] & size_t(-SIMDSIZE) ) : dims[0] );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims[0] - ( dims[0] % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
 
+   std::array< size_t, N > indices{};
+   for( size_t d=1UL, r=begin; d<N; ++d ) {
+      indices[d] = r % dims[d];
+      r /= dims[d];
+   }
 
+   if( jpos == 0UL )
+   {
+      ET redux( A( indices ) );
+
+      for( size_t r=begin; r<end; ++r ) {
+         for( indices[0]=( r == begin ? 1UL : 0UL ); indices[0]<dims[0]; ++indices[0] ) {
+            redux = op( redux, A( indices ) );
+         }
+         ArrayNextRow( dims, indices );
+      }
+
+      return redux;
+   }
+
+   const auto load = [&A]( auto... is ) { return A.load( is... ); };
+
+   alignas( AlignmentOf_v<ET> ) ET array[SIMDSIZE];
+
+   // Reduction of the current row into a single SIMD element
+   const auto row = [&]()
+   {
+      SIMDType xmm( ArrayRowApply( load, indices, 0UL ) );
+
+      for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+         xmm = op( xmm, ArrayRowApply( load, indices, j ) );
+      }
+
+      if( remainder && jpos < dims[0] ) {
+         storea( array, xmm );
+         for( indices[0]=jpos; indices[0]<dims[0]; ++indices[0] ) {
+            array[0UL] = op( array[0UL], A( indices ) );
+         }
+         indices[0] = 0UL;
+         xmm = loada( array );
+      }
+
+      return xmm;
+   };
+
+   SIMDType xmm1( row() );
+
+   for( size_t r=begin+1UL; r<end; ++r ) {
+      ArrayNextRow( dims, indices );
+      xmm1 = op( xmm1, row() );
+   }
+
+   return reduce( xmm1, op );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-//=================================================================================================
-//
-//  GLOBAL FUNCTIONS
-//
-//=================================================================================================
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the reduction of a dense array.
+/*!\brief Backend implementation of the reduction of a dense array.
 // \ingroup dense_array
 //
 // \param dm The given dense array for the reduction computation.
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a dense
-// array. Due to the explicit application of the SFINAE principle, this function can only be
-// selected by the compiler in case vectorization cannot be applied.
+// This function implements the performance optimized reduction operation for a dense array.
+// In case the array has at least SMP_DARRREDUCE_THRESHOLD elements, the rows of the array are
+// split into blocks, which are reduced in parallel by means of the active SMP backend. The
+// partial results are combined in a fixed tree order (see smpReduce()). Element-wise map
+// expressions are reduced in a single pass without evaluating the element-wise operations into
+// a temporary array (see darrayreduceTotalOperand()).
 */
 template< typename MT    // Type of the dense array
         , typename OP >  // Type of the reduction operation
 inline ElementType_t<MT> darrayreduce( const DenseArray<MT>& dm, OP op )
 {
-   using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
    constexpr size_t N =
@@ -955,20 +2168,20 @@ inline ElementType_t<MT> darrayreduce( const DenseArray<MT>& dm, OP op )
           []( size_t, size_t dim ) { return dim == 1; } ) )
       return ( ~dm )( dims );
 
-   CT tmp( ~dm );
+   decltype(auto) tmp( darrayreduceTotalOperand( ~dm ) );
 
    BLAZE_INTERNAL_ASSERT( tmp.dimensions() == (~dm).dimensions(), "Invalid number of elements" );
 
-   ET redux = ( ~dm )( dims );   // start with first element
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<N; ++d ) {
+      rows *= tmp.dimensions()[d];
+   }
 
-   std::array< size_t, N > starts_with{1};
-   ArrayForEachGroupedStartsWith( ( ~dm ).dimensions(),
-      [&]( std::array< size_t, N > const& ds ) {
-         redux = op( redux, tmp( ds ) );
-      },
-      starts_with );
+   const bool parallel( rows * tmp.dimensions()[0] >= SMP_DARRREDUCE_THRESHOLD );
 
-   return redux;
+   return smpReduce<ET>( rows, parallel, op, [&]( size_t begin, size_t end ) {
+      return darrayreduceRows( tmp, op, begin, end );
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -1001,7 +2214,9 @@ inline ElementType_t<MT> darrayreduce( const DenseArray<MT>& dm, OP op )
 //
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
-// operation is undefined if the given reduction operation modifies the values.
+// operation is undefined if the given reduction operation modifies the values. For large
+// arrays the reduction is executed in parallel. In case the BLAZE_USE_DETERMINISTIC_REDUCTION
+// switch is activated, the evaluation order is fixed and does not depend on the number of threads.
 */
 template< typename MT    // Type of the dense array
         , typename OP >  // Type of the reduction operation
@@ -1042,32 +2257,23 @@ inline const ReducedArray<MT,OP,RF> reduce_backend( const DenseArray<MT>& dm, OP
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function reduces the rows or columns of the given dense array \a dm by means of the
-// given reduction operation \a op. In case the reduction flag \a RF is set to \a blaze::columnwise,
-// the elements of the array are reduced column-wise and the result is a row array. In case
-// \a RF is set to \a blaze::rowwise, the elements of the array are reduced row-wise and the
-// result is a column array:
-
-   \code
-   using blaze::columnwise;
-
-   blaze::DynamicArray<double> A;
-   blaze::DynamicMatrix<double,rowMatrix> colsum1, colsum2;
-   // ... Resizing and initialization
-
-   colsum1 = reduce<columnwise>( A, blaze::Add() );
-   colsum2 = reduce<columnwise>( A, []( double a, double b ){ return a + b; } );
-   \endcode
+// This function reduces the given dense array \a dm along the dimension \a RF by means of the
+// given reduction operation \a op, where dimension 0 is the innermost dimension (i.e. the
+// columns). The result is an array with one dimension less than \a dm. A reduction along the
+// innermost dimension reduces each row of \a dm horizontally, a reduction along an outer
+// dimension accumulates entire rows of \a dm. Both kernels are vectorized and parallelized
+// over the remaining dimensions, if possible:
 
    \code
-   using blaze::rowwise;
+   using blaze::reduction;
 
-   blaze::DynamicArray<double> A;
-   blaze::DynamicMatrix<double,columnMatrix> rowsum1, rowsum2;
+   blaze::DynamicArray<4,float> A;
+   blaze::DynamicArray<3,float> batchsum1, batchsum2, rowsum;
    // ... Resizing and initialization
 
-   rowsum1 = reduce<rowwise>( A, blaze::Add() );
-   rowsum2 = reduce<rowwise>( A, []( double a, double b ){ return a + b; } );
+   batchsum1 = reduce<reduction<3>>( A, blaze::Add() );
+   batchsum2 = reduce<reduction<3>>( A, []( float a, float b ){ return a + b; } );
+   rowsum    = reduce<reduction<0>>( A, blaze::Add() );
    \endcode
 
 // As demonstrated in the examples it is possible to pass any binary callable as custom reduction
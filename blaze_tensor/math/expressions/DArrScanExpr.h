@@ -0,0 +1,1015 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DArrScanExpr.h
+//  \brief Header file for the dense array scan expression
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRSCANEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRSCANEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/constraints/DenseArray.h>
+#include <blaze_tensor/math/dense/Scan.h>
+#include <blaze_tensor/math/expressions/ArrScanExpr.h>
+#include <blaze_tensor/math/expressions/DArrReduceExpr.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/smp/ArrayRowAssign.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+#include <blaze_tensor/util/ArrayForEach.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SCAN KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scan of a block of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The scan operation.
+// \param rbegin The first scanned row to be computed.
+// \param rend The scanned row behind the last scanned row to be computed.
+// \param jbegin The first column to be computed (a multiple of the SIMD size).
+// \param jend The column behind the last column to be computed.
+// \return void
+//
+// The independently scanned rows (i.e. all outer dimensions except dimension \a R) are numbered
+// consecutively in memory order. Each row of the result is computed by combining the previous
+// row of the result with the next row of the operand along dimension \a R (see scanOuter()).
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the scan operation
+inline auto darrayscanOuter( DenseArray<TT>& C, const MT& A, OP op,
+                             size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> EnableIf_t< R != 0UL >
+{
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N( MT::num_dimensions );
+
+   BLAZE_STATIC_ASSERT( R > 0UL && R < N );
+
+   const auto dims( A.dimensions() );
+   const size_t L( dims[R] );
+
+   std::array<size_t,N-1UL> rdims;
+   for( size_t d=0UL; d<N-1UL; ++d ) {
+      rdims[d] = dims[ d < R ? d : d+1UL ];
+   }
+
+   const auto get    = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load   = [&A]( auto... indices ) { return A.load( indices... ); };
+   const auto target = [&C]( auto... indices ) -> decltype(auto) { return (~C)( indices... ); };
+
+   ArrayForEachRow( rdims, 0UL, rbegin, rend,
+                    [&]( size_t, const std::array<size_t,N-1UL>& indices )
+   {
+      const std::array<size_t,N> base( mergeDims<R>( indices, 0UL ) );
+
+      const auto row = [&base]( size_t l ) {
+         auto ai( base );
+         ai[R] = l;
+         return ai;
+      };
+
+      scanOuter<ET>( L, jbegin, jend, op,
+         [&]( size_t l, auto j ) -> decltype(auto) { return ArrayRowApply( get, row( l ), j ); },
+         [&]( size_t l, auto j ) { return ArrayRowApply( load, row( l ), j ); },
+         [&]( size_t l, auto j ) -> decltype(auto) { return ArrayRowApply( target, row( l ), j ); },
+         [&]( size_t l, auto j, const auto& xmm ) {
+            ArrayRowApply( [&]( auto... is ) { (~C).store( xmm, is... ); }, row( l ), j );
+         },
+         BoolConstant< UseVectorizedOuterScanKernel_v<TT,MT,OP> >() );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scan of a range of rows of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand (with a non-empty innermost dimension).
+// \param op The scan operation.
+// \param begin The first row to be computed.
+// \param end The row behind the last row to be computed.
+// \return void
+//
+// The rows are numbered consecutively in memory order across all outer dimensions. Each row is
+// scanned by means of scanRow().
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the scan operation
+inline void darrayscanInner( DenseArray<TT>& C, const MT& A, OP op, size_t begin, size_t end )
+{
+   using ET = ElementType_t<TT>;
+
+   constexpr size_t N( MT::num_dimensions );
+
+   const size_t n( A.dimensions()[0] );
+
+   const auto get    = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load   = [&A]( auto... indices ) { return A.load( indices... ); };
+   const auto target = [&C]( auto... indices ) -> decltype(auto) { return (~C)( indices... ); };
+
+   ArrayForEachRow( A.dimensions(), 0UL, begin, end,
+                    [&]( size_t, const std::array<size_t,N>& indices )
+   {
+      scanRow<ET>( 0UL, n, nullptr, op,
+         [&]( auto j ) -> decltype(auto) { return ArrayRowApply( get, indices, j ); },
+         [&]( auto j ) { return ArrayRowApply( load, indices, j ); },
+         [&]( auto j ) -> decltype(auto) { return ArrayRowApply( target, indices, j ); },
+         [&]( auto j, const auto& xmm ) {
+            ArrayRowApply( [&]( auto... is ) { (~C).store( xmm, is... ); }, indices, j );
+         },
+         BoolConstant< UseVectorizedInnerScanKernel_v<TT,MT,OP> >() );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Two-pass parallel scan of a range of rows of a dense array along the innermost
+//        dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand (with a non-empty innermost dimension).
+// \param op The scan operation.
+// \param begin The first row to be computed.
+// \param end The row behind the last row to be computed.
+// \param tasks The number of parallel tasks.
+// \return void
+//
+// The rows are processed one after another. Each row is split into blocks of full SIMD vectors,
+// which are scanned in parallel by means of blockScan().
+*/
+template< typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the scan operation
+inline void darrayscanBlocks( DenseArray<TT>& C, const MT& A, OP op,
+                              size_t begin, size_t end, size_t tasks )
+{
+   using ET  = ElementType_t<TT>;
+   using Tag = BoolConstant< UseVectorizedInnerScanKernel_v<TT,MT,OP> >;
+
+   constexpr size_t N( MT::num_dimensions );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t n( A.dimensions()[0] );
+
+   const auto get    = [&A]( auto... indices ) -> decltype(auto) { return A( indices... ); };
+   const auto load   = [&A]( auto... indices ) { return A.load( indices... ); };
+   const auto target = [&C]( auto... indices ) -> decltype(auto) { return (~C)( indices... ); };
+
+   ArrayForEachRow( A.dimensions(), 0UL, begin, end,
+                    [&]( size_t, const std::array<size_t,N>& indices )
+   {
+      const auto rget = [&]( auto j ) -> decltype(auto) {
+         return ArrayRowApply( get, indices, j );
+      };
+      const auto rload = [&]( auto j ) {
+         return ArrayRowApply( load, indices, j );
+      };
+
+      blockScan<ET>( n, tasks, SIMDSIZE, op,
+         [&]( size_t jbegin, size_t jend ) {
+            return scanTotal<ET>( jbegin, jend, op, rget, rload, Tag() );
+         },
+         [&]( size_t jbegin, size_t jend, const ET* init ) {
+            scanRow<ET>( jbegin, jend, init, op, rget, rload,
+               [&]( auto j ) -> decltype(auto) { return ArrayRowApply( target, indices, j ); },
+               [&]( auto j, const auto& xmm ) {
+                  ArrayRowApply( [&]( auto... is ) { (~C).store( xmm, is... ); }, indices, j );
+               },
+               Tag() );
+         } );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial scan of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The scan operation.
+// \return void
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the scan operation
+inline auto darrayscanAssign( DenseArray<TT>& C, const MT& A, OP op )
+   -> EnableIf_t< R != 0UL >
+{
+   const size_t n( A.dimensions()[0] );
+   darrayscanOuter<R>( ~C, A, op, 0UL, arrayRows( A ) / A.dimensions()[R], 0UL, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial scan of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The scan operation.
+// \return void
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the scan operation
+inline auto darrayscanAssign( DenseArray<TT>& C, const MT& A, OP op )
+   -> EnableIf_t< R == 0UL >
+{
+   darrayscanInner( ~C, A, op, 0UL, arrayRows( A ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP scan of a dense array along an outer dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The scan operation.
+// \return void
+//
+// The independently scanned rows (i.e. all outer dimensions except dimension \a R) are
+// distributed among the available threads. In case there are fewer rows than threads, the
+// columns are distributed in chunks of full SIMD vectors.
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the scan operation
+inline auto smpDArrScanAssign( DenseArray<TT>& C, const MT& A, OP op )
+   -> EnableIf_t< R != 0UL >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT> >::size );
+
+   const size_t M( arrayRows( A ) / A.dimensions()[R] );
+   const size_t N( A.dimensions()[0] );
+   const size_t tasks( smpTasks() );
+
+   if( tasks < 2UL || M*N < 2UL ) {
+      darrayscanAssign<R>( ~C, A, op );
+   }
+   else if( M >= tasks ) {
+      const size_t rows( ( M + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*rows );
+         const size_t end  ( min( begin+rows, M ) );
+         if( begin < end )
+            darrayscanOuter<R>( ~C, A, op, begin, end, 0UL, N );
+      } );
+   }
+   else {
+      const size_t columns( nextMultiple( ( N + tasks - 1UL ) / tasks, SIMDSIZE ) );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*columns );
+         const size_t end  ( min( begin+columns, N ) );
+         if( begin < end )
+            darrayscanOuter<R>( ~C, A, op, 0UL, M, begin, end );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP scan of a dense array along the innermost dimension.
+// \ingroup dense_array
+//
+// \param C The target dense array.
+// \param A The dense array operand.
+// \param op The scan operation.
+// \return void
+//
+// The rows of the array are distributed in contiguous ranges among the available threads. In
+// case there are fewer rows than threads, each row is scanned by all threads by means of a
+// two-pass block scan (see blockScan()).
+*/
+template< size_t R       // Reduction flag
+        , typename TT    // Type of the target dense array
+        , typename MT    // Type of the dense array operand
+        , typename OP >  // Type of the scan operation
+inline auto smpDArrScanAssign( DenseArray<TT>& C, const MT& A, OP op )
+   -> EnableIf_t< R == 0UL >
+{
+   const size_t rows( arrayRows( A ) );
+   const size_t tasks( smpTasks() );
+
+   if( tasks < 2UL ) {
+      darrayscanAssign<R>( ~C, A, op );
+   }
+   else if( rows >= tasks ) {
+      const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*chunk );
+         const size_t end  ( min( begin+chunk, rows ) );
+         if( begin < end )
+            darrayscanInner( ~C, A, op, begin, end );
+      } );
+   }
+   else {
+      darrayscanBlocks( ~C, A, op, 0UL, rows, tasks );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for prefix scan operations along a dimension of a dense array.
+// \ingroup dense_array_expression
+//
+// The DArrScanExpr class represents the compile time expression for inclusive prefix scans
+// (as for instance cumulative sums or products) along the dimension \a R of a dense array,
+// where dimension 0 is the innermost dimension. The result has the same shape as the array
+// operand.
+*/
+template< typename MT  // Type of the dense array
+        , typename OP  // Type of the scan operation
+        , size_t R >   // Dimension along which to perform the scan
+class DArrScanExpr
+   : public ArrScanExpr< DenseArray< DArrScanExpr<MT,OP,R> > >
+   , private Computation
+{
+ private:
+   //**********************************************************************************************
+   //! Number of dimensions of the dense array operand.
+   static constexpr size_t N = RemoveCV_t< RemoveReference_t<MT> >::num_dimensions;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DArrScanExpr<MT,OP,R>;         //!< Type of this DArrScanExpr instance.
+   using ResultType    = ResultType_t<MT>;              //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;   //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;     //!< Resulting element type.
+   using ReturnType    = const ElementType;             //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;              //!< Data type for composite expression templates.
+
+   //! Composite type of the dense array expression.
+   using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+
+   //! Data type of the scan operation.
+   using Operation = OP;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = MT::smpAssignable;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DArrScanExpr class.
+   //
+   // \param dm The array operand of the scan expression.
+   // \param op The scan operation.
+   */
+   explicit inline DArrScanExpr( const MT& dm, OP op ) noexcept
+      : dm_( dm )  // Dense array of the scan expression
+      , op_( op )  // The scan operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Multi-dimensional access to the array elements.
+   //
+   // \param dims Access indices (outermost dimension first).
+   // \return The resulting value.
+   */
+   template< typename... Dims >
+   inline ReturnType operator()( Dims... dims ) const {
+      BLAZE_STATIC_ASSERT( sizeof...( Dims ) == N );
+      const std::array<size_t,N> outer{ { size_t( dims )... } };
+      std::array<size_t,N> indices;
+      for( size_t d=0UL; d<N; ++d ) {
+         indices[d] = outer[N-1UL-d];
+      }
+      return (*this)( indices );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Multi-dimensional access to the array elements.
+   //
+   // \param indices Access indices (innermost dimension first).
+   // \return The resulting value.
+   //
+   // The element is computed by combining all elements of the operand along dimension \a R up
+   // to and including the given element.
+   */
+   inline ReturnType operator()( const std::array<size_t,N>& indices ) const {
+      const auto get = [this]( auto... is ) -> decltype(auto) { return dm_( is... ); };
+      std::array<size_t,N> ai( indices );
+      ai[R] = 0UL;
+      ElementType value( ArrayRowApply( get, ai, ai[0] ) );
+      for( size_t l=1UL; l<=indices[R]; ++l ) {
+         ai[R] = l;
+         value = op_( value, ArrayRowApply( get, ai, ai[0] ) );
+      }
+      return value;
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the array elements.
+   //
+   // \param dims Access indices (outermost dimension first).
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid array access index.
+   */
+   template< typename... Dims >
+   inline ReturnType at( Dims... dims ) const {
+      const std::array<size_t,N> indices{ { size_t( dims )... } };
+      const auto sizes( dimensions() );
+      for( size_t d=0UL; d<N; ++d ) {
+         if( indices[d] >= sizes[N-1UL-d] ) {
+            BLAZE_THROW_OUT_OF_RANGE( "Invalid array access index" );
+         }
+      }
+      return (*this)( dims... );
+   }
+   //**********************************************************************************************
+
+   //**Num_dimensions function*********************************************************************
+   /*!\brief Returns the current number of dimensions of the array.
+   //
+   // \return The number of dimensions of the array.
+   */
+   static constexpr size_t num_dimensions = N;
+   //**********************************************************************************************
+
+   //**Dimensions function*************************************************************************
+   /*!\brief Returns the current dimensions of the array.
+   //
+   // \return The dimensions of the array (innermost dimension first).
+   */
+   inline decltype(auto) dimensions() const noexcept {
+      return dm_.dimensions();
+   }
+   //**********************************************************************************************
+
+   //**Dimension function**************************************************************************
+   /*!\brief Returns the current size of the given dimension of the array.
+   //
+   // \return The size of dimension \a Dim.
+   */
+   template< size_t Dim >
+   inline size_t dimension() const noexcept {
+      return dm_.template dimension<Dim>();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense array operand.
+   //
+   // \return The dense array operand.
+   */
+   inline Operand operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the scan operation.
+   //
+   // \return A copy of the scan operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return dm_.canSMPAssign() ||
+             ( arrayRows( dm_ ) * dm_.template dimension<0>() >= SMP_DARRREDUCE_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   dm_;  //!< Dense array of the scan expression.
+   Operation op_;  //!< The scan operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense arrays******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense array scan expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side scan expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense array scan
+   // expression to a dense array. Along an outer dimension, entire rows of the operand are
+   // accumulated in a vectorized fashion, along the innermost dimension each row is scanned
+   // in-register.
+   */
+   template< typename VT1 >  // Type of the target dense array
+   friend inline void assign( DenseArray<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      if( arrayRows( rhs.dm_ ) * rhs.dm_.template dimension<0>() == 0UL ) {
+         return;
+      }
+
+      decltype(auto) A( darrayreduceOperand( rhs.dm_ ) );  // Evaluation of the dense array operand
+      darrayscanAssign<R>( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to arrays***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense array scan expression to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side scan expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense array
+   // scan expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void addAssign( Array<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to arrays************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense array scan expression to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side scan expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense array
+   // scan expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void subAssign( Array<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to arrays*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a dense array scan expression to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side scan expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a dense
+   // array scan expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void multAssign( Array<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to arrays***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a dense array scan expression to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side scan expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a dense array
+   // scan expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void divAssign( Array<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense arrays**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense array scan expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side scan expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense array scan
+   // expression to a dense array. The independent scans are distributed among the available
+   // threads; a single long row is scanned by all threads by means of a two-pass block scan.
+   */
+   template< typename VT1 >  // Type of the target dense array
+   friend inline void smpAssign( DenseArray<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      if( arrayRows( rhs.dm_ ) * rhs.dm_.template dimension<0>() == 0UL ) {
+         return;
+      }
+      else if( !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+      }
+      else {
+         decltype(auto) A( smpDArrReduceOperand( rhs.dm_ ) );  // Evaluation of the dense array operand
+         smpDArrScanAssign<R>( ~lhs, A, rhs.op_ );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to arrays***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense array scan expression to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side scan expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // array scan expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void smpAddAssign( Array<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to arrays********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense array scan expression to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side scan expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // array scan expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void smpSubAssign( Array<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to arrays*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a dense array scan expression to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side scan expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // dense array scan expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void smpMultAssign( Array<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to arrays***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a dense array scan expression to an array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side array.
+   // \param rhs The right-hand side scan expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a dense
+   // array scan expression to an array.
+   */
+   template< typename VT1 >  // Type of the target array
+   friend inline void smpDivAssign( Array<VT1>& lhs, const DArrScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( MT );
+   BLAZE_STATIC_ASSERT( R < N );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the inclusive prefix scan of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \param op The scan operation.
+// \return The prefix scan of the given array along dimension \a R.
+//
+// This function returns an expression representing the inclusive prefix scan of the given
+// dense array \a dm along the dimension \a R (where dimension 0 is the innermost dimension) by
+// means of the given binary operation \a op. Each element of the result is the combination of
+// all elements of \a dm along \a R up to and including the element itself:
+
+   \code
+   blaze::DynamicArray<3,int> A{ { { 1, 6 }, { 3, 4 } }, { { 5, 2 }, { 7, 0 } } };
+
+   // Results in ( ( ( 1 6 ) ( 3 4 ) ) ( ( 5 6 ) ( 7 4 ) ) )
+   blaze::DynamicArray<3,int> B = scan<2>( A, blaze::Max() );
+   \endcode
+
+// The operation \a op is required to be associative, since the evaluation of long rows may
+// split the scan into independently scanned blocks. For the scan operations \a blaze::Add and
+// \a blaze::Mult of single and double precision arrays, the scan along the innermost dimension
+// is performed in-register by means of SIMD operations.
+*/
+template< size_t R       // Dimension along which to perform the scan
+        , typename MT    // Type of the dense array
+        , typename OP >  // Type of the scan operation
+inline decltype(auto) scan( const DenseArray<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( R < MT::num_dimensions, "Invalid scan dimension" );
+
+   using ReturnType = const DArrScanExpr<MT,OP,R>;
+   return ReturnType( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative sum of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The cumulative sum of the given array along dimension \a R.
+//
+// This function returns an expression representing the cumulative sum of the given dense
+// array \a dm along the dimension \a R (see scan()):
+
+   \code
+   blaze::DynamicArray<2,int> A{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+   // Results in ( ( 1 3 6 ) ( 4 9 15 ) )
+   blaze::DynamicArray<2,int> B = cumsum<0>( A );
+   \endcode
+*/
+template< size_t R       // Dimension along which to perform the scan
+        , typename MT >  // Type of the dense array
+inline decltype(auto) cumsum( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<R>( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative product of the given dense array along the given dimension.
+// \ingroup dense_array
+//
+// \param dm The given dense array.
+// \return The cumulative product of the given array along dimension \a R.
+//
+// This function returns an expression representing the cumulative product of the given dense
+// array \a dm along the dimension \a R (see scan()):
+
+   \code
+   blaze::DynamicArray<2,int> A{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+   // Results in ( ( 1 2 3 ) ( 4 10 18 ) )
+   blaze::DynamicArray<2,int> B = cumprod<1>( A );
+   \endcode
+*/
+template< size_t R       // Dimension along which to perform the scan
+        , typename MT >  // Type of the dense array
+inline decltype(auto) cumprod( const DenseArray<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<R>( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,863 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DArrTransExpr.h
+//  \brief Header file for the dense array transpose expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRTRANSEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DARRTRANSEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/TransExpr.h>
+#include <blaze/math/expressions/Transformation.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/mpl/If.h>
+
+#include <blaze_tensor/math/constraints/DenseArray.h>
+#include <blaze_tensor/math/dense/Permutation.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/Forward.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DARRTRANSEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for runtime permutations of the axes of dense arrays.
+// \ingroup dense_array_expression
+//
+// The DArrTransExpr class represents the compile time expression for the permutation of the
+// axes of a dense array of arbitrary dimensionality, where the axis mapping is given at runtime.
+// Axis \a d of the expression corresponds to axis \a perm[d] of the operand, with axis 0 being
+// the outermost dimension. In case both the operand and the target array provide low-level data
+// access, the assignment is performed by the plan based permutation kernels (see permuteArray()),
+// otherwise the expression is evaluated via the subscript operator.
+*/
+template< typename MT >  // Type of the dense array
+class DArrTransExpr
+   : public TransExpr< DenseArray< DArrTransExpr<MT> > >
+   , private If< IsComputation_v<MT> >::template Type<Computation, Transformation >
+{
+ public:
+   //**Num_dimensions function*********************************************************************
+   /*!\brief Returns the number of dimensions of the array.
+   */
+   static constexpr size_t num_dimensions = MT::num_dimensions;
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using RT      = ResultType_t<MT>;                    //!< Result type of the operand.
+   using Indices = std::array<size_t, num_dimensions>;  //!< Type of axis mappings and indices.
+   //**********************************************************************************************
+
+   //**Serial evaluation strategy******************************************************************
+   //! Compilation switch for the serial evaluation strategy of the transposition expression.
+   /*! The \a useAssign compile time constant expression represents a compilation switch for
+       the serial evaluation strategy of the transposition expression. In case the given dense
+       array expression of type \a MT requires an intermediate evaluation, \a useAssign will
+       be set to 1 and the transposition expression will be evaluated via the \a assign function
+       family. Otherwise \a useAssign will be set to 0 and the expression will be evaluated
+       via the subscript operator. */
+   static constexpr bool useAssign = RequiresEvaluation_v<MT>;
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool UseAssign_v = useAssign;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Parallel evaluation strategy****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
+       In case the target array is SMP assignable and the dense array operand requires an
+       intermediate evaluation, the variable is set to 1 and the expression specific evaluation
+       strategy is selected. Otherwise the variable is set to 0 and the default strategy is
+       chosen. */
+   template< typename MT2 >
+   static constexpr bool UseSMPAssign_v = ( MT2::smpAssignable && useAssign );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Permutation kernels*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the selection of the permutation kernels.
+   /*! In case the dense array operand does not require an intermediate evaluation and both the
+       target array and the operand provide low-level data access to elements of the same type,
+       the variable is set to 1 and the transposition is evaluated by the plan based permutation
+       kernels. Otherwise the variable is set to 0 and the expression is evaluated via the
+       subscript operator. */
+   template< typename MT2 >
+   static constexpr bool UsePermutation_v = ( !useAssign && UsePermutationKernel_v<MT2,MT> );
+
+   //! Helper variable template for the selection of the parallel permutation kernels.
+   template< typename MT2 >
+   static constexpr bool UseSMPPermutation_v = ( MT2::smpAssignable && UsePermutation_v<MT2> );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DArrTransExpr<MT>;           //!< Type of this DArrTransExpr instance.
+   using ResultType    = RT;                          //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = ResultType;                  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<MT>;           //!< Resulting element type.
+   using ReturnType    = ReturnType_t<MT>;            //!< Return type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   using CompositeType = If_t< useAssign, const ResultType, const DArrTransExpr& >;
+
+   //! Composite data type of the dense array expression.
+   using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = MT::smpAssignable;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Constructor for the DArrTransExpr class.
+   //
+   // \param dm The dense array operand of the transposition expression.
+   // \param indices Pointer to the first element of the axis mapping.
+   // \param n The number of elements of the axis mapping.
+   // \param args Optional runtime arguments (unused).
+   // \exception std::invalid_argument Invalid transposition indices.
+   */
+   template< typename T          // Type of the mapping indices
+           , typename... RTAs >  // Optional runtime arguments
+   explicit inline DArrTransExpr( const MT& dm, T* indices, size_t n, RTAs... args )
+      : DArrTransExpr( dm, transpositionIndices<num_dimensions>( indices, n ) )
+   {
+      MAYBE_UNUSED( args... );
+   }
+
+   /*!\brief Constructor for the DArrTransExpr class.
+   //
+   // \param dm The dense array operand of the transposition expression.
+   // \param perm The axis mapping (outermost axis first).
+   */
+   explicit inline DArrTransExpr( const MT& dm, const Indices& perm ) noexcept
+      : dm_  ( dm   )  // Dense array of the transposition expression
+      , perm_( perm )  // The axis mapping
+      , dims_()        // The dimensions of the expression
+   {
+      constexpr size_t N( num_dimensions );
+
+      for( size_t d=0UL; d<N; ++d ) {
+         dims_[N-1UL-d] = dm_.dimensions()[N-1UL-perm_[d]];
+      }
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Element access to the array elements.
+   //
+   // \param idx The access indices (innermost dimension first).
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( const Indices& idx ) const {
+      constexpr size_t N( num_dimensions );
+
+      Indices source;
+      for( size_t d=0UL; d<N; ++d ) {
+         BLAZE_INTERNAL_ASSERT( idx[d] < dims_[d], "Invalid array access index" );
+         source[N-1UL-perm_[N-1UL-d]] = idx[d];
+      }
+      return dm_( source );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief Element access to the array elements.
+   //
+   // \param i Access index for the outermost dimension.
+   // \param dims Access indices for the remaining dimensions (outermost first).
+   // \return The resulting value.
+   */
+   template< typename... Dims >
+   inline ReturnType operator()( size_t i, Dims... dims ) const {
+      BLAZE_STATIC_ASSERT( 1UL + sizeof...( Dims ) == num_dimensions );
+
+      constexpr size_t N( num_dimensions );
+
+      const Indices outer{ { i, size_t( dims )... } };
+
+      Indices idx;
+      for( size_t d=0UL; d<N; ++d ) {
+         idx[N-1UL-d] = outer[d];
+      }
+      return (*this)( idx );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the array elements.
+   //
+   // \param idx The access indices (innermost dimension first).
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid array access index.
+   */
+   inline ReturnType at( const Indices& idx ) const {
+      for( size_t d=0UL; d<num_dimensions; ++d ) {
+         if( idx[d] >= dims_[d] ) {
+            BLAZE_THROW_OUT_OF_RANGE( "Invalid array access index" );
+         }
+      }
+      return (*this)( idx );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the array elements.
+   //
+   // \param i Access index for the outermost dimension.
+   // \param dims Access indices for the remaining dimensions (outermost first).
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid array access index.
+   */
+   template< typename... Dims >
+   inline ReturnType at( size_t i, Dims... dims ) const {
+      BLAZE_STATIC_ASSERT( 1UL + sizeof...( Dims ) == num_dimensions );
+
+      constexpr size_t N( num_dimensions );
+
+      const Indices outer{ { i, size_t( dims )... } };
+
+      Indices idx;
+      for( size_t d=0UL; d<N; ++d ) {
+         idx[N-1UL-d] = outer[d];
+      }
+      return at( idx );
+   }
+   //**********************************************************************************************
+
+   //**Dimensions function*************************************************************************
+   /*!\brief Returns the current dimensions of the array.
+   //
+   // \return The dimensions of the array (innermost dimension first).
+   */
+   inline const Indices& dimensions() const noexcept {
+      return dims_;
+   }
+   //**********************************************************************************************
+
+   //**Dimension function**************************************************************************
+   /*!\brief Returns the current extent of the given dimension of the array.
+   //
+   // \return The extent of dimension \a Dim (dimension 0 refers to the columns).
+   */
+   template< size_t Dim >
+   inline size_t dimension() const noexcept {
+      BLAZE_STATIC_ASSERT( Dim < num_dimensions );
+      return dims_[Dim];
+   }
+   //**********************************************************************************************
+
+   //**Indices function****************************************************************************
+   /*!\brief Returns the axis mapping of the transposition.
+   //
+   // \return The axis mapping (outermost axis first).
+   */
+   inline const Indices& idces() const noexcept {
+      return perm_;
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense array operand.
+   //
+   // \return The dense array operand.
+   */
+   inline Operand operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return dm_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return dm_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand dm_;    //!< Dense array of the transposition expression.
+   Indices perm_;  //!< The axis mapping (outermost axis first).
+   Indices dims_;  //!< The dimensions of the expression (innermost dimension first).
+   //**********************************************************************************************
+
+   //**Assignment to dense arrays******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense array
+   // transposition expression to a dense array by means of the plan based permutation
+   // kernels. Due to the explicit application of the SFINAE principle, this function can
+   // only be selected by the compiler in case both the target array and the operand provide
+   // low-level data access.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UsePermutation_v<MT2> >
+      assign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      permuteArray( ~lhs, rhs.dm_, rhs.perm_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense arrays******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense array
+   // transposition expression to a dense array. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseAssign_v<MT2> >
+      assign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( RT );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RT );
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const RT tmp( serial( rhs.dm_ ) );
+      assign( ~lhs, DArrTransExpr<RT>( tmp, rhs.perm_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense arrays*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense
+   // array transposition expression to a dense array. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseAssign_v<MT2> >
+      addAssign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( RT );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RT );
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const RT tmp( serial( rhs.dm_ ) );
+      addAssign( ~lhs, DArrTransExpr<RT>( tmp, rhs.perm_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense arrays******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // array transposition expression to a dense array. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseAssign_v<MT2> >
+      subAssign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( RT );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RT );
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const RT tmp( serial( rhs.dm_ ) );
+      subAssign( ~lhs, DArrTransExpr<RT>( tmp, rhs.perm_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense arrays****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a dense
+   // array transposition expression to a dense array. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the operand
+   // requires an intermediate evaluation.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseAssign_v<MT2> >
+      schurAssign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( RT );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RT );
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const RT tmp( serial( rhs.dm_ ) );
+      schurAssign( ~lhs, DArrTransExpr<RT>( tmp, rhs.perm_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense arrays**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense array
+   // transposition expression to a dense array by means of the parallel permutation kernels.
+   // Due to the explicit application of the SFINAE principle, this function can only be
+   // selected by the compiler in case both the target array and the operand provide low-level
+   // data access.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPPermutation_v<MT2> >
+      smpAssign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      if( ( ~lhs ).canSMPAssign() && rhs.canSMPAssign() ) {
+         smpPermuteArray( ~lhs, rhs.dm_, rhs.perm_ );
+      }
+      else {
+         permuteArray( ~lhs, rhs.dm_, rhs.perm_ );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense arrays**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense array
+   // transposition expression to a dense array. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPAssign_v<MT2> >
+      smpAssign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( RT );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RT );
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const RT tmp( rhs.dm_ );
+      smpAssign( ~lhs, DArrTransExpr<RT>( tmp, rhs.perm_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense arrays*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // array transposition expression to a dense array. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPAssign_v<MT2> >
+      smpAddAssign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( RT );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RT );
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const RT tmp( rhs.dm_ );
+      smpAddAssign( ~lhs, DArrTransExpr<RT>( tmp, rhs.perm_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense arrays**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // array transposition expression to a dense array. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPAssign_v<MT2> >
+      smpSubAssign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( RT );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RT );
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const RT tmp( rhs.dm_ );
+      smpSubAssign( ~lhs, DArrTransExpr<RT>( tmp, rhs.perm_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense arrays************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a dense array transposition expression to a dense
+   //        array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // dense array transposition expression to a dense array. Due to the explicit application
+   // of the SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPAssign_v<MT2> >
+      smpSchurAssign( DenseArray<MT2>& lhs, const DArrTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( RT );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RT );
+
+      BLAZE_INTERNAL_ASSERT( ( ~lhs ).dimensions() == rhs.dimensions(), "Invalid number of elements" );
+
+      const RT tmp( rhs.dm_ );
+      smpSchurAssign( ~lhs, DArrTransExpr<RT>( tmp, rhs.perm_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_ARRAY_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Permutation of the axes of the given dense array.
+// \ingroup dense_array
+//
+// \param dm The dense array to be transposed.
+// \param indices Pointer to the first element of the axis mapping.
+// \param n The number of elements of the axis mapping.
+// \param args Optional runtime arguments (unused).
+// \return The transpose of the array.
+// \exception std::invalid_argument Invalid transposition indices.
+//
+// This function returns an expression representing the permutation of the axes of the given
+// dense array. Axis \a d of the result corresponds to axis \a indices[d] of \a dm, where axis
+// 0 denotes the outermost dimension:
+
+   \code
+   blaze::DynamicArray<5UL,double> A;
+   blaze::DynamicArray<5UL,double> B;
+   // ... Resizing and initialization
+   const size_t perm[] = { 4UL, 2UL, 0UL, 1UL, 3UL };
+   B = trans( A, perm, 5UL );
+   \endcode
+
+// The number of mapping indices has to match the number of dimensions of the array and every
+// axis has to be named exactly once. In case the mapping is invalid, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT         // Type of the dense array
+        , typename T          // Type of the mapping indices
+        , typename ... RTAs>  // Runtime arguments
+inline decltype(auto) trans( const DenseArray<MT>& dm, T* indices, size_t n, RTAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ReturnType = const DArrTransExpr<MT>;
+   return ReturnType( ~dm, indices, n, args... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the axes of the given dense array.
+// \ingroup dense_array
+//
+// \param dm The dense array to be transposed.
+// \param indices Pointer to the first element of the axis mapping.
+// \param n The number of elements of the axis mapping.
+// \param args Optional runtime arguments (unused).
+// \return The transpose of the array.
+// \exception std::invalid_argument Invalid transposition indices.
+//
+// This function returns an expression representing the permutation of the axes of the given
+// dense array (see the overload for constant arrays). For non-constant four-dimensional arrays
+// the writable DQuatTransExpr is returned instead (see DQuatTransExpr.h).
+*/
+template< typename MT         // Type of the dense array
+        , typename T          // Type of the mapping indices
+        , typename ... RTAs>  // Runtime arguments
+inline auto trans( DenseArray<MT>& dm, T* indices, size_t n, RTAs... args )
+   -> DisableIf_t< MT::num_dimensions == 4UL, const DArrTransExpr<MT> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ReturnType = const DArrTransExpr<MT>;
+   return ReturnType( ~dm, indices, n, args... );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the axes of the given temporary dense array.
+// \ingroup dense_array
+//
+// \param dm The temporary dense array to be transposed.
+// \param indices Pointer to the first element of the axis mapping.
+// \param n The number of elements of the axis mapping.
+// \param args Optional runtime arguments (unused).
+// \return The transpose of the array.
+// \exception std::invalid_argument Invalid transposition indices.
+//
+// This function returns an expression representing the permutation of the axes of the given
+// temporary dense array (see the overload for constant arrays).
+*/
+template< typename MT         // Type of the dense array
+        , typename T          // Type of the mapping indices
+        , typename ... RTAs>  // Runtime arguments
+inline decltype(auto) trans( DenseArray<MT>&& dm, T* indices, size_t n, RTAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ReturnType = const DArrTransExpr<MT>;
+   return ReturnType( ~dm, indices, n, args... );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating the transpose of a transpose dense array.
+// \ingroup dense_array
+//
+// \param dm The dense array transposition expression to be (re-)transposed.
+// \param indices Pointer to the first element of the axis mapping.
+// \param n The number of elements of the axis mapping.
+// \param args Optional runtime arguments (unused).
+// \return The transpose of the transpose array.
+// \exception std::invalid_argument Invalid transposition indices.
+//
+// This function implements a performance optimized treatment of the transpose operation on a
+// dense array transposition expression. The two axis mappings are combined into a single one,
+// such that the operand is permuted only once.
+*/
+template< typename MT         // Type of the dense array
+        , typename T          // Type of the mapping indices
+        , typename ... RTAs>  // Runtime arguments
+inline decltype(auto) trans( const DArrTransExpr<MT>& dm, T* indices, size_t n, RTAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MAYBE_UNUSED( args... );
+
+   constexpr size_t N( MT::num_dimensions );
+
+   const std::array<size_t,N> perm( transpositionIndices<N>( indices, n ) );
+
+   std::array<size_t,N> combined;
+   for( size_t d=0UL; d<N; ++d ) {
+      combined[d] = dm.idces()[perm[d]];
+   }
+
+   using ReturnType = const DArrTransExpr<MT>;
+   return ReturnType( dm.operand(), combined );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -49,6 +49,9 @@
 #include <blaze/math/expressions/ExpandExprData.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/Transformation.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sub.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/traits/ExpandTrait.h>
@@ -67,7 +70,9 @@
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/typetraits/GetMemberType.h>
 
+#include <blaze_tensor/math/dense/PageBroadcast.h>
 #include <blaze_tensor/math/expressions/MatExpandExpr.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -131,6 +136,19 @@ class DMatExpandExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Broadcast evaluation strategy***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the broadcast evaluation strategy.
+       In case the dense matrix operand does not require an intermediate evaluation, the variable
+       is set to 1 and the expansion is evaluated by broadcasting the matrix across the pages of
+       the target tensor (see pageBroadcast()). Otherwise the variable is set to 0 and the matrix
+       operand is evaluated first. */
+   template< typename TT1 >
+   static constexpr bool UseBroadcastAssign_v = !useAssign;
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DMatExpandExpr<MT,CEAs...>;     //!< Type of this DMatExpandExpr instance.
@@ -350,7 +368,8 @@ class DMatExpandExpr
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return dm_.canSMPAssign();
+      return dm_.canSMPAssign() ||
+             ( pages() * rows() * columns() >= SMP_DTENSASSIGN_THRESHOLD );
    }
    //**********************************************************************************************
 
@@ -689,6 +708,266 @@ class DMatExpandExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Broadcast assignment to dense tensors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix expansion
+   // expression to a dense tensor. Each block of matrix rows is applied to all pages of the tensor
+   // while it resides in cache, such that the tensor is streamed exactly once. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler in
+   // case the matrix operand does not require an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      assign( DenseTensor<TT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      pageBroadcast( ~lhs, ~lhs, rhs.dm_, PageBroadcastCopy() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Broadcast addition assignment to dense tensors***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense matrix
+   // expansion expression to a dense tensor. Each block of matrix rows is applied to all pages of
+   // the tensor while it resides in cache, such that the tensor is streamed exactly once. Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the matrix operand does not require an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      addAssign( DenseTensor<TT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      pageBroadcast( ~lhs, ~lhs, rhs.dm_, Add() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Broadcast subtraction assignment to dense tensors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense matrix
+   // expansion expression to a dense tensor. Each block of matrix rows is applied to all pages of
+   // the tensor while it resides in cache, such that the tensor is streamed exactly once. Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the matrix operand does not require an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      subAssign( DenseTensor<TT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      pageBroadcast( ~lhs, ~lhs, rhs.dm_, Sub() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Broadcast schur product assignment to dense tensors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a dense matrix
+   // expansion expression to a dense tensor. Each block of matrix rows is applied to all pages of
+   // the tensor while it resides in cache, such that the tensor is streamed exactly once. Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the matrix operand does not require an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      schurAssign( DenseTensor<TT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      pageBroadcast( ~lhs, ~lhs, rhs.dm_, Mult() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP broadcast assignment to dense tensors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense matrix expansion
+   // expression to a dense tensor. The pages of the target tensor are split among the available
+   // threads, each of which broadcasts the matrix across its own range of pages. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the matrix operand does not require an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      smpAssign( DenseTensor<TT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.canSMPAssign() ) {
+         smpPageBroadcast( ~lhs, ~lhs, rhs.dm_, PageBroadcastCopy() );
+      }
+      else {
+         pageBroadcast( ~lhs, ~lhs, rhs.dm_, PageBroadcastCopy() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP broadcast addition assignment to dense tensors*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense matrix
+   // expansion expression to a dense tensor. The pages of the target tensor are split among the
+   // available threads, each of which broadcasts the matrix across its own range of pages. Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the matrix operand does not require an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      smpAddAssign( DenseTensor<TT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.canSMPAssign() ) {
+         smpPageBroadcast( ~lhs, ~lhs, rhs.dm_, Add() );
+      }
+      else {
+         pageBroadcast( ~lhs, ~lhs, rhs.dm_, Add() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP broadcast subtraction assignment to dense tensors****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // matrix expansion expression to a dense tensor. The pages of the target tensor are split among
+   // the available threads, each of which broadcasts the matrix across its own range of pages. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the matrix operand does not require an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      smpSubAssign( DenseTensor<TT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.canSMPAssign() ) {
+         smpPageBroadcast( ~lhs, ~lhs, rhs.dm_, Sub() );
+      }
+      else {
+         pageBroadcast( ~lhs, ~lhs, rhs.dm_, Sub() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP broadcast schur product assignment to dense tensors**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP schur product assignment of a dense matrix expansion expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side expansion expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a dense
+   // matrix expansion expression to a dense tensor. The pages of the target tensor are split among
+   // the available threads, each of which broadcasts the matrix across its own range of pages. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the matrix operand does not require an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      smpSchurAssign( DenseTensor<TT1>& lhs, const DMatExpandExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.canSMPAssign() ) {
+         smpPageBroadcast( ~lhs, ~lhs, rhs.dm_, Mult() );
+      }
+      else {
+         pageBroadcast( ~lhs, ~lhs, rhs.dm_, Mult() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Compile time checks*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
@@ -43,26 +43,30 @@
 
 #include <blaze/math/Aliases.h>
 #include <blaze/math/Exception.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/Transformation.h>
 #include <blaze/math/shims/Serial.h>
-#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/StorageOrder.h>
 #include <blaze/system/Inline.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/GetMemberType.h>
 
 #include <blaze_tensor/math/expressions/MatRavelExpr.h>
@@ -131,6 +135,15 @@ class DMatRavelExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Data access strategy************************************************************************
+   //! Compilation switch for the direct access to the elements of the matrix operand.
+   /*! In case the dense matrix operand is a row-major matrix with low-level data access,
+       \a useDataAccess is set to 1 and the ravel expression directly accesses the elements of
+       the matrix as long as its rows are stored without padding. Otherwise \a useDataAccess is
+       set to 0 and the elements are accessed via the function call operator of the matrix. */
+   static constexpr bool useDataAccess = HasConstDataAccess_v<MT> && IsRowMajorMatrix_v<MT>;
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DMatRavelExpr<MT>;              //!< Type of this DMatRavelExpr instance.
@@ -139,6 +152,7 @@ class DMatRavelExpr
    using TransposeType = TransposeType_t<ResultType>;    //!< Transpose type for expression template evaluations.
    using ElementType   = ElementType_t<MT>;              //!< Resulting element type.
    using ReturnType    = ReturnType_t<MT>;               //!< Return type for expression template evaluations.
+   using SIMDType      = SIMDTrait_t<ElementType>;       //!< Resulting SIMD element type.
 
    //! Data type for composite expression templates.
    using CompositeType = If_t< useAssign, const ResultType, const DMatRavelExpr& >;
@@ -427,7 +441,9 @@ class DMatRavelExpr
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   /*! The vectorized evaluation is only enabled for unpadded operands, since the elements of a
+       padded matrix are not stored contiguously and would have to be loaded one by one. */
+   static constexpr bool simdEnabled = useDataAccess && MT::simdEnabled && !IsPadded_v<MT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = (StorageOrder_v<MT> == rowMajor) && MT::smpAssignable;
@@ -440,7 +456,7 @@ class DMatRavelExpr
    // \param args The runtime ravel expression arguments.
    */
    explicit inline DMatRavelExpr( const MT& dm ) noexcept
-      : dm_     ( dm )       // Dense matrix of the ravel expression
+      : dm_( dm )  // Dense matrix of the ravel expression
    {}
    //**********************************************************************************************
 
@@ -454,6 +470,11 @@ class DMatRavelExpr
 
       BLAZE_INTERNAL_ASSERT( index < size(), "Invalid access index");
 
+      const ElementType* data( contiguousData( BoolConstant<useDataAccess>() ) );
+
+      if( data != nullptr )
+         return data[index];
+
 //       if (TF == blaze::columnVector)
 //       {
 //          auto div = std::div(index, dm_.rows());
@@ -481,6 +502,34 @@ class DMatRavelExpr
    }
    //**********************************************************************************************
 
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the vector.
+   //
+   // \param index Access index for the elements.
+   // \return Reference to the accessed values.
+   //
+   // In case the elements of the matrix are stored contiguously the SIMD element is loaded
+   // directly from the matrix. Otherwise the elements are collected one by one.
+   */
+   BLAZE_ALWAYS_INLINE SIMDType load( size_t index ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( index < size(), "Invalid vector access index" );
+      BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid vector access index" );
+
+      const ElementType* data( contiguousData( BoolConstant<useDataAccess>() ) );
+
+      if( data != nullptr )
+         return loadu( data + index );
+
+      alignas( AlignmentOf_v<ElementType> ) ElementType buffer[SIMDSIZE];
+
+      for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+         buffer[k] = (*this)[index+k];
+      }
+
+      return loada( buffer );
+   }
+   //**********************************************************************************************
+
    //**Begin function******************************************************************************
    /*!\brief Returns an iterator to the first element of the underlying matrix.
    //
@@ -586,6 +635,34 @@ class DMatRavelExpr
    //**********************************************************************************************
 
  private:
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+   //**Contiguous data function********************************************************************
+   /*!\brief Returns the elements of the dense matrix in case they are stored contiguously.
+   //
+   // \return Pointer to the first element, \a nullptr in case the rows of the matrix are padded.
+   //
+   // The pointer is queried from the operand on every access, such that the expression stays
+   // valid in case the operand is resized or reallocated after the creation of the expression.
+   */
+   inline const ElementType* contiguousData( TrueType ) const noexcept {
+      return ( dm_.rows() <= 1UL || dm_.spacing() == dm_.columns() )?( dm_.data() ):( nullptr );
+   }
+   //**********************************************************************************************
+
+   //**Contiguous data function********************************************************************
+   /*!\brief Returns the elements of the dense matrix in case they are stored contiguously.
+   //
+   // \return \a nullptr since the matrix does not provide low-level data access.
+   */
+   inline const ElementType* contiguousData( FalseType ) const noexcept {
+      return nullptr;
+   }
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    Operand dm_;  //!< Dense matrix of the ravel expression.
    //**********************************************************************************************
@@ -42,6 +42,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
 #include <iterator>
 
 #include <blaze/math/Aliases.h>
@@ -77,6 +78,7 @@
 #include <blaze/util/typetraits/GetMemberType.h>
 
 #include <blaze_tensor/math/constraints/DenseArray.h>
+#include <blaze_tensor/math/expressions/DArrTransExpr.h>
 #include <blaze_tensor/math/expressions/DenseArray.h>
 #include <blaze_tensor/math/expressions/DQuatTransExprData.h>
 #include <blaze_tensor/math/expressions/DQuatTransposer.h>
@@ -102,7 +104,7 @@ namespace blaze {
 template< typename MT,        // Type of the dense tensor
           size_t... CTAs >    // Compile time arguments
 class DQuatTransExpr
-   : public QuatTransExpr< DenseArray< DQuatTransExpr<MT> > >
+   : public QuatTransExpr< DenseArray< DQuatTransExpr<MT,CTAs...> > >
    , public DQuatTransExprData<CTAs...>
    , private If< IsComputation_v<MT> >::template Type<Computation, Transformation >
 {
@@ -147,9 +149,27 @@ class DQuatTransExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Permutation kernels*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the selection of the permutation kernels.
+   /*! In case the axis mapping is given at runtime, the dense array operand does not require an
+       intermediate evaluation, and both the target array and the operand provide low-level data
+       access to elements of the same type, the variable is set to 1 and the transposition is
+       evaluated by the permutation kernels of DArrTransExpr. Otherwise the variable is set to 0
+       and the default strategy is chosen. */
+   template< typename MT2 >
+   static constexpr bool UsePermutation_v =
+      ( sizeof...( CTAs ) == 0UL && !useAssign && UsePermutationKernel_v<MT2,MT> );
+
+   //! Helper variable template for the selection of the parallel permutation kernels.
+   template< typename MT2 >
+   static constexpr bool UseSMPPermutation_v = ( MT2::smpAssignable && UsePermutation_v<MT2> );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
-   using This          = DQuatTransExpr<MT>;          //!< Type of this DQuatTransExpr instance.
+   using This          = DQuatTransExpr<MT,CTAs...>;  //!< Type of this DQuatTransExpr instance.
    using ResultType    = TransposeType_t<MT>;         //!< Result type for expression template evaluations.
    using OppositeType  = OppositeType_t<ResultType>;  //!< Result type with opposite storage order for expression template evaluations.
    using TransposeType = ResultType_t<MT>;            //!< Transpose type for expression template evaluations.
@@ -230,6 +250,40 @@ class DQuatTransExpr
    //@}
    //**********************************************************************************************
 
+   //**Assignment operator*************************************************************************
+   /*!\brief Assignment of a dense array to the transposed array.
+   //
+   // \param rhs The right-hand side dense array to be assigned.
+   // \return Reference to the transposition expression.
+   // \exception std::invalid_argument Array sizes do not match.
+   //
+   // This operator assigns the elements of \a rhs to the according elements of the underlying
+   // array via the transposed indices. The right-hand side array is evaluated first, such that
+   // it may alias the underlying array.
+   */
+   template< typename MT2 >  // Type of the right-hand side dense array
+   inline DQuatTransExpr& operator=( const DenseArray<MT2>& rhs )
+   {
+      if( dimensions() != (~rhs).dimensions() ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Array sizes do not match" );
+      }
+
+      const ResultType_t<MT2> tmp( ~rhs );
+
+      for( size_t l=0UL; l<quats(); ++l ) {
+         for( size_t k=0UL; k<pages(); ++k ) {
+            for( size_t i=0UL; i<rows(); ++i ) {
+               for( size_t j=0UL; j<columns(); ++j ) {
+                  (*this)(l,k,i,j) = tmp(l,k,i,j);
+               }
+            }
+         }
+      }
+
+      return *this;
+   }
+   //**********************************************************************************************
+
    //**Access operator*****************************************************************************
    /*!\brief 4D-access to the array elements.
    //
@@ -585,6 +639,19 @@ inline void reset(size_t i, size_t l, size_t k)
    }
    //**********************************************************************************************
 
+   //**Permutation function************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the read-only permutation expression of the runtime axis mapping.
+   //
+   // \return The equivalent DArrTransExpr.
+   */
+   inline const DArrTransExpr<MT> permutation() const noexcept {
+      const std::array<size_t,4UL> perm{ { idces()[0], idces()[1], idces()[2], idces()[3] } };
+      return DArrTransExpr<MT>( dm_, perm );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*!\brief Returns whether the expression can alias with the given address \a alias.
    //
@@ -665,6 +732,34 @@ inline void reset(size_t i, size_t l, size_t k)
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense arrays******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense array
+   // transposition expression with a runtime axis mapping to a dense array via the
+   // permutation kernels of DArrTransExpr. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case both arrays
+   // provide low-level data access.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UsePermutation_v<MT2> >
+      assign( DenseArray<MT2>& lhs, const DQuatTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid array sizes" );
+
+      assign( ~lhs, rhs.permutation() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse tensors***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense tensor transposition expression to a sparse tensor.
@@ -847,6 +942,34 @@ inline void reset(size_t i, size_t l, size_t k)
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense arrays**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense array transposition expression to a dense array.
+   // \ingroup dense_array
+   //
+   // \param lhs The target left-hand side dense array.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense array
+   // transposition expression with a runtime axis mapping to a dense array via the parallel
+   // permutation kernels of DArrTransExpr. Due to the explicit application of the SFINAE
+   // principle, this function can only be selected by the compiler in case both arrays
+   // provide low-level data access.
+   */
+   template< typename MT2 > // Type of the target dense array
+   friend inline EnableIf_t< UseSMPPermutation_v<MT2> >
+      smpAssign( DenseArray<MT2>& lhs, const DQuatTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == rhs.dimensions(), "Invalid array sizes" );
+
+      smpAssign( ~lhs, rhs.permutation() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse tensors***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a dense tensor transposition expression to a sparse tensor.
@@ -1214,72 +1337,13 @@ inline decltype(auto) trans( DenseArray<MT>&& dm, RTAs... args )
    \endcode
 */
 template< typename MT         // Type of the target dense tensor
-        , typename T          // Type of the element indices
-        , typename ... RTAs>  // Runtime arguments
-inline decltype(auto) trans( const DenseArray<MT>& dm, const T* indices, size_t n, RTAs... args )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   using ReturnType = const DQuatTransExpr<MT>;
-   return ReturnType( ~dm, indices, n, args... );
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Calculation of the transpose of the given dense tensor.
-// \ingroup dense_tensor
-//
-// \param dm The dense tensor to be transposed.
-// \return The transpose of the tensor.
-//
-// This function returns an expression representing the transpose of the given dense tensor:
-
-   \code
-   blaze::DynamicArray<double> A;
-   blaze::DynamicArray<double,> B;
-   // ... Resizing and initialization
-   B = trans( A, { 2UL, 0UL, 1UL } );     // rotate tensor
-   \endcode
-*/
-template< typename MT         // Type of the target dense tensor
-        , typename T          // Type of the element indices
-        , typename ... RTAs>  // Runtime arguments
-inline decltype(auto) trans( DenseArray<MT>& dm, const T* indices, size_t n, RTAs... args )
-{
-   BLAZE_FUNCTION_TRACE;
-
-   using ReturnType = DQuatTransExpr<MT>;
-   return ReturnType( ~dm, indices, n, args... );
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Calculation of the transpose of the given dense tensor.
-// \ingroup dense_tensor
-//
-// \param dm The dense tensor to be transposed.
-// \return The transpose of the tensor.
-//
-// This function returns an expression representing the transpose of the given dense tensor:
-
-   \code
-   blaze::DynamicArray<double> A;
-   blaze::DynamicArray<double,> B;
-   // ... Resizing and initialization
-   B = trans( A, { 2UL, 0UL, 1UL } );     // rotate tensor
-   \endcode
-*/
-template< typename MT         // Type of the target dense tensor
-        , typename T          // Type of the element indices
+        , size_t... Is        // Element indices
         , typename ... RTAs>  // Runtime arguments
-inline decltype(auto) trans( DenseArray<MT>&& dm, const T* indices, size_t n, RTAs... args )
+inline decltype(auto) trans( const DenseArray<MT>& dm, std::index_sequence<Is...> indices, RTAs... args )
 {
    BLAZE_FUNCTION_TRACE;
 
-   using ReturnType = DQuatTransExpr<MT>;
-   return ReturnType( ~dm, indices, n, args... );
+   return trans<Is...>( ~dm, args... );
 }
 //*************************************************************************************************
 
@@ -1303,7 +1367,7 @@ inline decltype(auto) trans( DenseArray<MT>&& dm, const T* indices, size_t n, RT
 template< typename MT         // Type of the target dense tensor
         , size_t... Is        // Element indices
         , typename ... RTAs>  // Runtime arguments
-inline decltype(auto) trans( const DenseArray<MT>& dm, std::index_sequence<Is...> indices, RTAs... args )
+inline decltype(auto) trans( DenseArray<MT>& dm, std::index_sequence<Is...> indices, RTAs... args )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -1331,7 +1395,7 @@ inline decltype(auto) trans( const DenseArray<MT>& dm, std::index_sequence<Is...
 template< typename MT         // Type of the target dense tensor
         , size_t... Is        // Element indices
         , typename ... RTAs>  // Runtime arguments
-inline decltype(auto) trans( DenseArray<MT>& dm, std::index_sequence<Is...> indices, RTAs... args )
+inline decltype(auto) trans( DenseArray<MT>&& dm, std::index_sequence<Is...> indices, RTAs... args )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -1341,29 +1405,39 @@ inline decltype(auto) trans( DenseArray<MT>& dm, std::index_sequence<Is...> indi
 
 
 //*************************************************************************************************
-/*!\brief Calculation of the transpose of the given dense tensor.
+/*!\brief Calculation of the transpose of the given non-constant 4D dense array.
 // \ingroup dense_tensor
 //
-// \param dm The dense tensor to be transposed.
-// \return The transpose of the tensor.
+// \param dm The dense array to be transposed.
+// \param indices Pointer to the first element of the axis mapping.
+// \param n The number of elements of the axis mapping.
+// \return The transpose of the array.
 //
-// This function returns an expression representing the transpose of the given dense tensor:
+// This function returns a writable expression representing the transpose of the given
+// non-constant four-dimensional dense array, which allows to assign to the elements of \a dm
+// via the transposed indices. In case the axis mapping is invalid, a \a std::invalid_argument
+// exception is thrown:
 
    \code
-   blaze::DynamicArray<double> A;
-   blaze::DynamicArray<double,> B;
+   blaze::DynamicArray<4UL,double> A, B;
    // ... Resizing and initialization
-   B = trans( A, { 2UL, 0UL, 1UL } );     // rotate tensor
+   trans( A, { 3UL, 2UL, 0UL, 1UL } ) = B;
    \endcode
+
+// Constant and temporary arrays of any rank are transposed via DArrTransExpr.
 */
-template< typename MT         // Type of the target dense tensor
-        , size_t... Is        // Element indices
+template< typename MT         // Type of the target dense array
+        , typename T          // Type of the element indices
         , typename ... RTAs>  // Runtime arguments
-inline decltype(auto) trans( DenseArray<MT>&& dm, std::index_sequence<Is...> indices, RTAs... args )
+inline auto trans( DenseArray<MT>& dm, const T* indices, size_t n, RTAs... args )
+   -> EnableIf_t< MT::num_dimensions == 4UL, DQuatTransExpr<MT> >
 {
    BLAZE_FUNCTION_TRACE;
 
-   return trans<Is...>( ~dm, args... );
+   const std::array<size_t,4UL> perm( transpositionIndices<4UL>( indices, n ) );
+
+   using ReturnType = DQuatTransExpr<MT>;
+   return ReturnType( ~dm, perm.data(), perm.size(), args... );
 }
 //*************************************************************************************************
 
@@ -1529,6 +1603,34 @@ inline decltype(auto) trans( const DQuatTransExpr<MT, CTAs...>& dm, RTAs... args
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating the transpose of a transpose dense array with a runtime axis mapping.
+// \ingroup dense_array
+//
+// \param dm The dense array transposition expression to be (re-)transposed.
+// \param indices Pointer to the first element of the axis mapping.
+// \param n The number of elements of the axis mapping.
+// \param args Optional runtime arguments (unused).
+// \return The transpose of the transpose array.
+// \exception std::invalid_argument Invalid transposition indices.
+//
+// This function combines the two runtime axis mappings into a single one, such that the
+// operand is permuted only once (see DArrTransExpr).
+*/
+template< typename MT         // Type of the dense array
+        , typename T          // Type of the mapping indices
+        , typename ... RTAs>  // Runtime arguments
+inline decltype(auto) trans( const DQuatTransExpr<MT>& dm, T* indices, size_t n, RTAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return trans( dm.permutation(), indices, n, args... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Calculation of the transpose of the given dense tensor-scalar multiplication.
@@ -0,0 +1,549 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DTensArgReduceExpr.h
+//  \brief Header file for the dense tensor argmin() and argmax() functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSARGREDUCEEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSARGREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/dense/ArgReduce.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/smp/ParallelReduce.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ARGREDUCE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Position of the extremum of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor operand.
+// \param begin The first row to be reduced.
+// \param end The row behind the last row to be reduced (\a end > \a begin).
+// \return The first extremal element of the given rows and its flat index.
+//
+// The rows are numbered consecutively across all pages, the returned index is the flat index
+// \f$ (k \cdot M + i) \cdot N + j \f$ of the element.
+*/
+template< typename OP    // Type of the reduction operation
+        , typename TT >  // Type of the dense tensor operand
+inline ArgCandidate< ElementType_t<TT> >
+   dtensargreduceRows( const TT& A, size_t begin, size_t end )
+{
+   using ET = ElementType_t<TT>;
+
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   ArgCandidate<ET> result;
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      ArgCandidate<ET> row( argreduceRow<OP,ET>( N,
+         [&]( auto j ) { return A( k, i, j ); },
+         [&]( auto j ) { return A.load( k, i, j ); },
+         BoolConstant< UseVectorizedArgReduceKernel_v<TT,OP> >() ) );
+
+      row.index += r * N;
+
+      result = ( r == begin ) ? row : MergeArgCandidates<OP>()( result, row );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-wise or page-wise position of the extrema of a block of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target matrix of indices.
+// \param A The dense tensor operand.
+// \param rbegin The first row of the target matrix to be computed.
+// \param rend The row behind the last row of the target matrix to be computed.
+// \param jbegin The first column of the target matrix to be computed.
+// \param jend The column behind the last column of the target matrix to be computed.
+// \return void
+//
+// Each row of indices is computed by streaming the rows of the operand along the reduced
+// dimension through argreduceUpdate(). The columns are processed in blocks of
+// ARGREDUCE_BLOCK_SIZE, such that the current extrema of a block stay in the cache.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename OP       // Type of the reduction operation
+        , typename TT >     // Type of the dense tensor operand
+inline auto dtensargreduceOuter( DynamicMatrix<size_t>& C, const TT& A,
+                                 size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> EnableIf_t< RF != rowwise >
+{
+   using ET = ElementType_t<TT>;
+
+   const size_t L( RF == columnwise ? A.rows() : A.pages() );
+
+   std::unique_ptr<ET[]> best( new ET[ min( ARGREDUCE_BLOCK_SIZE, jend-jbegin ) ] );
+
+   for( size_t r=rbegin; r<rend; ++r )
+   {
+      size_t* index( C.data( r ) );
+
+      for( size_t jj=jbegin; jj<jend; jj+=ARGREDUCE_BLOCK_SIZE )
+      {
+         const size_t jjend( min( jj+ARGREDUCE_BLOCK_SIZE, jend ) );
+
+         for( size_t l=0UL; l<L; ++l )
+         {
+            const size_t k( RF == columnwise ? r : l );
+            const size_t i( RF == columnwise ? l : r );
+
+            argreduceUpdate<OP>( best.get(), index, l, jj, jjend,
+                                 [&]( size_t j ) { return A( k, i, j ); } );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-wise position of the extrema of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target matrix of indices.
+// \param A The dense tensor operand.
+// \param begin The first row of the operand to be reduced.
+// \param end The row behind the last row of the operand to be reduced.
+// \return void
+//
+// The rows are numbered consecutively across all pages. The position of the extremum of each
+// row is computed by means of argreduceRow().
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename OP       // Type of the reduction operation
+        , typename TT >     // Type of the dense tensor operand
+inline auto dtensargreduceInner( DynamicMatrix<size_t>& C, const TT& A, size_t begin, size_t end )
+   -> EnableIf_t< RF == rowwise >
+{
+   using ET = ElementType_t<TT>;
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      C( k, i ) = argreduceRow<OP,ET>( N,
+         [&]( auto j ) { return A( k, i, j ); },
+         [&]( auto j ) { return A.load( k, i, j ); },
+         BoolConstant< UseVectorizedArgReduceKernel_v<TT,OP> >() ).index;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP column-wise or page-wise position of the extrema of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target matrix of indices.
+// \param A The dense tensor operand (with a non-empty reduced dimension).
+// \return void
+//
+// The rows of the target matrix are distributed among the available threads. In case there
+// are fewer rows than threads, the columns are distributed in chunks of full SIMD vectors.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename OP       // Type of the reduction operation
+        , typename TT >     // Type of the dense tensor operand
+inline auto smpDTensArgReduceAssign( DynamicMatrix<size_t>& C, const TT& A )
+   -> EnableIf_t< RF != rowwise >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<TT> >::size );
+
+   const size_t M( C.rows()    );
+   const size_t N( C.columns() );
+   const bool parallel( A.pages() * A.rows() * A.columns() >= SMP_DTENSREDUCE_THRESHOLD );
+   const size_t tasks( parallel ? smpTasks() : 1UL );
+
+   if( tasks < 2UL || M*N < 2UL ) {
+      dtensargreduceOuter<RF,OP>( C, A, 0UL, M, 0UL, N );
+   }
+   else if( M >= tasks ) {
+      const size_t rows( ( M + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*rows );
+         const size_t end  ( min( begin+rows, M ) );
+         if( begin < end )
+            dtensargreduceOuter<RF,OP>( C, A, begin, end, 0UL, N );
+      } );
+   }
+   else {
+      const size_t columns( nextMultiple( ( N + tasks - 1UL ) / tasks, SIMDSIZE ) );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*columns );
+         const size_t end  ( min( begin+columns, N ) );
+         if( begin < end )
+            dtensargreduceOuter<RF,OP>( C, A, 0UL, M, begin, end );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP row-wise position of the extrema of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target matrix of indices.
+// \param A The dense tensor operand (with at least one column).
+// \return void
+//
+// The rows of the operand are distributed in contiguous ranges among the available threads.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename OP       // Type of the reduction operation
+        , typename TT >     // Type of the dense tensor operand
+inline auto smpDTensArgReduceAssign( DynamicMatrix<size_t>& C, const TT& A )
+   -> EnableIf_t< RF == rowwise >
+{
+   const size_t rows( A.pages() * A.rows() );
+   const bool parallel( rows * A.columns() >= SMP_DTENSREDUCE_THRESHOLD );
+   const size_t tasks( parallel ? min( smpTasks(), rows ) : 1UL );
+
+   if( tasks < 2UL ) {
+      dtensargreduceInner<RF,OP>( C, A, 0UL, rows );
+      return;
+   }
+
+   const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( t*chunk );
+      const size_t end  ( min( begin+chunk, rows ) );
+
+      if( begin < end ) {
+         dtensargreduceInner<RF,OP>( C, A, begin, end );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the total argmin() and argmax() functions for dense tensors.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param op The reduction operation (\a blaze::Min or \a blaze::Max).
+// \return The flat index of the first extremal element.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// The rows of the tensor are split into blocks, which are reduced in parallel in case the
+// tensor has at least SMP_DTENSREDUCE_THRESHOLD elements. The candidates of the blocks are
+// merged in a fixed tree order (see smpReduce()).
+*/
+template< typename MT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+inline size_t dtensargreduce( const DenseTensor<MT>& dm, OP op )
+{
+   UNUSED_PARAMETER( op );
+
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   const size_t rows( (~dm).pages() * (~dm).rows() );
+   const size_t N( (~dm).columns() );
+
+   if( rows * N == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   CT tmp( ~dm );
+
+   const bool parallel( rows * N >= SMP_DTENSREDUCE_THRESHOLD );
+
+   return smpReduce< ArgCandidate<ET> >( rows, parallel, MergeArgCandidates<OP>(),
+      [&]( size_t begin, size_t end ) {
+         return dtensargreduceRows<OP>( tmp, begin, end );
+      } ).index;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the partial argmin() and argmax() functions for dense tensors.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param op The reduction operation (\a blaze::Min or \a blaze::Max).
+// \return The matrix of the indices of the first extremal elements along dimension \a RF.
+// \exception std::invalid_argument Invalid input tensor.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense tensor
+        , typename OP >     // Type of the reduction operation
+inline DynamicMatrix<size_t> dtensargreduce( const DenseTensor<MT>& dm, OP op )
+{
+   UNUSED_PARAMETER( op );
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using CT = CompositeType_t<MT>;
+
+   const size_t O( (~dm).pages()   );
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   const size_t L( RF == columnwise ? M : ( RF == rowwise ? N : O ) );
+   const size_t m( RF == pagewise ? M : O );
+   const size_t n( RF == rowwise  ? M : N );
+
+   if( L == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   DynamicMatrix<size_t> C( m, n );
+
+   if( m == 0UL || n == 0UL ) {
+      return C;
+   }
+
+   CT tmp( ~dm );
+
+   smpDTensArgReduceAssign<RF,OP>( C, tmp );
+
+   return C;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the flat index of the smallest element of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The flat index of the first smallest element.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function returns the index of the smallest element of the given dense tensor \a dm in
+// a single pass over the elements. The index is the flat index \f$ (k \cdot M + i) \cdot N + j
+// \f$ of element \f$ (k,i,j) \f$ of the \f$ O \times M \times N \f$ tensor. In case the minimum
+// occurs several times, the index of the first occurrence is returned:
+
+   \code
+   blaze::DynamicTensor<int> A{ { { 1, -4 }, { 3, 4 } }, { { -4, 2 }, { 0, 1 } } };
+
+   const size_t index = argmin( A );  // Results in 1
+   \endcode
+
+// The rows of the tensor are reduced by means of SIMD operations and, in case the tensor has at
+// least SMP_DTENSREDUCE_THRESHOLD elements, in parallel. In case the tensor is empty, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the dense tensor
+inline size_t argmin( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dtensargreduce( ~dm, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the smallest elements of the given dense tensor along the given
+//        dimension.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The indices of the first smallest elements along dimension \a RF.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function returns the indices of the smallest elements of the given dense tensor \a dm
+// along the dimension \a RF. In case \a RF is set to \a blaze::columnwise, the result is an
+// \f$ O \times N \f$ matrix of row indices, in case \a RF is set to \a blaze::rowwise, an
+// \f$ O \times M \f$ matrix of column indices, and in case \a RF is set to \a blaze::pagewise,
+// an \f$ M \times N \f$ matrix of page indices:
+
+   \code
+   using blaze::pagewise;
+
+   blaze::DynamicTensor<int> A{ { { 1, -4 }, { 3, 4 } }, { { -4, 2 }, { 0, 1 } } };
+
+   // Results in ( ( 1 0 ) ( 1 1 ) )
+   const blaze::DynamicMatrix<size_t> indices = argmin<pagewise>( A );
+   \endcode
+
+// In case the reduced dimension is empty, a \a std::invalid_argument exception is thrown.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT >     // Type of the dense tensor
+inline DynamicMatrix<size_t> argmin( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dtensargreduce<RF>( ~dm, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the flat index of the largest element of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The flat index of the first largest element.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function returns the index of the largest element of the given dense tensor \a dm in
+// a single pass over the elements. The index is the flat index \f$ (k \cdot M + i) \cdot N + j
+// \f$ of element \f$ (k,i,j) \f$ of the \f$ O \times M \times N \f$ tensor. In case the maximum
+// occurs several times, the index of the first occurrence is returned:
+
+   \code
+   blaze::DynamicTensor<int> A{ { { 1, -4 }, { 3, 4 } }, { { -4, 2 }, { 0, 4 } } };
+
+   const size_t index = argmax( A );  // Results in 3
+   \endcode
+
+// The rows of the tensor are reduced by means of SIMD operations and, in case the tensor has at
+// least SMP_DTENSREDUCE_THRESHOLD elements, in parallel. In case the tensor is empty, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the dense tensor
+inline size_t argmax( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dtensargreduce( ~dm, Max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the indices of the largest elements of the given dense tensor along the given
+//        dimension.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The indices of the first largest elements along dimension \a RF.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function returns the indices of the largest elements of the given dense tensor \a dm
+// along the dimension \a RF. The shape of the result corresponds to the shape of argmin<RF>():
+
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, -4 }, { 3, 4 } }, { { -4, 2 }, { 0, 1 } } };
+
+   // Results in ( ( 0 1 ) ( 1 1 ) )
+   const blaze::DynamicMatrix<size_t> indices = argmax<rowwise>( A );
+   \endcode
+
+// In case the reduced dimension is empty, a \a std::invalid_argument exception is thrown.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT >     // Type of the dense tensor
+inline DynamicMatrix<size_t> argmax( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dtensargreduce<RF>( ~dm, Max() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
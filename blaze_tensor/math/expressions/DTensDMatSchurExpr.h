@@ -53,6 +53,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SchurExpr.h>
+#include <blaze/math/functors/Mult.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -85,6 +86,7 @@
 
 #include <blaze_tensor/math/constraints/DenseTensor.h>
 #include <blaze_tensor/math/constraints/TensMatSchurExpr.h>
+#include <blaze_tensor/math/dense/PageBroadcast.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/TensMatSchurExpr.h>
 #include <blaze_tensor/system/Thresholds.h>
@@ -168,6 +170,19 @@ class DTensDMatSchurExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Broadcast evaluation strategy***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the broadcast evaluation strategy.
+       In case none of the operands requires an intermediate evaluation, the variable is set to 1
+       and the Schur product is evaluated by broadcasting the dense matrix across the pages of the
+       dense tensor (see pageBroadcast()). Otherwise the variable is set to 0 and the operands are
+       evaluated first. */
+   template< typename TT1 >
+   static constexpr bool UseBroadcastAssign_v = !useAssign;
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DTensDMatSchurExpr<TT,MT,SO>;   //!< Type of this DTensDMatSchurExpr instance.
@@ -1086,6 +1101,72 @@ class DTensDMatSchurExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Broadcast assignment to dense tensors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense tensor-dense matrix Schur product to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side Schur product expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense tensor-dense matrix
+   // Schur product expression to a dense tensor. The matrix is broadcast across the pages of the
+   // tensor operand such that each block of matrix rows is reused for all pages while it resides in
+   // cache and both tensors are streamed exactly once. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case none of the
+   // operands requires an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      assign( DenseTensor<TT1>& lhs, const DTensDMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      pageBroadcast( ~lhs, rhs.lhs_, rhs.rhs_, Mult() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP broadcast assignment to dense tensors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense tensor-dense matrix Schur product to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side Schur product expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense tensor-dense
+   // matrix Schur product expression to a dense tensor. The pages of the target tensor are split
+   // among the available threads, each of which broadcasts the matrix across its own range of
+   // pages. Due to the explicit application of the SFINAE principle, this function can only be
+   // selected by the compiler in case none of the operands requires an intermediate evaluation.
+   */
+   template< typename TT1 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<TT1> >
+      smpAssign( DenseTensor<TT1>& lhs, const DTensDMatSchurExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      if( rhs.canSMPAssign() ) {
+         smpPageBroadcast( ~lhs, rhs.lhs_, rhs.rhs_, Mult() );
+      }
+      else {
+         pageBroadcast( ~lhs, rhs.lhs_, rhs.rhs_, Mult() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Compile time checks*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( TT );
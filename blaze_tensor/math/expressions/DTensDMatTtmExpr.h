@@ -0,0 +1,1037 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DTensDMatTtmExpr.h
+//  \brief Header file for the dense tensor/dense matrix mode-n multiplication (TTM) expression
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSDMATTTMEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSDMATTTMEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatDMatMultExpr.h>
+#include <blaze/math/expressions/DMatSerialExpr.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/expressions/MultExpr.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/Size.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/constraints/DenseTensor.h>
+#include <blaze_tensor/math/dense/Permutation.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/DTensSerialExpr.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/traits/TtmTrait.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DTENSDMATTTMEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the mode-n product of a dense tensor and a dense matrix.
+// \ingroup dense_tensor_expression
+//
+// The DTensDMatTtmExpr class represents the compile time expression for the multiplication of
+// a dense tensor with a dense matrix along the given mode (0: pages, 1: rows, 2: columns). The
+// extent of the selected mode of the tensor is replaced by the number of rows of the matrix:
+
+   \f[ C_{jil} = \sum_{k} M_{jk} T_{kil} \quad (mode 0), \qquad
+       C_{kjl} = \sum_{i} M_{ji} T_{kil} \quad (mode 1), \qquad
+       C_{kij} = \sum_{l} M_{jl} T_{kil} \quad (mode 2) \f]
+*/
+template< typename TT      // Type of the left-hand side dense tensor
+        , typename MT      // Type of the right-hand side dense matrix
+        , size_t MODE >    // Mode of the multiplication
+class DTensDMatTtmExpr
+   : public MultExpr< DenseTensor< DTensDMatTtmExpr<TT,MT,MODE> > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT1 = ResultType_t<TT>;      //!< Result type of the left-hand side dense tensor expression.
+   using RT2 = ResultType_t<MT>;      //!< Result type of the right-hand side dense matrix expression.
+   using CT1 = CompositeType_t<TT>;   //!< Composite type of the left-hand side dense tensor expression.
+   using CT2 = CompositeType_t<MT>;   //!< Composite type of the right-hand side dense matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the left-hand side dense tensor expression.
+   /*! The kernels operate on the raw data of the tensor, therefore tensors without low-level
+       data access are evaluated as well. */
+   static constexpr bool evaluateLeft =
+      ( IsComputation_v<TT> || RequiresEvaluation_v<TT> || !HasConstDataAccess_v<TT> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side dense matrix expression.
+   static constexpr bool evaluateRight = ( IsComputation_v<MT> || RequiresEvaluation_v<MT> );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this DTensDMatTtmExpr instance.
+   using This = DTensDMatTtmExpr<TT,MT,MODE>;
+
+   using ResultType    = TtmTrait_t<RT1,RT2,MODE>;     //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;   //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;    //!< Resulting element type.
+   using SIMDType      = SIMDTrait_t<ElementType>;     //!< Resulting SIMD element type.
+   using ReturnType    = const ElementType;            //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;             //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side dense tensor expression.
+   using LeftOperand = If_t< IsExpression_v<TT>, const TT, const TT& >;
+
+   //! Composite type of the right-hand side dense matrix expression.
+   using RightOperand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+
+   //! Type for the assignment of the left-hand side dense tensor operand.
+   using LT = If_t< evaluateLeft, const RT1, CT1 >;
+
+   //! Type for the assignment of the right-hand side dense matrix operand.
+   using RT = If_t< evaluateRight, const RT2, CT2 >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable =
+      ( !evaluateLeft && TT::smpAssignable && !evaluateRight && MT::smpAssignable );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensDMatTtmExpr class.
+   //
+   // \param tens The left-hand side dense tensor operand of the multiplication expression.
+   // \param mat The right-hand side dense matrix operand of the multiplication expression.
+   */
+   explicit inline DTensDMatTtmExpr( const TT& tens, const MT& mat ) noexcept
+      : tens_( tens )  // Left-hand side dense tensor of the multiplication expression
+      , mat_ ( mat  )  // Right-hand side dense matrix of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( mat.columns() == extent( tens ), "Invalid tensor/matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t k, size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( k < pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+      ElementType tmp{};
+
+      for( size_t l=0UL; l<mat_.columns(); ++l ) {
+         if( MODE == 0UL )
+            tmp += mat_(k,l) * tens_(l,i,j);
+         else if( MODE == 1UL )
+            tmp += mat_(i,l) * tens_(k,l,j);
+         else
+            tmp += tens_(k,i,l) * mat_(j,l);
+      }
+
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid tensor access index.
+   */
+   inline ReturnType at( size_t k, size_t i, size_t j ) const {
+      if( k >= pages() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+      }
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(k,i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return ( MODE == 1UL )?( mat_.rows() ):( tens_.rows() );
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return ( MODE == 2UL )?( mat_.rows() ):( tens_.columns() );
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return ( MODE == 0UL )?( mat_.rows() ):( tens_.pages() );
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side dense tensor operand.
+   //
+   // \return The left-hand side dense tensor operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return tens_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense matrix operand.
+   //
+   // \return The right-hand side dense matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return mat_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( tens_.canAlias( alias ) || mat_.canAlias( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( tens_.isAliased( alias ) || mat_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return tens_.isAligned() && mat_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   //
+   // As for the batched tensor multiplication the decision is based on the total number of
+   // elements of the result.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( !BLAZE_BLAS_MODE ||
+               !BLAZE_USE_BLAS_MATRIX_MATRIX_MULTIPLICATION ||
+               !BLAZE_BLAS_IS_PARALLEL ) &&
+             ( pages() * rows() * columns() >= SMP_DMATDMATMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  tens_;  //!< Left-hand side dense tensor of the multiplication expression.
+   RightOperand mat_;   //!< Right-hand side dense matrix of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Extent of the multiplied mode***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the extent of the multiplied mode of the given tensor.
+   //
+   // \param T The given dense tensor.
+   // \return The number of pages, rows, or columns of the tensor.
+   */
+   template< typename TT2 >  // Type of the dense tensor
+   static inline size_t extent( const TT2& T ) noexcept
+   {
+      return ( MODE == 0UL )?( T.pages() ):( ( MODE == 1UL )?( T.rows() ):( T.columns() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Flattening check****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Checks whether the pages of the given tensors can be viewed as a single matrix.
+   //
+   // \param C The target dense tensor.
+   // \param A The left-hand side tensor operand.
+   // \return \a true in case both tensors can be viewed as \f$ (O*M) \times N \f$ matrices.
+   */
+   template< typename TT3    // Type of the target dense tensor
+           , typename TT4 >  // Type of the left-hand side tensor operand
+   static inline bool isFlat( const TT3& C, const TT4& A ) noexcept
+   {
+      return ( pageSpacing( C ) == C.rows() * C.spacing() ) &&
+             ( pageSpacing( A ) == A.rows() * A.spacing() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Number of batches***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the number of independent matrix products of the multiplication.
+   //
+   // \param C The target dense tensor.
+   // \param A The left-hand side tensor operand.
+   // \return The number of rows (mode 0), pages (mode 1), or flattened rows (mode 2).
+   //
+   // In mode 2 the batches are the rows of the flattened \f$ (O*M) \times N \f$ view of the
+   // tensors in case the pages are stored contiguously, and the pages otherwise.
+   */
+   template< typename TT3    // Type of the target dense tensor
+           , typename TT4 >  // Type of the left-hand side tensor operand
+   static inline size_t batches( const TT3& C, const TT4& A ) noexcept
+   {
+      if( MODE == 0UL )
+         return C.rows();
+      else if( MODE == 1UL || !isFlat( C, A ) )
+         return C.pages();
+      else
+         return C.pages() * C.rows();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default kernel******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default kernel for the mode-n multiplication of a dense tensor and a dense matrix.
+   // \ingroup dense_tensor
+   //
+   // \param C The target dense tensor.
+   // \param A The left-hand side tensor operand.
+   // \param B The right-hand side matrix operand.
+   // \param begin The first batch to be computed.
+   // \param end The end of the range of batches to be computed.
+   // \param op The assignment operation.
+   // \return void
+   //
+   // This kernel wraps the tensors into unaligned, unpadded custom matrices and reduces the
+   // multiplication to the dense matrix multiplication (i.e. the BLAS \c gemm() or the Blaze
+   // \c mmm() kernels) without copying the tensor operands:
+   //
+   //  - mode 0: for each row \a i, \f$ C(:,i,:) = B * A(:,i,:) \f$, where the strided slices
+   //    \f$ A(:,i,:) \f$ are viewed as row-major matrices with the page spacing as row spacing;
+   //  - mode 1: for each page \a k, \f$ C(k,:,:) = B * A(k,:,:) \f$;
+   //  - mode 2: \f$ C = A * B^T \f$ as a single product of the flattened \f$ (O*M) \times N \f$
+   //    views in case the pages are stored contiguously, page by page otherwise.
+   */
+   template< typename TT3  // Type of the target dense tensor
+           , typename TT4  // Type of the left-hand side tensor operand
+           , typename MT5  // Type of the right-hand side matrix operand
+           , typename OP > // Type of the assignment operation
+   static void selectKernel( TT3& C, const TT4& A, const MT5& B, size_t begin, size_t end, OP op )
+   {
+      using CV = CustomMatrix< ElementType_t<TT3>, unaligned, unpadded, rowMajor >;
+      using AV = CustomMatrix< const ElementType_t<TT4>, unaligned, unpadded, rowMajor >;
+
+      if( begin >= end )
+         return;
+
+      if( MODE == 0UL )
+      {
+         const size_t psC( pageSpacing( C ) );
+         const size_t psA( pageSpacing( A ) );
+
+         for( size_t i=begin; i<end; ++i ) {
+            CV       Ci( C.data( i, 0UL ), C.pages(), C.columns(), psC );
+            const AV Ai( A.data( i, 0UL ), A.pages(), A.columns(), psA );
+            op( Ci, serial( B * Ai ) );
+         }
+      }
+      else if( MODE == 1UL )
+      {
+         for( size_t k=begin; k<end; ++k ) {
+            CV       Ck( C.data( 0UL, k ), C.rows(), C.columns(), C.spacing() );
+            const AV Ak( A.data( 0UL, k ), A.rows(), A.columns(), A.spacing() );
+            op( Ck, serial( B * Ak ) );
+         }
+      }
+      else if( isFlat( C, A ) )
+      {
+         const size_t M( C.rows() );
+
+         CV       Cv( C.data( begin % M, begin / M ), end - begin, C.columns(), C.spacing() );
+         const AV Av( A.data( begin % M, begin / M ), end - begin, A.columns(), A.spacing() );
+         op( Cv, serial( Av * trans( B ) ) );
+      }
+      else
+      {
+         for( size_t k=begin; k<end; ++k ) {
+            CV       Ck( C.data( 0UL, k ), C.rows(), C.columns(), C.spacing() );
+            const AV Ak( A.data( 0UL, k ), A.rows(), A.columns(), A.spacing() );
+            op( Ck, serial( Ak * trans( B ) ) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP kernel**********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP kernel for the mode-n multiplication of a dense tensor and a dense matrix.
+   // \ingroup dense_tensor
+   //
+   // \param C The target dense tensor.
+   // \param A The left-hand side tensor operand.
+   // \param B The right-hand side matrix operand.
+   // \param op The assignment operation.
+   // \return void
+   //
+   // The batches of the multiplication (see selectKernel()) are split into contiguous ranges
+   // of (almost) equal size and each range is processed by a single thread.
+   */
+   template< typename TT3  // Type of the target dense tensor
+           , typename TT4  // Type of the left-hand side tensor operand
+           , typename MT5  // Type of the right-hand side matrix operand
+           , typename OP > // Type of the assignment operation
+   static void selectSmpKernel( TT3& C, const TT4& A, const MT5& B, OP op )
+   {
+      const size_t n      ( batches( C, A ) );
+      const size_t threads( smpTasks() );
+
+      if( threads < 2UL || n < 2UL ) {
+         selectKernel( C, A, B, 0UL, n, op );
+         return;
+      }
+
+      const size_t tasks         ( min( threads, n ) );
+      const size_t batchesPerTask( n / tasks );
+      const size_t rest          ( n % tasks );
+
+      smpFor( tasks, [&]( size_t t )
+      {
+         const size_t begin( t*batchesPerTask + min( t, rest ) );
+         const size_t end  ( begin + batchesPerTask + ( ( t < rest )?( 1UL ):( 0UL ) ) );
+
+         selectKernel( C, A, B, begin, end, op );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment kernel selection*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Evaluates the operands and selects the kernel for the given assignment operation.
+   // \ingroup dense_tensor
+   //
+   // \param C The target dense tensor.
+   // \param rhs The right-hand side multiplication expression.
+   // \param op The assignment operation.
+   // \param parallel \a true in case the SMP kernel should be used, \a false if not.
+   // \return void
+   */
+   template< typename TT3  // Type of the target dense tensor
+           , typename OP > // Type of the assignment operation
+   static void assignKernel( TT3& C, const DTensDMatTtmExpr& rhs, OP op, bool parallel )
+   {
+      LT A( serial( rhs.tens_ ) );  // Evaluation of the left-hand side dense tensor operand
+      RT B( serial( rhs.mat_  ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.pages()   == rhs.tens_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.tens_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.tens_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.mat_.rows()    , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.mat_.columns() , "Invalid number of columns" );
+
+      if( parallel && rhs.canSMPAssign() )
+         DTensDMatTtmExpr::selectSmpKernel( C, A, B, op );
+      else
+         DTensDMatTtmExpr::selectKernel( C, A, B, 0UL, batches( C, A ), op );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense tensors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense tensor/dense matrix mode-n multiplication to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense tensor/dense
+   // matrix mode-n multiplication expression to a dense tensor with low-level data access.
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto assign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> EnableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).pages() == 0UL || (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      assignKernel( ~lhs, rhs, []( auto& C, const auto& P ){ C = P; }, false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense tensors without data access*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense tensor/dense matrix mode-n multiplication to a dense tensor
+   //        without low-level data access.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto assign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> DisableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense tensors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense tensor/dense matrix mode-n multiplication to a dense
+   //        tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto addAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> EnableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).pages() == 0UL || (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ||
+          rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      assignKernel( ~lhs, rhs, []( auto& C, const auto& P ){ C += P; }, false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense tensors without data access************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense tensor/dense matrix mode-n multiplication to a dense
+   //        tensor without low-level data access.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto addAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> DisableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense tensors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense tensor/dense matrix mode-n multiplication to a
+   //        dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto subAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> EnableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).pages() == 0UL || (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ||
+          rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      assignKernel( ~lhs, rhs, []( auto& C, const auto& P ){ C -= P; }, false );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense tensors without data access*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense tensor/dense matrix mode-n multiplication to a
+   //        dense tensor without low-level data access.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto subAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> DisableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense tensors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense tensor/dense matrix mode-n multiplication to a
+   //        dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline void schurAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense tensors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense tensor/dense matrix mode-n multiplication to a dense
+   //        tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense tensor/dense
+   // matrix mode-n multiplication expression to a dense tensor with low-level data access. The
+   // independent matrix products are distributed among the available threads.
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto smpAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> EnableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).pages() == 0UL || (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ) {
+         return;
+      }
+      else if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      assignKernel( ~lhs, rhs, []( auto& C, const auto& P ){ C = P; }, true );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense tensors without data access*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense tensor/dense matrix mode-n multiplication to a dense
+   //        tensor without low-level data access.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto smpAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> DisableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense tensors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense tensor/dense matrix mode-n multiplication to a
+   //        dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto smpAddAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> EnableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).pages() == 0UL || (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ||
+          rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      assignKernel( ~lhs, rhs, []( auto& C, const auto& P ){ C += P; }, true );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense tensors without data access********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense tensor/dense matrix mode-n multiplication to a
+   //        dense tensor without low-level data access.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto smpAddAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> DisableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense tensors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense tensor/dense matrix mode-n multiplication to a
+   //        dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto smpSubAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> EnableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).pages() == 0UL || (~lhs).rows() == 0UL || (~lhs).columns() == 0UL ||
+          rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      assignKernel( ~lhs, rhs, []( auto& C, const auto& P ){ C -= P; }, true );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense tensors without data access*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense tensor/dense matrix mode-n multiplication to a
+   //        dense tensor without low-level data access.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline auto smpSubAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+      -> DisableIf_t< HasMutableDataAccess_v<TT3> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense tensors***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a dense tensor/dense matrix mode-n multiplication to
+   //        a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   */
+   template< typename TT3 > // Type of the target dense tensor
+   friend inline void smpSchurAssign( DenseTensor<TT3>& lhs, const DTensDMatTtmExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSchurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( TT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   BLAZE_STATIC_ASSERT_MSG( MODE < 3UL, "Invalid tensor mode detected" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mode-n multiplication of a dense tensor and a dense matrix (tensor-times-matrix).
+// \ingroup dense_tensor
+//
+// \param tens The left-hand side dense tensor.
+// \param mat The right-hand side dense matrix.
+// \return The resulting tensor.
+// \exception std::invalid_argument Tensor and matrix sizes do not match.
+//
+// This function multiplies the given dense tensor along the given mode (0: pages, 1: rows,
+// 2: columns) with the given dense matrix, i.e. the extent of the selected mode of the tensor
+// is contracted with the columns of the matrix and replaced by the number of rows of the
+// matrix. This operation is the building block of the higher-order SVD and of the Tucker
+// decomposition:
+
+   \code
+   blaze::DynamicTensor<double> T( 32UL, 64UL, 128UL ), C;
+   blaze::DynamicMatrix<double> U0( 8UL, 32UL ), U1( 16UL, 64UL ), U2( 24UL, 128UL );
+
+   // Tucker core tensor of size 8x16x24
+   C = blaze::ttm<2UL>( blaze::ttm<1UL>( blaze::ttm<0UL>( T, U0 ), U1 ), U2 );
+   \endcode
+
+// The multiplication is evaluated lazily. All three modes are computed by means of the dense
+// matrix multiplication without copying the tensor: mode 2 as a single product of the
+// flattened \f$ (O*M) \times N \f$ view of the tensor, mode 1 as one product per page, and
+// mode 0 as one product per strided slice \f$ T(:,i,:) \f$. In case the multiplied dimension
+// of the tensor does not match the number of columns of the matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< size_t MODE     // Mode of the multiplication
+        , typename TT     // Type of the left-hand side dense tensor
+        , typename MT     // Type of the right-hand side dense matrix
+        , bool SO >       // Storage order of the right-hand side dense matrix
+inline decltype(auto) ttm( const DenseTensor<TT>& tens, const DenseMatrix<MT,SO>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( MODE < 3UL, "Invalid tensor mode detected" );
+
+   const size_t extent( ( MODE == 0UL )?( (~tens).pages() )
+                                       :( ( MODE == 1UL )?( (~tens).rows() )
+                                                         :( (~tens).columns() ) ) );
+
+   if( extent != (~mat).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor and matrix sizes do not match" );
+   }
+
+   using ReturnType = const DTensDMatTtmExpr<TT,MT,MODE>;
+   return ReturnType( ~tens, ~mat );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SIZE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename MT, size_t MODE, size_t N >
+struct Size< DTensDMatTtmExpr<TT,MT,MODE>, N >
+   : public If_t< N == MODE, Size<MT,0UL>, Size<TT,N> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,127 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DTensDTensInnerExpr.h
+//  \brief Header file for the dense tensor/dense tensor inner product
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSDTENSINNEREXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSDTENSINNEREXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/util/FunctionTrace.h>
+
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/DTensDTensSchurExpr.h>
+#include <blaze_tensor/math/expressions/DTensReduceExpr.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scalar product (inner product) of two dense tensors.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor for the inner product.
+// \param rhs The right-hand side dense tensor for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This function computes the scalar product of the two dense tensors \a lhs and \a rhs, i.e.
+// the sum of the element-wise products of both tensors
+// (\f$ s=\sum_{k,i,j} A_{kij} \cdot B_{kij} \f$):
+
+   \code
+   blaze::DynamicTensor<double> A, B;
+   // ... Resizing and initialization
+   const double s = inner( A, B );
+   \endcode
+
+// The element-wise products are not stored in a temporary tensor, but are computed and summed
+// up in a single pass (vectorized and, for large tensors, in parallel). In case the sizes of
+// the two tensors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1    // Type of the left-hand side dense tensor
+        , typename MT2 >  // Type of the right-hand side dense tensor
+inline decltype(auto) inner( const DenseTensor<MT1>& lhs, const DenseTensor<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).pages() != (~rhs).pages() || (~lhs).rows() != (~rhs).rows() ||
+       (~lhs).columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   return sum( ~lhs % ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar product (dot product) of two dense tensors.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor for the dot product.
+// \param rhs The right-hand side dense tensor for the dot product.
+// \return The scalar product.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This function is a synonym for the inner() function for dense tensors:
+
+   \code
+   blaze::DynamicTensor<double> A, B;
+   // ... Resizing and initialization
+   const double s = dot( A, B );
+   \endcode
+*/
+template< typename MT1    // Type of the left-hand side dense tensor
+        , typename MT2 >  // Type of the right-hand side dense tensor
+inline decltype(auto) dot( const DenseTensor<MT1>& lhs, const DenseTensor<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return inner( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,12 +42,15 @@
 //*************************************************************************************************
 
 #include <blaze/math/expressions/DMatDMatSubExpr.h>
+#include <blaze/math/functors/Sub.h>
 
 #include <blaze_tensor/math/constraints/DenseTensor.h>
 #include <blaze_tensor/math/constraints/TensTensSubExpr.h>
+#include <blaze_tensor/math/dense/PageBroadcast.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/Forward.h>
 #include <blaze_tensor/math/expressions/TensTensSubExpr.h>
+#include <blaze_tensor/math/typetraits/IsMatExpandExpr.h>
 
 namespace blaze {
 
@@ -127,6 +130,28 @@ class DTensDTensSubExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Broadcast evaluation strategy***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the broadcast evaluation strategy.
+       In case the right-hand side operand is a dense matrix expansion and none of the operands
+       requires an intermediate evaluation, the variable is set to 1 and the expanded matrix is
+       broadcast across the pages of the left-hand side tensor operand (see pageBroadcast()).
+       Otherwise the variable is set to 0 and the default strategy is chosen. */
+   template< typename MT >
+   static constexpr bool UseBroadcastAssign_v = ( !useAssign && IsMatExpandExpr_v<MT2> );
+
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is the counterpart of \a UseBroadcastAssign_v for a left-hand side
+       dense matrix expansion. In case only the left-hand side operand is a dense matrix expansion
+       and none of the operands requires an intermediate evaluation, the variable is set to 1 and
+       the expanded matrix is broadcast across the pages of the right-hand side tensor operand. */
+   template< typename MT >
+   static constexpr bool UseLeftBroadcastAssign_v =
+      ( !useAssign && IsMatExpandExpr_v<MT1> && !IsMatExpandExpr_v<MT2> );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DTensDTensSubExpr<MT1,MT2>;  //!< Type of this DTensDTensSubExpr instance.
@@ -895,6 +920,140 @@ class DTensDTensSubExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Broadcast assignment to dense tensors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense tensor-matrix expansion subtraction to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side subtraction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a subtraction between a dense
+   // tensor and a dense matrix expansion to a dense tensor. Instead of evaluating the expansion
+   // element by element, the expanded matrix is broadcast across the pages of the tensor operand,
+   // such that each block of matrix rows is reused for all pages while it resides in cache and both
+   // tensors are streamed exactly once. Due to the explicit application of the SFINAE principle,
+   // this function can only be selected by the compiler in case the right-hand side operand is a
+   // matrix expansion and none of the operands requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<MT> >
+      assign( DenseTensor<MT>& lhs, const DTensDTensSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      pageBroadcast( ~lhs, rhs.lhs_, rhs.rhs_.operand(), Sub() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP broadcast assignment to dense tensors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense tensor-matrix expansion subtraction to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side subtraction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a subtraction between a
+   // dense tensor and a dense matrix expansion to a dense tensor. The pages of the target tensor
+   // are split among the available threads, each of which broadcasts the expanded matrix across its
+   // own range of pages. Due to the explicit application of the SFINAE principle, this function can
+   // only be selected by the compiler in case the right-hand side operand is a matrix expansion and
+   // none of the operands requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseBroadcastAssign_v<MT> >
+      smpAssign( DenseTensor<MT>& lhs, const DTensDTensSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      if( rhs.canSMPAssign() ) {
+         smpPageBroadcast( ~lhs, rhs.lhs_, rhs.rhs_.operand(), Sub() );
+      }
+      else {
+         pageBroadcast( ~lhs, rhs.lhs_, rhs.rhs_.operand(), Sub() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Left broadcast assignment to dense tensors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix expansion-tensor subtraction to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side subtraction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a subtraction between a dense
+   // matrix expansion and a dense tensor to a dense tensor by broadcasting the expanded matrix
+   // across the pages of the tensor operand (see pageBroadcast()). The order of the operands is
+   // preserved. Due to the explicit application of the SFINAE principle, this function can only
+   // be selected by the compiler in case only the left-hand side operand is a matrix expansion
+   // and none of the operands requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseLeftBroadcastAssign_v<MT> >
+      assign( DenseTensor<MT>& lhs, const DTensDTensSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      pageBroadcast( ~lhs, rhs.rhs_, rhs.lhs_.operand(), PageBroadcastSwap<Sub>() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP left broadcast assignment to dense tensors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix expansion-tensor subtraction to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side subtraction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a subtraction between a
+   // dense matrix expansion and a dense tensor to a dense tensor (see smpPageBroadcast()). The
+   // order of the operands is preserved. Due to the explicit application of the SFINAE principle,
+   // this function can only be selected by the compiler in case only the left-hand side operand
+   // is a matrix expansion and none of the operands requires an intermediate evaluation.
+   */
+   template< typename MT > // Type of the target dense tensor
+   friend inline EnableIf_t< UseLeftBroadcastAssign_v<MT> >
+      smpAssign( DenseTensor<MT>& lhs, const DTensDTensSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      if( rhs.canSMPAssign() ) {
+         smpPageBroadcast( ~lhs, rhs.rhs_, rhs.lhs_.operand(), PageBroadcastSwap<Sub>() );
+      }
+      else {
+         pageBroadcast( ~lhs, rhs.rhs_, rhs.lhs_.operand(), PageBroadcastSwap<Sub>() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Compile time checks*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( MT1 );
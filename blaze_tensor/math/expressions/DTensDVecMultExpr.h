@@ -45,19 +45,25 @@
 #include <blaze/math/blas/gemv.h>
 #include <blaze/math/blas/trmv.h>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/constraints/ColumnVector.h>
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DMatDVecMultExpr.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecSerialExpr.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
 #include <blaze/math/expressions/VecScalarMultExpr.h>
+#include <blaze/math/PaddingFlag.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
@@ -82,11 +88,14 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/SameType.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsComplex.h>
 #include <blaze/util/typetraits/IsComplexDouble.h>
@@ -98,8 +107,10 @@
 #include <blaze_tensor/config/BLAS.h>
 #include <blaze_tensor/math/constraints/DenseTensor.h>
 #include <blaze_tensor/math/constraints/TensVecMultExpr.h>
+#include <blaze_tensor/math/dense/Permutation.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/expressions/TensVecMultExpr.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
 #include <blaze_tensor/math/traits/MultTrait.h>
 #include <blaze_tensor/math/views/PageSlice.h>
 #include <blaze_tensor/math/views/RowSlice.h>
@@ -149,14 +160,29 @@ class DTensDVecMultExpr
    static constexpr bool evaluateVector = ( IsComputation_v<VT> || RequiresEvaluation_v<VT> );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the target matrix and the tensor operand provide low-level data access, the
+       multiplication can be computed as dense matrix/dense vector multiplication on the
+       flattened \f$ (O*M) \times N \f$ view of the tensor and the variable will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   static constexpr bool UseFlatKernel_v =
+      ( useOptimizedKernels && HasMutableDataAccess_v<T1> && HasConstDataAccess_v<T2> );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case either the tensor or the vector operand requires an intermediate evaluation, the
-       variable will be set to 1, otherwise it will be 0. */
+       In case either the tensor or the vector operand requires an intermediate evaluation or
+       in case the flattened kernel can be used, the variable will be set to 1, otherwise it
+       will be 0. */
    template< typename T1 >
-   static constexpr bool UseSMPAssign_v = ( evaluateTensor || evaluateVector );
+   static constexpr bool UseSMPAssign_v =
+      ( evaluateTensor || evaluateVector || UseFlatKernel_v<T1,TT> );
    /*! \endcond */
    //**********************************************************************************************
 
@@ -200,6 +226,13 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The DMatScalarMultExpr specialization shares the flattened kernels of this expression.
+   template< typename, typename, bool > friend class DMatScalarMultExpr;
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DTensDVecMultExpr<TT,VT>;     //!< Type of this DTensDVecMultExpr instance.
@@ -384,6 +417,156 @@ class DTensDVecMultExpr
    RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
    //**********************************************************************************************
 
+   //**Flattened kernel***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Flattened kernel for a dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param begin The first row of the flattened tensor to be computed.
+   // \param end The end of the range of rows of the flattened tensor to be computed.
+   // \param op The assignment operation.
+   // \return void
+   //
+   // A row-major \f$ O \times M \times N \f$ tensor times a vector is an \f$ (O*M) \times N \f$
+   // matrix/vector product. In case the pages of the tensor and the rows of the target matrix
+   // are stored contiguously, this kernel computes the given range of rows of the flattened
+   // tensor by means of a single dense matrix/dense vector multiplication on custom views of
+   // the operands, which in turn uses the vectorized Blaze kernels or the BLAS \c gemv()
+   // function. Otherwise the range is split at the page boundaries.
+   */
+   template< typename MT1  // Type of the left-hand side target matrix
+           , typename TT1  // Type of the left-hand side tensor operand
+           , typename VT1  // Type of the right-hand side vector operand
+           , typename OP > // Type of the assignment operation
+   static void selectFlatKernel( MT1& y, const TT1& A, const VT1& x,
+                                 size_t begin, size_t end, OP op )
+   {
+      using YV = CustomVector< ElementType_t<MT1>, unaligned, unpadded, columnVector >;
+      using AV = CustomMatrix< const ElementType_t<TT1>, unaligned, unpadded, rowMajor >;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+
+      const bool flat( A.pages() < 2UL ||
+                       ( pageSpacing( A ) == M * A.spacing() && y.spacing() == M ) );
+
+      while( begin < end )
+      {
+         const size_t p( begin / M );
+         const size_t i( begin % M );
+         const size_t n( flat ? end - begin : min( end - begin, M - i ) );
+
+         YV       yv( y.data( p ) + i, n );
+         const AV Av( A.data( i, p ), n, N, A.spacing() );
+         op( yv, serial( Av * x ) );
+
+         begin += n;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP flattened kernel************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP variant of the flattened kernel for a dense tensor-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The assignment operation.
+   // \return void
+   //
+   // The rows of the flattened tensor are split into contiguous, SIMD-aligned ranges of at least
+   // \a BLAZE_SMP_DTENSDVECMULT_THRESHOLD rows, which are computed in parallel by means of the
+   // flattened kernel.
+   */
+   template< typename MT1  // Type of the left-hand side target matrix
+           , typename TT1  // Type of the left-hand side tensor operand
+           , typename VT1  // Type of the right-hand side vector operand
+           , typename OP > // Type of the assignment operation
+   static void selectSmpFlatKernel( MT1& y, const TT1& A, const VT1& x, OP op )
+   {
+      const size_t rows   ( A.pages() * A.rows() );
+      const size_t minRows( max( SMP_DTENSDVECMULT_THRESHOLD, 1UL ) );
+      const size_t tasks  ( max( min( smpTasks(), rows / minRows ), 1UL ) );
+
+      const size_t addon      ( ( ( rows % tasks ) != 0UL )?( 1UL ):( 0UL ) );
+      const size_t equalShare ( rows / tasks + addon );
+      const size_t rest       ( equalShare & ( SIMDSIZE - 1UL ) );
+      const size_t rowsPerTask( ( rest != 0UL )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+      smpFor( tasks, [&]( size_t t )
+      {
+         const size_t begin( min( t*rowsPerTask, rows ) );
+         const size_t end  ( min( begin+rowsPerTask, rows ) );
+
+         selectFlatKernel( y, A, x, begin, end, op );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP kernel selection************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the SMP kernel for a dense tensor-dense vector multiplication in case
+   //        the flattened kernel can be used.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param parallel \a true in case the multiplication should be computed in parallel.
+   // \param op The assignment operation for the flattened kernel.
+   // \return void
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename OP     // Type of the assignment operation
+           , typename SOP >  // Type of the SMP assignment operation
+   static inline auto selectSmpKernel( MT1& y, const TT1& A, const VT1& x,
+                                       bool parallel, OP op, SOP )
+      -> EnableIf_t< UseFlatKernel_v<MT1,TT1> >
+   {
+      if( parallel )
+         selectSmpFlatKernel( y, A, x, op );
+      else
+         selectFlatKernel( y, A, x, 0UL, A.pages() * A.rows(), op );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP kernel selection (default)**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the SMP kernel for a dense tensor-dense vector multiplication in case
+   //        the flattened kernel cannot be used.
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param smpOp The SMP assignment operation for the evaluated multiplication.
+   // \return void
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename OP     // Type of the assignment operation
+           , typename SOP >  // Type of the SMP assignment operation
+   static inline auto selectSmpKernel( MT1& y, const TT1& A, const VT1& x, bool, OP, SOP smpOp )
+      -> DisableIf_t< UseFlatKernel_v<MT1,TT1> >
+   {
+      smpOp( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense vectors*****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense tensor-dense vector multiplication to a dense column-major matrix
@@ -441,7 +624,8 @@ class DTensDVecMultExpr
    template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( MT1& y, const TT1& A, const VT1& x )
+   static inline auto selectAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> DisableIf_t< UseFlatKernel_v<MT1,TT1> >
    {
       if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
          selectSmallAssignKernel( y, A, x );
@@ -451,6 +635,32 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense vectors (flattened kernel selection)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the flattened kernel for an assignment of a dense tensor-dense vector
+   //        multiplication to a dense matrix (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the flattened kernel in case both the target matrix and the tensor
+   // operand provide low-level data access.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseFlatKernel_v<MT1,TT1> >
+   {
+      selectFlatKernel( y, A, x, 0UL, A.pages() * A.rows(),
+                        []( auto& y, const auto& P ){ y = P; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense tensor-dense vector multiplication
@@ -1040,9 +1250,10 @@ class DTensDVecMultExpr
    template< typename MT1    // Type of the left-hand side target matrix
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
+   static inline auto selectAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> DisableIf_t< UseFlatKernel_v<MT1,TT1> >
    {
-      if ( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
+      if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
          selectSmallAddAssignKernel( y, A, x );
       else
          selectLargeAddAssignKernel( y, A, x );
@@ -1050,6 +1261,32 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense vectors (flattened kernel selection)***************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the flattened kernel for an addition assignment of a dense
+   //        tensor-dense vector multiplication to a dense matrix (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the flattened kernel in case both the target matrix and the tensor
+   // operand provide low-level data access.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectAddAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseFlatKernel_v<MT1,TT1> >
+   {
+      selectFlatKernel( y, A, x, 0UL, A.pages() * A.rows(),
+                        []( auto& y, const auto& P ){ y += P; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to dense matrices***********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a dense tensor-dense vector multiplication
@@ -1607,7 +1844,8 @@ class DTensDVecMultExpr
    template< typename MT1    // Type of the left-hand side target vector
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
+   static inline auto selectSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> DisableIf_t< UseFlatKernel_v<MT1,TT1> >
    {
       if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
          selectSmallSubAssignKernel( y, A, x );
@@ -1617,6 +1855,32 @@ class DTensDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense vectors (flattened kernel selection)************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the flattened kernel for a subtraction assignment of a dense
+   //        tensor-dense vector multiplication to a dense matrix (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays to the flattened kernel in case both the target matrix and the tensor
+   // operand provide low-level data access.
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline auto selectSubAssignKernel( MT1& y, const TT1& A, const VT1& x )
+      -> EnableIf_t< UseFlatKernel_v<MT1,TT1> >
+   {
+      selectFlatKernel( y, A, x, 0UL, A.pages() * A.rows(),
+                        []( auto& y, const auto& P ){ y -= P; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense matrices********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a dense tensor-dense vector multiplication
@@ -2193,7 +2457,9 @@ class DTensDVecMultExpr
       BLAZE_INTERNAL_ASSERT( A.pages()   == (~lhs).rows()      , "Invalid matrix rows"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).columns()   , "Invalid matrix columns"    );
 
-      smpAssign( ~lhs, A * x );
+      DTensDVecMultExpr::selectSmpKernel( ~lhs, A, x, rhs.canSMPAssign(),
+         []( auto& y, const auto& P ){ y = P; },
+         []( auto& y, const auto& P ){ smpAssign( y, P ); } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2268,7 +2534,9 @@ class DTensDVecMultExpr
       BLAZE_INTERNAL_ASSERT( A.pages()   == (~lhs).rows()      , "Invalid matrix rows"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).columns()   , "Invalid matrix columns"    );
 
-      smpAddAssign( ~lhs, A * x );
+      DTensDVecMultExpr::selectSmpKernel( ~lhs, A, x, rhs.canSMPAssign(),
+         []( auto& y, const auto& P ){ y += P; },
+         []( auto& y, const auto& P ){ smpAddAssign( y, P ); } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2314,7 +2582,9 @@ class DTensDVecMultExpr
       BLAZE_INTERNAL_ASSERT( A.pages()   == (~lhs).rows()      , "Invalid matrix rows"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).columns()   , "Invalid matrix columns"    );
 
-      smpSubAssign( ~lhs, A * x );
+      DTensDVecMultExpr::selectSmpKernel( ~lhs, A, x, rhs.canSMPAssign(),
+         []( auto& y, const auto& P ){ y -= P; },
+         []( auto& y, const auto& P ){ smpSubAssign( y, P ); } );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2424,10 +2694,12 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case either the tensor or the vector operand requires an intermediate evaluation, the
-       variable will be set to 1, otherwise it will be 0. */
+       In case either the tensor or the vector operand requires an intermediate evaluation or
+       in case the flattened kernel can be used, the variable will be set to 1, otherwise it
+       will be 0. */
    template< typename T1 >
-   static constexpr bool UseSMPAssign_v = ( evaluateTensor || evaluateVector );
+   static constexpr bool UseSMPAssign_v =
+      ( evaluateTensor || evaluateVector || MVM::template UseFlatKernel_v<T1,TT> );
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -2709,7 +2981,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST1 >  // Type of the scalar value
-   static inline void selectAssignKernel( MT1& y, const TT1& A, const VT1& x, ST1 scalar )
+   static inline auto selectAssignKernel( MT1& y, const TT1& A, const VT1& x, ST1 scalar )
+      -> DisableIf_t< MVM::template UseFlatKernel_v<MT1,TT1> >
    {
       if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
          selectSmallAssignKernel( y, A, x, scalar );
@@ -2718,6 +2991,29 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Assignment to dense vectors (flattened kernel selection)************************************
+   /*!\brief Selection of the flattened kernel for an assignment of a scaled dense tensor-dense
+   //        vector multiplication to a dense matrix (\f$ \vec{y}=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST1 >  // Type of the scalar value
+   static inline auto selectAssignKernel( MT1& y, const TT1& A, const VT1& x, ST1 scalar )
+      -> EnableIf_t< MVM::template UseFlatKernel_v<MT1,TT1> >
+   {
+      MVM::selectFlatKernel( y, A, x, 0UL, A.pages() * A.rows(),
+                             [scalar]( auto& y, const auto& P ){ y = P * scalar; } );
+   }
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*!\brief Default assignment of a scaled dense tensor-dense vector multiplication
    //        (\f$ \vec{y}=s*A*\vec{x} \f$).
@@ -3323,7 +3619,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+   static inline auto selectAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> DisableIf_t< MVM::template UseFlatKernel_v<MT1,TT1> >
    {
       if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
          selectSmallAddAssignKernel( y, A, x, scalar );
@@ -3332,6 +3629,29 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Addition assignment to dense vectors (flattened kernel selection)***************************
+   /*!\brief Selection of the flattened kernel for an addition assignment of a scaled dense
+   //        tensor-dense vector multiplication to a dense matrix (\f$ \vec{y}+=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectAddAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< MVM::template UseFlatKernel_v<MT1,TT1> >
+   {
+      MVM::selectFlatKernel( y, A, x, 0UL, A.pages() * A.rows(),
+                             [scalar]( auto& y, const auto& P ){ y += P * scalar; } );
+   }
+   //**********************************************************************************************
+
    //**Default addition assignment to dense vectors************************************************
    /*!\brief Default addition assignment of a scaled dense tensor-dense vector multiplication
    //        (\f$ \vec{y}+=s*A*\vec{x} \f$).
@@ -3907,7 +4227,8 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
            , typename TT1    // Type of the left-hand side tensor operand
            , typename VT1    // Type of the right-hand side vector operand
            , typename ST2 >  // Type of the scalar value
-   static inline void selectSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+   static inline auto selectSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> DisableIf_t< MVM::template UseFlatKernel_v<MT1,TT1> >
    {
       if( A.pages() * A.rows() * A.columns() < DTENSDVECMULT_THRESHOLD )
          selectSmallSubAssignKernel( y, A, x, scalar );
@@ -3916,6 +4237,29 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
    }
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense vectors (flattened kernel selection)************************
+   /*!\brief Selection of the flattened kernel for a subtraction assignment of a scaled dense
+   //        tensor-dense vector multiplication to a dense matrix (\f$ \vec{y}-=s*A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense matrix.
+   // \param A The left-hand side dense tensor operand.
+   // \param x The right-hand side dense vector operand.
+   // \param scalar The scaling factor.
+   // \return void
+   */
+   template< typename MT1    // Type of the left-hand side target matrix
+           , typename TT1    // Type of the left-hand side tensor operand
+           , typename VT1    // Type of the right-hand side vector operand
+           , typename ST2 >  // Type of the scalar value
+   static inline auto selectSubAssignKernel( MT1& y, const TT1& A, const VT1& x, ST2 scalar )
+      -> EnableIf_t< MVM::template UseFlatKernel_v<MT1,TT1> >
+   {
+      MVM::selectFlatKernel( y, A, x, 0UL, A.pages() * A.rows(),
+                             [scalar]( auto& y, const auto& P ){ y -= P * scalar; } );
+   }
+   //**********************************************************************************************
+
    //**Default subtraction assignment to dense vectors*********************************************
    /*!\brief Default subtraction assignment of a scaled dense tensor-dense vector multiplication
    //        (\f$ \vec{y}-=s*A*\vec{x} \f$).
@@ -4492,7 +4836,11 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
       BLAZE_INTERNAL_ASSERT( A.pages()   == (~lhs).rows()    , "Invalid matrix rows"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).columns() , "Invalid matrix columns"    );
 
-      smpAssign( ~lhs, A * x * rhs.scalar_ );
+      const ST scalar( rhs.scalar_ );
+
+      MVM::selectSmpKernel( ~lhs, A, x, rhs.canSMPAssign(),
+         [scalar]( auto& y, const auto& P ){ y = P * scalar; },
+         [scalar]( auto& y, const auto& P ){ smpAssign( y, P * scalar ); } );
    }
    //**********************************************************************************************
 
@@ -4570,7 +4918,11 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
       BLAZE_INTERNAL_ASSERT( A.pages()   == (~lhs).rows()    , "Invalid matrix rows"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).columns() , "Invalid matrix columns"    );
 
-      smpAddAssign( ~lhs, A * x * rhs.scalar_ );
+      const ST scalar( rhs.scalar_ );
+
+      MVM::selectSmpKernel( ~lhs, A, x, rhs.canSMPAssign(),
+         [scalar]( auto& y, const auto& P ){ y += P * scalar; },
+         [scalar]( auto& y, const auto& P ){ smpAddAssign( y, P * scalar ); } );
    }
    //**********************************************************************************************
 
@@ -4617,7 +4969,11 @@ class DMatScalarMultExpr< DTensDVecMultExpr<TT,VT>, ST, false >
       BLAZE_INTERNAL_ASSERT( A.pages()   == (~lhs).rows()    , "Invalid matrix rows"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).columns() , "Invalid matrix columns"    );
 
-      smpSubAssign( ~lhs, A * x * rhs.scalar_ );
+      const ST scalar( rhs.scalar_ );
+
+      MVM::selectSmpKernel( ~lhs, A, x, rhs.canSMPAssign(),
+         [scalar]( auto& y, const auto& P ){ y -= P * scalar; },
+         [scalar]( auto& y, const auto& P ){ smpSubAssign( y, P * scalar ); } );
    }
    //**********************************************************************************************
 
@@ -0,0 +1,445 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DTensMomentsExpr.h
+//  \brief Header file for the dense tensor moments functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSMOMENTSEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSMOMENTSEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/dense/Moments.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/smp/ParallelReduce.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MOMENTS KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moments of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor operand.
+// \param begin The first row to be accumulated.
+// \param end The row behind the last row to be accumulated.
+// \return The moments of all elements of the given rows.
+//
+// The rows are numbered consecutively across all pages. The moments of each row are computed
+// by means of momentsRow() and merged into the result.
+*/
+template< typename TT >  // Type of the dense tensor operand
+inline MomentsAccumulator< MomentsType_t< ElementType_t<TT> > >
+   dtensmomentsRows( const TT& A, size_t begin, size_t end )
+{
+   using T = MomentsType_t< ElementType_t<TT> >;
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   MomentsAccumulator<T> result;
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      result = MergeMoments()( result, momentsRow<T>( N,
+         [&]( auto j ) { return A( k, i, j ); },
+         [&]( auto j ) { return A.load( k, i, j ); },
+         BoolConstant< UseVectorizedMomentsKernel_v<TT> >() ) );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-wise or page-wise moments of a block of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param res The statistics of the partial reduction.
+// \param A The dense tensor operand.
+// \param rbegin The first row of the statistics to be computed.
+// \param rend The row behind the last row of the statistics to be computed.
+// \param jbegin The first column of the statistics to be computed (a multiple of the SIMD size).
+// \param jend The column behind the last column of the statistics to be computed.
+// \return void
+//
+// Each row of the statistics is computed by streaming the rows of the operand along the reduced
+// dimension through momentsUpdate(). The columns are processed in blocks of MOMENTS_BLOCK_SIZE,
+// such that the statistics of a block stay in the cache while the reduced dimension is traversed.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename T        // Type of the statistics
+        , typename TT >     // Type of the dense tensor operand
+inline auto dtensmomentsOuter( Moments< DynamicMatrix<T> >& res, const TT& A,
+                               size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> EnableIf_t< RF != rowwise >
+{
+   const size_t L( RF == columnwise ? A.rows() : A.pages() );
+
+   for( size_t r=rbegin; r<rend; ++r )
+   {
+      T* mean( res.mean.data( r ) );
+      T* m2  ( res.variance.data( r ) );
+      T* mn  ( res.min.data( r ) );
+      T* mx  ( res.max.data( r ) );
+
+      for( size_t jj=jbegin; jj<jend; jj+=MOMENTS_BLOCK_SIZE )
+      {
+         const size_t jjend( min( jj+MOMENTS_BLOCK_SIZE, jend ) );
+
+         for( size_t l=0UL; l<L; ++l )
+         {
+            const size_t k( RF == columnwise ? r : l );
+            const size_t i( RF == columnwise ? l : r );
+
+            momentsUpdate( mean, m2, mn, mx, l, jj, jjend,
+               [&]( auto j ) { return A( k, i, j ); },
+               [&]( auto j ) { return A.load( k, i, j ); },
+               BoolConstant< UseVectorizedMomentsKernel_v<TT> >() );
+         }
+
+         momentsVariance( m2, jj, jjend, L );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-wise moments of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param res The statistics of the partial reduction.
+// \param A The dense tensor operand.
+// \param begin The first row of the operand to be reduced.
+// \param end The row behind the last row of the operand to be reduced.
+// \return void
+//
+// The rows are numbered consecutively across all pages. Each row of the operand is reduced to
+// a single element of the statistics by means of momentsRow().
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename T        // Type of the statistics
+        , typename TT >     // Type of the dense tensor operand
+inline auto dtensmomentsInner( Moments< DynamicMatrix<T> >& res, const TT& A,
+                               size_t begin, size_t end )
+   -> EnableIf_t< RF == rowwise >
+{
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      const MomentsAccumulator<T> acc( momentsRow<T>( N,
+         [&]( auto j ) { return A( k, i, j ); },
+         [&]( auto j ) { return A.load( k, i, j ); },
+         BoolConstant< UseVectorizedMomentsKernel_v<TT> >() ) );
+
+      res.mean    ( k, i ) = acc.mean;
+      res.variance( k, i ) = acc.m2 / T( N-1UL );
+      res.min     ( k, i ) = acc.min;
+      res.max     ( k, i ) = acc.max;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP column-wise or page-wise moments of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param res The statistics of the partial reduction.
+// \param A The dense tensor operand (with at least two elements along the reduced dimension).
+// \return void
+//
+// The rows of the statistics are distributed among the available threads. In case there are
+// fewer rows than threads, the columns are distributed in chunks of full SIMD vectors.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename T        // Type of the statistics
+        , typename TT >     // Type of the dense tensor operand
+inline auto smpDTensMomentsAssign( Moments< DynamicMatrix<T> >& res, const TT& A )
+   -> EnableIf_t< RF != rowwise >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+
+   const size_t M( res.mean.rows()    );
+   const size_t N( res.mean.columns() );
+   const bool parallel( A.pages() * A.rows() * A.columns() >= SMP_DTENSREDUCE_THRESHOLD );
+   const size_t tasks( parallel ? smpTasks() : 1UL );
+
+   if( tasks < 2UL || M*N < 2UL ) {
+      dtensmomentsOuter<RF>( res, A, 0UL, M, 0UL, N );
+   }
+   else if( M >= tasks ) {
+      const size_t rows( ( M + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*rows );
+         const size_t end  ( min( begin+rows, M ) );
+         if( begin < end )
+            dtensmomentsOuter<RF>( res, A, begin, end, 0UL, N );
+      } );
+   }
+   else {
+      const size_t columns( nextMultiple( ( N + tasks - 1UL ) / tasks, SIMDSIZE ) );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*columns );
+         const size_t end  ( min( begin+columns, N ) );
+         if( begin < end )
+            dtensmomentsOuter<RF>( res, A, 0UL, M, begin, end );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP row-wise moments of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param res The statistics of the partial reduction.
+// \param A The dense tensor operand (with at least two columns).
+// \return void
+//
+// The rows of the operand are distributed in contiguous ranges among the available threads.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename T        // Type of the statistics
+        , typename TT >     // Type of the dense tensor operand
+inline auto smpDTensMomentsAssign( Moments< DynamicMatrix<T> >& res, const TT& A )
+   -> EnableIf_t< RF == rowwise >
+{
+   const size_t rows( A.pages() * A.rows() );
+   const bool parallel( rows * A.columns() >= SMP_DTENSREDUCE_THRESHOLD );
+   const size_t tasks( parallel ? min( smpTasks(), rows ) : 1UL );
+
+   if( tasks < 2UL ) {
+      dtensmomentsInner<RF>( res, A, 0UL, rows );
+      return;
+   }
+
+   const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( t*chunk );
+      const size_t end  ( min( begin+chunk, rows ) );
+
+      if( begin < end ) {
+         dtensmomentsInner<RF>( res, A, begin, end );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the mean, the variance, the minimum, and the maximum of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the computation.
+// \return The statistics of all elements of the given dense tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes several statistics of all elements of the given dense tensor \a dm
+// in a single pass over the elements:
+
+   \code
+   blaze::DynamicTensor<double> A;
+   // ... Resizing and initialization
+
+   const blaze::Moments<double> stats( moments( A ) );
+   // stats.mean, stats.variance, stats.min, stats.max
+   \endcode
+
+// In comparison to separate calls to mean(), var(), min(), and max(), the tensor is traversed
+// only once. The computation is numerically stable: the rows of the tensor are processed in
+// blocks, the squared deviations are accumulated relative to the mean of each block, and the
+// partial results are merged pairwise (see MergeMoments). The blocks are vectorized and, in
+// case the tensor has at least SMP_DTENSREDUCE_THRESHOLD elements, processed in parallel.
+// Tensors with floating point elements are reduced in their own precision, all other tensors
+// in double precision. In case the tensor has less than two elements, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the dense tensor
+inline Moments< MomentsType_t< ElementType_t<MT> > > moments( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+   using T  = MomentsType_t< ElementType_t<MT> >;
+
+   const size_t rows( (~dm).pages() * (~dm).rows() );
+   const size_t N( (~dm).columns() );
+
+   if( rows * N < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   CT tmp( ~dm );
+
+   const bool parallel( rows * N >= SMP_DTENSREDUCE_THRESHOLD );
+
+   return momentsResult( smpReduce< MomentsAccumulator<T> >( rows, parallel, MergeMoments(),
+      [&]( size_t begin, size_t end ) {
+         return dtensmomentsRows( tmp, begin, end );
+      } ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the mean, the variance, the minimum, and the maximum of the given dense tensor
+//        along the given dimension.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor for the computation.
+// \return The statistics of each reduced slice of the given dense tensor.
+// \exception std::invalid_argument Invalid input tensor.
+//
+// This function computes several statistics of the given dense tensor \a dm along the dimension
+// \a RF in a single pass over the elements. In case \a RF is set to \a blaze::columnwise, the
+// statistics of each column of each page are computed (resulting in \f$ O \times N \f$
+// matrices), in case \a RF is set to \a blaze::rowwise, the statistics of each row (resulting
+// in \f$ O \times M \f$ matrices), and in case \a RF is set to \a blaze::pagewise, the
+// statistics across all pages (resulting in \f$ M \times N \f$ matrices):
+
+   \code
+   using blaze::pagewise;
+
+   blaze::DynamicTensor<float> A;
+   // ... Resizing and initialization
+
+   const blaze::Moments< blaze::DynamicMatrix<float> > stats( moments<pagewise>( A ) );
+   // stats.mean, stats.variance, stats.min, stats.max
+   \endcode
+
+// For a column-wise or page-wise reduction the rows of the operand are streamed along the
+// reduced dimension by means of the update formula of Welford, for a row-wise reduction each
+// row is reduced in blocks (see moments()). The computation is vectorized and, in case the
+// tensor has at least SMP_DTENSREDUCE_THRESHOLD elements, parallelized over the independent
+// statistics. In case the reduced dimension has less than two elements, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT >     // Type of the dense tensor
+inline Moments< DynamicMatrix< MomentsType_t< ElementType_t<MT> > > >
+   moments( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using CT = CompositeType_t<MT>;
+   using T  = MomentsType_t< ElementType_t<MT> >;
+
+   const size_t O( (~dm).pages()   );
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   const size_t L( RF == columnwise ? M : ( RF == rowwise ? N : O ) );
+   const size_t m( RF == pagewise ? M : O );
+   const size_t n( RF == rowwise  ? M : N );
+
+   if( L < 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid input tensor" );
+   }
+
+   Moments< DynamicMatrix<T> > res{ L, DynamicMatrix<T>( m, n ), DynamicMatrix<T>( m, n ),
+                                    DynamicMatrix<T>( m, n ), DynamicMatrix<T>( m, n ) };
+
+   if( m == 0UL || n == 0UL ) {
+      return res;
+   }
+
+   CT tmp( ~dm );
+
+   smpDTensMomentsAssign<RF>( res, tmp );
+
+   return res;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,6 +44,7 @@
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -63,13 +64,17 @@
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsView.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
@@ -80,7 +85,10 @@
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
+#include <blaze_tensor/math/dense/ContiguousNorm.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/smp/ParallelReduce.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
 
@@ -132,91 +140,82 @@ struct DTensNormHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the norm of a row-major dense tensor.
+/*!\brief Auxiliary variable template for the selection of the contiguous dense tensor norm kernel.
 // \ingroup dense_tensor
 //
-// \param dm The given row-major dense tensor for the norm computation.
+// In case the dense tensor operand \a TT is not a view and provides direct access to its
+// elements, the rows of all pages are stored consecutively with a distance of \a spacing()
+// elements and the variable is set to \a true. Otherwise it is set to \a false.
+*/
+template< typename TT >  // Type of the dense tensor operand
+constexpr bool UseContiguousDTensNormKernel_v =
+   ( HasConstDataAccess_v<TT> && !IsView_v<TT> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the norm of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor operand.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given tensor.
+// \param begin The first row to be processed (counting the rows of all pages consecutively).
+// \param end The row behind the last row to be processed.
+// \return The accumulated powers of the given range of rows (without the root).
 //
-// This function implements the performance optimized norm of a row-major dense tensor. Due to
-// the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization cannot be applied.
+// This function accumulates the powers of the elements of the non-empty range \f$[begin..end)\f$
+// of rows of the given dense tensor. Due to the explicit application of the SFINAE principle,
+// this function can only be selected by the compiler in case vectorization cannot be applied.
 */
-template< typename MT      // Type of the dense tensor
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power power, Root root, FalseType )
+template< typename TT       // Type of the dense tensor operand
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline auto dtensnormRows( const TT& A, Abs abs, Power power, size_t begin, size_t end )
+   -> DisableIf_t< DTensNormHelper<TT,Abs,Power>::value, ElementType_t<TT> >
 {
-   using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
+   using ET = ElementType_t<TT>;
 
-   if( (~dm).pages() == 0UL || (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return RT();
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
 
-   CT tmp( ~dm );
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
 
-   const size_t O( tmp.pages()   );
-   const size_t M( tmp.rows()    );
-   const size_t N( tmp.columns() );
+   size_t k( begin / M );
+   size_t i( begin % M );
+   size_t j( 1UL );
 
-   ET norm( power( abs( tmp(0UL,0UL,0UL) ) ) );
+   ET norm( power( abs( A( k, i, 0UL ) ) ) );
 
+   for( size_t r=begin; r<end; ++r )
    {
-      size_t j( 1UL );
-
-      for( size_t k = 0; k < O; ++k ) {
-
-         for( ; ( j + 4UL ) <= N; j += 4UL )
-         {
-            norm += power( abs( tmp( k, 0UL, j ) ) ) +
-               power( abs( tmp( k, 0UL, j + 1UL ) ) ) +
-               power( abs( tmp( k, 0UL, j + 2UL ) ) ) +
-               power( abs( tmp( k, 0UL, j + 3UL ) ) );
-         }
-         for( ; ( j + 2UL ) <= N; j += 2UL )
-         {
-            norm += power( abs( tmp( k, 0UL, j ) ) ) +
-               power( abs( tmp( k, 0UL, j + 1UL ) ) );
-         }
-         for( ; j < N; ++j )
-         {
-            norm += power( abs( tmp( k, 0UL, j ) ) );
-         }
-
-         j = 0UL;
+      for( ; ( j + 4UL ) <= N; j += 4UL )
+      {
+         norm += power( abs( A( k, i, j ) ) ) +
+            power( abs( A( k, i, j + 1UL ) ) ) +
+            power( abs( A( k, i, j + 2UL ) ) ) +
+            power( abs( A( k, i, j + 3UL ) ) );
       }
-   }
-
-   for( size_t k = 0; k < O; ++k )
-   {
-      for( size_t i = 1UL; i < M; ++i )
+      for( ; ( j + 2UL ) <= N; j += 2UL )
+      {
+         norm += power( abs( A( k, i, j ) ) ) + power( abs( A( k, i, j + 1UL ) ) );
+      }
+      for( ; j < N; ++j )
       {
-         size_t j( 0UL );
-
-         for( ; ( j + 4UL ) <= N; j += 4UL )
-         {
-            norm += power( abs( tmp( k, i, j ) ) ) +
-               power( abs( tmp( k, i, j + 1UL ) ) ) +
-               power( abs( tmp( k, i, j + 2UL ) ) ) +
-               power( abs( tmp( k, i, j + 3UL ) ) );
-         }
-         for( ; ( j + 2UL ) <= N; j += 2UL )
-         {
-            norm +=
-               power( abs( tmp( k, i, j ) ) ) + power( abs( tmp( k, i, j + 1UL ) ) );
-         }
-         for( ; j < N; ++j )
-         {
-            norm += power( abs( tmp( k, i, j ) ) );
-         }
+         norm += power( abs( A( k, i, j ) ) );
+      }
+
+      j = 0UL;
+
+      if( ++i == M ) {
+         i = 0UL;
+         ++k;
       }
    }
 
-   return evaluate( root( norm ) );
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -224,40 +223,37 @@ inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power po
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the norm of a row-major dense tensor.
+/*!\brief SIMD optimized kernel for the norm of a range of rows of a dense tensor view.
 // \ingroup dense_tensor
 //
-// \param dm The given row-major dense tensor for the norm computation.
+// \param A The dense tensor operand.
 // \param abs The functor for the abs operation.
 // \param power The functor for the power operation.
-// \param root The functor for the root operation.
-// \return The norm of the given tensor.
-//
-// This function implements the performance optimized norm of a row-major dense tensor. Due to
-// the explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization can be applied.
+// \param begin The first row to be processed (counting the rows of all pages consecutively).
+// \param end The row behind the last row to be processed.
+// \return The accumulated powers of the given range of rows (without the root).
+//
+// This function accumulates the powers of the elements of the non-empty range \f$[begin..end)\f$
+// of rows of the given dense tensor row by row. Due to the explicit application of the SFINAE
+// principle, this function can only be selected by the compiler in case vectorization can be
+// applied, but the rows are not guaranteed to be stored consecutively.
 */
-template< typename MT      // Type of the dense tensor
-        , typename Abs     // Type of the abs operation
-        , typename Power   // Type of the power operation
-        , typename Root >  // Type of the root operation
-inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power power, Root root, TrueType )
+template< typename TT       // Type of the dense tensor operand
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline auto dtensnormRows( const TT& A, Abs abs, Power power, size_t begin, size_t end )
+   -> EnableIf_t< DTensNormHelper<TT,Abs,Power>::value && !UseContiguousDTensNormKernel_v<TT>
+                , ElementType_t<TT> >
 {
-   using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
-   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
-
-   static constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
-
-   if( (~dm).pages() == 0UL || (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return RT();
+   using ET = ElementType_t<TT>;
 
-   CT tmp( ~dm );
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
 
-   const size_t O( tmp.pages()   );
-   const size_t M( tmp.rows()    );
-   const size_t N( tmp.columns() );
+   constexpr bool remainder( !IsPadded_v<TT> );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
 
-   constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
 
    const size_t jpos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
@@ -265,38 +261,91 @@ inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power po
    SIMDTrait_t<ET> xmm1, xmm2, xmm3, xmm4;
    ET norm{};
 
-   for( size_t k = 0; k < O; ++k )
+   for( size_t r=begin; r<end; ++r )
    {
-      for( size_t i = 0UL; i < M; ++i )
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      size_t j( 0UL );
+
+      for( ; ( j + SIMDSIZE * 3UL ) < jpos; j += SIMDSIZE * 4UL )
+      {
+         xmm1 += power( abs( A.load( k, i, j ) ) );
+         xmm2 += power( abs( A.load( k, i, j + SIMDSIZE ) ) );
+         xmm3 += power( abs( A.load( k, i, j + SIMDSIZE * 2UL ) ) );
+         xmm4 += power( abs( A.load( k, i, j + SIMDSIZE * 3UL ) ) );
+      }
+      for( ; ( j + SIMDSIZE ) < jpos; j += SIMDSIZE * 2UL )
+      {
+         xmm1 += power( abs( A.load( k, i, j ) ) );
+         xmm2 += power( abs( A.load( k, i, j + SIMDSIZE ) ) );
+      }
+      for( ; j < jpos; j += SIMDSIZE )
+      {
+         xmm1 += power( abs( A.load( k, i, j ) ) );
+      }
+      for( ; remainder && j < N; ++j )
       {
-         size_t j( 0UL );
-
-         for( ; ( j + SIMDSIZE * 3UL ) < jpos; j += SIMDSIZE * 4UL )
-         {
-            xmm1 += power( abs( tmp.load( k, i, j ) ) );
-            xmm2 += power( abs( tmp.load( k, i, j + SIMDSIZE ) ) );
-            xmm3 += power( abs( tmp.load( k, i, j + SIMDSIZE * 2UL ) ) );
-            xmm4 += power( abs( tmp.load( k, i, j + SIMDSIZE * 3UL ) ) );
-         }
-         for( ; ( j + SIMDSIZE ) < jpos; j += SIMDSIZE * 2UL )
-         {
-            xmm1 += power( abs( tmp.load( k, i, j ) ) );
-            xmm2 += power( abs( tmp.load( k, i, j + SIMDSIZE ) ) );
-         }
-         for( ; j < jpos; j += SIMDSIZE )
-         {
-            xmm1 += power( abs( tmp.load( k, i, j ) ) );
-         }
-         for( ; remainder && j < N; ++j )
-         {
-            norm += power( abs( tmp( k, i, j ) ) );
-         }
+         norm += power( abs( A( k, i, j ) ) );
       }
    }
 
    norm += sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
-   return evaluate( root( norm ) );
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized kernel for the norm of a range of rows of a contiguous dense tensor.
+// \ingroup dense_tensor
+//
+// \param A The dense tensor operand.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param begin The first row to be processed (counting the rows of all pages consecutively).
+// \param end The row behind the last row to be processed.
+// \return The accumulated powers of the given range of rows (without the root).
+//
+// This function accumulates the powers of the elements of the non-empty range \f$[begin..end)\f$
+// of rows of the given dense tensor via its data pointer. In case the tensor is padded or its
+// rows are not separated by any gap, the complete range is traversed as a single contiguous
+// block, such that tensors with narrow columns don't fall back to the scalar remainder loop.
+// Padding elements are zero and therefore don't contribute to any norm. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case vectorization can be applied.
+*/
+template< typename TT       // Type of the dense tensor operand
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline auto dtensnormRows( const TT& A, Abs abs, Power power, size_t begin, size_t end )
+   -> EnableIf_t< DTensNormHelper<TT,Abs,Power>::value && UseContiguousDTensNormKernel_v<TT>
+                , ElementType_t<TT> >
+{
+   using ET = ElementType_t<TT>;
+
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
+
+   const size_t N ( A.columns() );
+   const size_t nn( A.spacing() );
+
+   const ET* row( A.data() + begin*nn );
+
+   if( IsPadded_v<TT> || nn == N ) {
+      return contiguousNorm( row, ( end - begin ) * nn, abs, power );
+   }
+
+   ET norm( contiguousNorm( row, N, abs, power ) );
+
+   for( size_t r=begin+1UL; r<end; ++r ) {
+      row += nn;
+      norm += contiguousNorm( row, N, abs, power );
+   }
+
+   return norm;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -314,7 +363,9 @@ inline decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power po
 // \return The norm of the given dense tensor.
 //
 // This function computes a custom norm of the given dense tensor by means of the given functors.
-// The following example demonstrates the computation of the L2 norm by means of the blaze::Pow2
+// In case the tensor has at least SMP_DTENSREDUCE_THRESHOLD elements, the rows of all pages are
+// split into blocks, which are processed in parallel by means of the active SMP backend. The
+// following example demonstrates the computation of the L2 norm by means of the blaze::Pow2
 // and blaze::Sqrt functors:
 
    \code
@@ -329,7 +380,22 @@ template< typename MT      // Type of the dense tensor
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseTensor<MT>& dm, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dm, abs, power, root, Bool_t< DTensNormHelper<MT,Abs,Power>::value >() );
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+   using RT = decltype( evaluate( root( std::declval<ET>() ) ) );
+
+   if( (~dm).pages() == 0UL || (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return RT();
+
+   CT tmp( ~dm );
+
+   const size_t rows( tmp.pages() * tmp.rows() );
+   const bool parallel( rows * tmp.columns() >= SMP_DTENSREDUCE_THRESHOLD );
+
+   const ET norm( smpReduce<ET>( rows, parallel, Add(), [&]( size_t begin, size_t end ) {
+      return dtensnormRows( tmp, abs, power, begin, end );
+   } ) );
+
+   return evaluate( root( norm ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -43,26 +43,30 @@
 
 #include <blaze/math/Aliases.h>
 #include <blaze/math/Exception.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/Transformation.h>
 #include <blaze/math/shims/Serial.h>
-#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsView.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/StorageOrder.h>
 #include <blaze/system/Inline.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/GetMemberType.h>
 
 #include <blaze_tensor/math/expressions/TensRavelExpr.h>
@@ -131,6 +135,16 @@ class DTensRavelExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Data access strategy************************************************************************
+   //! Compilation switch for the direct access to the elements of the tensor operand.
+   /*! In case the dense tensor operand is a tensor with low-level data access to its entire
+       storage, \a useDataAccess is set to 1 and the ravel expression directly accesses the
+       elements of the tensor as long as its rows are stored without padding. Otherwise
+       \a useDataAccess is set to 0 and the elements are accessed via the function call
+       operator of the tensor. */
+   static constexpr bool useDataAccess = HasConstDataAccess_v<TT> && !IsView_v<TT>;
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = DTensRavelExpr<TT>;              //!< Type of this DTensRavelExpr instance.
@@ -139,6 +153,7 @@ class DTensRavelExpr
    using TransposeType = TransposeType_t<ResultType>;    //!< Transpose type for expression template evaluations.
    using ElementType   = ElementType_t<TT>;              //!< Resulting element type.
    using ReturnType    = ReturnType_t<TT>;               //!< Return type for expression template evaluations.
+   using SIMDType      = SIMDTrait_t<ElementType>;       //!< Resulting SIMD element type.
 
    //! Data type for composite expression templates.
    using CompositeType = If_t< useAssign, const ResultType, const DTensRavelExpr& >;
@@ -455,7 +470,9 @@ class DTensRavelExpr
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   /*! The vectorized evaluation is only enabled for unpadded operands, since the elements of a
+       padded tensor are not stored contiguously and would have to be loaded one by one. */
+   static constexpr bool simdEnabled = useDataAccess && TT::simdEnabled && !IsPadded_v<TT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = TT::smpAssignable;
@@ -468,7 +485,7 @@ class DTensRavelExpr
    // \param args The runtime ravel expression arguments.
    */
    explicit inline DTensRavelExpr( const TT& dm ) noexcept
-      : dm_     ( dm )       // Dense tensor of the ravel expression
+      : dm_( dm )  // Dense tensor of the ravel expression
    {}
    //**********************************************************************************************
 
@@ -482,6 +499,11 @@ class DTensRavelExpr
 
       BLAZE_INTERNAL_ASSERT( index < size(), "Invalid access index");
 
+      const ElementType* data( contiguousData( BoolConstant<useDataAccess>() ) );
+
+      if( data != nullptr )
+         return data[index];
+
 //       if (TF == blaze::columnVector)
 //       {
 //          auto div = std::div(index, dm_.rows());
@@ -510,6 +532,34 @@ class DTensRavelExpr
    }
    //**********************************************************************************************
 
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the vector.
+   //
+   // \param index Access index for the elements.
+   // \return Reference to the accessed values.
+   //
+   // In case the elements of the tensor are stored contiguously the SIMD element is loaded
+   // directly from the tensor. Otherwise the elements are collected one by one.
+   */
+   BLAZE_ALWAYS_INLINE SIMDType load( size_t index ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( index < size(), "Invalid vector access index" );
+      BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid vector access index" );
+
+      const ElementType* data( contiguousData( BoolConstant<useDataAccess>() ) );
+
+      if( data != nullptr )
+         return loadu( data + index );
+
+      alignas( AlignmentOf_v<ElementType> ) ElementType buffer[SIMDSIZE];
+
+      for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+         buffer[k] = (*this)[index+k];
+      }
+
+      return loada( buffer );
+   }
+   //**********************************************************************************************
+
    //**Begin function******************************************************************************
    /*!\brief Returns an iterator to the first element of the underlying tensor.
    //
@@ -615,6 +665,34 @@ class DTensRavelExpr
    //**********************************************************************************************
 
  private:
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+   //**Contiguous data function********************************************************************
+   /*!\brief Returns the elements of the dense tensor in case they are stored contiguously.
+   //
+   // \return Pointer to the first element, \a nullptr in case the rows of the tensor are padded.
+   //
+   // The pointer is queried from the operand on every access, such that the expression stays
+   // valid in case the operand is resized or reallocated after the creation of the expression.
+   */
+   inline const ElementType* contiguousData( TrueType ) const noexcept {
+      return ( dm_.pages() * dm_.rows() <= 1UL || dm_.spacing() == dm_.columns() )?( dm_.data() ):( nullptr );
+   }
+   //**********************************************************************************************
+
+   //**Contiguous data function********************************************************************
+   /*!\brief Returns the elements of the dense tensor in case they are stored contiguously.
+   //
+   // \return \a nullptr since the tensor does not provide low-level data access.
+   */
+   inline const ElementType* contiguousData( FalseType ) const noexcept {
+      return nullptr;
+   }
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    Operand dm_;  //!< Dense tensor of the ravel expression.
    //**********************************************************************************************
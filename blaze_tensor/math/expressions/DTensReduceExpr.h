@@ -42,8 +42,11 @@
 //*************************************************************************************************
 
 #include <iterator>
+#include <utility>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/Forward.h>
@@ -51,33 +54,47 @@
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sub.h>
 #include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/DisableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 #include <blaze_tensor/math/ReductionFlag.h>
 #include <blaze_tensor/math/constraints/DenseTensor.h>
 #include <blaze_tensor/math/constraints/Tensor.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/Forward.h>
 #include <blaze_tensor/math/expressions/TensReduceExpr.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/math/smp/ParallelReduce.h>
+#include <blaze_tensor/system/Thresholds.h>
 
 namespace blaze {
-
 //=================================================================================================
 //
 //  CLASS DEFINITION
@@ -85,17 +102,664 @@ namespace blaze {
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Base template for dense tensor reduction operations.
-// \ingroup dense_tensor_expression
+/*!\brief Base template for dense tensor reduction operations.
+// \ingroup dense_tensor_expression
+//
+// The DTensReduceExpr class represents the compile time expression for partial reduction operations
+// of dense matrices.
+*/
+template< typename MT  // Type of the dense tensor
+        , typename OP  // Type of the reduction operation
+        , size_t RF >  // Reduction flag
+class DTensReduceExpr
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense tensor reduction operation.
+// \ingroup dense_tensor
+*/
+template< typename MT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+struct DTensReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense tensor expression.
+   using CT = RemoveReference_t< CompositeType_t<MT> >;
+
+   //! Element type of the dense tensor expression.
+   using ET = ElementType_t<CT>;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( CT::simdEnabled &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET,ET>, HasLoad<OP> >::value );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARTIAL REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the element access of the column-wise and page-wise
+//        reduction kernels.
+// \ingroup dense_tensor
+//
+// The DTensReduceAccess class template maps the row \a r of the resulting matrix, the index
+// \a l along the reduced dimension, and the column index \a j to the according element of the
+// dense tensor operand.
+*/
+template< size_t RF >  // Reduction flag
+struct DTensReduceAccess;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DTensReduceAccess class template for column-wise reductions.
+// \ingroup dense_tensor
+*/
+template<>
+struct DTensReduceAccess<columnwise>
+{
+   //! Returns the number of rows of the resulting matrix.
+   template< typename TT >
+   static inline size_t rows( const TT& A ) noexcept { return A.pages(); }
+
+   //! Returns the size of the reduced dimension.
+   template< typename TT >
+   static inline size_t size( const TT& A ) noexcept { return A.rows(); }
+
+   //! Access to the element \a j of the reduced row \a l of row \a r.
+   template< typename TT >
+   static BLAZE_ALWAYS_INLINE decltype(auto) get( const TT& A, size_t r, size_t l, size_t j ) {
+      return A(r,l,j);
+   }
+
+   //! Load of a SIMD element of the reduced row \a l of row \a r.
+   template< typename TT >
+   static BLAZE_ALWAYS_INLINE decltype(auto) load( const TT& A, size_t r, size_t l, size_t j ) noexcept {
+      return A.load(r,l,j);
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DTensReduceAccess class template for page-wise reductions.
+// \ingroup dense_tensor
+*/
+template<>
+struct DTensReduceAccess<pagewise>
+{
+   //! Returns the number of rows of the resulting matrix.
+   template< typename TT >
+   static inline size_t rows( const TT& A ) noexcept { return A.rows(); }
+
+   //! Returns the size of the reduced dimension.
+   template< typename TT >
+   static inline size_t size( const TT& A ) noexcept { return A.pages(); }
+
+   //! Access to the element \a j of the reduced row \a l of row \a r.
+   template< typename TT >
+   static BLAZE_ALWAYS_INLINE decltype(auto) get( const TT& A, size_t r, size_t l, size_t j ) {
+      return A(l,r,j);
+   }
+
+   //! Load of a SIMD element of the reduced row \a l of row \a r.
+   template< typename TT >
+   static BLAZE_ALWAYS_INLINE decltype(auto) load( const TT& A, size_t r, size_t l, size_t j ) noexcept {
+      return A.load(l,r,j);
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized partial reduction kernels.
+// \ingroup dense_tensor
+//
+// In case the target matrix \a MT is a SIMD-enabled row-major matrix and the dense tensor
+// operand \a TT can be reduced by means of the vectorized reduction operation \a OP, the
+// variable is set to \a true, otherwise it is \a false.
+*/
+template< typename MT    // Type of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+constexpr bool UseVectorizedDTensReduceKernel_v =
+   ( useOptimizedKernels &&
+     IsRowMajorMatrix_v<MT> &&
+     MT::simdEnabled &&
+     DTensReduceExprHelper<TT,OP>::value &&
+     IsSame_v< ElementType_t<MT>, ElementType_t<TT> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the use of the padding elements in the partial
+//        reduction kernels.
+// \ingroup dense_tensor
+//
+// The padding elements of both the target matrix \a MT and the dense tensor operand \a TT can
+// be processed in case both are padded and the reduction operation \a OP maps zeros to zero.
+*/
+template< typename MT    // Type of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+constexpr bool UsePaddedDTensReduceKernel_v =
+   ( IsPadded_v<MT> && IsPadded_v<TT> &&
+     ( IsSame_v<OP,Add> || IsSame_v<OP,Mult> || IsSame_v<OP,Min> || IsSame_v<OP,Max> ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial evaluation of the dense tensor operand of a partial reduction.
+// \ingroup dense_tensor
+//
+// \param dt The dense tensor operand.
+// \return The evaluated dense tensor operand.
+//
+// This function evaluates an operand that requires an intermediate evaluation into a temporary.
+// All other operands are directly passed on to the reduction kernels.
+*/
+template< typename TT >  // Type of the dense tensor operand
+inline auto dtensreduceOperand( const DenseTensor<TT>& dt )
+   -> EnableIf_t< RequiresEvaluation_v<TT>, const ResultType_t<TT> >
+{
+   return ResultType_t<TT>( serial( ~dt ) );
+}
+
+template< typename TT >  // Type of the dense tensor operand
+inline auto dtensreduceOperand( const DenseTensor<TT>& dt )
+   -> DisableIf_t< RequiresEvaluation_v<TT>, const TT& >
+{
+   return ~dt;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP evaluation of the dense tensor operand of a partial reduction.
+// \ingroup dense_tensor
+//
+// \param dt The dense tensor operand.
+// \return The evaluated dense tensor operand.
+//
+// This function evaluates an operand that requires an intermediate evaluation into a temporary
+// by means of the parallel evaluation strategy. All other operands are directly passed on to
+// the reduction kernels.
+*/
+template< typename TT >  // Type of the dense tensor operand
+inline auto smpDTensReduceOperand( const DenseTensor<TT>& dt )
+   -> EnableIf_t< RequiresEvaluation_v<TT>, const ResultType_t<TT> >
+{
+   return ResultType_t<TT>( ~dt );
+}
+
+template< typename TT >  // Type of the dense tensor operand
+inline auto smpDTensReduceOperand( const DenseTensor<TT>& dt )
+   -> DisableIf_t< RequiresEvaluation_v<TT>, const TT& >
+{
+   return ~dt;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized column-wise and page-wise reduction of a block of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense matrix.
+// \param A The dense tensor operand.
+// \param op The reduction operation.
+// \param rbegin The first row of the target matrix to be computed.
+// \param rend The row behind the last row of the target matrix to be computed.
+// \param jbegin The first column of the target matrix to be computed (a multiple of the SIMD size).
+// \param jend The column behind the last column of the target matrix to be computed.
+// \return void
+//
+// Each row of the result is computed by accumulating entire rows of the operand in a block
+// of four SIMD registers, which are stored only once per block of columns.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+inline auto dtensreduceAccumulate( DenseMatrix<MT,SO>& C, const TT& A, OP op,
+                                   size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> EnableIf_t< UseVectorizedDTensReduceKernel_v<MT,TT,OP> >
+{
+   using Access   = DTensReduceAccess<RF>;
+   using ET       = ElementType_t<MT>;
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   BLAZE_INTERNAL_ASSERT( jbegin % SIMDSIZE == 0UL, "Invalid column range detected" );
+
+   const size_t L( Access::size( A ) );
+
+   const bool remainder( !UsePaddedDTensReduceKernel_v<MT,TT,OP> || jend < A.columns() );
+   const size_t jpos( remainder ? ( jbegin + ( ( jend - jbegin ) & size_t(-SIMDSIZE) ) ) : jend );
+
+   for( size_t r=rbegin; r<rend; ++r )
+   {
+      size_t j( jbegin );
+
+      for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+      {
+         SIMDType xmm1( Access::load( A, r, 0UL, j              ) );
+         SIMDType xmm2( Access::load( A, r, 0UL, j+SIMDSIZE     ) );
+         SIMDType xmm3( Access::load( A, r, 0UL, j+SIMDSIZE*2UL ) );
+         SIMDType xmm4( Access::load( A, r, 0UL, j+SIMDSIZE*3UL ) );
+
+         for( size_t l=1UL; l<L; ++l ) {
+            xmm1 = op( xmm1, Access::load( A, r, l, j              ) );
+            xmm2 = op( xmm2, Access::load( A, r, l, j+SIMDSIZE     ) );
+            xmm3 = op( xmm3, Access::load( A, r, l, j+SIMDSIZE*2UL ) );
+            xmm4 = op( xmm4, Access::load( A, r, l, j+SIMDSIZE*3UL ) );
+         }
+
+         (~C).store( r, j             , xmm1 );
+         (~C).store( r, j+SIMDSIZE    , xmm2 );
+         (~C).store( r, j+SIMDSIZE*2UL, xmm3 );
+         (~C).store( r, j+SIMDSIZE*3UL, xmm4 );
+      }
+
+      for( ; j<jpos; j+=SIMDSIZE )
+      {
+         SIMDType xmm1( Access::load( A, r, 0UL, j ) );
+
+         for( size_t l=1UL; l<L; ++l ) {
+            xmm1 = op( xmm1, Access::load( A, r, l, j ) );
+         }
+
+         (~C).store( r, j, xmm1 );
+      }
+
+      for( ; remainder && j<jend; ++j )
+      {
+         ET value( Access::get( A, r, 0UL, j ) );
+
+         for( size_t l=1UL; l<L; ++l ) {
+            value = op( value, Access::get( A, r, l, j ) );
+         }
+
+         (~C)(r,j) = value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default column-wise and page-wise reduction of a block of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense matrix.
+// \param A The dense tensor operand.
+// \param op The reduction operation.
+// \param rbegin The first row of the target matrix to be computed.
+// \param rend The row behind the last row of the target matrix to be computed.
+// \param jbegin The first column of the target matrix to be computed.
+// \param jend The column behind the last column of the target matrix to be computed.
+// \return void
+//
+// Each row of the result is computed by accumulating entire rows of the operand element-wise.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+inline auto dtensreduceAccumulate( DenseMatrix<MT,SO>& C, const TT& A, OP op,
+                                   size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> DisableIf_t< UseVectorizedDTensReduceKernel_v<MT,TT,OP> >
+{
+   using Access = DTensReduceAccess<RF>;
+
+   const size_t L( Access::size( A ) );
+
+   for( size_t r=rbegin; r<rend; ++r )
+   {
+      for( size_t j=jbegin; j<jend; ++j ) {
+         (~C)(r,j) = Access::get( A, r, 0UL, j );
+      }
+
+      for( size_t l=1UL; l<L; ++l ) {
+         for( size_t j=jbegin; j<jend; ++j ) {
+            (~C)(r,j) = op( (~C)(r,j), Access::get( A, r, l, j ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized row-wise reduction of a range of rows of a single page of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense matrix.
+// \param A The dense tensor operand.
+// \param op The reduction operation.
+// \param k The page of the dense tensor operand.
+// \param ibegin The first row of the page to be reduced.
+// \param iend The row behind the last row of the page to be reduced.
+// \return void
+//
+// Four rows are reduced at a time, each of them in its own SIMD register. The registers are
+// reduced horizontally once the row has been traversed.
+*/
+template< typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+inline auto dtensreduceHorizontal( DenseMatrix<MT,SO>& C, const TT& A, OP op,
+                                   size_t k, size_t ibegin, size_t iend )
+   -> EnableIf_t< DTensReduceExprHelper<TT,OP>::value >
+{
+   using ET       = ElementType_t<TT>;
+   using SIMDType = SIMDTrait_t<ET>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t N( A.columns() );
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+
+   size_t i( ibegin );
+
+   if( jpos > 0UL )
+   {
+      for( ; (i+4UL) <= iend; i+=4UL )
+      {
+         SIMDType xmm1( A.load(k,i    ,0UL) );
+         SIMDType xmm2( A.load(k,i+1UL,0UL) );
+         SIMDType xmm3( A.load(k,i+2UL,0UL) );
+         SIMDType xmm4( A.load(k,i+3UL,0UL) );
+
+         for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+            xmm1 = op( xmm1, A.load(k,i    ,j) );
+            xmm2 = op( xmm2, A.load(k,i+1UL,j) );
+            xmm3 = op( xmm3, A.load(k,i+2UL,j) );
+            xmm4 = op( xmm4, A.load(k,i+3UL,j) );
+         }
+
+         ET value1( reduce( xmm1, op ) );
+         ET value2( reduce( xmm2, op ) );
+         ET value3( reduce( xmm3, op ) );
+         ET value4( reduce( xmm4, op ) );
+
+         for( size_t j=jpos; j<N; ++j ) {
+            value1 = op( value1, A(k,i    ,j) );
+            value2 = op( value2, A(k,i+1UL,j) );
+            value3 = op( value3, A(k,i+2UL,j) );
+            value4 = op( value4, A(k,i+3UL,j) );
+         }
+
+         (~C)(k,i    ) = value1;
+         (~C)(k,i+1UL) = value2;
+         (~C)(k,i+2UL) = value3;
+         (~C)(k,i+3UL) = value4;
+      }
+
+      for( ; i<iend; ++i )
+      {
+         SIMDType xmm1( A.load(k,i,0UL) );
+
+         for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+            xmm1 = op( xmm1, A.load(k,i,j) );
+         }
+
+         ET value1( reduce( xmm1, op ) );
+
+         for( size_t j=jpos; j<N; ++j ) {
+            value1 = op( value1, A(k,i,j) );
+         }
+
+         (~C)(k,i) = value1;
+      }
+   }
+   else
+   {
+      for( ; i<iend; ++i )
+      {
+         ET value( A(k,i,0UL) );
+
+         for( size_t j=1UL; j<N; ++j ) {
+            value = op( value, A(k,i,j) );
+         }
+
+         (~C)(k,i) = value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default row-wise reduction of a range of rows of a single page of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense matrix.
+// \param A The dense tensor operand.
+// \param op The reduction operation.
+// \param k The page of the dense tensor operand.
+// \param ibegin The first row of the page to be reduced.
+// \param iend The row behind the last row of the page to be reduced.
+// \return void
+*/
+template< typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+inline auto dtensreduceHorizontal( DenseMatrix<MT,SO>& C, const TT& A, OP op,
+                                   size_t k, size_t ibegin, size_t iend )
+   -> DisableIf_t< DTensReduceExprHelper<TT,OP>::value >
+{
+   const size_t N( A.columns() );
+
+   for( size_t i=ibegin; i<iend; ++i )
+   {
+      ElementType_t<MT> value( A(k,i,0UL) );
+
+      for( size_t j=1UL; j<N; ++j ) {
+         value = op( value, A(k,i,j) );
+      }
+
+      (~C)(k,i) = value;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial column-wise or page-wise reduction of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense matrix.
+// \param A The dense tensor operand (with a non-empty reduced dimension).
+// \param op The reduction operation.
+// \return void
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+inline auto dtensreduceAssign( DenseMatrix<MT,SO>& C, const TT& A, OP op )
+   -> EnableIf_t< RF != rowwise >
+{
+   dtensreduceAccumulate<RF>( ~C, A, op, 0UL, (~C).rows(), 0UL, (~C).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial row-wise reduction of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense matrix.
+// \param A The dense tensor operand (with a non-empty reduced dimension).
+// \param op The reduction operation.
+// \return void
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+inline auto dtensreduceAssign( DenseMatrix<MT,SO>& C, const TT& A, OP op )
+   -> EnableIf_t< RF == rowwise >
+{
+   for( size_t k=0UL; k<A.pages(); ++k ) {
+      dtensreduceHorizontal( ~C, A, op, k, 0UL, A.rows() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP column-wise or page-wise reduction of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense matrix.
+// \param A The dense tensor operand (with a non-empty reduced dimension).
+// \param op The reduction operation.
+// \return void
+//
+// The rows of the target matrix are distributed among the available threads. In case there
+// are fewer rows than threads, the columns are distributed in chunks of full SIMD vectors.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+inline auto smpDTensReduceAssign( DenseMatrix<MT,SO>& C, const TT& A, OP op )
+   -> EnableIf_t< RF != rowwise >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<MT> >::size );
+
+   const size_t M( (~C).rows()    );
+   const size_t N( (~C).columns() );
+   const size_t tasks( smpTasks() );
+
+   if( tasks < 2UL || M*N < 2UL ) {
+      dtensreduceAssign<RF>( ~C, A, op );
+   }
+   else if( M >= tasks ) {
+      const size_t rows( ( M + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*rows );
+         const size_t end  ( min( begin+rows, M ) );
+         if( begin < end )
+            dtensreduceAccumulate<RF>( ~C, A, op, begin, end, 0UL, N );
+      } );
+   }
+   else {
+      const size_t columns( nextMultiple( ( N + tasks - 1UL ) / tasks, SIMDSIZE ) );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*columns );
+         const size_t end  ( min( begin+columns, N ) );
+         if( begin < end )
+            dtensreduceAccumulate<RF>( ~C, A, op, 0UL, M, begin, end );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP row-wise reduction of a dense tensor.
+// \ingroup dense_tensor
 //
-// The DTensReduceExpr class represents the compile time expression for partial reduction operations
-// of dense matrices.
+// \param C The target dense matrix.
+// \param A The dense tensor operand (with a non-empty reduced dimension).
+// \param op The reduction operation.
+// \return void
+//
+// The rows of all pages of the operand are distributed in contiguous ranges among the
+// available threads.
 */
-template< typename MT  // Type of the dense tensor
-        , typename OP  // Type of the reduction operation
-        , size_t RF >  // Reduction flag
-class DTensReduceExpr
-{};
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the reduction operation
+inline auto smpDTensReduceAssign( DenseMatrix<MT,SO>& C, const TT& A, OP op )
+   -> EnableIf_t< RF == rowwise >
+{
+   const size_t M( A.rows() );
+   const size_t rows( A.pages() * M );
+   const size_t tasks( min( smpTasks(), rows ) );
+
+   if( tasks < 2UL ) {
+      dtensreduceAssign<RF>( ~C, A, op );
+      return;
+   }
+
+   const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t begin( t*chunk );
+      const size_t end  ( min( begin+chunk, rows ) );
+
+      for( size_t k=begin/M; begin<end && k*M<end; ++k ) {
+         const size_t ibegin( max( begin, k*M ) - k*M );
+         const size_t iend  ( min( end, (k+1UL)*M ) - k*M );
+         dtensreduceHorizontal( ~C, A, op, k, ibegin, iend );
+      }
+   } );
+}
+/*! \endcond */
 //*************************************************************************************************
 
 
@@ -112,9 +776,10 @@ class DTensReduceExpr
 // \ingroup dense_tensor_expression
 //
 // This specialization of the DTensReduceExpr class template represents the compile time expression
-// for column-wise reduction operations of dense matrices.
+// for column-wise reduction operations of dense tensors. The column-wise reduction of an \f$ O \times M
+// \times N \f$ tensor results in an \f$ O \times N \f$ row-major matrix.
 */
-template< typename MT    // Type of the dense matrix
+template< typename MT    // Type of the dense tensor
         , typename OP >  // Type of the reduction operation
 class DTensReduceExpr<MT,OP,columnwise>
    : public TensReduceExpr< DenseMatrix< DTensReduceExpr<MT,OP,columnwise>, rowMajor >, columnwise >
@@ -122,38 +787,28 @@ class DTensReduceExpr<MT,OP,columnwise>
 {
  private:
    //**Type definitions****************************************************************************
-   using RT = ResultType_t<MT>;     //!< Result type of the dense tensor expression.
-   using ET = ElementType_t<MT>;    //!< Element type of the dense tensor expression.
-   using CT = CompositeType_t<MT>;  //!< Composite type of the dense tensor expression.
-   //**********************************************************************************************
-
-   //**Parallel evaluation strategy****************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   //! Helper variable template for the explicit application of the SFINAE principle.
-   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case the dense tensor operand is not SMP assignable and requires an intermediate
-       evaluation, the variable is set to 1 and the expression specific evaluation strategy is
-       selected. Otherwise the variable is set to 0 and the default strategy is chosen. */
-   template< typename VT >
-   static constexpr bool UseSMPAssign_v = ( !MT::smpAssignable && RequiresEvaluation_v<MT> );
-   /*! \endcond */
+   using RT = ResultType_t<MT>;   //!< Result type of the dense tensor expression.
+   using ET = ElementType_t<MT>;  //!< Element type of the dense tensor expression.
    //**********************************************************************************************
 
  public:
    //**Type definitions****************************************************************************
    using This          = DTensReduceExpr<MT,OP,columnwise>;  //!< Type of this DTensReduceExpr instance.
-   using ResultType    = ReduceTrait_t<RT,OP,columnwise>;   //!< Result type for expression template evaluations.
-   using TransposeType = TransposeType_t<ResultType>;       //!< Transpose type for expression template evaluations.
-   using ElementType   = ElementType_t<ResultType>;         //!< Resulting element type.
-   using SIMDType      = SIMDTrait_t<ElementType>;          //!< Resulting SIMD element type.
-   using ReturnType    = const ElementType;                 //!< Return type for expression template evaluations.
-   using CompositeType = const ResultType;                  //!< Data type for composite expression templates.
+   using ResultType    = ReduceTrait_t<RT,OP,columnwise>;    //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;        //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;          //!< Resulting element type.
+   using SIMDType      = SIMDTrait_t<ElementType>;           //!< Resulting SIMD element type.
+   using ReturnType    = const ElementType;                  //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;                   //!< Data type for composite expression templates.
 
    //! Composite type of the left-hand side dense tensor expression.
    using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
 
+   //! Data type of the custom unary operation.
+   using Operation = OP;
+
    //**ConstIterator class definition**************************************************************
-   /*!\brief Iterator over the elements of the dense tensor.
+   /*!\brief Iterator over the elements of a row of the reduction expression.
    */
    class ConstIterator
    {
@@ -177,15 +832,15 @@ class DTensReduceExpr<MT,OP,columnwise>
       /*!\brief Constructor for the ConstIterator class.
       //
       // \param dm The dense tensor operand of the reduction expression.
-      // \param j Index to the initial tensor column.
-      // \param k Index to the tensor page.
+      // \param i Index of the row of the reduction expression.
+      // \param j Index to the initial column of the reduction expression.
       // \param op The reduction operation.
       */
-      explicit inline ConstIterator( Operand dm, size_t j, size_t k, OP op )
-         : dm_   ( dm    )  // Dense tensor of the reduction expression
-         , j_    ( j     )  // Index to the current tensor column
-         , k_    ( k     )  // Index to the tensor page
-         , op_   ( op    )  // The reduction operation
+      explicit inline ConstIterator( Operand dm, size_t i, size_t j, OP op )
+         : dm_( dm )  // Dense tensor of the reduction expression
+         , i_ ( i  )  // Index of the row of the reduction expression
+         , j_ ( j  )  // Index to the current column of the reduction expression
+         , op_( op )  // The reduction operation
       {}
       //*******************************************************************************************
 
@@ -230,7 +885,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return The previous position of the iterator.
       */
       inline const ConstIterator operator++( int ) {
-         return ConstIterator( j_++, k_ );
+         return ConstIterator( dm_, i_, j_++, op_ );
       }
       //*******************************************************************************************
 
@@ -251,7 +906,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return The previous position of the iterator.
       */
       inline const ConstIterator operator--( int ) {
-         return ConstIterator( j_--, k_ );
+         return ConstIterator( dm_, i_, j_--, op_ );
       }
       //*******************************************************************************************
 
@@ -261,7 +916,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return The resulting value.
       */
       inline ReturnType operator*() const {
-         return reduce( column( pageslice(dm_, k_, unchecked), j_, unchecked ), op_ );
+         return element( dm_, i_, j_, op_ );
       }
       //*******************************************************************************************
 
@@ -272,7 +927,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return \a true if the iterators refer to the same element, \a false if not.
       */
       inline bool operator==( const ConstIterator& rhs ) const {
-         return j_ == rhs.j_ && k_ == rhs.k_;
+         return j_ == rhs.j_;
       }
       //*******************************************************************************************
 
@@ -283,7 +938,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return \a true if the iterators don't refer to the same element, \a false if they do.
       */
       inline bool operator!=( const ConstIterator& rhs ) const {
-         return j_ != rhs.j_ || k_ != rhs.k_;
+         return j_ != rhs.j_;
       }
       //*******************************************************************************************
 
@@ -294,7 +949,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return \a true if the left-hand side iterator is smaller, \a false if not.
       */
       inline bool operator<( const ConstIterator& rhs ) const {
-         return j_ < rhs.j_ ? true : k_ < rhs.k_;
+         return j_ < rhs.j_;
       }
       //*******************************************************************************************
 
@@ -305,7 +960,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return \a true if the left-hand side iterator is greater, \a false if not.
       */
       inline bool operator>( const ConstIterator& rhs ) const {
-         return !(*this <= rhs);
+         return j_ > rhs.j_;
       }
       //*******************************************************************************************
 
@@ -316,7 +971,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
       */
       inline bool operator<=( const ConstIterator& rhs ) const {
-         return j_ <= rhs.j_ ? true : k_ <= rhs.k_;
+         return j_ <= rhs.j_;
       }
       //*******************************************************************************************
 
@@ -327,7 +982,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
       */
       inline bool operator>=( const ConstIterator& rhs ) const {
-         return !(*this < rhs);
+         return j_ >= rhs.j_;
       }
       //*******************************************************************************************
 
@@ -350,7 +1005,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return The incremented iterator.
       */
       friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
-         return ConstIterator( it.j_ + inc, it.k_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ + inc, it.op_ );
       }
       //*******************************************************************************************
 
@@ -362,7 +1017,7 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return The incremented iterator.
       */
       friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
-         return ConstIterator( it.j_ + inc, it.k_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ + inc, it.op_ );
       }
       //*******************************************************************************************
 
@@ -374,24 +1029,20 @@ class DTensReduceExpr<MT,OP,columnwise>
       // \return The decremented iterator.
       */
       friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
-         return ConstIterator( it.j_ - dec, it.k_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ - dec, it.op_ );
       }
       //*******************************************************************************************
 
     private:
       //**Member variables*************************************************************************
-      Operand dm_;     //!< Dense tensor of the reduction expression.
-      size_t  j_;      //!< Index to the current tensor row.
-      size_t  k_;      //!< Index to the tensor page.
-      OP      op_;     //!< The reduction operation.
+      Operand dm_;  //!< Dense tensor of the reduction expression.
+      size_t  i_;   //!< Index of the row of the reduction expression.
+      size_t  j_;   //!< Index to the current column of the reduction expression.
+      OP      op_;  //!< The reduction operation.
       //*******************************************************************************************
    };
    //**********************************************************************************************
 
-   //! Data type of the custom unary operation.
-   using Operation = OP;
-   //**********************************************************************************************
-
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
    static constexpr bool simdEnabled = false;
@@ -412,71 +1063,75 @@ class DTensReduceExpr<MT,OP,columnwise>
    {}
    //**********************************************************************************************
 
-   //**Subscript operator**************************************************************************
-   /*!\brief Subscript operator for the direct access to the tensor elements.
+   //**Function call operator**********************************************************************
+   /*!\brief 2D-access to the matrix elements.
    //
-   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..O-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
    // \return The resulting value.
    */
-   inline ReturnType operator()( size_t j, size_t k ) const {
-      BLAZE_INTERNAL_ASSERT( j < dm_.columns(), "Invalid tensor access index" );
-      BLAZE_INTERNAL_ASSERT( k < dm_.pages(), "Invalid tensor access index" );
-      return reduce( column( pageslice(dm_, k, unchecked ), j, unchecked), op_ );
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+      return element( dm_, i, j, op_ );
    }
    //**********************************************************************************************
 
    //**At function*********************************************************************************
-   /*!\brief Checked access to the tensor elements.
+   /*!\brief Checked access to the matrix elements.
    //
-   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..O-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
    // \return The resulting value.
-   // \exception std::out_of_range Invalid tensor access index.
+   // \exception std::out_of_range Invalid matrix access index.
    */
-   inline ReturnType at( size_t j, size_t k ) const {
-      if( j >= dm_.columns() ) {
-         BLAZE_THROW_OUT_OF_RANGE( "Invalid tensor access index" );
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
       }
-      if( k >= dm_.pages() ) {
-         BLAZE_THROW_OUT_OF_RANGE( "Invalid tensor access index" );
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
       }
-      return (*this)(j, k);
+      return (*this)(i,j);
    }
    //**********************************************************************************************
 
    //**Begin function******************************************************************************
-   /*!\brief Returns an iterator to the first element of the dense tensor.
+   /*!\brief Returns an iterator to the first element of row \a i.
    //
-   // \return Iterator to the first element of the dense tensor.
+   // \param i The row index.
+   // \return Iterator to the first element of row \a i.
    */
-   inline ConstIterator begin( size_t k ) const {
-      return ConstIterator( dm_, 0UL, k, op_ );
+   inline ConstIterator begin( size_t i ) const {
+      return ConstIterator( dm_, i, 0UL, op_ );
    }
    //**********************************************************************************************
 
    //**End function********************************************************************************
-   /*!\brief Returns an iterator just past the last non-zero element of the dense tensor.
+   /*!\brief Returns an iterator just past the last element of row \a i.
    //
-   // \return Iterator just past the last non-zero element of the dense tensor.
+   // \param i The row index.
+   // \return Iterator just past the last element of row \a i.
    */
-   inline ConstIterator end( size_t k ) const {
-      return ConstIterator( dm_, dm_.columns(), k, op_ );
+   inline ConstIterator end( size_t i ) const {
+      return ConstIterator( dm_, i, columns(), op_ );
    }
    //**********************************************************************************************
 
    //**Rows function*******************************************************************************
-   /*!\brief Returns the current size/dimension of the tensor.
+   /*!\brief Returns the current number of rows of the matrix.
    //
-   // \return The size of the tensor.
+   // \return The number of rows of the matrix.
    */
    inline size_t rows() const noexcept {
       return dm_.pages();
    }
    //**********************************************************************************************
 
-   //**Pages function*******************************************************************************
-   /*!\brief Returns the current size/dimension of the tensor.
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
    //
-   // \return The size of the tensor.
+   // \return The number of columns of the matrix.
    */
    inline size_t columns() const noexcept {
       return dm_.columns();
@@ -548,64 +1203,73 @@ class DTensReduceExpr<MT,OP,columnwise>
    //**********************************************************************************************
 
  private:
+   //**Element computation*************************************************************************
+   /*!\brief Computation of a single element of the reduction expression.
+   //
+   // \param dm The dense tensor operand.
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \param op The reduction operation.
+   // \return The resulting value.
+   */
+   static inline ReturnType element( const MT& dm, size_t i, size_t j, OP op ) {
+      return reduce( column( pageslice( dm, i, unchecked ), j, unchecked ), op );
+   }
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    Operand   dm_;  //!< Dense tensor of the reduction expression.
    Operation op_;  //!< The reduction operation.
    //**********************************************************************************************
 
-   //**Assignment to dense tensors*****************************************************************
+   //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a column-wise dense tensor reduction operation to a dense tensor.
+   /*!\brief Assignment of a column-wise dense tensor reduction operation to a dense matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side dense tensor.
+   // \param lhs The target left-hand side dense matrix.
    // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized assignment of a column-wise row-major
-   // dense tensor reduction expression to a dense tensor.
+   // This function implements the performance optimized assignment of a column-wise dense tensor
+   // reduction expression to a dense matrix. The rows of each
+   // page of the tensor are accumulated in a vectorized fashion, if possible.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void assign( DenseMatrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
+   template< typename MT2   // Type of the target dense matrix
+           , bool SO >      // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
-
-      const size_t M( rhs.dm_.rows() );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      if( M == 0UL ) {
+      if( rhs.dm_.rows() == 0UL ) {
          reset( ~lhs );
          return;
       }
 
-      CT tmp( serial( rhs.dm_ ) );
-
-      assign( ~lhs, rowslice( tmp, 0UL, unchecked ) );
-      for( size_t i=1UL; i<M; ++i ) {
-         assign( ~lhs, map( ~lhs, rowslice( tmp, i, unchecked ), rhs.op_ ) );
-      }
+      decltype(auto) A( dtensreduceOperand( rhs.dm_ ) );  // Evaluation of the dense tensor operand
+      dtensreduceAssign<columnwise>( ~lhs, A, rhs.op_ );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Assignment to sparse tensors****************************************************************
+   //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a column-wise dense tensor reduction operation to a dense tensor.
+   /*!\brief Assignment of a column-wise dense tensor reduction operation to a sparse matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side dense tensor.
+   // \param lhs The target left-hand side sparse matrix.
    // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized assignment of a column-wise row-major
-   // dense tensor reduction expression to a dense tensor.
+   // This function implements the performance optimized assignment of a column-wise dense tensor
+   // reduction expression to a sparse matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void assign( SparseMatrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
+   template< typename MT2   // Type of the target sparse matrix
+           , bool SO >      // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -613,8 +1277,8 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
       BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
       const ResultType tmp( serial( rhs ) );
       assign( ~lhs, tmp );
@@ -622,62 +1286,21 @@ class DTensReduceExpr<MT,OP,columnwise>
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Addition assignment to dense tensors********************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Addition assignment of a column-wise dense tensor reduction operation to a
-   //        dense tensor.
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side dense tensor.
-   // \param rhs The right-hand side reduction expression to be added.
-   // \return void
-   //
-   // This function implements the performance optimized addition assignment of a column-wise
-   // dense tensor reduction expression to a dense tensor.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void addAssign( DenseMatrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-   {
-      BLAZE_FUNCTION_TRACE;
-
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
-
-      if( rhs.dm_.rows() == 0UL ) {
-         return;
-      }
-      else if( IsSame_v<OP,Add> ) {
-         CT tmp( serial( rhs.dm_ ) );
-         const size_t M( tmp.rows() );
-         for( size_t i=0UL; i<M; ++i ) {
-            addAssign( (~lhs), rowslice( tmp, i, unchecked ) );
-         }
-      }
-      else {
-         const ResultType tmp( serial( rhs ) );
-         addAssign( ~lhs, tmp );
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Addition assignment to sparse tensors*******************************************************
+   //**Addition assignment to matrices*************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Addition assignment of a column-wise dense tensor reduction operation to a
-   //        dense tensor.
+   /*!\brief Addition assignment of a column-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side dense tensor.
+   // \param lhs The target left-hand side matrix.
    // \param rhs The right-hand side reduction expression to be added.
    // \return void
    //
    // This function implements the performance optimized addition assignment of a column-wise
-   // dense tensor reduction expression to a dense tensor.
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void addAssign( SparseMatrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void addAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -685,8 +1308,8 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
       BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
       const ResultType tmp( serial( rhs ) );
       addAssign( ~lhs, tmp );
@@ -694,62 +1317,21 @@ class DTensReduceExpr<MT,OP,columnwise>
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Subtraction assignment to dense tensors*****************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a column-wise dense tensor reduction operation
-   //        to a dense tensor.
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side dense tensor.
-   // \param rhs The right-hand side reduction expression to be subtracted.
-   // \return void
-   //
-   // This function implements the performance optimized subtraction assignment of a column-wise
-   // dense tensor reduction expression to a dense tensor.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void subAssign( DenseMatrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-   {
-      BLAZE_FUNCTION_TRACE;
-
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
-
-      if( rhs.dm_.rows() == 0UL ) {
-         return;
-      }
-      else if( IsSame_v<OP,Add> ) {
-         CT tmp( serial( rhs.dm_ ) );
-         const size_t M( tmp.rows() );
-         for( size_t i=0UL; i<M; ++i ) {
-            subAssign( (~lhs), rowslice( tmp, i, unchecked ) );
-         }
-      }
-      else {
-         const ResultType tmp( serial( rhs ) );
-         subAssign( ~lhs, tmp );
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Subtraction assignment to sparse tensors****************************************************
+   //**Subtraction assignment to matrices**********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a column-wise dense tensor reduction operation
-   //        to a dense tensor.
+   /*!\brief Subtraction assignment of a column-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side dense tensor.
+   // \param lhs The target left-hand side matrix.
    // \param rhs The right-hand side reduction expression to be subtracted.
    // \return void
    //
    // This function implements the performance optimized subtraction assignment of a column-wise
-   // dense tensor reduction expression to a dense tensor.
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void subAssign( SparseMatrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void subAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -757,8 +1339,8 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
       BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
       const ResultType tmp( serial( rhs ) );
       subAssign( ~lhs, tmp );
@@ -766,94 +1348,21 @@ class DTensReduceExpr<MT,OP,columnwise>
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Multiplication assignment to dense tensors**************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Multiplication assignment of a column-wise dense tensor reduction operation
-   //        to a dense tensor.
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side dense tensor.
-   // \param rhs The right-hand side reduction expression to be multiplied.
-   // \return void
-   //
-   // This function implements the performance optimized multiplication assignment of a column-wise
-   // dense tensor reduction expression to a dense tensor.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void multAssign( DenseMatrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-   {
-      BLAZE_FUNCTION_TRACE;
-
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
-
-      if( rhs.dm_.rows() == 0UL ) {
-         reset( ~lhs );
-      }
-      else if( IsSame_v<OP,Mult> ) {
-         CT tmp( serial( rhs.dm_ ) );
-         const size_t M( tmp.rows() );
-         for( size_t i=0UL; i<M; ++i ) {
-            multAssign( (~lhs), rowslice( tmp, i, unchecked ) );
-         }
-      }
-      else {
-         const ResultType tmp( serial( rhs ) );
-         multAssign( ~lhs, tmp );
-      }
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Multiplication assignment to sparse tensors*************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief Multiplication assignment of a column-wise dense tensor reduction operation
-   //        to a dense tensor.
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side dense tensor.
-   // \param rhs The right-hand side reduction expression to be multiplied.
-   // \return void
-   //
-   // This function implements the performance optimized multiplication assignment of a column-wise
-   // dense tensor reduction expression to a dense tensor.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void multAssign( SparseMatrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-   {
-      BLAZE_FUNCTION_TRACE;
-
-      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
-      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
-
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
-
-      const ResultType tmp( serial( rhs ) );
-      multAssign( ~lhs, tmp );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Division assignment to tensors**************************************************************
+   //**Schur product assignment to matrices********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Division assignment of a column-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief Schur product assignment of a column-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression divisor.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression for the Schur product.
    // \return void
    //
-   // This function implements the performance optimized division assignment of a column-wise
-   // dense tensor reduction expression to a tensor.
+   // This function implements the performance optimized Schur product assignment of a column-wise
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline void divAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void schurAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
@@ -861,165 +1370,130 @@ class DTensReduceExpr<MT,OP,columnwise>
       BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
       BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
       const ResultType tmp( serial( rhs ) );
-      divAssign( ~lhs, tmp );
+      schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP assignment to tensors*******************************************************************
+   //**SMP assignment to dense matrices************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP assignment of a column-wise dense tensor reduction operation to a tensor.
+   /*!\brief SMP assignment of a column-wise dense tensor reduction operation to a dense matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side dense matrix.
    // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized SMP assignment of a column-wise row-major
-   // dense tensor reduction expression to a tensor. Due to the explicit application of the SFINAE
-   // principle, this function can only be selected by the compiler in case the expression specific
-   // parallel evaluation strategy is selected.
+   // This function implements the performance optimized SMP assignment of a column-wise dense
+   // tensor reduction expression to a dense matrix. The rows of the target
+   // matrix or, in case there are not sufficiently many, its columns are distributed among
+   // the available threads.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target dense matrix
+           , bool SO >      // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
+      if( rhs.dm_.rows() == 0UL ) {
+         reset( ~lhs );
+      }
+      else if( !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+      }
+      else {
+         decltype(auto) A( smpDTensReduceOperand( rhs.dm_ ) );  // Evaluation of the dense tensor operand
+         smpDTensReduceAssign<columnwise>( ~lhs, A, rhs.op_ );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP addition assignment to tensors**********************************************************
+   //**SMP addition assignment to matrices*********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP addition assignment of a column-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief SMP addition assignment of a column-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side matrix.
    // \param rhs The right-hand side reduction expression to be added.
    // \return void
    //
    // This function implements the performance optimized SMP addition assignment of a column-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpAddAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
-
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
-
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpAddAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**SMP subtraction assignment to tensors*******************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP subtraction assignment of a column-wise dense tensor reduction operation
-   //        to a tensor.
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be subtracted.
-   // \return void
-   //
-   // This function implements the performance optimized SMP subtraction assignment of a column-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpSubAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpAddAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpSubAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP multiplication assignment to tensors****************************************************
+   //**SMP subtraction assignment to matrices******************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP multiplication assignment of a column-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief SMP subtraction assignment of a column-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression to be subtracted.
    // \return void
    //
-   // This function implements the performance optimized SMP multiplication assignment of a
-   // column-wise dense tensor reduction expression to a tensor. Due to the explicit
-   // application of the SFINAE principle, this function can only be selected by the compiler
-   // in case the expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // column-wise dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpMultAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpSubAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpMultAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP division assignment to tensors**********************************************************
+   //**SMP Schur product assignment to matrices****************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP division assignment of a column-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief SMP Schur product assignment of a column-wise dense tensor reduction operation to a
+   //        matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression divisor.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression for the Schur product.
    // \return void
    //
-   // This function implements the performance optimized SMP division assignment of a column-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // column-wise dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpDivAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpSchurAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpDivAssign( ~lhs, reduce<columnwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( rhs );
+      smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1046,9 +1520,10 @@ class DTensReduceExpr<MT,OP,columnwise>
 // \ingroup dense_tensor_expression
 //
 // This specialization of the DTensReduceExpr class template represents the compile time expression
-// for row-wise reduction operations of dense matrices.
+// for row-wise reduction operations of dense tensors. The row-wise reduction of an \f$ O \times M
+// \times N \f$ tensor results in an \f$ O \times M \f$ row-major matrix.
 */
-template< typename MT    // Type of the dense matrix
+template< typename MT    // Type of the dense tensor
         , typename OP >  // Type of the reduction operation
 class DTensReduceExpr<MT,OP,rowwise>
    : public TensReduceExpr< DenseMatrix< DTensReduceExpr<MT,OP,rowwise>, rowMajor >, rowwise >
@@ -1060,56 +1535,24 @@ class DTensReduceExpr<MT,OP,rowwise>
    using ET = ElementType_t<MT>;  //!< Element type of the dense tensor expression.
    //**********************************************************************************************
 
-   //**Serial evaluation strategy******************************************************************
-   //! Compilation switch for the serial evaluation strategy of the reduction expression.
-   /*! The \a useAssign compile time constant expression represents a compilation switch for
-       the serial evaluation strategy of the reduction expression. In case the dense tensor
-       operand requires an intermediate evaluation, \a useAssign will be set to 1 and the
-       reduction expression will be evaluated via the \a assign function family. Otherwise
-       \a useAssign will be set to 0 and the expression will be evaluated via the subscript
-       operator. */
-   static constexpr bool useAssign = RequiresEvaluation_v<MT>;
-
-   /*! \cond BLAZE_INTERNAL */
-   //! Helper variable template for the explicit application of the SFINAE principle.
-   template< typename VT >
-   static constexpr bool UseAssign_v = useAssign;
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Parallel evaluation strategy****************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   //! Helper variable template for the explicit application of the SFINAE principle.
-   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case the dense tensor operand is not SMP assignable and requires an intermediate
-       evaluation, the variable is set to 1 and the expression specific evaluation strategy
-       is selected. Otherwise the variable is set to 0 and the default strategy is chosen. */
-   template< typename VT >
-   static constexpr bool UseSMPAssign_v = ( !MT::smpAssignable && useAssign );
-   /*! \endcond */
-   //**********************************************************************************************
-
  public:
    //**Type definitions****************************************************************************
-   using This          = DTensReduceExpr<MT,OP,rowwise>; //!< Type of this DTensReduceExpr instance.
-   using ResultType    = ReduceTrait_t<RT,OP,rowwise>;   //!< Result type for expression template evaluations.
-   using TransposeType = TransposeType_t<ResultType>;    //!< Transpose type for expression template evaluations.
-   using ElementType   = ElementType_t<ResultType>;      //!< Resulting element type.
-   using SIMDType      = SIMDTrait_t<ElementType>;       //!< Resulting SIMD element type.
-   using ReturnType    = const ElementType;              //!< Return type for expression template evaluations.
-
-   //! Data type for composite expression templates.
-   using CompositeType = If_t< useAssign, const ResultType, const DTensReduceExpr& >;
+   using This          = DTensReduceExpr<MT,OP,rowwise>;  //!< Type of this DTensReduceExpr instance.
+   using ResultType    = ReduceTrait_t<RT,OP,rowwise>;    //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;     //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;       //!< Resulting element type.
+   using SIMDType      = SIMDTrait_t<ElementType>;        //!< Resulting SIMD element type.
+   using ReturnType    = const ElementType;               //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;                //!< Data type for composite expression templates.
 
    //! Composite type of the left-hand side dense tensor expression.
    using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
 
    //! Data type of the custom unary operation.
    using Operation = OP;
-   //**********************************************************************************************
 
    //**ConstIterator class definition**************************************************************
-   /*!\brief Iterator over the elements of the dense tensor.
+   /*!\brief Iterator over the elements of a row of the reduction expression.
    */
    class ConstIterator
    {
@@ -1133,15 +1576,15 @@ class DTensReduceExpr<MT,OP,rowwise>
       /*!\brief Constructor for the ConstIterator class.
       //
       // \param dm The dense tensor operand of the reduction expression.
-      // \param i Index to the initial tensor row.
-      // \param i Index to the tensor column.
+      // \param i Index of the row of the reduction expression.
+      // \param j Index to the initial column of the reduction expression.
       // \param op The reduction operation.
       */
-      explicit inline ConstIterator( Operand dm, size_t j, size_t i, OP op )
-         : dm_   ( dm    )  // Dense tensor of the reduction expression
-         , j_    ( j )      // Index to the current tensor column
-         , i_    ( i )      // Index to the tensor row
-         , op_   ( op    )  // The reduction operation
+      explicit inline ConstIterator( Operand dm, size_t i, size_t j, OP op )
+         : dm_( dm )  // Dense tensor of the reduction expression
+         , i_ ( i  )  // Index of the row of the reduction expression
+         , j_ ( j  )  // Index to the current column of the reduction expression
+         , op_( op )  // The reduction operation
       {}
       //*******************************************************************************************
 
@@ -1186,7 +1629,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return The previous position of the iterator.
       */
       inline const ConstIterator operator++( int ) {
-         return ConstIterator( j_++, i_ );
+         return ConstIterator( dm_, i_, j_++, op_ );
       }
       //*******************************************************************************************
 
@@ -1207,7 +1650,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return The previous position of the iterator.
       */
       inline const ConstIterator operator--( int ) {
-         return ConstIterator( j_--, i_ );
+         return ConstIterator( dm_, i_, j_--, op_ );
       }
       //*******************************************************************************************
 
@@ -1217,7 +1660,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return The resulting value.
       */
       inline ReturnType operator*() const {
-         return reduce( row( columnslice(dm_, j_, unchecked), i_, unchecked ), op_ );
+         return element( dm_, i_, j_, op_ );
       }
       //*******************************************************************************************
 
@@ -1228,7 +1671,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return \a true if the iterators refer to the same element, \a false if not.
       */
       inline bool operator==( const ConstIterator& rhs ) const {
-         return j_ == rhs.j_ && i_ == rhs.i_;
+         return j_ == rhs.j_;
       }
       //*******************************************************************************************
 
@@ -1239,7 +1682,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return \a true if the iterators don't refer to the same element, \a false if they do.
       */
       inline bool operator!=( const ConstIterator& rhs ) const {
-         return j_ != rhs.j_ || i_ != rhs.i_;
+         return j_ != rhs.j_;
       }
       //*******************************************************************************************
 
@@ -1250,7 +1693,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return \a true if the left-hand side iterator is smaller, \a false if not.
       */
       inline bool operator<( const ConstIterator& rhs ) const {
-         return j_ < rhs.j_ ? true : i_ < rhs.i_;
+         return j_ < rhs.j_;
       }
       //*******************************************************************************************
 
@@ -1261,7 +1704,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return \a true if the left-hand side iterator is greater, \a false if not.
       */
       inline bool operator>( const ConstIterator& rhs ) const {
-         return !(*this <= rhs);
+         return j_ > rhs.j_;
       }
       //*******************************************************************************************
 
@@ -1272,7 +1715,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
       */
       inline bool operator<=( const ConstIterator& rhs ) const {
-         return j_ <= rhs.j_ ? true : i_ <= rhs.i_;
+         return j_ <= rhs.j_;
       }
       //*******************************************************************************************
 
@@ -1283,7 +1726,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
       */
       inline bool operator>=( const ConstIterator& rhs ) const {
-         return !(*this < rhs);
+         return j_ >= rhs.j_;
       }
       //*******************************************************************************************
 
@@ -1306,7 +1749,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return The incremented iterator.
       */
       friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
-         return ConstIterator( it.j_ + inc, it.i_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ + inc, it.op_ );
       }
       //*******************************************************************************************
 
@@ -1318,7 +1761,7 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return The incremented iterator.
       */
       friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
-         return ConstIterator( it.j_ + inc, it.i_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ + inc, it.op_ );
       }
       //*******************************************************************************************
 
@@ -1330,16 +1773,16 @@ class DTensReduceExpr<MT,OP,rowwise>
       // \return The decremented iterator.
       */
       friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
-         return ConstIterator( it.j_ - dec, it.i_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ - dec, it.op_ );
       }
       //*******************************************************************************************
 
     private:
       //**Member variables*************************************************************************
-      Operand dm_;     //!< Dense tensor of the reduction expression.
-      size_t  j_;      //!< Index to the current tensor column.
-      size_t  i_;      //!< Index to the tensor row.
-      OP      op_;     //!< The reduction operation.
+      Operand dm_;  //!< Dense tensor of the reduction expression.
+      size_t  i_;   //!< Index of the row of the reduction expression.
+      size_t  j_;   //!< Index to the current column of the reduction expression.
+      OP      op_;  //!< The reduction operation.
       //*******************************************************************************************
    };
    //**********************************************************************************************
@@ -1364,74 +1807,78 @@ class DTensReduceExpr<MT,OP,rowwise>
    {}
    //**********************************************************************************************
 
-   //**Subscript operator**************************************************************************
-   /*!\brief Subscript operator for the direct access to the tensor elements.
+   //**Function call operator**********************************************************************
+   /*!\brief 2D-access to the matrix elements.
    //
-   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..O-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..M-1]\f$.
    // \return The resulting value.
    */
    inline ReturnType operator()( size_t i, size_t j ) const {
-      BLAZE_INTERNAL_ASSERT( i < dm_.rows(), "Invalid tensor access index" );
-      BLAZE_INTERNAL_ASSERT( j < dm_.columns(), "Invalid tensor access index" );
-      return reduce( column( rowslice(dm_, i, unchecked ), j, unchecked ), op_ );
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+      return element( dm_, i, j, op_ );
    }
    //**********************************************************************************************
 
    //**At function*********************************************************************************
-   /*!\brief Checked access to the tensor elements.
+   /*!\brief Checked access to the matrix elements.
    //
-   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..O-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..M-1]\f$.
    // \return The resulting value.
-   // \exception std::out_of_range Invalid tensor access index.
+   // \exception std::out_of_range Invalid matrix access index.
    */
    inline ReturnType at( size_t i, size_t j ) const {
-      if( i >= dm_.rows() ) {
-         BLAZE_THROW_OUT_OF_RANGE( "Invalid tensor access index" );
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
       }
-      if( j >= dm_.columns() ) {
-         BLAZE_THROW_OUT_OF_RANGE( "Invalid tensor access index" );
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
       }
-      return (*this)(i, j);
+      return (*this)(i,j);
    }
    //**********************************************************************************************
 
    //**Begin function******************************************************************************
-   /*!\brief Returns an iterator to the first element of the dense tensor.
+   /*!\brief Returns an iterator to the first element of row \a i.
    //
-   // \return Iterator to the first element of the dense tensor.
+   // \param i The row index.
+   // \return Iterator to the first element of row \a i.
    */
    inline ConstIterator begin( size_t i ) const {
-      return ConstIterator( dm_, 0UL, i, op_ );
+      return ConstIterator( dm_, i, 0UL, op_ );
    }
    //**********************************************************************************************
 
    //**End function********************************************************************************
-   /*!\brief Returns an iterator just past the last non-zero element of the dense tensor.
+   /*!\brief Returns an iterator just past the last element of row \a i.
    //
-   // \return Iterator just past the last non-zero element of the dense tensor.
+   // \param i The row index.
+   // \return Iterator just past the last element of row \a i.
    */
    inline ConstIterator end( size_t i ) const {
-      return ConstIterator( dm_, dm_.columns(), i, op_ );
+      return ConstIterator( dm_, i, columns(), op_ );
    }
    //**********************************************************************************************
 
-   //**Size function*******************************************************************************
-   /*!\brief Returns the current size/dimension of the tensor.
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
    //
-   // \return The size of the tensor.
+   // \return The number of rows of the matrix.
    */
    inline size_t rows() const noexcept {
-      return dm_.rows();
+      return dm_.pages();
    }
    //**********************************************************************************************
 
-   //**Pages function*******************************************************************************
-   /*!\brief Returns the current size/dimension of the tensor.
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
    //
-   // \return The size of the tensor.
+   // \return The number of columns of the matrix.
    */
    inline size_t columns() const noexcept {
-      return dm_.columns();
+      return dm_.rows();
    }
    //**********************************************************************************************
 
@@ -1500,313 +1947,296 @@ class DTensReduceExpr<MT,OP,rowwise>
    //**********************************************************************************************
 
  private:
+   //**Element computation*************************************************************************
+   /*!\brief Computation of a single element of the reduction expression.
+   //
+   // \param dm The dense tensor operand.
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \param op The reduction operation.
+   // \return The resulting value.
+   */
+   static inline ReturnType element( const MT& dm, size_t i, size_t j, OP op ) {
+      return reduce( row( pageslice( dm, i, unchecked ), j, unchecked ), op );
+   }
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    Operand   dm_;  //!< Dense tensor of the reduction expression.
    Operation op_;  //!< The reduction operation.
    //**********************************************************************************************
 
-   //**Assignment to tensors***********************************************************************
+   //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a row-wise dense tensor reduction operation to a tensor.
+   /*!\brief Assignment of a row-wise dense tensor reduction operation to a dense matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side dense matrix.
    // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized assignment of a row-wise row-major
-   // dense tensor reduction expression to a tensor. Due to the explicit application of the SFINAE
-   // principle, this function can only be selected by the compiler in case the expression specific
-   // parallel evaluation strategy is selected.
+   // This function implements the performance optimized assignment of a row-wise dense tensor
+   // reduction expression to a dense matrix. Each row of the tensor
+   // is reduced horizontally in a vectorized fashion, if possible.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto assign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   template< typename MT2   // Type of the target dense matrix
+           , bool SO >      // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.dm_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      assign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      decltype(auto) A( dtensreduceOperand( rhs.dm_ ) );  // Evaluation of the dense tensor operand
+      dtensreduceAssign<rowwise>( ~lhs, A, rhs.op_ );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Addition assignment to tensors**************************************************************
+   //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Addition assignment of a row-wise dense tensor reduction operation to a tensor.
+   /*!\brief Assignment of a row-wise dense tensor reduction operation to a sparse matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be added.
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized addition assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto addAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   // This function implements the performance optimized assignment of a row-wise dense tensor
+   // reduction expression to a sparse matrix.
+   */
+   template< typename MT2   // Type of the target sparse matrix
+           , bool SO >      // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      addAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Subtraction assignment to tensors***********************************************************
+   //**Addition assignment to matrices*************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief Addition assignment of a row-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression to be added.
    // \return void
    //
-   // This function implements the performance optimized subtraction assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto subAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   // This function implements the performance optimized addition assignment of a row-wise
+   // dense tensor reduction expression to a matrix.
+   */
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void addAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      subAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Multiplication assignment to tensors********************************************************
+   //**Subtraction assignment to matrices**********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Multiplication assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief Subtraction assignment of a row-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression to be subtracted.
    // \return void
    //
-   // This function implements the performance optimized multiplication assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized subtraction assignment of a row-wise
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto multAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void subAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      multAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Division assignment to tensors**************************************************************
+   //**Schur product assignment to matrices********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Division assignment of a row-wise dense tensor reduction operation to a tensor.
+   /*!\brief Schur product assignment of a row-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression divisor.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression for the Schur product.
    // \return void
    //
-   // This function implements the performance optimized division assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized Schur product assignment of a row-wise
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto divAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void schurAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      divAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP assignment to tensors*******************************************************************
+   //**SMP assignment to dense matrices************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP assignment of a row-wise dense tensor reduction operation to a tensor.
+   /*!\brief SMP assignment of a row-wise dense tensor reduction operation to a dense matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side dense matrix.
    // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized SMP assignment of a row-wise row-major
-   // dense tensor reduction expression to a tensor. Due to the explicit application of the SFINAE
-   // principle, this function can only be selected by the compiler in case the expression specific
-   // parallel evaluation strategy is selected.
+   // This function implements the performance optimized SMP assignment of a row-wise dense
+   // tensor reduction expression to a dense matrix. The rows of all pages of
+   // the tensor operand are distributed among the available threads.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target dense matrix
+           , bool SO >      // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      if( rhs.dm_.columns() == 0UL ) {
+         reset( ~lhs );
+      }
+      else if( !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+      }
+      else {
+         decltype(auto) A( smpDTensReduceOperand( rhs.dm_ ) );  // Evaluation of the dense tensor operand
+         smpDTensReduceAssign<rowwise>( ~lhs, A, rhs.op_ );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP addition assignment to tensors**********************************************************
+   //**SMP addition assignment to matrices*********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP addition assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief SMP addition assignment of a row-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side matrix.
    // \param rhs The right-hand side reduction expression to be added.
    // \return void
    //
    // This function implements the performance optimized SMP addition assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpAddAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
-
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
-
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpAddAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**SMP subtraction assignment to tensors*******************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP subtraction assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be subtracted.
-   // \return void
-   //
-   // This function implements the performance optimized SMP subtraction assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpSubAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpAddAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpSubAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP multiplication assignment to tensors****************************************************
+   //**SMP subtraction assignment to matrices******************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP multiplication assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief SMP subtraction assignment of a row-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression to be subtracted.
    // \return void
    //
-   // This function implements the performance optimized SMP multiplication assignment of a
-   // row-wise dense tensor reduction expression to a tensor. Due to the explicit
-   // application of the SFINAE principle, this function can only be selected by the compiler
-   // in case the expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // row-wise dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpMultAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpSubAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpMultAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP division assignment to tensors**********************************************************
+   //**SMP Schur product assignment to matrices****************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP division assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief SMP Schur product assignment of a row-wise dense tensor reduction operation to a
+   //        matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression divisor.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression for the Schur product.
    // \return void
    //
-   // This function implements the performance optimized SMP division assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // row-wise dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpDivAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpSchurAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpDivAssign( ~lhs, reduce<rowwise>( tmp, rhs.op_ ) );
+      const ResultType tmp( rhs );
+      smpSchurAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1829,16 +2259,17 @@ class DTensReduceExpr<MT,OP,rowwise>
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Expression object for row-wise dense tensor reduction operations.
+/*!\brief Expression object for page-wise dense tensor reduction operations.
 // \ingroup dense_tensor_expression
 //
 // This specialization of the DTensReduceExpr class template represents the compile time expression
-// for row-wise reduction operations of dense matrices.
+// for page-wise reduction operations of dense tensors. The page-wise reduction of an \f$ O \times M
+// \times N \f$ tensor results in an \f$ M \times N \f$ row-major matrix.
 */
-template< typename MT    // Type of the dense matrix
+template< typename MT    // Type of the dense tensor
         , typename OP >  // Type of the reduction operation
 class DTensReduceExpr<MT,OP,pagewise>
-   : public TensReduceExpr< DenseMatrix< DTensReduceExpr<MT,OP,pagewise>, true >, pagewise >
+   : public TensReduceExpr< DenseMatrix< DTensReduceExpr<MT,OP,pagewise>, rowMajor >, pagewise >
    , private Computation
 {
  private:
@@ -1847,56 +2278,24 @@ class DTensReduceExpr<MT,OP,pagewise>
    using ET = ElementType_t<MT>;  //!< Element type of the dense tensor expression.
    //**********************************************************************************************
 
-   //**Serial evaluation strategy******************************************************************
-   //! Compilation switch for the serial evaluation strategy of the reduction expression.
-   /*! The \a useAssign compile time constant expression represents a compilation switch for
-       the serial evaluation strategy of the reduction expression. In case the dense tensor
-       operand requires an intermediate evaluation, \a useAssign will be set to 1 and the
-       reduction expression will be evaluated via the \a assign function family. Otherwise
-       \a useAssign will be set to 0 and the expression will be evaluated via the subscript
-       operator. */
-   static constexpr bool useAssign = RequiresEvaluation_v<MT>;
-
-   /*! \cond BLAZE_INTERNAL */
-   //! Helper variable template for the explicit application of the SFINAE principle.
-   template< typename VT >
-   static constexpr bool UseAssign_v = useAssign;
-   /*! \endcond */
-   //**********************************************************************************************
-
-   //**Parallel evaluation strategy****************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   //! Helper variable template for the explicit application of the SFINAE principle.
-   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
-       In case the dense tensor operand is not SMP assignable and requires an intermediate
-       evaluation, the variable is set to 1 and the expression specific evaluation strategy
-       is selected. Otherwise the variable is set to 0 and the default strategy is chosen. */
-   template< typename VT >
-   static constexpr bool UseSMPAssign_v = ( !MT::smpAssignable && useAssign );
-   /*! \endcond */
-   //**********************************************************************************************
-
  public:
    //**Type definitions****************************************************************************
-   using This          = DTensReduceExpr<MT,OP,pagewise>; //!< Type of this DTensReduceExpr instance.
-   using ResultType    = ReduceTrait_t<RT,OP,pagewise>;   //!< Result type for expression template evaluations.
-   using TransposeType = TransposeType_t<ResultType>;    //!< Transpose type for expression template evaluations.
-   using ElementType   = ElementType_t<ResultType>;      //!< Resulting element type.
-   using SIMDType      = SIMDTrait_t<ElementType>;       //!< Resulting SIMD element type.
-   using ReturnType    = const ElementType;              //!< Return type for expression template evaluations.
-
-   //! Data type for composite expression templates.
-   using CompositeType = If_t< useAssign, const ResultType, const DTensReduceExpr& >;
+   using This          = DTensReduceExpr<MT,OP,pagewise>;  //!< Type of this DTensReduceExpr instance.
+   using ResultType    = ReduceTrait_t<RT,OP,pagewise>;    //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;      //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;        //!< Resulting element type.
+   using SIMDType      = SIMDTrait_t<ElementType>;         //!< Resulting SIMD element type.
+   using ReturnType    = const ElementType;                //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;                 //!< Data type for composite expression templates.
 
    //! Composite type of the left-hand side dense tensor expression.
    using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
 
    //! Data type of the custom unary operation.
    using Operation = OP;
-   //**********************************************************************************************
 
    //**ConstIterator class definition**************************************************************
-   /*!\brief Iterator over the elements of the dense tensor.
+   /*!\brief Iterator over the elements of a row of the reduction expression.
    */
    class ConstIterator
    {
@@ -1920,15 +2319,15 @@ class DTensReduceExpr<MT,OP,pagewise>
       /*!\brief Constructor for the ConstIterator class.
       //
       // \param dm The dense tensor operand of the reduction expression.
-      // \param i Index to the initial tensor page.
-      // \param i Index to the tensor row.
+      // \param i Index of the row of the reduction expression.
+      // \param j Index to the initial column of the reduction expression.
       // \param op The reduction operation.
       */
-      explicit inline ConstIterator( Operand dm, size_t k, size_t i, OP op )
-         : dm_   ( dm    )  // Dense tensor of the reduction expression
-         , k_    ( k )      // Index to the current tensor page
-         , i_    ( i )      // Index to the tensor row
-         , op_   ( op    )  // The reduction operation
+      explicit inline ConstIterator( Operand dm, size_t i, size_t j, OP op )
+         : dm_( dm )  // Dense tensor of the reduction expression
+         , i_ ( i  )  // Index of the row of the reduction expression
+         , j_ ( j  )  // Index to the current column of the reduction expression
+         , op_( op )  // The reduction operation
       {}
       //*******************************************************************************************
 
@@ -1939,7 +2338,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The incremented iterator.
       */
       inline ConstIterator& operator+=( size_t inc ) {
-         k_ += inc;
+         j_ += inc;
          return *this;
       }
       //*******************************************************************************************
@@ -1951,7 +2350,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The decremented iterator.
       */
       inline ConstIterator& operator-=( size_t dec ) {
-         k_ -= dec;
+         j_ -= dec;
          return *this;
       }
       //*******************************************************************************************
@@ -1962,7 +2361,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return Reference to the incremented iterator.
       */
       inline ConstIterator& operator++() {
-         ++k_;
+         ++j_;
          return *this;
       }
       //*******************************************************************************************
@@ -1973,7 +2372,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The previous position of the iterator.
       */
       inline const ConstIterator operator++( int ) {
-         return ConstIterator( k_++, i_ );
+         return ConstIterator( dm_, i_, j_++, op_ );
       }
       //*******************************************************************************************
 
@@ -1983,7 +2382,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return Reference to the decremented iterator.
       */
       inline ConstIterator& operator--() {
-         --k_;
+         --j_;
          return *this;
       }
       //*******************************************************************************************
@@ -1994,7 +2393,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The previous position of the iterator.
       */
       inline const ConstIterator operator--( int ) {
-         return ConstIterator( k_--, i_ );
+         return ConstIterator( dm_, i_, j_--, op_ );
       }
       //*******************************************************************************************
 
@@ -2004,7 +2403,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The resulting value.
       */
       inline ReturnType operator*() const {
-         return reduce( column( rowslice(dm_, i_, unchecked), k_, unchecked ), op_ );
+         return element( dm_, i_, j_, op_ );
       }
       //*******************************************************************************************
 
@@ -2015,7 +2414,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return \a true if the iterators refer to the same element, \a false if not.
       */
       inline bool operator==( const ConstIterator& rhs ) const {
-         return k_ == rhs.k_ && i_ == rhs.i_;
+         return j_ == rhs.j_;
       }
       //*******************************************************************************************
 
@@ -2026,7 +2425,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return \a true if the iterators don't refer to the same element, \a false if they do.
       */
       inline bool operator!=( const ConstIterator& rhs ) const {
-         return k_ != rhs.k_ || i_ != rhs.i_;
+         return j_ != rhs.j_;
       }
       //*******************************************************************************************
 
@@ -2037,7 +2436,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return \a true if the left-hand side iterator is smaller, \a false if not.
       */
       inline bool operator<( const ConstIterator& rhs ) const {
-         return k_ < rhs.k_ ? true : i_ < rhs.i_;
+         return j_ < rhs.j_;
       }
       //*******************************************************************************************
 
@@ -2048,7 +2447,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return \a true if the left-hand side iterator is greater, \a false if not.
       */
       inline bool operator>( const ConstIterator& rhs ) const {
-         return !(*this <= rhs);
+         return j_ > rhs.j_;
       }
       //*******************************************************************************************
 
@@ -2059,7 +2458,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
       */
       inline bool operator<=( const ConstIterator& rhs ) const {
-         return k_ <= rhs.k_ ? true : i_ <= rhs.i_;
+         return j_ <= rhs.j_;
       }
       //*******************************************************************************************
 
@@ -2070,7 +2469,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
       */
       inline bool operator>=( const ConstIterator& rhs ) const {
-         return !(*this < rhs);
+         return j_ >= rhs.j_;
       }
       //*******************************************************************************************
 
@@ -2081,7 +2480,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The number of elements between the two iterators.
       */
       inline DifferenceType operator-( const ConstIterator& rhs ) const {
-         return k_ - rhs.k_;
+         return j_ - rhs.j_;
       }
       //*******************************************************************************************
 
@@ -2093,7 +2492,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The incremented iterator.
       */
       friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
-         return ConstIterator( it.k_ + inc, it.i_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ + inc, it.op_ );
       }
       //*******************************************************************************************
 
@@ -2105,7 +2504,7 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The incremented iterator.
       */
       friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
-         return ConstIterator( it.k_ + inc, it.i_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ + inc, it.op_ );
       }
       //*******************************************************************************************
 
@@ -2117,16 +2516,16 @@ class DTensReduceExpr<MT,OP,pagewise>
       // \return The decremented iterator.
       */
       friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
-         return ConstIterator( it.k_ - dec, it.i_ );
+         return ConstIterator( it.dm_, it.i_, it.j_ - dec, it.op_ );
       }
       //*******************************************************************************************
 
     private:
       //**Member variables*************************************************************************
-      Operand dm_;     //!< Dense tensor of the reduction expression.
-      size_t  k_;      //!< Index to the current tensor page.
-      size_t  i_;      //!< Index to the tensor row.
-      OP      op_;     //!< The reduction operation.
+      Operand dm_;  //!< Dense tensor of the reduction expression.
+      size_t  i_;   //!< Index of the row of the reduction expression.
+      size_t  j_;   //!< Index to the current column of the reduction expression.
+      OP      op_;  //!< The reduction operation.
       //*******************************************************************************************
    };
    //**********************************************************************************************
@@ -2151,74 +2550,78 @@ class DTensReduceExpr<MT,OP,pagewise>
    {}
    //**********************************************************************************************
 
-   //**Subscript operator**************************************************************************
-   /*!\brief Subscript operator for the direct access to the tensor elements.
+   //**Function call operator**********************************************************************
+   /*!\brief 2D-access to the matrix elements.
    //
-   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
    // \return The resulting value.
    */
-   inline ReturnType operator()( size_t k, size_t i ) const {
-      BLAZE_INTERNAL_ASSERT( k < dm_.pages(), "Invalid tensor access index" );
-      BLAZE_INTERNAL_ASSERT( i < dm_.rows(), "Invalid tensor access index" );
-      return reduce( column( rowslice(dm_, i, unchecked ), k, unchecked ), op_ );
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+      return element( dm_, i, j, op_ );
    }
    //**********************************************************************************************
 
    //**At function*********************************************************************************
-   /*!\brief Checked access to the tensor elements.
+   /*!\brief Checked access to the matrix elements.
    //
-   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
    // \return The resulting value.
-   // \exception std::out_of_range Invalid tensor access index.
+   // \exception std::out_of_range Invalid matrix access index.
    */
-   inline ReturnType at( size_t k, size_t i ) const {
-      if( k >= dm_.pages() ) {
-         BLAZE_THROW_OUT_OF_RANGE( "Invalid tensor access index" );
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
       }
-      if( i >= dm_.rows() ) {
-         BLAZE_THROW_OUT_OF_RANGE( "Invalid tensor access index" );
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
       }
-      return (*this)(k, i);
+      return (*this)(i,j);
    }
    //**********************************************************************************************
 
    //**Begin function******************************************************************************
-   /*!\brief Returns an iterator to the first element of the dense tensor.
+   /*!\brief Returns an iterator to the first element of row \a i.
    //
-   // \return Iterator to the first element of the dense tensor.
+   // \param i The row index.
+   // \return Iterator to the first element of row \a i.
    */
    inline ConstIterator begin( size_t i ) const {
-      return ConstIterator( dm_, 0UL, i, op_ );
+      return ConstIterator( dm_, i, 0UL, op_ );
    }
    //**********************************************************************************************
 
    //**End function********************************************************************************
-   /*!\brief Returns an iterator just past the last non-zero element of the dense tensor.
+   /*!\brief Returns an iterator just past the last element of row \a i.
    //
-   // \return Iterator just past the last non-zero element of the dense tensor.
+   // \param i The row index.
+   // \return Iterator just past the last element of row \a i.
    */
    inline ConstIterator end( size_t i ) const {
-      return ConstIterator( dm_, dm_.pages(), i, op_ );
+      return ConstIterator( dm_, i, columns(), op_ );
    }
    //**********************************************************************************************
 
-   //**Size function*******************************************************************************
-   /*!\brief Returns the current size/dimension of the tensor.
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
    //
-   // \return The size of the tensor.
+   // \return The number of rows of the matrix.
    */
    inline size_t rows() const noexcept {
       return dm_.rows();
    }
    //**********************************************************************************************
 
-   //**Pages function*******************************************************************************
-   /*!\brief Returns the current size/dimension of the tensor.
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
    //
-   // \return The size of the tensor.
+   // \return The number of columns of the matrix.
    */
    inline size_t columns() const noexcept {
-      return dm_.pages();
+      return dm_.columns();
    }
    //**********************************************************************************************
 
@@ -2287,358 +2690,777 @@ class DTensReduceExpr<MT,OP,pagewise>
    //**********************************************************************************************
 
  private:
+   //**Element computation*************************************************************************
+   /*!\brief Computation of a single element of the reduction expression.
+   //
+   // \param dm The dense tensor operand.
+   // \param i The row index of the element.
+   // \param j The column index of the element.
+   // \param op The reduction operation.
+   // \return The resulting value.
+   */
+   static inline ReturnType element( const MT& dm, size_t i, size_t j, OP op ) {
+      return reduce( column( columnslice( dm, j, unchecked ), i, unchecked ), op );
+   }
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    Operand   dm_;  //!< Dense tensor of the reduction expression.
    Operation op_;  //!< The reduction operation.
    //**********************************************************************************************
 
-   //**Assignment to tensors***********************************************************************
+   //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a row-wise dense tensor reduction operation to a tensor.
+   /*!\brief Assignment of a page-wise dense tensor reduction operation to a dense matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side dense matrix.
    // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized assignment of a row-wise row-major
-   // dense tensor reduction expression to a tensor. Due to the explicit application of the SFINAE
-   // principle, this function can only be selected by the compiler in case the expression specific
-   // parallel evaluation strategy is selected.
+   // This function implements the performance optimized assignment of a page-wise dense tensor
+   // reduction expression to a dense matrix. Entire rows of all
+   // pages of the tensor are accumulated in a vectorized fashion, if possible.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto assign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   template< typename MT2   // Type of the target dense matrix
+           , bool SO >      // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( rhs.dm_.pages() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      assign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
+      decltype(auto) A( dtensreduceOperand( rhs.dm_ ) );  // Evaluation of the dense tensor operand
+      dtensreduceAssign<pagewise>( ~lhs, A, rhs.op_ );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Addition assignment to tensors**************************************************************
+   //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Addition assignment of a row-wise dense tensor reduction operation to a tensor.
+   /*!\brief Assignment of a page-wise dense tensor reduction operation to a sparse matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be added.
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized addition assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto addAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   // This function implements the performance optimized assignment of a page-wise dense tensor
+   // reduction expression to a sparse matrix.
+   */
+   template< typename MT2   // Type of the target sparse matrix
+           , bool SO >      // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      addAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Subtraction assignment to tensors***********************************************************
+   //**Addition assignment to matrices*************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief Addition assignment of a page-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression to be added.
    // \return void
    //
-   // This function implements the performance optimized subtraction assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto subAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   // This function implements the performance optimized addition assignment of a page-wise
+   // dense tensor reduction expression to a matrix.
+   */
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void addAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      subAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Multiplication assignment to tensors********************************************************
+   //**Subtraction assignment to matrices**********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Multiplication assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief Subtraction assignment of a page-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression to be subtracted.
    // \return void
    //
-   // This function implements the performance optimized multiplication assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized subtraction assignment of a page-wise
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto multAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void subAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      multAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Division assignment to tensors**************************************************************
+   //**Schur product assignment to matrices********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Division assignment of a row-wise dense tensor reduction operation to a tensor.
+   /*!\brief Schur product assignment of a page-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression divisor.
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression for the Schur product.
    // \return void
    //
-   // This function implements the performance optimized division assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized Schur product assignment of a page-wise
+   // dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto divAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void schurAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( serial( rhs.dm_ ) );  // Evaluation of the dense tensor operand
-      divAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP assignment to tensors*******************************************************************
+   //**SMP assignment to dense matrices************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP assignment of a row-wise dense tensor reduction operation to a tensor.
+   /*!\brief SMP assignment of a page-wise dense tensor reduction operation to a dense matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side dense matrix.
    // \param rhs The right-hand side reduction expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized SMP assignment of a row-wise row-major
-   // dense tensor reduction expression to a tensor. Due to the explicit application of the SFINAE
-   // principle, this function can only be selected by the compiler in case the expression specific
-   // parallel evaluation strategy is selected.
+   // This function implements the performance optimized SMP assignment of a page-wise dense
+   // tensor reduction expression to a dense matrix. The rows of the target
+   // matrix or, in case there are not sufficiently many, its columns are distributed among
+   // the available threads.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target dense matrix
+           , bool SO >      // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
+      if( rhs.dm_.pages() == 0UL ) {
+         reset( ~lhs );
+      }
+      else if( !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+      }
+      else {
+         decltype(auto) A( smpDTensReduceOperand( rhs.dm_ ) );  // Evaluation of the dense tensor operand
+         smpDTensReduceAssign<pagewise>( ~lhs, A, rhs.op_ );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP addition assignment to tensors**********************************************************
+   //**SMP addition assignment to matrices*********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP addition assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief SMP addition assignment of a page-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side matrix.
    // \param rhs The right-hand side reduction expression to be added.
    // \return void
    //
-   // This function implements the performance optimized SMP addition assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpAddAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   // This function implements the performance optimized SMP addition assignment of a page-wise
+   // dense tensor reduction expression to a matrix.
+   */
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpAddAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpAddAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP subtraction assignment to tensors*******************************************************
+   //**SMP subtraction assignment to matrices******************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP subtraction assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
+   /*!\brief SMP subtraction assignment of a page-wise dense tensor reduction operation to a matrix.
    // \ingroup dense_tensor
    //
-   // \param lhs The target left-hand side tensor.
+   // \param lhs The target left-hand side matrix.
    // \param rhs The right-hand side reduction expression to be subtracted.
    // \return void
    //
-   // This function implements the performance optimized SMP subtraction assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // page-wise dense tensor reduction expression to a matrix.
+   */
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpSubAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a page-wise dense tensor reduction operation to a
+   //        matrix.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side matrix.
+   // \param rhs The right-hand side reduction expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // page-wise dense tensor reduction expression to a matrix.
    */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpSubAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   template< typename MT2   // Type of the target matrix
+           , bool SO >      // Storage order of the target matrix
+   friend inline void smpSchurAssign( Matrix<MT2,SO>& lhs, const DTensReduceExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSchurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED REDUCTION OPERANDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the storage of a leaf operand of a fused reduction.
+// \ingroup dense_tensor
+//
+// Dense tensors that are no expressions are stored by reference. Expressions are stored by
+// value, which either stores the expression itself (in case it can be evaluated element-wise)
+// or the temporary result of an expression that requires an intermediate evaluation (as for
+// instance a tensor multiplication).
+*/
+template< typename MT >  // Type of the dense tensor operand
+using DTensFusedOperand_t =
+   If_t< IsExpression_v<MT>, RemoveCV_t< RemoveReference_t< CompositeType_t<MT> > >, const MT& >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise unary operation within a fused reduction of a dense tensor expression.
+// \ingroup dense_tensor
+//
+// The DTensFusedUnary class template represents a unary element-wise operation within a fused
+// reduction (see dtensreduce()). In contrast to the DTensMapExpr class template it never
+// requires an intermediate evaluation: only the leaf operands that require an evaluation are
+// evaluated, while the operation itself is applied on the fly within the reduction kernels.
+*/
+template< typename CT    // Storage type of the dense tensor operand
+        , typename OP >  // Type of the custom unary operation
+class DTensFusedUnary
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MT = RemoveCV_t< RemoveReference_t<CT> >;  //!< Type of the dense tensor operand.
+   using ET = ElementType_t<MT>;                    //!< Element type of the dense tensor operand.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Resulting element type.
+   using ElementType = RemoveCV_t< RemoveReference_t<
+      decltype( std::declval<OP>()( std::declval<ET>() ) ) > >;
+
+   //! Data type for composite expression templates.
+   using CompositeType = const DTensFusedUnary&;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized evaluation within the reduction kernels.
+   static constexpr bool simdEnabled =
+      ( MT::simdEnabled &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET>, HasLoad<OP> >::value );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensFusedUnary class.
+   //
+   // \param dm The dense tensor operand.
+   // \param op The custom unary operation.
+   */
+   explicit inline DTensFusedUnary( CT dm, OP op )
+      : dm_( std::forward<CT>( dm ) )  // Dense tensor operand
+      , op_( op )                      // The custom unary operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ElementType operator()( size_t k, size_t i, size_t j ) const {
+      return op_( dm_(k,i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the tensor.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting SIMD element.
+   */
+   BLAZE_ALWAYS_INLINE auto load( size_t k, size_t i, size_t j ) const noexcept {
+      return op_.load( dm_.load(k,i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return dm_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return dm_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return dm_.pages();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   CT dm_;  //!< Dense tensor operand of the fused operation.
+   OP op_;  //!< The custom unary operation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise binary operation within a fused reduction of a dense tensor expression.
+// \ingroup dense_tensor
+//
+// The DTensFusedBinary class template represents a binary element-wise operation (as for
+// instance the addition, subtraction or Schur product of two dense tensors) within a fused
+// reduction (see dtensreduce()). Only the leaf operands that require an intermediate evaluation
+// are evaluated, while the operation itself is applied on the fly within the reduction kernels.
+*/
+template< typename CT1   // Storage type of the left-hand side dense tensor operand
+        , typename CT2   // Storage type of the right-hand side dense tensor operand
+        , typename OP >  // Type of the custom binary operation
+class DTensFusedBinary
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MT1 = RemoveCV_t< RemoveReference_t<CT1> >;  //!< Type of the left-hand side operand.
+   using MT2 = RemoveCV_t< RemoveReference_t<CT2> >;  //!< Type of the right-hand side operand.
+   using ET1 = ElementType_t<MT1>;  //!< Element type of the left-hand side operand.
+   using ET2 = ElementType_t<MT2>;  //!< Element type of the right-hand side operand.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Resulting element type.
+   using ElementType = RemoveCV_t< RemoveReference_t<
+      decltype( std::declval<OP>()( std::declval<ET1>(), std::declval<ET2>() ) ) > >;
+
+   //! Data type for composite expression templates.
+   using CompositeType = const DTensFusedBinary&;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized evaluation within the reduction kernels.
+   static constexpr bool simdEnabled =
+      ( MT1::simdEnabled && MT2::simdEnabled &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET1,ET2>, HasLoad<OP> >::value );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensFusedBinary class.
+   //
+   // \param lhs The left-hand side dense tensor operand.
+   // \param rhs The right-hand side dense tensor operand.
+   // \param op The custom binary operation.
+   */
+   explicit inline DTensFusedBinary( CT1 lhs, CT2 rhs, OP op )
+      : lhs_( std::forward<CT1>( lhs ) )  // Left-hand side dense tensor operand
+      , rhs_( std::forward<CT2>( rhs ) )  // Right-hand side dense tensor operand
+      , op_ ( op )                        // The custom binary operation
+   {
+      BLAZE_INTERNAL_ASSERT( lhs_.pages()   == rhs_.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( lhs_.rows()    == rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( lhs_.columns() == rhs_.columns(), "Invalid number of columns" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ElementType operator()( size_t k, size_t i, size_t j ) const {
+      return op_( lhs_(k,i,j), rhs_(k,i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the tensor.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting SIMD element.
+   */
+   BLAZE_ALWAYS_INLINE auto load( size_t k, size_t i, size_t j ) const noexcept {
+      return op_.load( lhs_.load(k,i,j), rhs_.load(k,i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return lhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return lhs_.pages();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   CT1 lhs_;  //!< Left-hand side dense tensor operand of the fused operation.
+   CT2 rhs_;  //!< Right-hand side dense tensor operand of the fused operation.
+   OP  op_;   //!< The custom binary operation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary type trait for the detection of the element-wise dense tensor expressions
+//        that can be fused into a reduction.
+// \ingroup dense_tensor
+//
+// In case the given type \a MT is an element-wise dense tensor expression (i.e. an addition,
+// subtraction, Schur product or map expression), the \a value member constant is set to
+// \a true, otherwise it is set to \a false.
+*/
+template< typename MT >  // Type of the dense tensor operand
+struct IsFusableDTensReduce
+   : public FalseType
+{};
+
+template< typename MT1, typename MT2 >
+struct IsFusableDTensReduce< DTensDTensAddExpr<MT1,MT2> >
+   : public TrueType
+{};
+
+template< typename MT1, typename MT2 >
+struct IsFusableDTensReduce< DTensDTensSubExpr<MT1,MT2> >
+   : public TrueType
+{};
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpSubAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
+template< typename MT1, typename MT2 >
+struct IsFusableDTensReduce< DTensDTensSchurExpr<MT1,MT2> >
+   : public TrueType
+{};
 
-   //**SMP multiplication assignment to tensors****************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP multiplication assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression to be multiplied.
-   // \return void
-   //
-   // This function implements the performance optimized SMP multiplication assignment of a
-   // row-wise dense tensor reduction expression to a tensor. Due to the explicit
-   // application of the SFINAE principle, this function can only be selected by the compiler
-   // in case the expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpMultAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
+template< typename MT, typename OP >
+struct IsFusableDTensReduce< DTensMapExpr<MT,OP> >
+   : public TrueType
+{};
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
+template< typename MT1, typename MT2, typename OP >
+struct IsFusableDTensReduce< DTensDTensMapExpr<MT1,MT2,OP> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpMultAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
 
-   //**SMP division assignment to tensors**********************************************************
-   /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP division assignment of a row-wise dense tensor reduction operation
-   //        to a tensor.
-   // \ingroup dense_tensor
-   //
-   // \param lhs The target left-hand side tensor.
-   // \param rhs The right-hand side reduction expression divisor.
-   // \return void
-   //
-   // This function implements the performance optimized SMP division assignment of a row-wise
-   // dense tensor reduction expression to a tensor. Due to the explicit application
-   // of the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
-   */
-   template< typename VT1   // Type of the target dense tensor
-           , bool SO >      // Storage order of destination matrix
-   friend inline auto smpDivAssign( Matrix<VT1,SO>& lhs, const DTensReduceExpr& rhs )
-      -> EnableIf_t< UseSMPAssign_v<VT1> >
-   {
-      BLAZE_FUNCTION_TRACE;
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the fused reduction of a dense tensor.
+// \ingroup dense_tensor
+//
+// An element-wise dense tensor expression is reduced without intermediate evaluation in case
+// the expression itself would require an evaluation into a temporary tensor, i.e. in case any
+// of its operands requires an intermediate evaluation.
+*/
+template< typename MT >  // Type of the dense tensor operand
+constexpr bool UseFusedDTensReduce_v =
+   ( RequiresEvaluation_v<MT> && IsFusableDTensReduce<MT>::value );
+/*! \endcond */
+//*************************************************************************************************
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows() == rhs.rows(), "Invalid tensor sizes" );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid tensor sizes" );
 
-      const RT tmp( rhs.dm_ );  // Evaluation of the dense tensor operand
-      smpDivAssign( ~lhs, reduce<pagewise>( tmp, rhs.op_ ) );
-   }
-   /*! \endcond */
-   //**********************************************************************************************
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the fused representation of a leaf operand of a fused reduction.
+// \ingroup dense_tensor
+//
+// \param dm The dense tensor operand.
+// \return The stored dense tensor operand (see DTensFusedOperand_t).
+*/
+template< typename MT >  // Type of the dense tensor operand
+inline DTensFusedOperand_t<MT> fuseDTensOperand( const DenseTensor<MT>& dm )
+{
+   return DTensFusedOperand_t<MT>( ~dm );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-   //**Compile time checks*************************************************************************
-   /*! \cond BLAZE_INTERNAL */
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( MT );
-   /*! \endcond */
-   //**********************************************************************************************
-};
-//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the fused representation of a unary element-wise operation.
+// \ingroup dense_tensor
 //
-//  CLASS DEFINITION
+// \param dm The dense tensor operand.
+// \param op The custom unary operation.
+// \return The fused element-wise operation.
+*/
+template< typename MT    // Type of the dense tensor operand
+        , typename OP >  // Type of the custom unary operation
+inline auto fuseDTensUnary( const DenseTensor<MT>& dm, OP op )
+{
+   using CT = decltype( fuseDTensOperand( ~dm ) );
+
+   return DTensFusedUnary<CT,OP>( fuseDTensOperand( ~dm ), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the fused representation of a binary element-wise operation.
+// \ingroup dense_tensor
 //
-//=================================================================================================
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense tensor operand.
+// \param op The custom binary operation.
+// \return The fused element-wise operation.
+*/
+template< typename MT1   // Type of the left-hand side dense tensor operand
+        , typename MT2   // Type of the right-hand side dense tensor operand
+        , typename OP >  // Type of the custom binary operation
+inline auto fuseDTensBinary( const DenseTensor<MT1>& lhs, const DenseTensor<MT2>& rhs, OP op )
+{
+   using CT1 = decltype( fuseDTensOperand( ~lhs ) );
+   using CT2 = decltype( fuseDTensOperand( ~rhs ) );
+
+   return DTensFusedBinary<CT1,CT2,OP>( fuseDTensOperand( ~lhs ), fuseDTensOperand( ~rhs ), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Auxiliary helper struct for the dense tensor reduction operation.
+/*!\brief Creates the fused representation of element-wise dense tensor expressions.
 // \ingroup dense_tensor
+//
+// \param dm The element-wise dense tensor expression.
+// \return The fused element-wise operation.
+//
+// These overloads recursively replace the element-wise expressions of an expression tree by
+// their fused counterparts. The recursion stops at all other operands (see DTensFusedOperand_t).
 */
-template< typename MT    // Type of the dense tensor
-        , typename OP >  // Type of the reduction operation
-struct DTensReduceExprHelper
+template< typename MT1, typename MT2 >
+inline auto fuseDTensOperand( const DTensDTensAddExpr<MT1,MT2>& dm )
 {
-   //**Type definitions****************************************************************************
-   //! Composite type of the dense tensor expression.
-   using CT = RemoveReference_t< CompositeType_t<MT> >;
+   return fuseDTensBinary( dm.leftOperand(), dm.rightOperand(), Add() );
+}
 
-   //! Element type of the dense tensor expression.
-   using ET = ElementType_t<CT>;
+template< typename MT1, typename MT2 >
+inline auto fuseDTensOperand( const DTensDTensSubExpr<MT1,MT2>& dm )
+{
+   return fuseDTensBinary( dm.leftOperand(), dm.rightOperand(), Sub() );
+}
 
-   //! Definition of the HasSIMDEnabled type trait.
-   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+template< typename MT1, typename MT2 >
+inline auto fuseDTensOperand( const DTensDTensSchurExpr<MT1,MT2>& dm )
+{
+   return fuseDTensBinary( dm.leftOperand(), dm.rightOperand(), Mult() );
+}
 
-   //! Definition of the HasLoad type trait.
-   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
-   //**********************************************************************************************
+template< typename MT, typename OP >
+inline auto fuseDTensOperand( const DTensMapExpr<MT,OP>& dm )
+{
+   return fuseDTensUnary( dm.operand(), dm.operation() );
+}
 
-   //**********************************************************************************************
-   static constexpr bool value =
-      ( CT::simdEnabled &&
-        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,ET,ET>, HasLoad<OP> >::value );
-   //**********************************************************************************************
-};
+template< typename MT1, typename MT2, typename OP >
+inline auto fuseDTensOperand( const DTensDTensMapExpr<MT1,MT2,OP>& dm )
+{
+   return fuseDTensBinary( dm.leftOperand(), dm.rightOperand(), dm.operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the dense tensor operand of a total reduction.
+// \ingroup dense_tensor
+//
+// \param dm The dense tensor operand.
+// \return The evaluated or fused dense tensor operand.
+//
+// Element-wise expressions that would otherwise be evaluated into a temporary tensor are
+// replaced by their fused representation, which evaluates the element-wise operations in
+// registers. All other operands are evaluated according to their composite type.
+*/
+template< typename MT >  // Type of the dense tensor operand
+inline auto dtensreduceTotalOperand( const DenseTensor<MT>& dm )
+   -> EnableIf_t< UseFusedDTensReduce_v<MT>, decltype( fuseDTensOperand( ~dm ) ) >
+{
+   return fuseDTensOperand( ~dm );
+}
+
+template< typename MT >  // Type of the dense tensor operand
+inline auto dtensreduceTotalOperand( const DenseTensor<MT>& dm )
+   -> DisableIf_t< UseFusedDTensReduce_v<MT>, CompositeType_t<MT> >
+{
+   return ~dm;
+}
 /*! \endcond */
 //*************************************************************************************************
 
@@ -2653,86 +3475,69 @@ struct DTensReduceExprHelper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default backend implementation of the reduction of a dense tensor.
+/*!\brief Default kernel for the reduction of a range of rows of a dense tensor.
 // \ingroup dense_tensor
 //
-// \param dm The given dense tensor for the reduction computation.
+// \param A The dense tensor operand.
 // \param op The reduction operation.
+// \param begin The first row to be reduced (counting the rows of all pages consecutively).
+// \param end The row behind the last row to be reduced.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a dense
-// tensor. Due to the explicit application of the SFINAE principle, this function can only be
-// selected by the compiler in case vectorization cannot be applied.
+// This function implements the reduction of the non-empty range \f$[begin..end)\f$ of rows of
+// the given dense tensor. Due to the explicit application of the SFINAE principle, this function
+// can only be selected by the compiler in case vectorization cannot be applied.
 */
-template< typename MT    // Type of the dense tensor
+template< typename TT    // Type of the dense tensor operand
         , typename OP >  // Type of the reduction operation
-inline auto dtensreduce( const DenseTensor<MT>& dm, OP op )
-   -> EnableIf_t< !DTensReduceExprHelper<MT,OP>::value, ElementType_t<MT> >
+inline auto dtensreduceRows( const TT& A, OP op, size_t begin, size_t end )
+   -> DisableIf_t< DTensReduceExprHelper<TT,OP>::value, ElementType_t<TT> >
 {
-   using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
+   using ET = ElementType_t<TT>;
 
-   const size_t M( (~dm).rows()    );
-   const size_t N( (~dm).columns() );
-   const size_t O( (~dm).pages()   );
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
 
-   if( M == 0UL || N == 0UL || O == 0UL ) return ET{};
-   if( M == 1UL && N == 1UL && O == 1UL ) return (~dm)(0UL,0UL,0UL);
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
 
-   CT tmp( ~dm );
+   ET redux( A(begin/M,begin%M,0UL) );
 
-   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
-   BLAZE_INTERNAL_ASSERT( tmp.pages()   == O, "Invalid number of pages" );
+   for( size_t j=1UL; j<N; ++j ) {
+      redux = op( redux, A(begin/M,begin%M,j) );
+   }
 
-   ET redux0{};
+   size_t r( begin+1UL );
 
+   for( ; (r+2UL) <= end; r+=2UL )
    {
-      redux0 = tmp(0UL,0UL,0UL);
+      const size_t k1( r/M ), i1( r%M );
+      const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
 
-      size_t j(1UL);
-      for( size_t k=0UL; k<O; ++k )
-      {
-         for( ; j<N; ++j )
-         {
-            redux0 = op( redux0, tmp(k,0UL,j) );
-         }
-         j = 0UL;
+      ET redux1( A(k1,i1,0UL) );
+      ET redux2( A(k2,i2,0UL) );
+
+      for( size_t j=1UL; j<N; ++j ) {
+         redux1 = op( redux1, A(k1,i1,j) );
+         redux2 = op( redux2, A(k2,i2,j) );
       }
+
+      redux = op( redux, op( redux1, redux2 ) );
    }
 
-   size_t i( 1UL );
-   for( size_t k=0UL; k<O; ++k )
+   if( r < end )
    {
-      for( ; (i+2UL) <= M; i+=2UL )
-      {
-         ET redux1( tmp(k,i    ,0UL) );
-         ET redux2( tmp(k,i+1UL,0UL) );
-
-         for( size_t j=1UL; j<N; ++j ) {
-            redux1 = op( redux1, tmp(k,i    ,j) );
-            redux2 = op( redux2, tmp(k,i+1UL,j) );
-         }
-
-         redux1 = op( redux1, redux2 );
-         redux0 = op( redux0, redux1 );
-      }
-
-      if( i < M )
-      {
-         ET redux1( tmp(k,i,0UL) );
+      const size_t k1( r/M ), i1( r%M );
 
-         for( size_t j=1UL; j<N; ++j ) {
-            redux1 = op( redux1, tmp(k,i,j) );
-         }
+      ET redux1( A(k1,i1,0UL) );
 
-         redux0 = op( redux0, redux1 );
+      for( size_t j=1UL; j<N; ++j ) {
+         redux1 = op( redux1, A(k1,i1,j) );
       }
 
-      i = 1UL;
+      redux = op( redux, redux1 );
    }
 
-   return redux0;
+   return redux;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -2740,197 +3545,125 @@ inline auto dtensreduce( const DenseTensor<MT>& dm, OP op )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the reduction of a dense tensor.
+/*!\brief SIMD optimized kernel for the reduction of a range of rows of a dense tensor.
 // \ingroup dense_tensor
 //
-// \param dm The given dense tensor for the reduction computation.
+// \param A The dense tensor operand.
 // \param op The reduction operation.
+// \param begin The first row to be reduced (counting the rows of all pages consecutively).
+// \param end The row behind the last row to be reduced.
 // \return The result of the reduction operation.
 //
-// This function implements the performance optimized reduction operation for a dense
-// tensor. Due to the explicit application of the SFINAE principle, this function can only be
-// selected by the compiler in case vectorization can be applied.
+// This function implements the vectorized reduction of the non-empty range \f$[begin..end)\f$
+// of rows of the given dense tensor. Four rows are processed at a time in separate SIMD
+// registers, which are combined into a single register that is reduced horizontally at the very
+// end. The padding elements of a padded tensor are only included in case of a summation. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case vectorization can be applied.
 */
-template< typename MT    // Type of the dense tensor
+template< typename TT    // Type of the dense tensor operand
         , typename OP >  // Type of the reduction operation
-inline auto dtensreduce( const DenseTensor<MT>& dm, OP op )
-   -> EnableIf_t< DTensReduceExprHelper<MT,OP>::value, ElementType_t<MT> >
+inline auto dtensreduceRows( const TT& A, OP op, size_t begin, size_t end )
+   -> EnableIf_t< DTensReduceExprHelper<TT,OP>::value, ElementType_t<TT> >
 {
-   using CT = CompositeType_t<MT>;
-   using ET = ElementType_t<MT>;
-
-   const size_t M( (~dm).rows()    );
-   const size_t N( (~dm).columns() );
-   const size_t O( (~dm).pages()   );
-
-   if( M == 0UL || N == 0UL || O == 0UL ) return ET{};
-
-   CT tmp( ~dm );
+   using ET       = ElementType_t<TT>;
+   using SIMDType = SIMDTrait_t<ET>;
 
-   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
-   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
-   BLAZE_INTERNAL_ASSERT( tmp.pages()   == O, "Invalid number of pages" );
+   BLAZE_INTERNAL_ASSERT( begin < end, "Invalid range of rows detected" );
 
-   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+   constexpr bool remainder( !IsPadded_v<TT> || !IsSame_v<OP,Add> );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
 
-   alignas( AlignmentOf_v<ET> ) ET array1[SIMDSIZE];
-   alignas( AlignmentOf_v<ET> ) ET array2[SIMDSIZE];
-   alignas( AlignmentOf_v<ET> ) ET array3[SIMDSIZE];
-   alignas( AlignmentOf_v<ET> ) ET array4[SIMDSIZE];
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
 
-   ET redux{};
+   const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
 
-   if( N >= SIMDSIZE )
+   if( jpos == 0UL )
    {
-      const size_t jpos( N & size_t(-SIMDSIZE) );
-      BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
-
-      SIMDTrait_t<ET> xmm1 = tmp.load(0UL,0UL,0UL);
-
-      for( size_t k=0UL; k<O; ++k )
-      {
-         {
-            if ( k != 0UL ) {
-               xmm1 = op( xmm1, tmp.load(k,0UL,0UL) );
-            }
-
-            size_t j( SIMDSIZE );
-
-            for( ; j<jpos; j+=SIMDSIZE ) {
-               xmm1 = op( xmm1, tmp.load(k,0UL,j) );
-            }
-
-            if( jpos < N )
-            {
-               storea( array1, xmm1 );
+      ET redux( A(begin/M,begin%M,0UL) );
 
-               for( ; j<N; ++j ) {
-                  array1[0UL] = op( array1[0UL], tmp(k,0UL,j) );
-               }
-
-               xmm1 = loada( array1 );
-            }
-         }
+      for( size_t j=1UL; j<N; ++j ) {
+         redux = op( redux, A(begin/M,begin%M,j) );
+      }
 
-         size_t i( 1UL );
-
-         for( ; (i+4UL) <= M; i+=4UL )
-         {
-            xmm1 = op( xmm1, tmp.load(k,i,0UL) );
-            SIMDTrait_t<ET> xmm2( tmp.load(k,i+1UL,0UL) );
-            SIMDTrait_t<ET> xmm3( tmp.load(k,i+2UL,0UL) );
-            SIMDTrait_t<ET> xmm4( tmp.load(k,i+3UL,0UL) );
-            size_t j( SIMDSIZE );
-
-            for( ; j<jpos; j+=SIMDSIZE ) {
-               xmm1 = op( xmm1, tmp.load(k,i    ,j) );
-               xmm2 = op( xmm2, tmp.load(k,i+1UL,j) );
-               xmm3 = op( xmm3, tmp.load(k,i+2UL,j) );
-               xmm4 = op( xmm4, tmp.load(k,i+3UL,j) );
-            }
-
-            if( jpos < N )
-            {
-               storea( array1, xmm1 );
-               storea( array2, xmm2 );
-               storea( array3, xmm3 );
-               storea( array4, xmm4 );
-
-               for( ; j<N; ++j ) {
-                  array1[0UL] = op( array1[0UL], tmp(k,i    ,j) );
-                  array2[0UL] = op( array2[0UL], tmp(k,i+1UL,j) );
-                  array3[0UL] = op( array3[0UL], tmp(k,i+2UL,j) );
-                  array4[0UL] = op( array4[0UL], tmp(k,i+3UL,j) );
-               }
-
-               xmm1 = loada( array1 );
-               xmm2 = loada( array2 );
-               xmm3 = loada( array3 );
-               xmm4 = loada( array4 );
-            }
-
-            xmm1 = op( xmm1, xmm2 );
-            xmm3 = op( xmm3, xmm4 );
-            xmm1 = op( xmm1, xmm3 );
+      for( size_t r=begin+1UL; r<end; ++r ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            redux = op( redux, A(r/M,r%M,j) );
          }
+      }
 
-         if( i+2UL <= M )
-         {
-            xmm1 = op( xmm1, tmp.load(k,i,0UL) );
-            SIMDTrait_t<ET> xmm2( tmp.load(k,i+1UL,0UL) );
-            size_t j( SIMDSIZE );
+      return redux;
+   }
 
-            for( ; j<jpos; j+=SIMDSIZE ) {
-               xmm1 = op( xmm1, tmp.load(k,i    ,j) );
-               xmm2 = op( xmm2, tmp.load(k,i+1UL,j) );
-            }
+   alignas( AlignmentOf_v<ET> ) ET array[SIMDSIZE];
 
-            if( jpos < N )
-            {
-               storea( array1, xmm1 );
-               storea( array2, xmm2 );
+   // Accumulation of the remaining (non-vectorizable) elements of a row into the first lane
+   const auto tail = [&]( SIMDType& xmm, size_t k, size_t i )
+   {
+      if( remainder && jpos < N ) {
+         storea( array, xmm );
+         for( size_t j=jpos; j<N; ++j ) {
+            array[0UL] = op( array[0UL], A(k,i,j) );
+         }
+         xmm = loada( array );
+      }
+   };
 
-               for( ; j<N; ++j ) {
-                  array1[0UL] = op( array1[0UL], tmp(k,i    ,j) );
-                  array2[0UL] = op( array2[0UL], tmp(k,i+1UL,j) );
-               }
+   SIMDType xmm1( A.load(begin/M,begin%M,0UL) );
 
-               xmm1 = loada( array1 );
-               xmm2 = loada( array2 );
-            }
+   for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+      xmm1 = op( xmm1, A.load(begin/M,begin%M,j) );
+   }
 
-            xmm1 = op( xmm1, xmm2 );
+   tail( xmm1, begin/M, begin%M );
 
-            i += 2UL;
-         }
+   size_t r( begin+1UL );
 
-         if( i < M )
-         {
-            xmm1 = op( xmm1, tmp.load(k,i,0UL) );
-            size_t j( SIMDSIZE );
+   for( ; (r+4UL) <= end; r+=4UL )
+   {
+      const size_t k1( r/M ), i1( r%M );
+      const size_t k2( (r+1UL)/M ), i2( (r+1UL)%M );
+      const size_t k3( (r+2UL)/M ), i3( (r+2UL)%M );
+      const size_t k4( (r+3UL)/M ), i4( (r+3UL)%M );
+
+      SIMDType xmm2( A.load(k1,i1,0UL) );
+      SIMDType xmm3( A.load(k2,i2,0UL) );
+      SIMDType xmm4( A.load(k3,i3,0UL) );
+      SIMDType xmm5( A.load(k4,i4,0UL) );
+
+      for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+         xmm2 = op( xmm2, A.load(k1,i1,j) );
+         xmm3 = op( xmm3, A.load(k2,i2,j) );
+         xmm4 = op( xmm4, A.load(k3,i3,j) );
+         xmm5 = op( xmm5, A.load(k4,i4,j) );
+      }
 
-            for( ; j<jpos; j+=SIMDSIZE ) {
-               xmm1 = op( xmm1, tmp.load(k,i,j) );
-            }
+      tail( xmm2, k1, i1 );
+      tail( xmm3, k2, i2 );
+      tail( xmm4, k3, i3 );
+      tail( xmm5, k4, i4 );
 
-            if( jpos < N )
-            {
-               storea( array1, xmm1 );
+      xmm1 = op( xmm1, op( op( xmm2, xmm3 ), op( xmm4, xmm5 ) ) );
+   }
 
-               for( ; j<N; ++j ) {
-                  array1[0] = op( array1[0], tmp(k,i,j) );
-               }
+   for( ; r<end; ++r )
+   {
+      const size_t k1( r/M ), i1( r%M );
 
-               xmm1 = loada( array1 );
-            }
-         }
+      SIMDType xmm2( A.load(k1,i1,0UL) );
 
-         redux = reduce( xmm1, op );
+      for( size_t j=SIMDSIZE; j<jpos; j+=SIMDSIZE ) {
+         xmm2 = op( xmm2, A.load(k1,i1,j) );
       }
-   }
-   else
-   {
-      for( size_t k=0UL; k<O; ++k )
-      {
-         if ( k == 0UL ) {
-            redux = tmp(k,0UL,0UL);
-         }
-         else {
-            redux = op( redux, tmp(k,0UL,0UL) );
-         }
-         for( size_t j=1UL; j<N; ++j ) {
-            redux = op( redux, tmp(k,0UL,j) );
-         }
 
-         for( size_t i=1UL; i<M; ++i ) {
-            for( size_t j=0UL; j<N; ++j ) {
-               redux = op( redux, tmp(k,i,j) );
-            }
-         }
-      }
+      tail( xmm2, k1, i1 );
+
+      xmm1 = op( xmm1, xmm2 );
    }
 
-   return redux;
+   return reduce( xmm1, op );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -2938,21 +3671,25 @@ inline auto dtensreduce( const DenseTensor<MT>& dm, OP op )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief SIMD optimized backend implementation of the summation of a dense tensor.
+/*!\brief Backend implementation of the reduction of a dense tensor.
 // \ingroup dense_tensor
 //
-// \param dm The given dense tensor for the summation.
-// \return The result of the summation.
+// \param dm The given dense tensor for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
 //
-// This function implements the performance optimized summation for a dense tensor.
-// Due to the explicit application of the SFINAE principle, this function can only be selected
-// by the compiler in case vectorization can be applied.
+// This function implements the performance optimized reduction operation for a dense tensor.
+// In case the tensor has at least SMP_DTENSREDUCE_THRESHOLD elements, the rows of all pages
+// are split into blocks, which are reduced in parallel by means of the active SMP backend.
+// The partial results are combined in a fixed tree order (see smpReduce()). Element-wise
+// expressions (as for instance \c sum(A % (B * C)) or \c max(abs(A - B * C))) are reduced in a
+// single pass without evaluating the element-wise operations into a temporary tensor (see
+// dtensreduceTotalOperand()).
 */
-template< typename MT >  // Type of the dense tensor
-inline auto dtensreduce( const DenseTensor<MT>& dm, Add /*op*/ )
-   -> EnableIf_t< DTensReduceExprHelper<MT,Add>::value, ElementType_t<MT> >
+template< typename MT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> dtensreduce( const DenseTensor<MT>& dm, OP op )
 {
-   using CT = CompositeType_t<MT>;
    using ET = ElementType_t<MT>;
 
    const size_t M( (~dm).rows()    );
@@ -2960,104 +3697,19 @@ inline auto dtensreduce( const DenseTensor<MT>& dm, Add /*op*/ )
    const size_t O( (~dm).pages()   );
 
    if( M == 0UL || N == 0UL || O == 0UL ) return ET{};
+   if( M == 1UL && N == 1UL && O == 1UL ) return (~dm)(0UL,0UL,0UL);
 
-   CT tmp( ~dm );
+   decltype(auto) tmp( dtensreduceTotalOperand( ~dm ) );
 
    BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
-   BLAZE_INTERNAL_ASSERT( tmp.pages()   == O, "Invalid number of pages" );
-
-   constexpr bool remainder( !IsPadded_v< RemoveReference_t<CT> > );
-   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
-
-   ET redux{};
-
-   if( !remainder || N >= SIMDSIZE )
-   {
-      const size_t jpos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
-      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
-
-      SIMDTrait_t<ET> xmm1;
-
-      for( size_t k=0UL; k<O; ++k )
-      {
-         size_t i( 0UL );
-         for( ; (i+4UL) <= M; i+=4UL )
-         {
-            xmm1 = tmp.load(k,i,0UL);
-            SIMDTrait_t<ET> xmm2( tmp.load(k,i+1UL,0UL) );
-            SIMDTrait_t<ET> xmm3( tmp.load(k,i+2UL,0UL) );
-            SIMDTrait_t<ET> xmm4( tmp.load(k,i+3UL,0UL) );
-            size_t j( SIMDSIZE );
-
-            for( ; j<jpos; j+=SIMDSIZE ) {
-               xmm1 += tmp.load(k,i    ,j);
-               xmm2 += tmp.load(k,i+1UL,j);
-               xmm3 += tmp.load(k,i+2UL,j);
-               xmm4 += tmp.load(k,i+3UL,j);
-            }
-            for( ; remainder && j<N; ++j ) {
-               redux += tmp(k,i    ,j);
-               redux += tmp(k,i+1UL,j);
-               redux += tmp(k,i+2UL,j);
-               redux += tmp(k,i+3UL,j);
-            }
-
-            xmm1 += xmm2;
-            xmm3 += xmm4;
-            xmm1 += xmm3;
-         }
-
-         if( i+2UL <= M )
-         {
-            xmm1 += tmp.load(k,i,0UL);
-            SIMDTrait_t<ET> xmm2( tmp.load(k,i+1UL,0UL) );
-            size_t j( SIMDSIZE );
-
-            for( ; j<jpos; j+=SIMDSIZE ) {
-               xmm1 += tmp.load(k,i    ,j);
-               xmm2 += tmp.load(k,i+1UL,j);
-            }
-            for( ; remainder && j<N; ++j ) {
-               redux += tmp(k,i    ,j);
-               redux += tmp(k,i+1UL,j);
-            }
-
-            xmm1 += xmm2;
-
-            i += 2UL;
-         }
-
-         if( i < M )
-         {
-            xmm1 += tmp.load(k,i,0UL);
-            size_t j( SIMDSIZE );
-
-            for( ; j<jpos; j+=SIMDSIZE ) {
-               xmm1 += tmp.load(k,i,j);
-            }
-            for( ; remainder && j<N; ++j ) {
-               redux += tmp(k,i,j);
-            }
-         }
-
-         redux += sum( xmm1 );
-         xmm1 = SIMDTrait_t<ET>{};
-      }
-   }
-   else
-   {
-      for( size_t k=0UL; k<O; ++k ) {
-         for( size_t i=0UL; i<M; ++i ) {
-            for( size_t j=0UL; j<N; ++j ) {
-               redux += tmp(k,i,j);
-            }
-         }
-      }
-   }
+   BLAZE_INTERNAL_ASSERT( tmp.pages()   == O, "Invalid number of pages"   );
 
-   return redux;
+   const bool parallel( O*M*N >= SMP_DTENSREDUCE_THRESHOLD );
 
+   return smpReduce<ET>( O*M, parallel, op, [&]( size_t begin, size_t end ) {
+      return dtensreduceRows( tmp, op, begin, end );
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3090,7 +3742,9 @@ inline auto dtensreduce( const DenseTensor<MT>& dm, Add /*op*/ )
 //
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
-// operation is undefined if the given reduction operation modifies the values.
+// operation is undefined if the given reduction operation modifies the values. For large
+// tensors the reduction is executed in parallel. In case the BLAZE_USE_DETERMINISTIC_REDUCTION
+// switch is activated, the evaluation order is fixed and does not depend on the number of threads.
 */
 template< typename MT    // Type of the dense tensor
         , typename OP >  // Type of the reduction operation
@@ -3131,32 +3785,28 @@ inline const DTensReduceExpr<MT,OP,RF> reduce_backend( const DenseTensor<MT>& dm
 // \param op The reduction operation.
 // \return The result of the reduction operation.
 //
-// This function reduces the rows or columns of the given dense tensor \a dm by means of the
-// given reduction operation \a op. In case the reduction flag \a RF is set to \a blaze::columnwise,
-// the elements of the tensor are reduced column-wise and the result is a row tensor. In case
-// \a RF is set to \a blaze::rowwise, the elements of the tensor are reduced row-wise and the
-// result is a column tensor:
+// This function reduces the columns, rows or pages of the given \f$ O \times M \times N \f$
+// dense tensor \a dm by means of the given reduction operation \a op. The result is a row-major
+// matrix, whose shape depends on the reduction flag \a RF:
+//
+//  - \a blaze::columnwise: the elements of each column of each page are reduced, i.e. the
+//    result is an \f$ O \times N \f$ matrix with \f$ R(k,j) = op_i( A(k,i,j) ) \f$.
+//  - \a blaze::rowwise: the elements of each row of each page are reduced, i.e. the result is
+//    an \f$ O \times M \f$ matrix with \f$ R(k,i) = op_j( A(k,i,j) ) \f$.
+//  - \a blaze::pagewise: the elements of each (row,column) position are reduced across all
+//    pages, i.e. the result is an \f$ M \times N \f$ matrix with \f$ R(i,j) = op_k( A(k,i,j) ) \f$.
 
    \code
    using blaze::columnwise;
+   using blaze::pagewise;
 
    blaze::DynamicTensor<double> A;
-   blaze::DynamicMatrix<double,rowMatrix> colsum1, colsum2;
+   blaze::DynamicMatrix<double> colsum1, colsum2, pagesum;
    // ... Resizing and initialization
 
    colsum1 = reduce<columnwise>( A, blaze::Add() );
    colsum2 = reduce<columnwise>( A, []( double a, double b ){ return a + b; } );
-   \endcode
-
-   \code
-   using blaze::rowwise;
-
-   blaze::DynamicTensor<double> A;
-   blaze::DynamicMatrix<double,columnMatrix> rowsum1, rowsum2;
-   // ... Resizing and initialization
-
-   rowsum1 = reduce<rowwise>( A, blaze::Add() );
-   rowsum2 = reduce<rowwise>( A, []( double a, double b ){ return a + b; } );
+   pagesum = reduce<pagewise>( A, blaze::Add() );
    \endcode
 
 // As demonstrated in the examples it is possible to pass any binary callable as custom reduction
@@ -3217,28 +3867,23 @@ inline decltype(auto) sum( const DenseTensor<MT>& dm )
 // \param dm The given dense tensor for the reduction operation.
 // \return The result of the reduction operation.
 //
-// This function reduces the rows or columns of the given dense tensor \a dm by means of
-// addition. In case the reduction flag \a RF is set to \a blaze::columnwise, the elements of
-// the tensor are reduced column-wise and the result is a row tensor. In case \a RF is set to
-// \a blaze::rowwise, the elements of the tensor are reduced row-wise and the result is a
-// column tensor:
+// This function reduces the columns, rows or pages of the given dense tensor \a dm by means
+// of addition. In case the reduction flag \a RF is set to \a blaze::columnwise, the result is
+// an \f$ O \times N \f$ matrix, in case \a RF is set to \a blaze::rowwise the result is an
+// \f$ O \times M \f$ matrix, and in case \a RF is set to \a blaze::pagewise the result is an
+// \f$ M \times N \f$ matrix:
 
    \code
    using blaze::columnwise;
-
-   blaze::DynamicTensor<int> A{ { 1, 0, 2 }, { 1, 3, 4 } };
-   blaze::DynamicMatrix<int,rowMatrix> colsum;
-
-   colsum = sum<columnwise>( A );  // Results in ( 2, 3, 6 )
-   \endcode
-
-   \code
    using blaze::rowwise;
+   using blaze::pagewise;
 
-   blaze::DynamicTensor<int> A{ { 1, 0, 2 }, { 1, 3, 4 } };
-   blaze::DynamicMatrix<int,columnMatrix> rowsum;
+   blaze::DynamicTensor<int> A{ { { 1, 0, 2 }, { 1, 3, 4 } }, { { 2, 1, 0 }, { 0, 1, 2 } } };
+   blaze::DynamicMatrix<int> colsum, rowsum, pagesum;
 
-   rowsum = sum<rowwise>( A );  // Results in ( 3, 8 )
+   colsum  = sum<columnwise>( A );  // Results in ( ( 2 3 6 ) ( 2 2 2 ) )
+   rowsum  = sum<rowwise>( A );     // Results in ( ( 3 8 ) ( 3 3 ) )
+   pagesum = sum<pagewise>( A );    // Results in ( ( 3 1 2 ) ( 1 4 6 ) )
    \endcode
 
 // Please note that the evaluation order of the reduction operation is unspecified.
@@ -3288,28 +3933,23 @@ inline decltype(auto) prod( const DenseTensor<MT>& dm )
 // \param dm The given dense tensor for the reduction operation.
 // \return The result of the reduction operation.
 //
-// This function reduces the rows or columns of the given dense tensor \a dm by means of
-// multiplication. In case the reduction flag \a RF is set to \a blaze::columnwise, the elements
-// of the tensor are reduced column-wise and the result is a row tensor. In case \a RF is set to
-// \a blaze::rowwise, the elements of the tensor are reduced row-wise and the result is a column
-// tensor:
+// This function reduces the columns, rows or pages of the given dense tensor \a dm by means
+// of multiplication. In case the reduction flag \a RF is set to \a blaze::columnwise, the
+// result is an \f$ O \times N \f$ matrix, in case \a RF is set to \a blaze::rowwise the result
+// is an \f$ O \times M \f$ matrix, and in case \a RF is set to \a blaze::pagewise the result is
+// an \f$ M \times N \f$ matrix:
 
    \code
    using blaze::columnwise;
-
-   blaze::DynamicTensor<int> A{ { 1, 0, 2 }, { 1, 3, 4 } };
-   blaze::DynamicMatrix<int,rowMatrix> colprod;
-
-   colprod = prod<columnwise>( A );  // Results in ( 1, 0, 8 )
-   \endcode
-
-   \code
    using blaze::rowwise;
+   using blaze::pagewise;
 
-   blaze::DynamicTensor<int> A{ { 1, 0, 2 }, { 1, 3, 4 } };
-   blaze::DynamicMatrix<int,columnMatrix> rowprod;
+   blaze::DynamicTensor<int> A{ { { 1, 0, 2 }, { 1, 3, 4 } }, { { 2, 1, 3 }, { 1, 1, 2 } } };
+   blaze::DynamicMatrix<int> colprod, rowprod, pageprod;
 
-   rowprod = prod<rowwise>( A );  // Results in ( 0, 12 )
+   colprod  = prod<columnwise>( A );  // Results in ( ( 1 0 8 ) ( 2 1 6 ) )
+   rowprod  = prod<rowwise>( A );     // Results in ( ( 0 12 ) ( 6 2 ) )
+   pageprod = prod<pagewise>( A );    // Results in ( ( 2 0 6 ) ( 1 3 8 ) )
    \endcode
 
 // Please note that the evaluation order of the reduction operation is unspecified.
@@ -3354,33 +3994,30 @@ inline decltype(auto) min( const DenseTensor<MT>& dm )
 
 
 //*************************************************************************************************
-/*!\brief Returns the smallest element of each row/columns of the dense tensor.
+/*!\brief Returns the smallest element of each column/row/page of the dense tensor.
 // \ingroup dense_tensor
 //
 // \param dm The given dense tensor.
-// \return The smallest elements in each row/column.
+// \return The smallest elements in each column/row/page.
 //
-// This function returns the smallest element of each row/column of the given dense tensor \a dm.
-// In case the reduction flag \a RF is set to \a blaze::columnwise, a row tensor containing the
-// smallest element of each column is returned. In case \a RF is set to \a blaze::rowwise, a
-// column tensor containing the smallest element of each row is returned.
+// This function returns the smallest element of each column, row or page of the given dense
+// tensor \a dm. In case the reduction flag \a RF is set to \a blaze::columnwise, an
+// \f$ O \times N \f$ matrix containing the smallest element of each column is returned. In
+// case \a RF is set to \a blaze::rowwise, an \f$ O \times M \f$ matrix containing the smallest
+// element of each row is returned. In case \a RF is set to \a blaze::pagewise, an
+// \f$ M \times N \f$ matrix containing the smallest element across all pages is returned.
 
    \code
    using blaze::columnwise;
-
-   blaze::DynamicTensor<int> A{ { 1, 0, 2 }, { 1, 3, 4 } };
-   blaze::DynamicMatrix<int,rowMatrix> colmin;
-
-   colmin = min<columnwise>( A );  // Results in ( 1, 0, 2 )
-   \endcode
-
-   \code
    using blaze::rowwise;
+   using blaze::pagewise;
 
-   blaze::DynamicTensor<int> A{ { 1, 0, 2 }, { 1, 3, 4 } };
-   blaze::DynamicMatrix<int,columnMatrix> rowmin;
+   blaze::DynamicTensor<int> A{ { { 1, 0, 2 }, { 1, 3, 4 } }, { { 2, 1, 0 }, { 0, 1, 2 } } };
+   blaze::DynamicMatrix<int> colmin, rowmin, pagemin;
 
-   rowmin = min<rowwise>( A );  // Results in ( 0, 1 )
+   colmin  = min<columnwise>( A );  // Results in ( ( 1 0 2 ) ( 0 1 0 ) )
+   rowmin  = min<rowwise>( A );     // Results in ( ( 0 1 ) ( 0 0 ) )
+   pagemin = min<pagewise>( A );    // Results in ( ( 1 0 0 ) ( 0 1 2 ) )
    \endcode
 */
 template< size_t RF    // Reduction flag
@@ -3423,33 +4060,30 @@ inline decltype(auto) max( const DenseTensor<MT>& dm )
 
 
 //*************************************************************************************************
-/*!\brief Returns the largest element of each row/columns of the dense tensor.
+/*!\brief Returns the largest element of each column/row/page of the dense tensor.
 // \ingroup dense_tensor
 //
 // \param dm The given dense tensor.
-// \return The largest elements in each row/column.
+// \return The largest elements in each column/row/page.
 //
-// This function returns the largest element of each row/column of the given dense tensor \a dm.
-// In case the reduction flag \a RF is set to \a blaze::columnwise, a row tensor containing the
-// largest element of each column is returned. In case \a RF is set to \a blaze::rowwise, a
-// column tensor containing the largest element of each row is returned.
+// This function returns the largest element of each column, row or page of the given dense
+// tensor \a dm. In case the reduction flag \a RF is set to \a blaze::columnwise, an
+// \f$ O \times N \f$ matrix containing the largest element of each column is returned. In
+// case \a RF is set to \a blaze::rowwise, an \f$ O \times M \f$ matrix containing the largest
+// element of each row is returned. In case \a RF is set to \a blaze::pagewise, an
+// \f$ M \times N \f$ matrix containing the largest element across all pages is returned.
 
    \code
    using blaze::columnwise;
-
-   blaze::DynamicTensor<int> A{ { 1, 0, 2 }, { 1, 3, 4 } };
-   blaze::DynamicMatrix<int,rowMatrix> colmax;
-
-   colmax = max<columnwise>( A );  // Results in ( 1, 3, 4 )
-   \endcode
-
-   \code
    using blaze::rowwise;
+   using blaze::pagewise;
 
-   blaze::DynamicTensor<int> A{ { 1, 0, 2 }, { 1, 3, 4 } };
-   blaze::DynamicMatrix<int,columnMatrix> rowmax;
+   blaze::DynamicTensor<int> A{ { { 1, 0, 2 }, { 1, 3, 4 } }, { { 2, 1, 0 }, { 0, 1, 2 } } };
+   blaze::DynamicMatrix<int> colmax, rowmax, pagemax;
 
-   rowmax = max<rowwise>( A );  // Results in ( 2, 4 )
+   colmax  = max<columnwise>( A );  // Results in ( ( 1 3 4 ) ( 2 1 2 ) )
+   rowmax  = max<rowwise>( A );     // Results in ( ( 2 4 ) ( 2 2 ) )
+   pagemax = max<pagewise>( A );    // Results in ( ( 2 1 2 ) ( 1 3 4 ) )
    \endcode
 */
 template< size_t RF    // Reduction flag
@@ -0,0 +1,939 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/expressions/DTensScanExpr.h
+//  \brief Header file for the dense tensor scan expression
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSSCANEXPR_H_
+#define _BLAZE_TENSOR_MATH_EXPRESSIONS_DTENSSCANEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/constraints/DenseTensor.h>
+#include <blaze_tensor/math/dense/Scan.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+#include <blaze_tensor/math/expressions/DTensReduceExpr.h>
+#include <blaze_tensor/math/expressions/TensScanExpr.h>
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SCAN KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Column-wise or page-wise scan of a block of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The dense tensor operand.
+// \param op The scan operation.
+// \param rbegin The first page (column-wise) or row (page-wise) to be computed.
+// \param rend The page or row behind the last page or row to be computed.
+// \param jbegin The first column to be computed (a multiple of the SIMD size).
+// \param jend The column behind the last column to be computed.
+// \return void
+//
+// Each row of the result is computed by combining the previous row of the result with the
+// next row of the operand along the scanned dimension (see scanOuter()).
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense tensor
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the scan operation
+inline auto dtensscanOuter( DenseTensor<MT>& C, const TT& A, OP op,
+                            size_t rbegin, size_t rend, size_t jbegin, size_t jend )
+   -> EnableIf_t< RF != rowwise >
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t L( RF == columnwise ? A.rows() : A.pages() );
+
+   for( size_t r=rbegin; r<rend; ++r )
+   {
+      const auto k = [r]( size_t l ) { return RF == columnwise ? r : l; };
+      const auto i = [r]( size_t l ) { return RF == columnwise ? l : r; };
+
+      scanOuter<ET>( L, jbegin, jend, op,
+         [&]( size_t l, auto j ) -> decltype(auto) { return A( k(l), i(l), j ); },
+         [&]( size_t l, auto j ) { return A.load( k(l), i(l), j ); },
+         [&]( size_t l, auto j ) -> decltype(auto) { return (~C)( k(l), i(l), j ); },
+         [&]( size_t l, auto j, const auto& xmm ) { (~C).store( k(l), i(l), j, xmm ); },
+         BoolConstant< UseVectorizedOuterScanKernel_v<MT,TT,OP> >() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-wise scan of a range of rows of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The dense tensor operand (with a non-empty row-wise dimension).
+// \param op The scan operation.
+// \param begin The first row to be computed.
+// \param end The row behind the last row to be computed.
+// \return void
+//
+// The rows are numbered consecutively across all pages. Each row is scanned by means of
+// scanRow().
+*/
+template< typename MT    // Type of the target dense tensor
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the scan operation
+inline void dtensscanInner( DenseTensor<MT>& C, const TT& A, OP op, size_t begin, size_t end )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   for( size_t r=begin; r<end; ++r )
+   {
+      const size_t k( r / M );
+      const size_t i( r % M );
+
+      scanRow<ET>( 0UL, N, nullptr, op,
+         [&]( auto j ) -> decltype(auto) { return A( k, i, j ); },
+         [&]( auto j ) { return A.load( k, i, j ); },
+         [&]( auto j ) -> decltype(auto) { return (~C)( k, i, j ); },
+         [&]( auto j, const auto& xmm ) { (~C).store( k, i, j, xmm ); },
+         BoolConstant< UseVectorizedInnerScanKernel_v<MT,TT,OP> >() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Two-pass parallel row-wise scan of a single row of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The dense tensor operand (with a non-empty row-wise dimension).
+// \param op The scan operation.
+// \param k The page index of the row.
+// \param i The row index of the row.
+// \param tasks The number of parallel tasks.
+// \return void
+//
+// The row is split into blocks of full SIMD vectors, which are scanned in parallel by means of
+// blockScan().
+*/
+template< typename MT    // Type of the target dense tensor
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the scan operation
+inline void dtensscanBlocks( DenseTensor<MT>& C, const TT& A, OP op,
+                             size_t k, size_t i, size_t tasks )
+{
+   using ET  = ElementType_t<MT>;
+   using Tag = BoolConstant< UseVectorizedInnerScanKernel_v<MT,TT,OP> >;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const auto get  = [&]( auto j ) -> decltype(auto) { return A( k, i, j ); };
+   const auto load = [&]( auto j ) { return A.load( k, i, j ); };
+
+   blockScan<ET>( A.columns(), tasks, SIMDSIZE, op,
+      [&]( size_t jbegin, size_t jend ) {
+         return scanTotal<ET>( jbegin, jend, op, get, load, Tag() );
+      },
+      [&]( size_t jbegin, size_t jend, const ET* init ) {
+         scanRow<ET>( jbegin, jend, init, op, get, load,
+            [&]( auto j ) -> decltype(auto) { return (~C)( k, i, j ); },
+            [&]( auto j, const auto& xmm ) { (~C).store( k, i, j, xmm ); },
+            Tag() );
+      } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial column-wise or page-wise scan of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The dense tensor operand.
+// \param op The scan operation.
+// \return void
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense tensor
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the scan operation
+inline auto dtensscanAssign( DenseTensor<MT>& C, const TT& A, OP op )
+   -> EnableIf_t< RF != rowwise >
+{
+   dtensscanOuter<RF>( ~C, A, op, 0UL, ( RF == columnwise ? A.pages() : A.rows() ),
+                       0UL, A.columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial row-wise scan of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The dense tensor operand.
+// \param op The scan operation.
+// \return void
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense tensor
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the scan operation
+inline auto dtensscanAssign( DenseTensor<MT>& C, const TT& A, OP op )
+   -> EnableIf_t< RF == rowwise >
+{
+   dtensscanInner( ~C, A, op, 0UL, A.pages() * A.rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP column-wise or page-wise scan of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The dense tensor operand.
+// \param op The scan operation.
+// \return void
+//
+// The pages (column-wise) or rows (page-wise) of the tensor, which are scanned independently,
+// are distributed among the available threads. In case there are fewer of them than threads,
+// the columns are distributed in chunks of full SIMD vectors.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense tensor
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the scan operation
+inline auto smpDTensScanAssign( DenseTensor<MT>& C, const TT& A, OP op )
+   -> EnableIf_t< RF != rowwise >
+{
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_t<MT> >::size );
+
+   const size_t M( RF == columnwise ? A.pages() : A.rows() );
+   const size_t N( A.columns() );
+   const size_t tasks( smpTasks() );
+
+   if( tasks < 2UL || M*N < 2UL ) {
+      dtensscanAssign<RF>( ~C, A, op );
+   }
+   else if( M >= tasks ) {
+      const size_t rows( ( M + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*rows );
+         const size_t end  ( min( begin+rows, M ) );
+         if( begin < end )
+            dtensscanOuter<RF>( ~C, A, op, begin, end, 0UL, N );
+      } );
+   }
+   else {
+      const size_t columns( nextMultiple( ( N + tasks - 1UL ) / tasks, SIMDSIZE ) );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*columns );
+         const size_t end  ( min( begin+columns, N ) );
+         if( begin < end )
+            dtensscanOuter<RF>( ~C, A, op, 0UL, M, begin, end );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP row-wise scan of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param C The target dense tensor.
+// \param A The dense tensor operand (with a non-empty row-wise dimension).
+// \param op The scan operation.
+// \return void
+//
+// The rows of all pages of the tensor are distributed in contiguous ranges among the available
+// threads. In case there are fewer rows than threads, each row is scanned by all threads by
+// means of a two-pass block scan (see blockScan()).
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the target dense tensor
+        , typename TT    // Type of the dense tensor operand
+        , typename OP >  // Type of the scan operation
+inline auto smpDTensScanAssign( DenseTensor<MT>& C, const TT& A, OP op )
+   -> EnableIf_t< RF == rowwise >
+{
+   const size_t M( A.rows() );
+   const size_t rows( A.pages() * M );
+   const size_t tasks( smpTasks() );
+
+   if( tasks < 2UL ) {
+      dtensscanAssign<RF>( ~C, A, op );
+   }
+   else if( rows >= tasks ) {
+      const size_t chunk( ( rows + tasks - 1UL ) / tasks );
+      smpFor( tasks, [&]( size_t t ) {
+         const size_t begin( t*chunk );
+         const size_t end  ( min( begin+chunk, rows ) );
+         if( begin < end )
+            dtensscanInner( ~C, A, op, begin, end );
+      } );
+   }
+   else {
+      for( size_t r=0UL; r<rows; ++r ) {
+         dtensscanBlocks( ~C, A, op, r / M, r % M, tasks );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for prefix scan operations along a dimension of a dense tensor.
+// \ingroup dense_tensor_expression
+//
+// The DTensScanExpr class represents the compile time expression for inclusive prefix scans
+// (as for instance cumulative sums or products) along the dimension \a RF of a dense tensor.
+// The result has the same shape as the tensor operand.
+*/
+template< typename MT  // Type of the dense tensor
+        , typename OP  // Type of the scan operation
+        , size_t RF >  // Reduction flag
+class DTensScanExpr
+   : public TensScanExpr< DenseTensor< DTensScanExpr<MT,OP,RF> > >
+   , private Computation
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DTensScanExpr<MT,OP,RF>;          //!< Type of this DTensScanExpr instance.
+   using ResultType    = ResultType_t<MT>;                 //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_t<ResultType>;       //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;      //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;        //!< Resulting element type.
+   using ReturnType    = const ElementType;                //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;                 //!< Data type for composite expression templates.
+
+   //! Composite type of the dense tensor expression.
+   using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+
+   //! Data type of the scan operation.
+   using Operation = OP;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = MT::smpAssignable;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensScanExpr class.
+   //
+   // \param dm The tensor operand of the scan expression.
+   // \param op The scan operation.
+   */
+   explicit inline DTensScanExpr( const MT& dm, OP op ) noexcept
+      : dm_( dm )  // Dense tensor of the scan expression
+      , op_( op )  // The scan operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   //
+   // The element is computed by combining all elements of the operand along dimension \a RF up
+   // to and including the given element. For the evaluation of the entire tensor the optimized
+   // scan kernels are used instead.
+   */
+   inline ReturnType operator()( size_t k, size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( k < pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+      const size_t L( RF == columnwise ? i : ( RF == rowwise ? j : k ) );
+
+      ElementType value( dm_( RF == pagewise   ? 0UL : k,
+                              RF == columnwise ? 0UL : i,
+                              RF == rowwise    ? 0UL : j ) );
+
+      for( size_t l=1UL; l<=L; ++l ) {
+         value = op_( value, dm_( RF == pagewise   ? l : k,
+                                  RF == columnwise ? l : i,
+                                  RF == rowwise    ? l : j ) );
+      }
+
+      return value;
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid tensor access index.
+   */
+   inline ReturnType at( size_t k, size_t i, size_t j ) const {
+      if( k >= pages() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+      }
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(k,i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return dm_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return dm_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return dm_.pages();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense tensor operand.
+   //
+   // \return The dense tensor operand.
+   */
+   inline Operand operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the scan operation.
+   //
+   // \return A copy of the scan operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an aliasing effect is possible, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( dm_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return dm_.canSMPAssign() || ( pages() * rows() * columns() >= SMP_DTENSREDUCE_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   dm_;  //!< Dense tensor of the scan expression.
+   Operation op_;  //!< The scan operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense tensors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense tensor scan expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side scan expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense tensor scan
+   // expression to a dense tensor. Along the pages and rows, entire rows of the operand are
+   // accumulated in a vectorized fashion, along the columns each row is scanned in-register.
+   */
+   template< typename MT2 >  // Type of the target dense tensor
+   friend inline void assign( DenseTensor<MT2>& lhs, const DTensScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      if( rhs.pages() == 0UL || rhs.rows() == 0UL || rhs.columns() == 0UL ) {
+         return;
+      }
+
+      decltype(auto) A( dtensreduceOperand( rhs.dm_ ) );  // Evaluation of the dense tensor operand
+      dtensscanAssign<RF>( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense tensors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense tensor scan expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side scan expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense tensor
+   // scan expression to a dense tensor.
+   */
+   template< typename MT2 >  // Type of the target dense tensor
+   friend inline void addAssign( DenseTensor<MT2>& lhs, const DTensScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense tensors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense tensor scan expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side scan expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // tensor scan expression to a dense tensor.
+   */
+   template< typename MT2 >  // Type of the target dense tensor
+   friend inline void subAssign( DenseTensor<MT2>& lhs, const DTensScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense tensors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense tensor scan expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side scan expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a dense
+   // tensor scan expression to a dense tensor.
+   */
+   template< typename MT2 >  // Type of the target dense tensor
+   friend inline void schurAssign( DenseTensor<MT2>& lhs, const DTensScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to dense tensors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense tensor scan expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side scan expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense tensor scan
+   // expression to a dense tensor. The independent scans are distributed among the available
+   // threads; a single long row is scanned by all threads by means of a two-pass block scan.
+   */
+   template< typename MT2 >  // Type of the target dense tensor
+   friend inline void smpAssign( DenseTensor<MT2>& lhs, const DTensScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      if( rhs.pages() == 0UL || rhs.rows() == 0UL || rhs.columns() == 0UL ) {
+         return;
+      }
+      else if( !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+      }
+      else {
+         decltype(auto) A( smpDTensReduceOperand( rhs.dm_ ) );  // Evaluation of the dense tensor operand
+         smpDTensScanAssign<RF>( ~lhs, A, rhs.op_ );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense tensors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense tensor scan expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side scan expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // tensor scan expression to a dense tensor.
+   */
+   template< typename MT2 >  // Type of the target dense tensor
+   friend inline void smpAddAssign( DenseTensor<MT2>& lhs, const DTensScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense tensors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense tensor scan expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side scan expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // tensor scan expression to a dense tensor.
+   */
+   template< typename MT2 >  // Type of the target dense tensor
+   friend inline void smpSubAssign( DenseTensor<MT2>& lhs, const DTensScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense tensors***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a dense tensor scan expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side scan expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // dense tensor scan expression to a dense tensor.
+   */
+   template< typename MT2 >  // Type of the target dense tensor
+   friend inline void smpSchurAssign( DenseTensor<MT2>& lhs, const DTensScanExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+
+      const ResultType tmp( rhs );
+      smpSchurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_TENSOR_TYPE( MT );
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the inclusive prefix scan of the given dense tensor along the given dimension.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \param op The scan operation.
+// \return The prefix scan of the given tensor along dimension \a RF.
+//
+// This function returns an expression representing the inclusive prefix scan of the given
+// dense tensor \a dm along the dimension \a RF by means of the given binary operation \a op.
+// Each element of the result is the combination of all elements of \a dm along \a RF up to and
+// including the element itself. In case \a RF is set to \a blaze::columnwise, the rows are
+// scanned, in case \a RF is set to \a blaze::rowwise, the columns, and in case \a RF is set to
+// \a blaze::pagewise, the pages:
+
+   \code
+   using blaze::pagewise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 6 }, { 3, 4 } }, { { 5, 2 }, { 7, 0 } } };
+
+   // Results in ( ( ( 1 6 ) ( 3 4 ) ) ( ( 5 6 ) ( 7 4 ) ) )
+   blaze::DynamicTensor<int> B = scan<pagewise>( A, blaze::Max() );
+   \endcode
+
+// The operation \a op is required to be associative, since the evaluation of long rows may
+// split the scan into independently scanned blocks. For the scan operations \a blaze::Add and
+// \a blaze::Mult of single and double precision tensors, the scan along the columns is
+// performed in-register by means of SIMD operations.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense tensor
+        , typename OP >     // Type of the scan operation
+inline decltype(auto) scan( const DenseTensor<MT>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF < 3UL, "Invalid reduction flag" );
+
+   using ReturnType = const DTensScanExpr<MT,OP,RF>;
+   return ReturnType( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative sum of the given dense tensor along the given dimension.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The cumulative sum of the given tensor along dimension \a RF.
+//
+// This function returns an expression representing the cumulative sum of the given dense
+// tensor \a dm along the dimension \a RF (see scan()):
+
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 2, 3 }, { 4, 5, 6 } } };
+
+   // Results in ( ( ( 1 3 6 ) ( 4 9 15 ) ) )
+   blaze::DynamicTensor<int> B = cumsum<rowwise>( A );
+   \endcode
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT >     // Type of the dense tensor
+inline decltype(auto) cumsum( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<RF>( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cumulative product of the given dense tensor along the given dimension.
+// \ingroup dense_tensor
+//
+// \param dm The given dense tensor.
+// \return The cumulative product of the given tensor along dimension \a RF.
+//
+// This function returns an expression representing the cumulative product of the given dense
+// tensor \a dm along the dimension \a RF (see scan()):
+
+   \code
+   using blaze::columnwise;
+
+   blaze::DynamicTensor<int> A{ { { 1, 2, 3 }, { 4, 5, 6 } } };
+
+   // Results in ( ( ( 1 2 3 ) ( 4 10 18 ) ) )
+   blaze::DynamicTensor<int> B = cumprod<columnwise>( A );
+   \endcode
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT >     // Type of the dense tensor
+inline decltype(auto) cumprod( const DenseTensor<MT>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return scan<RF>( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,6 +42,7 @@
 //*************************************************************************************************
 
 #include <iterator>
+#include <utility>
 
 #include <blaze/math/Aliases.h>
 #include <blaze/math/Exception.h>
@@ -70,12 +71,14 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/typetraits/GetMemberType.h>
 
 #include <blaze_tensor/math/constraints/DenseTensor.h>
+#include <blaze_tensor/math/dense/Permutation.h>
 #include <blaze_tensor/math/expressions/DTensTransExprData.h>
 #include <blaze_tensor/math/expressions/DTensTransposer.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
@@ -90,6 +93,25 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the given compile time axis mapping leaves the column axis in place.
+// \ingroup dense_tensor_expression
+//
+// \return \a true for the compile time mappings {0,1,2} and {1,0,2}, \a false otherwise.
+//
+// Runtime mappings (i.e. an empty list of compile time arguments) always yield \a false.
+*/
+template< size_t... CTAs >  // Compile time axis mapping
+constexpr bool isColumnPreservingMapping() noexcept
+{
+   constexpr size_t indices[] = { CTAs..., 0UL };
+   return ( sizeof...( CTAs ) == 3UL && indices[2] == 2UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Expression object for dense tensor transpositions.
 // \ingroup dense_tensor_expression
@@ -100,7 +122,7 @@ namespace blaze {
 template< typename MT,        // Type of the dense tensor
           size_t... CTAs >    // Compile time arguments
 class DTensTransExpr
-   : public TensTransExpr< DenseTensor< DTensTransExpr<MT> > >
+   : public TensTransExpr< DenseTensor< DTensTransExpr<MT,CTAs...> > >
    , public DTensTransExprData<CTAs...>
    , private If< IsComputation_v<MT> >::template Type< Computation, Transformation >
 {
@@ -115,6 +137,15 @@ class DTensTransExpr
    BLAZE_CREATE_GET_TYPE_MEMBER_TYPE_TRAIT( GetConstIterator, ConstIterator, INVALID_TYPE );
    //**********************************************************************************************
 
+   //**Column preservation*************************************************************************
+   //! Compilation switch for compile time mappings that leave the column axis in place.
+   /*! In case the compile time axis mapping keeps the columns of the operand as columns of the
+       transposition, \a keepsColumns is set to 1 and the rows of the expression are contiguous
+       rows of the operand. In this case the expression forwards the iterators and the SIMD
+       access of its operand. Otherwise \a keepsColumns is set to 0. */
+   static constexpr bool keepsColumns = isColumnPreservingMapping<CTAs...>();
+   //**********************************************************************************************
+
    //**Serial evaluation strategy******************************************************************
    //! Compilation switch for the serial evaluation strategy of the transposition expression.
    /*! The \a useAssign compile time constant expression represents a compilation switch for
@@ -145,9 +176,26 @@ class DTensTransExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Permutation kernels*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the selection of the permutation kernels.
+   /*! In case the dense tensor operand does not require an intermediate evaluation and both the
+       target tensor and the operand provide low-level data access to elements of the same type,
+       the variable is set to 1 and the transposition is evaluated by the cache-blocked permutation
+       kernels. Otherwise the variable is set to 0 and the expression is evaluated via the
+       subscript operator. */
+   template< typename MT2 >
+   static constexpr bool UsePermutation_v = ( !useAssign && UsePermutationKernel_v<MT2,MT> );
+
+   //! Helper variable template for the selection of the parallel permutation kernels.
+   template< typename MT2 >
+   static constexpr bool UseSMPPermutation_v = ( MT2::smpAssignable && UsePermutation_v<MT2> );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
-   using This          = DTensTransExpr<MT>;          //!< Type of this DTensTransExpr instance.
+   using This          = DTensTransExpr<MT,CTAs...>;  //!< Type of this DTensTransExpr instance.
    using ResultType    = TransposeType_t<MT>;         //!< Result type for expression template evaluations.
    using OppositeType  = OppositeType_t<ResultType>;  //!< Result type with opposite storage order for expression template evaluations.
    using TransposeType = ResultType_t<MT>;            //!< Transpose type for expression template evaluations.
@@ -169,14 +217,256 @@ class DTensTransExpr
    //! Pointer to a non-constant transpose value.
    using Pointer = If_t< IsConst_v<MT> || !HasMutableDataAccess_v<MT>, ConstPointer, Pointer_t<MT> >;
 
+   //! Composite data type of the dense tensor expression.
+   using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+   //**********************************************************************************************
+
+   //**ElementIterator class definition************************************************************
+   /*!\brief Iterator over the elements of a row of a transposition that moves the column axis.
+   //
+   // In case the axis mapping moves the column axis of the operand, the elements of a row of
+   // the transposition are not contiguous in the operand. The ElementIterator therefore steps
+   // through the row by means of the subscript operator of the transposition expression.
+   */
+   class ElementIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = ElementType;                      //!< Type of the underlying elements.
+      using PointerType      = ElementType*;                     //!< Pointer return type.
+      using ReferenceType    = ElementType&;                     //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ElementIterator class.
+      //
+      // \param expr The transposition expression to be traversed.
+      // \param k The page index of the traversed row.
+      // \param i The index of the traversed row.
+      // \param j The initial column index.
+      */
+      explicit inline ElementIterator( const DTensTransExpr* expr, size_t k, size_t i, size_t j )
+         : expr_( expr )  // The traversed transposition expression
+         , k_   ( k    )  // Page index of the traversed row
+         , i_   ( i    )  // Index of the traversed row
+         , j_   ( j    )  // Current column index
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator**************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ElementIterator& operator+=( size_t inc ) {
+         j_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator***********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ElementIterator& operator-=( size_t dec ) {
+         j_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator*****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ElementIterator& operator++() {
+         ++j_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator****************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ElementIterator operator++( int ) {
+         return ElementIterator( expr_, k_, i_, j_++ );
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator*****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ElementIterator& operator--() {
+         --j_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator****************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ElementIterator operator--( int ) {
+         return ElementIterator( expr_, k_, i_, j_-- );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator*******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReturnType operator*() const {
+         return (*expr_)( k_, i_, j_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator*************************************************************************
+      /*!\brief Equality comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ElementIterator& rhs ) const {
+         return j_ == rhs.j_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator***********************************************************************
+      /*!\brief Inequality comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ElementIterator& rhs ) const {
+         return j_ != rhs.j_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator************************************************************************
+      /*!\brief Less-than comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ElementIterator& rhs ) const {
+         return j_ < rhs.j_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator*********************************************************************
+      /*!\brief Greater-than comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ElementIterator& rhs ) const {
+         return j_ > rhs.j_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator***************************************************************
+      /*!\brief Less-than comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ElementIterator& rhs ) const {
+         return j_ <= rhs.j_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator************************************************************
+      /*!\brief Greater-than comparison between two ElementIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ElementIterator& rhs ) const {
+         return j_ >= rhs.j_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator**********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ElementIterator& rhs ) const {
+         return static_cast<DifferenceType>( j_ ) - static_cast<DifferenceType>( rhs.j_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator*************************************************************************
+      /*!\brief Addition between an ElementIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ElementIterator operator+( const ElementIterator& it, size_t inc ) {
+         return ElementIterator( it.expr_, it.k_, it.i_, it.j_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator*************************************************************************
+      /*!\brief Addition between an integral value and an ElementIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ElementIterator operator+( size_t inc, const ElementIterator& it ) {
+         return ElementIterator( it.expr_, it.k_, it.i_, it.j_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator**********************************************************************
+      /*!\brief Subtraction between an ElementIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ElementIterator operator-( const ElementIterator& it, size_t dec ) {
+         return ElementIterator( it.expr_, it.k_, it.i_, it.j_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const DTensTransExpr* expr_;  //!< The traversed transposition expression.
+      size_t                k_;     //!< Page index of the traversed row.
+      size_t                i_;     //!< Index of the traversed row.
+      size_t                j_;     //!< Current column index.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Iterator type definitions*******************************************************************
    //! Iterator over the elements of the dense tensor.
-   using ConstIterator = GetConstIterator_t<MT>;
+   using ConstIterator = If_t< keepsColumns, GetConstIterator_t<MT>, ElementIterator >;
 
    //! Iterator over non-constant elements.
-   using Iterator = If_t< IsConst_v<MT>, ConstIterator, GetIterator_t<MT> >;
-
-   //! Composite data type of the dense tensor expression.
-   using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
+   using Iterator = If_t< IsConst_v<MT> || !keepsColumns, ConstIterator, GetIterator_t<MT> >;
    //**********************************************************************************************
 
    //**Utility functions***************************************************************************
@@ -194,7 +484,7 @@ class DTensTransExpr
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = ( keepsColumns && MT::simdEnabled );
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -254,6 +544,26 @@ class DTensTransExpr
    }
    //**********************************************************************************************
 
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the tensor.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed values.
+   //
+   // This function is only available for compile time axis mappings that leave the column axis
+   // in place, in which case the SIMD elements of a row are loaded directly from the operand.
+   */
+   BLAZE_ALWAYS_INLINE auto load( size_t k, size_t i, size_t j ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( k < pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( j % SIMDSIZE == 0UL, "Invalid column access index" );
+      return dm_.load( reverse_page(k, i, j), reverse_row(k, i, j), j );
+   }
+   //**********************************************************************************************
+
    //**Low-level data access***********************************************************************
    /*!\brief Low-level data access to the tensor elements.
    //
@@ -282,7 +592,7 @@ class DTensTransExpr
    // \return Iterator to the first non-zero element of row/column \a i.
    */
    inline ConstIterator begin( size_t i, size_t k ) const {
-      return ConstIterator( dm_.begin( reverse_row(k, i, 0), reverse_page(k, i, 0) ) );
+      return begin( i, k, BoolConstant<keepsColumns>() );
    }
    //**********************************************************************************************
 
@@ -293,7 +603,7 @@ class DTensTransExpr
    // \return Iterator just past the last non-zero element of row/column \a i.
    */
    inline ConstIterator end( size_t i, size_t k ) const {
-      return ConstIterator( dm_.end( reverse_row(k, i, 0), reverse_page(k, i, 0) ) );
+      return end( i, k, BoolConstant<keepsColumns>() );
    }
    //**********************************************************************************************
 
@@ -417,6 +727,89 @@ class DTensTransExpr
    Operand dm_;  //!< Dense tensor of the transposition expression.
    //**********************************************************************************************
 
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first element of row \a i of page \a k.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return Iterator to the first element of row \a i, forwarded from the operand.
+   */
+   inline ConstIterator begin( size_t i, size_t k, TrueType ) const {
+      return ConstIterator( dm_.begin( reverse_row(k, i, 0), reverse_page(k, i, 0) ) );
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first element of row \a i of page \a k.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return Iterator to the first element of row \a i, stepping through the operand.
+   */
+   inline ConstIterator begin( size_t i, size_t k, FalseType ) const {
+      return ConstIterator( this, k, i, 0UL );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last element of row \a i of page \a k.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return Iterator just past the last element of row \a i, forwarded from the operand.
+   */
+   inline ConstIterator end( size_t i, size_t k, TrueType ) const {
+      return ConstIterator( dm_.end( reverse_row(k, i, 0), reverse_page(k, i, 0) ) );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last element of row \a i of page \a k.
+   //
+   // \param i The row index.
+   // \param k The page index.
+   // \return Iterator just past the last element of row \a i, stepping through the operand.
+   */
+   inline ConstIterator end( size_t i, size_t k, FalseType ) const {
+      return ConstIterator( this, k, i, columns() );
+   }
+   //**********************************************************************************************
+
+   //**Permutation function************************************************************************
+   /*!\brief Returns the axis mapping in the form expected by the permutation kernels.
+   //
+   // \return The compile time axis mapping as index sequence or the runtime axis mapping.
+   //
+   // Compile time axis mappings are passed to the permutation kernels as index sequence, which
+   // selects the kernel for the specific mapping at compile time.
+   */
+   inline decltype(auto) permutation() const noexcept {
+      return permutation( std::index_sequence<CTAs...>() );
+   }
+   //**********************************************************************************************
+
+   //**Permutation function************************************************************************
+   /*!\brief Returns the runtime axis mapping of the transposition.
+   //
+   // \return The runtime axis mapping.
+   */
+   inline decltype(auto) permutation( std::index_sequence<> ) const noexcept {
+      return idces();
+   }
+   //**********************************************************************************************
+
+   //**Permutation function************************************************************************
+   /*!\brief Returns the compile time axis mapping of the transposition.
+   //
+   // \param seq The compile time axis mapping.
+   // \return The compile time axis mapping.
+   */
+   template< size_t... Is >
+   inline std::index_sequence<Is...> permutation( std::index_sequence<Is...> seq ) const noexcept {
+      return seq;
+   }
+   //**********************************************************************************************
+
    //**Assignment to dense tensors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense tensor transposition expression to a dense tensor.
@@ -447,6 +840,36 @@ class DTensTransExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Assignment to dense tensors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense tensor transposition expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense tensor
+   // transposition expression to a dense tensor by means of the cache-blocked permutation
+   // kernels. Due to the explicit application of the SFINAE principle, this function can
+   // only be selected by the compiler in case both the target tensor and the operand provide
+   // low-level data access.
+   */
+   template< typename MT2 > // Type of the target dense tensor
+   friend inline EnableIf_t< UsePermutation_v<MT2> >
+      assign( DenseTensor<MT2>& lhs, const DTensTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      permute( ~lhs, rhs.dm_, rhs.permutation() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse tensors***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense tensor transposition expression to a sparse tensor.
@@ -625,6 +1048,41 @@ class DTensTransExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense tensors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense tensor transposition expression to a dense tensor.
+   // \ingroup dense_tensor
+   //
+   // \param lhs The target left-hand side dense tensor.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense tensor
+   // transposition expression to a dense tensor by means of the parallel permutation kernels.
+   // Due to the explicit application of the SFINAE principle, this function can only be
+   // selected by the compiler in case both the target tensor and the operand provide low-level
+   // data access.
+   */
+   template< typename MT2 > // Type of the target dense tensor
+   friend inline EnableIf_t< UseSMPPermutation_v<MT2> >
+      smpAssign( DenseTensor<MT2>& lhs, const DTensTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == rhs.pages()  , "Invalid number of pages"   );
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).canSMPAssign() && rhs.canSMPAssign() ) {
+         smpPermute( ~lhs, rhs.dm_, rhs.permutation() );
+      }
+      else {
+         permute( ~lhs, rhs.dm_, rhs.permutation() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse tensors***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a dense tensor transposition expression to a sparse tensor.
@@ -812,6 +1270,7 @@ template< size_t O            // Mapping index for page dimension
         , size_t M            // Mapping index for row dimension
         , size_t N            // Mapping index for column dimension
         , typename MT         // Type of the target dense tensor
+        , DisableIf_t< O == 0UL && M == 1UL && N == 2UL >* = nullptr
         , typename ... RTAs>  // Runtime arguments
 inline decltype(auto) trans( const DenseTensor<MT>& dm, RTAs... args )
 {
@@ -823,6 +1282,34 @@ inline decltype(auto) trans( const DenseTensor<MT>& dm, RTAs... args )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculation of the identity transpose of the given dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The dense tensor to be transposed.
+// \return The given dense tensor.
+//
+// The identity mapping \f$ (0,1,2) \f$ leaves all axes in place. Therefore this overload
+// does not create a transposition expression but returns the given dense tensor itself.
+*/
+template< size_t O            // Mapping index for page dimension
+        , size_t M            // Mapping index for row dimension
+        , size_t N            // Mapping index for column dimension
+        , typename MT         // Type of the target dense tensor
+        , EnableIf_t< O == 0UL && M == 1UL && N == 2UL >* = nullptr
+        , typename ... RTAs>  // Runtime arguments
+inline If_t< IsExpression_v<MT>, const MT, const MT& >
+   trans( const DenseTensor<MT>& dm, RTAs... )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ~dm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Calculation of the transpose of the given dense tensor.
 // \ingroup dense_tensor
@@ -947,15 +1434,53 @@ inline decltype(auto) trans( const DenseTensor<MT>& dm, std::initializer_list<T>
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Calculating the transpose of a transpose dense tensor.
+/*!\brief Calculating the compile time transpose of a compile time transpose dense tensor.
 // \ingroup dense_tensor
 //
 // \param dm The dense tensor to be (re-)transposed.
 // \return The transpose of the transpose tensor.
 //
 // This function implements a performance optimized treatment of the transpose operation on a
-// dense tensor transpose expression. It returns an expression representing the transpose of a
-// transpose dense tensor:
+// dense tensor transpose expression. Both axis mappings are combined at compile time into a
+// single mapping of the original operand. In case the combined mapping is the identity, e.g.
+// for a double swap of the same two axes, the original operand is returned:
+
+   \code
+   blaze::DynamicTensor<double> A, B;
+   // ... Resizing and initialization
+   B = trans<0UL, 2UL, 1UL>( trans<0UL, 2UL, 1UL>( A ) );  // Results in B = A
+   \endcode
+*/
+template< size_t O               // Mapping index for page dimension
+        , size_t M               // Mapping index for row dimension
+        , size_t N               // Mapping index for column dimension
+        , typename MT            // Type of the target dense tensor
+        , size_t A               // Page mapping index of the operand
+        , size_t B               // Row mapping index of the operand
+        , size_t C               // Column mapping index of the operand
+        , typename ... RTAs>     // Runtime arguments
+inline decltype(auto) trans( const DTensTransExpr<MT, A, B, C>& dm, RTAs... args )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using Data = DTensTransExprData<A, B, C>;
+   return trans< Data::idces()[O], Data::idces()[M], Data::idces()[N] >( dm.operand(), args... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating the compile time transpose of a runtime transpose dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The dense tensor to be (re-)transposed.
+// \return The transpose of the transpose tensor.
+//
+// This function implements a performance optimized treatment of the transpose operation on a
+// dense tensor transpose expression. It combines both axis mappings into a single runtime
+// mapping of the original operand:
 
    \code
    blaze::DynamicTensor<double> A, B;
@@ -967,14 +1492,15 @@ template< size_t O               // Mapping index for page dimension
         , size_t M               // Mapping index for row dimension
         , size_t N               // Mapping index for column dimension
         , typename MT            // Type of the target dense tensor
-        , size_t... CTAs         // Compile time arguments of source
         , typename ... RTAs>     // Runtime arguments
-inline decltype(auto) trans( const DTensTransExpr<MT, CTAs...>& dm, RTAs... args )
+inline decltype(auto) trans( const DTensTransExpr<MT>& dm, RTAs... args )
 {
    BLAZE_FUNCTION_TRACE;
 
-   using ReturnType = const DTensTransExpr<MT, O, M, N>;
-   return ReturnType( ~dm, args... );
+   const auto& inner( dm.idces() );
+   const size_t indices[] = { inner[O], inner[M], inner[N] };
+
+   return trans( dm.operand(), indices, 3UL, args... );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -982,31 +1508,70 @@ inline decltype(auto) trans( const DTensTransExpr<MT, CTAs...>& dm, RTAs... args
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Calculating the transpose of a transpose dense tensor.
+/*!\brief Calculating the runtime transpose of a transpose dense tensor.
 // \ingroup dense_tensor
 //
 // \param dm The dense tensor to be (re-)transposed.
+// \param indices Pointer to the first index of the axis mapping.
+// \param n The total number of indices.
 // \return The transpose of the transpose tensor.
+// \exception std::invalid_argument Invalid transposition indices.
 //
 // This function implements a performance optimized treatment of the transpose operation on a
-// dense tensor transpose expression. It returns an expression representing the transpose of a
-// transpose dense tensor:
+// dense tensor transpose expression. It combines both axis mappings into a single runtime
+// mapping of the original operand:
 
    \code
    blaze::DynamicTensor<double> A, B;
    // ... Resizing and initialization
-   B = trans( trans( A ), { 2UL, 0UL, 1UL } );
+   B = trans( trans<1UL, 0UL, 2UL>( A ), { 2UL, 0UL, 1UL } );
    \endcode
 */
 template< typename MT            // Type of the target dense tensor
         , size_t... CTAs         // Compile time arguments of source
-        , typename ... RTAs >     // Runtime arguments
-inline decltype(auto) trans( const DTensTransExpr<MT, CTAs...>& dm, RTAs... args )
+        , typename T             // Type of the element indices
+        , typename ... RTAs >    // Runtime arguments
+inline decltype(auto)
+   trans( const DTensTransExpr<MT, CTAs...>& dm, const T* indices, size_t n, RTAs... args )
 {
    BLAZE_FUNCTION_TRACE;
 
-   using ReturnType = const DTensTransExpr<MT, CTAs...>;
-   return ReturnType( ~dm, args... );
+   const auto outer( transpositionIndices<3UL>( indices, n ) );
+   const auto& inner( dm.idces() );
+   const size_t combined[] = { inner[outer[0]], inner[outer[1]], inner[outer[2]] };
+
+   return trans( dm.operand(), combined, 3UL, args... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating the default transpose of a transpose dense tensor.
+// \ingroup dense_tensor
+//
+// \param dm The dense tensor to be (re-)transposed.
+// \return The transpose of the transpose tensor.
+//
+// This function implements a performance optimized treatment of the transpose operation on a
+// dense tensor transpose expression. It combines the default mapping \f$ (2,1,0) \f$ with the
+// mapping of the given expression into a single mapping of the original operand:
+
+   \code
+   blaze::DynamicTensor<double> A, B;
+   // ... Resizing and initialization
+   B = trans( trans<2UL, 0UL, 1UL>( A ) );
+   \endcode
+*/
+template< typename MT            // Type of the target dense tensor
+        , size_t... CTAs >       // Compile time arguments of source
+inline decltype(auto) trans( const DTensTransExpr<MT, CTAs...>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t indices[] = { 2UL, 1UL, 0UL };
+   return trans( dm, indices, 3UL );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -1065,8 +1630,9 @@ struct HasConstDataAccess< DTensTransExpr<MT> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename MT > // Type of the target dense tensor
-struct IsAligned< DTensTransExpr<MT> >
+template< typename MT       // Type of the target dense tensor
+        , size_t... CTAs >  // Compile time arguments
+struct IsAligned< DTensTransExpr<MT,CTAs...> >
    : public IsAligned<MT>
 {};
 /*! \endcond */
@@ -1083,8 +1649,9 @@ struct IsAligned< DTensTransExpr<MT> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename MT > // Type of the target dense tensor
-struct IsPadded< DTensTransExpr<MT> >
+template< typename MT       // Type of the target dense tensor
+        , size_t... CTAs >  // Compile time arguments
+struct IsPadded< DTensTransExpr<MT,CTAs...> >
    : public IsPadded<MT>
 {};
 /*! \endcond */
@@ -58,6 +58,7 @@ template< typename > struct DenseTensor;
 
 template< typename > class DTensSerialExpr;
 template< typename, typename, bool > class DTensDMatSchurExpr;
+template< typename, typename, size_t > class DTensDMatTtmExpr;
 template< typename, typename > class DTensDTensAddExpr;
 template< typename, typename > class DTensDTensMultExpr;
 template< typename, typename > class DTensDTensSchurExpr;
@@ -76,8 +77,10 @@ template< typename > class DMatRavelExpr;
 
 template< typename, typename > class DArrMapExpr;
 template< typename, typename, typename > class DArrDArrMapExpr;
+template< typename, typename, typename > class DArrDArrBroadcastExpr;
 template< typename, typename > class DArrScalarMultExpr;
 template< typename, typename > class DArrScalarDivExpr;
+template< typename > class DArrTransExpr;
 
 
 template< typename TT1, typename TT2 >
@@ -98,6 +101,9 @@ decltype(auto) operator%( const DenseTensor<TT1>&, const DenseTensor<TT2>& );
 template< typename TT, typename MT, bool SO >
 decltype(auto) operator%(const DenseTensor<TT>&, const DenseMatrix<MT,SO>&);
 
+template< size_t MODE, typename TT, typename MT, bool SO >
+decltype(auto) ttm( const DenseTensor<TT>&, const DenseMatrix<MT,SO>& );
+
 
 template< size_t O, size_t M, size_t N, typename MT, typename ... RTAs>
 decltype(auto) trans( const DenseTensor<MT>& dm, RTAs... args );
@@ -133,6 +139,9 @@ decltype(auto) map( const DenseArray<TT>&, OP );
 template< typename TT1, typename TT2, typename OP >
 decltype(auto) map( const DenseArray<TT1>&, const DenseArray<TT2>&, OP );
 
+template< typename TT1, typename TT2, typename OP >
+decltype(auto) broadcast( const DenseArray<TT1>&, const DenseArray<TT2>&, OP );
+
 template< typename TT, typename OP >
 decltype(auto) reduce( const DenseTensor<TT>&, OP );
 
@@ -0,0 +1,296 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/ArrayRowAssign.h
+//  \brief Header file for the row-range assignment kernels of the SMP assignment of dense arrays
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_ARRAYROWASSIGN_H_
+#define _BLAZE_TENSOR_MATH_SMP_ARRAYROWASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/util/ArrayForEach.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise operation of the plain SMP assignment of dense arrays.
+// \ingroup smp
+//
+// The ArrayRowCopy functor returns the assigned value and ignores the current value of the
+// target. Passing it to the row-range kernels selects a store-only code path that does not
+// read the target array.
+*/
+struct ArrayRowCopy
+{
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE decltype(auto) operator()( const T1&, const T2& b ) const noexcept
+   {
+      return b;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY VARIABLE TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized row-range kernel.
+// \ingroup smp
+//
+// The vectorized kernel is selected in case the (compound) assignment operation is vectorizable
+// (\a SIMD), the target array provides direct access to its elements, and both operands are
+// SIMD-enabled with SIMD-combinable element types.
+*/
+template< bool SIMD      // Flag for a vectorizable assignment operation
+        , typename TT1   // Type of the left-hand side dense array
+        , typename TT2 > // Type of the right-hand side dense array
+constexpr bool UseVectorizedArrayRowAssign_v =
+   ( SIMD &&
+     HasMutableDataAccess_v<TT1> &&
+     TT1::simdEnabled && TT2::simdEnabled &&
+     IsSIMDCombinable_v< ElementType_t<TT1>, ElementType_t<TT2> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the given dense array.
+// \ingroup smp
+//
+// \param A The given dense array.
+// \return The total number of rows (the product of all but the innermost dimension).
+*/
+template< typename TT >  // Type of the dense array
+size_t arrayRows( const DenseArray<TT>& A )
+{
+   const auto& dims( (~A).dimensions() );
+
+   size_t rows( 1UL );
+   for( size_t d=1UL; d<dims.size(); ++d ) {
+      rows *= dims[d];
+   }
+
+   return rows;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROW-RANGE ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default (compound) assignment of a range of rows of a dense array to a dense array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side dense array.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \param op The element-wise operation combining the current and the assigned value.
+// \return void
+//
+// This function (compound) assigns the rows \f$[begin..end)\f$ of \a rhs to the according rows
+// of \a lhs. The rows are numbered consecutively in memory order across all outer dimensions of
+// the arrays, such that each row range is a contiguous part of the target array.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< bool SIMD      // Flag for a vectorizable assignment operation
+        , typename TT1   // Type of the left-hand side dense array
+        , typename TT2   // Type of the right-hand side dense array
+        , typename OP >  // Type of the element-wise operation
+auto arrayRowAssign( DenseArray<TT1>& lhs, const DenseArray<TT2>& rhs,
+                     size_t begin, size_t end, OP op )
+   -> DisableIf_t< UseVectorizedArrayRowAssign_v<SIMD,TT1,TT2> >
+{
+   constexpr size_t N( TT1::num_dimensions );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions(), "Invalid array sizes" );
+
+   const std::array<size_t,N>& dims( (~rhs).dimensions() );
+
+   const auto target = [&lhs]( auto... indices ) -> decltype(auto) { return (~lhs)( indices... ); };
+   const auto source = [&rhs]( auto... indices ) -> decltype(auto) { return (~rhs)( indices... ); };
+
+   constexpr bool copy( IsSame_v<OP,ArrayRowCopy> );
+
+   ArrayForEachRow( dims, 0UL, begin, end, [&]( size_t, std::array<size_t,N> const& indices ) {
+      for( size_t j=0UL; j<dims[0]; ++j ) {
+         auto& value( ArrayRowApply( target, indices, j ) );
+         if( copy )
+            value = ArrayRowApply( source, indices, j );
+         else
+            value = op( value, ArrayRowApply( source, indices, j ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized (compound) assignment of a range of rows of a dense array to a dense
+//        array.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense array.
+// \param rhs The right-hand side dense array.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \param op The element-wise operation combining the current and the assigned value.
+// \return void
+//
+// This function (compound) assigns the rows \f$[begin..end)\f$ of \a rhs to the according rows
+// of \a lhs. Each row is processed directly via the padded row spacing of the target array. In
+// case the rows of the target array are aligned, aligned loads and stores are used. In case
+// \a op is the ArrayRowCopy functor, the target array is only written and never read.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< bool SIMD      // Flag for a vectorizable assignment operation
+        , typename TT1   // Type of the left-hand side dense array
+        , typename TT2   // Type of the right-hand side dense array
+        , typename OP >  // Type of the element-wise operation
+auto arrayRowAssign( DenseArray<TT1>& lhs, const DenseArray<TT2>& rhs,
+                     size_t begin, size_t end, OP op )
+   -> EnableIf_t< UseVectorizedArrayRowAssign_v<SIMD,TT1,TT2> >
+{
+   using ET = ElementType_t<TT1>;
+
+   constexpr size_t N( TT1::num_dimensions );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+   constexpr bool remainder( !IsPadded_v<TT1> || !IsPadded_v<TT2> );
+   constexpr bool copy( IsSame_v<OP,ArrayRowCopy> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).dimensions() == (~rhs).dimensions(), "Invalid array sizes" );
+
+   const std::array<size_t,N>& dims( (~rhs).dimensions() );
+   const size_t spacing( (~lhs).spacing() );
+
+   const size_t jpos( ( remainder )?( dims[0] & size_t(-SIMDSIZE) ):( dims[0] ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( dims[0] - ( dims[0] % SIMDSIZE ) ) == jpos,
+                          "Invalid end calculation" );
+
+   const bool aligned( (~lhs).isAligned() && spacing % SIMDSIZE == 0UL );
+
+   const auto load   = [&rhs]( auto... indices ) { return (~rhs).load( indices... ); };
+   const auto source = [&rhs]( auto... indices ) -> decltype(auto) { return (~rhs)( indices... ); };
+
+   ET* const data( (~lhs).data() );
+
+   ArrayForEachRow( dims, spacing, begin, end,
+                    [&]( size_t i, std::array<size_t,N> const& indices ) {
+      ET* const row( data + i );
+      size_t j( 0UL );
+
+      if( copy && aligned ) {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            storea( row+j, ArrayRowApply( load, indices, j ) );
+         }
+      }
+      else if( copy ) {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            storeu( row+j, ArrayRowApply( load, indices, j ) );
+         }
+      }
+      else if( aligned ) {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            storea( row+j, op( loada( row+j ), ArrayRowApply( load, indices, j ) ) );
+         }
+      }
+      else {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            storeu( row+j, op( loadu( row+j ), ArrayRowApply( load, indices, j ) ) );
+         }
+      }
+      for( ; remainder && j<dims[0]; ++j ) {
+         row[j] = op( row[j], ArrayRowApply( source, indices, j ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -47,7 +47,7 @@
 #if BLAZE_HPX_PARALLEL_MODE
 #include <blaze_tensor/math/smp/hpx/DenseArray.h>
 #elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
-//#include <blaze_tensor/math/smp/threads/DenseArray.h>
+#include <blaze_tensor/math/smp/threads/DenseArray.h>
 #elif BLAZE_OPENMP_PARALLEL_MODE
 #include <blaze_tensor/math/smp/openmp/DenseArray.h>
 #else
@@ -0,0 +1,130 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/ParallelReduce.h
+//  \brief Header file for the parallel reduction of a range of partial results
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_PARALLELREDUCE_H_
+#define _BLAZE_TENSOR_MATH_SMP_PARALLELREDUCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+#include <blaze_tensor/math/smp/ParallelFor.h>
+#include <blaze_tensor/system/Optimizations.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel reduction of a range of work units.
+// \ingroup smp
+//
+// \param units The total number of work units (e.g. rows) to be reduced.
+// \param parallel \a true in case the reduction should be executed in parallel, \a false if not.
+// \param op The reduction operation used to combine two partial results.
+// \param kernel The serial kernel reducing a non-empty range \f$[begin..end)\f$ of work units.
+// \return The result of the reduction.
+//
+// This function splits the given range of work units into contiguous blocks, reduces each
+// block by means of the given serial \a kernel and combines the partial results of the blocks
+// pairwise in a fixed tree order ((0,1),(2,3),...), ((01,23),...). The blocks are distributed
+// among the threads of the active SMP backend via smpFor(). In case the deterministic reduction
+// mode is active (see BLAZE_USE_DETERMINISTIC_REDUCTION), the number of blocks only depends on
+// the number of work units, which makes the result independent of the number of threads.
+// Otherwise each thread computes a single block.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions.
+*/
+template< typename ET        // Type of the partial results
+        , typename OP        // Type of the reduction operation
+        , typename Kernel >  // Type of the serial reduction kernel
+ET smpReduce( size_t units, bool parallel, OP op, Kernel kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( units > 0UL, "Invalid number of work units" );
+
+   if( !parallel ) {
+      return kernel( 0UL, units );
+   }
+
+   const size_t tasks ( smpTasks() );
+   const size_t blocks( min( units, useDeterministicReduction ? DETERMINISTIC_REDUCTION_BLOCKS : tasks ) );
+
+   if( blocks < 2UL ) {
+      return kernel( 0UL, units );
+   }
+
+   std::unique_ptr<ET[]> partials( new ET[blocks] );
+
+   const size_t threads( min( tasks, blocks ) );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      const size_t bbegin( (  t     *blocks ) / threads );
+      const size_t bend  ( ( (t+1UL)*blocks ) / threads );
+
+      for( size_t b=bbegin; b<bend; ++b ) {
+         partials[b] = kernel( ( b*units ) / blocks, ( (b+1UL)*units ) / blocks );
+      }
+   } );
+
+   for( size_t stride=1UL; stride<blocks; stride*=2UL ) {
+      for( size_t b=0UL; b+stride<blocks; b+=2UL*stride ) {
+         partials[b] = op( partials[b], partials[b+stride] );
+      }
+   }
+
+   return partials[0UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -108,6 +108,70 @@ ThreadMapping createThreadMapping( size_t threads, const Tensor<MT>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Page-aware 3D mapping of threads.
+// \ingroup smp
+//
+// The first element specifies the number of threads along the pages, the second and third
+// element the number of threads along the rows and columns of a tensor, respectively.
+*/
+using TensorThreadMapping = std::tuple<size_t,size_t,size_t>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a page-aware 3D mapping of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped.
+// \param A The tensor the mapping is created for.
+// \return 3D mapping of the given number of threads.
+//
+// This function creates a 3D mapping of the given number of threads for the given tensor \a A.
+// The pages of the tensor are split first, such that each thread works on a contiguous range of
+// pages. From all divisors of \a threads that do not exceed the number of pages, the one that
+// distributes the pages most evenly (and, in case of a tie, the largest one) is chosen. Only the
+// remaining threads are distributed among the rows and columns of the tensor via the 2D mapping
+// of createThreadMapping(). Thus in case the tensor has at least as many pages as there are
+// threads, the work is split across pages only.
+*/
+template< typename MT >  // Type of the tensor
+TensorThreadMapping createTensorThreadMapping( size_t threads, const Tensor<MT>& A )
+{
+   const size_t O( (~A).pages() );
+
+   if( O >= threads ) {
+      return TensorThreadMapping( threads, 1UL, 1UL );
+   }
+
+   size_t o( 1UL );
+   double efficiency( 1.0 );
+
+   for( size_t p=2UL; p<=O; ++p )
+   {
+      if( threads % p != 0UL )
+         continue;
+
+      const size_t pagesPerThread( ( O + p - 1UL ) / p );
+      const double current( double(O) / double( p*pagesPerThread ) );
+
+      if( current >= efficiency ) {
+         o = p;
+         efficiency = current;
+      }
+   }
+
+   const ThreadMapping rest( createThreadMapping( threads / o, ~A ) );
+
+   return TensorThreadMapping( o, rest.first, rest.second );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
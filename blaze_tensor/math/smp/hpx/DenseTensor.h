@@ -44,6 +44,8 @@
 #include <hpx/include/parallel_executor_parameters.hpp>
 #include <hpx/include/parallel_for_loop.hpp>
 
+#include <tuple>
+
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/StorageOrder.h>
@@ -53,7 +55,6 @@
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
-#include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -66,7 +67,7 @@
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/smp/TensorThreadMapping.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
-#include <blaze_tensor/math/views/PageSlice.h>
+#include <blaze_tensor/math/views/Subtensor.h>
 
 namespace blaze {
 
@@ -86,8 +87,10 @@ namespace blaze {
 // \param op The (compound) assignment operation.
 // \return void
 //
-// This function is the backend implementation of the HPX-based SMP assignment of a dense
-// tensor to a dense tensor.\n
+// This function is the backend implementation of the HPX-based SMP assignment of a dense tensor to
+// a dense tensor. The tensor is partitioned via a page-aware 3D thread mapping (see
+// createTensorThreadMapping()), such that each thread is assigned a single block of contiguous
+// pages and, only in case there are fewer pages than threads, of rows and columns.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -112,57 +115,57 @@ void hpxAssign( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs, OP op )
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads    ( getNumThreads() );
-   const size_t numRows ( min( static_cast<std::size_t>( BLAZE_HPX_MATRIX_BLOCK_SIZE_ROW ), (~rhs).rows() ) );
-   const size_t numCols ( min( static_cast<std::size_t>( BLAZE_HPX_MATRIX_BLOCK_SIZE_COLUMN ), (~rhs).columns() ) );
+   const TensorThreadMapping threadmap( createTensorThreadMapping( getNumThreads(), ~rhs ) );
+
+   const size_t pageThreads( std::get<0>( threadmap ) );
+   const size_t rowThreads ( std::get<1>( threadmap ) );
+   const size_t colThreads ( std::get<2>( threadmap ) );
 
-   const size_t rowsPerIter( numRows );
-   const size_t addon1     ( ( ( (~rhs).rows() % rowsPerIter ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / rowsPerIter + addon1 );
+   const size_t addon0        ( ( ( (~rhs).pages() % pageThreads ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( (~rhs).pages() / pageThreads + addon0 );
 
-   const size_t rest2      ( numCols & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerIter( ( simdEnabled && rest2 )?( numCols - rest2 + SIMDSIZE ):( numCols ) );
-   const size_t addon2     ( ( ( (~rhs).columns() % colsPerIter ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / colsPerIter + addon2 );
+   const size_t addon1       ( ( ( (~rhs).rows() % rowThreads ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( (~rhs).rows() / rowThreads + addon1 );
 
-   hpx::parallel::execution::dynamic_chunk_size chunkSize ( BLAZE_HPX_MATRIX_CHUNK_SIZE );
+   const size_t addon2     ( ( ( (~rhs).columns() % colThreads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~rhs).columns() / colThreads + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-   for_loop( par.with( chunkSize ), size_t(0), equalShare1 * equalShare2, [&](size_t i)
+   const size_t blocks( pageThreads * rowThreads * colThreads );
+
+   for_loop( par, size_t(0), blocks, [&](size_t i)
    {
-      const size_t row   ( ( i / equalShare2 ) * rowsPerIter );
-      const size_t column( ( i % equalShare2 ) * colsPerIter );
+      const size_t page  ( ( i / ( rowThreads * colThreads ) ) * pagesPerThread );
+      const size_t row   ( ( ( i / colThreads ) % rowThreads ) * rowsPerThread );
+      const size_t column( ( i % colThreads ) * colsPerThread );
 
-      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
+      if( page >= (~rhs).pages() || row >= (~rhs).rows() || column >= (~rhs).columns() )
          return;
 
-      for (size_t k = 0; k != (~rhs).pages(); ++k)
-      {
-         const size_t m( min( rowsPerIter, (~rhs).rows()    - row    ) );
-         const size_t n( min( colsPerIter, (~rhs).columns() - column ) );
-
-         auto lhs_slice = pageslice( ~lhs, k );
-         auto rhs_slice = pageslice( ~rhs, k );
-
-         if( simdEnabled && lhsAligned && rhsAligned ) {
-            auto       target( submatrix<aligned>  ( ~lhs_slice, row, column, m, n ) );
-            const auto source( submatrix<aligned>  ( ~rhs_slice, row, column, m, n ) );
-            op( target, source );
-         }
-         else if( simdEnabled && lhsAligned ) {
-            auto       target( submatrix<aligned>  ( ~lhs_slice, row, column, m, n ) );
-            const auto source( submatrix<unaligned>( ~rhs_slice, row, column, m, n ) );
-            op( target, source );
-         }
-         else if( simdEnabled && rhsAligned ) {
-            auto       target( submatrix<unaligned>( ~lhs_slice, row, column, m, n ) );
-            const auto source( submatrix<aligned>  ( ~rhs_slice, row, column, m, n ) );
-            op( target, source );
-         }
-         else {
-            auto       target(submatrix<unaligned>(~lhs_slice, row, column, m, n ));
-            const auto source(submatrix<unaligned>(~rhs_slice, row, column, m, n ));
-            op(target, source);
-         }
+      const size_t o( min( pagesPerThread, (~rhs).pages()   - page   ) );
+      const size_t m( min( rowsPerThread,  (~rhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread,  (~rhs).columns() - column ) );
+
+      if( simdEnabled && lhsAligned && rhsAligned ) {
+         auto       target( subtensor<aligned>  ( ~lhs, page, row, column, o, m, n, unchecked ) );
+         const auto source( subtensor<aligned>  ( ~rhs, page, row, column, o, m, n, unchecked ) );
+         op( target, source );
+      }
+      else if( simdEnabled && lhsAligned ) {
+         auto       target( subtensor<aligned>  ( ~lhs, page, row, column, o, m, n, unchecked ) );
+         const auto source( subtensor<unaligned>( ~rhs, page, row, column, o, m, n, unchecked ) );
+         op( target, source );
+      }
+      else if( simdEnabled && rhsAligned ) {
+         auto       target( subtensor<unaligned>( ~lhs, page, row, column, o, m, n, unchecked ) );
+         const auto source( subtensor<aligned>  ( ~rhs, page, row, column, o, m, n, unchecked ) );
+         op( target, source );
+      }
+      else {
+         auto       target( subtensor<unaligned>( ~lhs, page, row, column, o, m, n, unchecked ) );
+         const auto source( subtensor<unaligned>( ~rhs, page, row, column, o, m, n, unchecked ) );
+         op( target, source );
       }
    } );
 }
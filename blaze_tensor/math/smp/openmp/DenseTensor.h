@@ -41,6 +41,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <tuple>
+
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/StorageOrder.h>
@@ -51,7 +53,6 @@
 #include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
-#include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -64,7 +65,7 @@
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/smp/TensorThreadMapping.h>
 #include <blaze_tensor/math/typetraits/IsDenseTensor.h>
-#include <blaze_tensor/math/views/PageSlice.h>
+#include <blaze_tensor/math/views/Subtensor.h>
 
 namespace blaze {
 
@@ -84,8 +85,10 @@ namespace blaze {
 // \param op The (compound) assignment operation.
 // \return void
 //
-// This function is the backend implementation of the OpenMP-based SMP assignment of a dense
-// tensor to a dense tensor.\n
+// This function is the backend implementation of the OpenMP-based SMP assignment of a dense tensor
+// to a dense tensor. The tensor is partitioned via a page-aware 3D thread mapping (see
+// createTensorThreadMapping()), such that each thread is assigned a single block of contiguous
+// pages and, only in case there are fewer pages than threads, of rows and columns.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -109,56 +112,59 @@ void openmpAssign( DenseTensor<MT1>& lhs, const DenseTensor<MT2>& rhs, OP op )
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const int threads( omp_get_num_threads() );
-   const ThreadMapping threadmap( createThreadMapping( threads, ~rhs ) );
+   const size_t threads( omp_get_num_threads() );
+   const TensorThreadMapping threadmap( createTensorThreadMapping( threads, ~rhs ) );
+
+   const size_t pageThreads( std::get<0>( threadmap ) );
+   const size_t rowThreads ( std::get<1>( threadmap ) );
+   const size_t colThreads ( std::get<2>( threadmap ) );
+
+   const size_t addon0        ( ( ( (~rhs).pages() % pageThreads ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( (~rhs).pages() / pageThreads + addon0 );
 
-   const size_t addon1     ( ( ( (~rhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threadmap.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+   const size_t addon1       ( ( ( (~rhs).rows() % rowThreads ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( (~rhs).rows() / rowThreads + addon1 );
 
-   const size_t addon2     ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threadmap.second + addon2 );
+   const size_t addon2     ( ( ( (~rhs).columns() % colThreads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~rhs).columns() / colThreads + addon2 );
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
+   const size_t blocks( pageThreads * rowThreads * colThreads );
+
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0; i<threads; ++i )
+   for( int i=0; i<int(blocks); ++i )
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const size_t page  ( ( size_t(i) / ( rowThreads * colThreads ) ) * pagesPerThread );
+      const size_t row   ( ( ( size_t(i) / colThreads ) % rowThreads ) * rowsPerThread );
+      const size_t column( ( size_t(i) % colThreads ) * colsPerThread );
 
-      if( row >= (~rhs).rows() || column >= (~rhs).columns() )
+      if( page >= (~rhs).pages() || row >= (~rhs).rows() || column >= (~rhs).columns() )
          continue;
 
-      for (size_t k = 0; k != (~rhs).pages(); ++k)
-      {
-         const size_t m( min( rowsPerThread, (~rhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
-
-         auto lhs_slice = pageslice( ~lhs, k );
-         auto rhs_slice = pageslice( ~rhs, k );
-
-         if( simdEnabled && lhsAligned && rhsAligned ) {
-            auto       target( submatrix<aligned>  ( ~lhs_slice, row, column, m, n ) );
-            const auto source( submatrix<aligned>  ( ~rhs_slice, row, column, m, n ) );
-            op( target, source );
-         }
-         else if( simdEnabled && lhsAligned ) {
-            auto       target( submatrix<aligned>  ( ~lhs_slice, row, column, m, n ) );
-            const auto source( submatrix<unaligned>( ~rhs_slice, row, column, m, n ) );
-            op( target, source );
-         }
-         else if( simdEnabled && rhsAligned ) {
-            auto       target( submatrix<unaligned>( ~lhs_slice, row, column, m, n ) );
-            const auto source( submatrix<aligned>  ( ~rhs_slice, row, column, m, n ) );
-            op( target, source );
-         }
-         else {
-            auto       target( submatrix<unaligned>( ~lhs_slice, row, column, m, n ) );
-            const auto source( submatrix<unaligned>( ~rhs_slice, row, column, m, n ) );
-            op( target, source );
-         }
+      const size_t o( min( pagesPerThread, (~rhs).pages()   - page   ) );
+      const size_t m( min( rowsPerThread,  (~rhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread,  (~rhs).columns() - column ) );
+
+      if( simdEnabled && lhsAligned && rhsAligned ) {
+         auto       target( subtensor<aligned>  ( ~lhs, page, row, column, o, m, n, unchecked ) );
+         const auto source( subtensor<aligned>  ( ~rhs, page, row, column, o, m, n, unchecked ) );
+         op( target, source );
+      }
+      else if( simdEnabled && lhsAligned ) {
+         auto       target( subtensor<aligned>  ( ~lhs, page, row, column, o, m, n, unchecked ) );
+         const auto source( subtensor<unaligned>( ~rhs, page, row, column, o, m, n, unchecked ) );
+         op( target, source );
+      }
+      else if( simdEnabled && rhsAligned ) {
+         auto       target( subtensor<unaligned>( ~lhs, page, row, column, o, m, n, unchecked ) );
+         const auto source( subtensor<aligned>  ( ~rhs, page, row, column, o, m, n, unchecked ) );
+         op( target, source );
+      }
+      else {
+         auto       target( subtensor<unaligned>( ~lhs, page, row, column, o, m, n, unchecked ) );
+         const auto source( subtensor<unaligned>( ~rhs, page, row, column, o, m, n, unchecked ) );
+         op( target, source );
       }
    }
 }
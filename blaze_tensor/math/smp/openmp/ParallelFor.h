@@ -0,0 +1,119 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/openmp/ParallelFor.h
+//  \brief Header file for the OpenMP-based parallel loop SMP implementation
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_OPENMP_PARALLELFOR_H_
+#define _BLAZE_TENSOR_MATH_SMP_OPENMP_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of tasks a parallel loop should be split into.
+// \ingroup smp
+//
+// \return The maximum number of OpenMP threads (1 in case a serial section is active).
+*/
+inline size_t smpTasks()
+{
+   return ( isSerialSectionActive() || isParallelSectionActive() || omp_in_parallel() )
+          ?( 1UL )
+          :( static_cast<size_t>( omp_get_max_threads() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based implementation of the SMP loop over a range of tasks.
+// \ingroup smp
+//
+// \param tasks The number of tasks to be executed.
+// \param op The operation to be called for each task index in the range \f$[0..tasks)\f$.
+// \return void
+//
+// This function distributes the tasks of the given range dynamically among the OpenMP threads.
+// In case a serial section is active, in case the function is called from within a parallel
+// section, or in case there is only a single task, the tasks are executed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates and kernels.
+*/
+template< typename OP >  // Type of the task operation
+void smpFor( size_t tasks, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( tasks < 2UL || isSerialSectionActive() || isParallelSectionActive() || omp_in_parallel() ) {
+      for( size_t t=0UL; t<tasks; ++t ) {
+         op( t );
+      }
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      const int n( static_cast<int>( tasks ) );
+
+#pragma omp parallel for schedule(dynamic,1) shared( op )
+      for( int t=0; t<n; ++t ) {
+         op( static_cast<size_t>( t ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
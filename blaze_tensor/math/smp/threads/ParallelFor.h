@@ -0,0 +1,165 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/smp/threads/ParallelFor.h
+//  \brief Header file for the C++11 and Boost thread-based parallel loop SMP implementation
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_SMP_THREADS_PARALLELFOR_H_
+#define _BLAZE_TENSOR_MATH_SMP_THREADS_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Wrapper for a single task of a thread-based SMP loop.
+// \ingroup smp
+//
+// The ThreadBackend only accepts expression types as operands of scheduled tasks. This wrapper
+// encapsulates the task operation and the index of the task such that it can be handed to the
+// thread pool.
+*/
+template< typename OP >  // Type of the task operation
+struct SMPForTask
+   : public Expression< SMPForTask<OP> >
+{
+   //**Constructor*********************************************************************************
+   explicit inline SMPForTask( const OP& op, size_t task )
+      : op_  ( op   )  // The task operation
+      , task_( task )  // The index of the task
+   {}
+   //**********************************************************************************************
+
+   //**Execution function**************************************************************************
+   inline void run() const
+   {
+      op_( task_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   OP     op_;    //!< The task operation.
+   size_t task_;  //!< The index of the task.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of tasks a parallel loop should be split into.
+// \ingroup smp
+//
+// \return The number of available threads (1 in case a serial section is active).
+*/
+inline size_t smpTasks()
+{
+   return ( isSerialSectionActive() || isParallelSectionActive() )
+          ?( 1UL )
+          :( TheThreadBackend::size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based implementation of the SMP loop over a range of tasks.
+// \ingroup smp
+//
+// \param tasks The number of tasks to be executed.
+// \param op The operation to be called for each task index in the range \f$[0..tasks)\f$.
+// \return void
+//
+// This function schedules each task of the given range for execution by the thread pool and
+// waits for all of them to complete. In case a serial section is active, in case the function
+// is called from within a parallel section, or in case there is only a single task, the tasks
+// are executed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates and kernels.
+*/
+template< typename OP >  // Type of the task operation
+void smpFor( size_t tasks, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( tasks < 2UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      for( size_t t=0UL; t<tasks; ++t ) {
+         op( t );
+      }
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t t=0UL; t<tasks; ++t ) {
+         SMPForTask<OP> task( op, t );
+         TheThreadBackend::schedule( task, task, []( auto& target, const auto& ){ target.run(); } );
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,205 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/math/traits/TtmTrait.h
+//  \brief Header file for the ttm trait
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_MATH_TRAITS_TTMTRAIT_H_
+#define _BLAZE_TENSOR_MATH_TRAITS_TTMTRAIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/util/InvalidType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename, typename, size_t > struct TtmTrait;
+template< typename, typename, size_t, typename = void > struct TtmTraitEval1;
+template< typename, typename, size_t, typename = void > struct TtmTraitEval2;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< size_t MODE, typename T1, typename T2 >
+auto evalTtmTrait( T1&, T2& )
+   -> typename TtmTraitEval1<T1,T2,MODE>::Type;
+
+template< size_t MODE, typename T1, typename T2 >
+auto evalTtmTrait( const T1&, const T2& )
+   -> typename TtmTrait<T1,T2,MODE>::Type;
+
+template< size_t MODE, typename T1, typename T2 >
+auto evalTtmTrait( const volatile T1&, const volatile T2& )
+   -> typename TtmTrait<T1,T2,MODE>::Type;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Base template for the TtmTrait class.
+// \ingroup math_traits
+//
+// \section ttmtrait_general General
+//
+// The TtmTrait class template offers the possibility to select the resulting data type of the
+// mode-n multiplication of a tensor with a matrix (see the ttm() function). The extent of the
+// given mode of the tensor is replaced by the number of rows of the matrix, all other extents
+// are preserved. TtmTrait defines the nested type \a Type, which represents the resulting data
+// type of the operation. In case the given data types are not a tensor and a matrix type, the
+// resulting data type \a Type is set to \a INVALID_TYPE. Note that \a const and \a volatile
+// qualifiers and reference modifiers are generally ignored.
+//
+//
+// \section ttmtrait_specializations Creating custom specializations
+//
+// Per default, TtmTrait supports all dense tensor and dense matrix types of the Blaze library.
+// For all other data types it is possible to specialize the TtmTrait template. The following
+// example shows the according specialization for two dynamic operands:
+
+   \code
+   template< typename T1, typename T2, bool SO, size_t MODE >
+   struct TtmTrait< DynamicTensor<T1>, DynamicMatrix<T2,SO>, MODE >
+   {
+      using Type = DynamicTensor< MultTrait_t<T1,T2> >;
+   };
+   \endcode
+
+// \n \section ttmtrait_examples Examples
+//
+// The following example demonstrates the use of the TtmTrait template, where depending on the
+// given tensor and matrix types the resulting type is selected:
+
+   \code
+   // Mode-2 product of a static 2x3x4 tensor and a static 5x4 matrix: StaticTensor<int,2,3,5>
+   using TensorType1 = blaze::StaticTensor<int,2UL,3UL,4UL>;
+   using MatrixType1 = blaze::StaticMatrix<int,5UL,4UL>;
+   using ResultType1 = typename blaze::TtmTrait<TensorType1,MatrixType1,2UL>::Type;
+
+   // Mode-0 product of a static 2x3x4 tensor and a dynamic matrix: DynamicTensor<int>
+   using TensorType2 = blaze::StaticTensor<int,2UL,3UL,4UL>;
+   using MatrixType2 = blaze::DynamicMatrix<int>;
+   using ResultType2 = typename blaze::TtmTrait<TensorType2,MatrixType2,0UL>::Type;
+   \endcode
+*/
+template< typename T1    // Type of the tensor operand
+        , typename T2    // Type of the matrix operand
+        , size_t MODE >  // Mode of the multiplication
+struct TtmTrait
+{
+ public:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   using Type = decltype( evalTtmTrait<MODE>( std::declval<T1&>(), std::declval<T2&>() ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary alias declaration for the TtmTrait type trait.
+// \ingroup math_traits
+//
+// The TtmTrait_t alias declaration provides a convenient shortcut to access the nested \a Type
+// of the TtmTrait class template. For instance, given the tensor type \a TT and the matrix type
+// \a MT the following two type definitions are identical:
+
+   \code
+   using Type1 = typename blaze::TtmTrait<TT,MT,1UL>::Type;
+   using Type2 = blaze::TtmTrait_t<TT,MT,1UL>;
+   \endcode
+*/
+template< typename T1    // Type of the tensor operand
+        , typename T2    // Type of the matrix operand
+        , size_t MODE >  // Mode of the multiplication
+using TtmTrait_t = typename TtmTrait<T1,T2,MODE>::Type;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First auxiliary helper struct for the TtmTrait type trait.
+// \ingroup math_traits
+*/
+template< typename T1    // Type of the tensor operand
+        , typename T2    // Type of the matrix operand
+        , size_t MODE    // Mode of the multiplication
+        , typename >     // Restricting condition
+struct TtmTraitEval1
+{
+ public:
+   //**********************************************************************************************
+   using Type = typename TtmTraitEval2<T1,T2,MODE>::Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Second auxiliary helper struct for the TtmTrait type trait.
+// \ingroup math_traits
+*/
+template< typename T1    // Type of the tensor operand
+        , typename T2    // Type of the matrix operand
+        , size_t MODE    // Mode of the multiplication
+        , typename >     // Restricting condition
+struct TtmTraitEval2
+{
+ public:
+   //**********************************************************************************************
+   using Type = INVALID_TYPE;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
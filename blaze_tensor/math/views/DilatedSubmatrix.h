@@ -67,7 +67,6 @@
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
-#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
@@ -5334,42 +5333,6 @@ struct IsRestricted< DilatedSubmatrix<MT,SO,DF,CSAs...> >
 
 
 
-//=================================================================================================
-//
-//  HASCONSTDATAACCESS SPECIALIZATIONS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-template< typename MT, bool SO, size_t... CSAs >
-struct HasConstDataAccess< DilatedSubmatrix<MT,SO,true,CSAs...> >
-   : public HasConstDataAccess<MT>
-{};
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
-//=================================================================================================
-//
-//  HASMUTABLEDATAACCESS SPECIALIZATIONS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-template< typename MT, bool SO, size_t... CSAs >
-struct HasMutableDataAccess< DilatedSubmatrix<MT,SO,true,CSAs...> >
-   : public HasMutableDataAccess<MT>
-{};
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
 //=================================================================================================
 //
 //  ISSYMMETRIC SPECIALIZATIONS
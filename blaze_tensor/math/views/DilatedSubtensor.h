@@ -54,7 +54,6 @@
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
-#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
@@ -4463,42 +4462,6 @@ struct IsRestricted< DilatedSubtensor<TT,DF,CSAs...> >
 
 
 
-//=================================================================================================
-//
-//  HASCONSTDATAACCESS SPECIALIZATIONS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-template< typename TT, size_t... CSAs >
-struct HasConstDataAccess< DilatedSubtensor<TT,true,CSAs...> >
-   : public HasConstDataAccess<TT>
-{};
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
-//=================================================================================================
-//
-//  HASMUTABLEDATAACCESS SPECIALIZATIONS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-template< typename TT, size_t... CSAs >
-struct HasMutableDataAccess< DilatedSubtensor<TT,true,CSAs...> >
-   : public HasMutableDataAccess<TT>
-{};
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
 //=================================================================================================
 //
 //  ISSYMMETRIC SPECIALIZATIONS
@@ -59,8 +59,6 @@
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
-#include <blaze/math/typetraits/HasConstDataAccess.h>
-#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsRestricted.h>
 #include <blaze/math/typetraits/MaxSize.h>
 #include <blaze/math/typetraits/Size.h>
@@ -2392,42 +2390,6 @@ struct IsRestricted< DilatedSubvector<VT,TF,DF,CSAs...> >
 /*! \endcond */
 //*************************************************************************************************
 
-
-
-
-//=================================================================================================
-//
-//  HASCONSTDATAACCESS SPECIALIZATIONS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-template< typename VT, bool TF, size_t... CSAs >
-struct HasConstDataAccess< DilatedSubvector<VT,TF,true,CSAs...> >
-   : public HasConstDataAccess<VT>
-{};
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
-//=================================================================================================
-//
-//  HASMUTABLEDATAACCESS SPECIALIZATIONS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-template< typename VT, bool TF, size_t... CSAs >
-struct HasMutableDataAccess< DilatedSubvector<VT,TF,true,CSAs...> >
-   : public HasMutableDataAccess<VT>
-{};
-/*! \endcond */
-//*************************************************************************************************
-
 } // namespace blaze
 
 #endif
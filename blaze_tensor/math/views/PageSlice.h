@@ -432,7 +432,8 @@ inline decltype(auto) pageslice( const TensMatSchurExpr<TT>& tensor, RRAs... arg
 // \return View on the specified pageslice of the multiplication.
 //
 // This function returns an expression representing the specified pageslice of the given tensor/tensor
-// multiplication.
+// multiplication, i.e. the product of the corresponding pageslices of both operands. In case the
+// right-hand side operand consists of a single page, this page is used for all pageslices.
 */
 template< size_t... CRAs      // Compile time pageslice arguments
         , typename MT         // Tensor base type of the expression
@@ -441,7 +442,12 @@ inline decltype(auto) pageslice( const TensTensMultExpr<MT>& tensor, RRAs... arg
 {
    BLAZE_FUNCTION_TRACE;
 
-   return pageslice<CRAs...>( (~tensor).leftOperand(), args... ) * (~tensor).rightOperand();
+   decltype(auto) left( pageslice<CRAs...>( (~tensor).leftOperand(), args... ) );
+   decltype(auto) right( (~tensor).rightOperand() );
+
+   const size_t page( ( right.pages() == 1UL )?( 0UL ):( left.page() ) );
+
+   return left * pageslice( right, page, unchecked );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -43,6 +43,8 @@
 
 #include <blaze/math/views/row/Dense.h>
 #include <blaze/math/traits/SchurTrait.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
 
 #include <blaze_tensor/math/InitializerList.h>
 #include <blaze_tensor/math/constraints/DenseTensor.h>
@@ -574,17 +576,17 @@ class ColumnSlice
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
-   template< typename VT, bool SO >
-   inline auto assign( const DenseMatrix<VT,SO>& rhs );
+   template< typename MT2 > inline void assign( const DenseMatrix<MT2,rowMajor>&    rhs );
+   template< typename MT2 > inline void assign( const DenseMatrix<MT2,columnMajor>& rhs );
 
-   template< typename VT, bool SO >
-   inline auto addAssign( const DenseMatrix<VT,SO>& rhs );
+   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,rowMajor>&    rhs );
+   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,columnMajor>& rhs );
 
-   template< typename VT, bool SO >
-   inline auto subAssign( const DenseMatrix<VT,SO>& rhs );
+   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,rowMajor>&    rhs );
+   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,columnMajor>& rhs );
 
-   template< typename VT, bool SO >
-   inline auto schurAssign( const DenseMatrix<VT,SO>& rhs );
+   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,rowMajor>&    rhs );
+   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,columnMajor>& rhs );
    //@}
    //**********************************************************************************************
 
@@ -1699,7 +1701,7 @@ inline bool ColumnSlice<MT,CRAs...>::canSMPAssign() const noexcept
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the assignment of a dense matrix.
+/*!\brief Default implementation of the assignment of a row-major dense matrix.
 //
 // \param rhs The right-hand side dense matrix to be assigned.
 // \return void
@@ -1710,10 +1712,9 @@ inline bool ColumnSlice<MT,CRAs...>::canSMPAssign() const noexcept
 // assignment operator.
 */
 template< typename MT       // Type of the dense tensor
-        , size_t... CRAs >  // Compile time rowslice arguments
-template< typename VT       // Type of the right-hand side dense matrix
-        , bool SO >         // Storage order
-inline auto ColumnSlice<MT,CRAs...>::assign( const DenseMatrix<VT,SO>& rhs )
+        , size_t... CRAs >  // Compile time columnslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void ColumnSlice<MT,CRAs...>::assign( const DenseMatrix<MT2,rowMajor>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows(), "Invalid matrix sizes" );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid matrix sizes" );
@@ -1730,7 +1731,47 @@ inline auto ColumnSlice<MT,CRAs...>::assign( const DenseMatrix<VT,SO>& rhs )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the addition assignment of a dense matrix.
+/*!\brief Blocked implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// The elements of the dense columnslice are strided in both dimensions. In order to avoid
+// reading the column-major matrix with the stride of its columns, the matrix is traversed in
+// square blocks, which keeps the touched columns of the matrix in cache. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time columnslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void ColumnSlice<MT,CRAs...>::assign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t kk=0UL; kk<rows(); kk+=block ) {
+      const size_t kend( min( rows(), kk+block ) );
+      for( size_t ii=0UL; ii<columns(); ii+=block ) {
+         const size_t iend( min( columns(), ii+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t k=kk; k<kend; ++k ) {
+               tensor_(k,i,column()) = (~rhs)(k,i);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a row-major dense matrix.
 //
 // \param rhs The right-hand side dense matrix to be added.
 // \return void
@@ -1741,10 +1782,9 @@ inline auto ColumnSlice<MT,CRAs...>::assign( const DenseMatrix<VT,SO>& rhs )
 // assignment operator.
 */
 template< typename MT       // Type of the dense tensor
-        , size_t... CRAs >  // Compile time rowslice arguments
-template< typename VT       // Type of the right-hand side dense matrix
-        , bool SO >         // Storage order
-inline auto ColumnSlice<MT,CRAs...>::addAssign( const DenseMatrix<VT,SO>& rhs )
+        , size_t... CRAs >  // Compile time columnslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void ColumnSlice<MT,CRAs...>::addAssign( const DenseMatrix<MT2,rowMajor>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -1761,7 +1801,47 @@ inline auto ColumnSlice<MT,CRAs...>::addAssign( const DenseMatrix<VT,SO>& rhs )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+/*!\brief Blocked implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// The elements of the dense columnslice are strided in both dimensions. In order to avoid
+// reading the column-major matrix with the stride of its columns, the matrix is traversed in
+// square blocks, which keeps the touched columns of the matrix in cache. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time columnslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void ColumnSlice<MT,CRAs...>::addAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t kk=0UL; kk<rows(); kk+=block ) {
+      const size_t kend( min( rows(), kk+block ) );
+      for( size_t ii=0UL; ii<columns(); ii+=block ) {
+         const size_t iend( min( columns(), ii+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t k=kk; k<kend; ++k ) {
+               tensor_(k,i,column()) += (~rhs)(k,i);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
 //
 // \param rhs The right-hand side dense matrix to be subtracted.
 // \return void
@@ -1772,10 +1852,9 @@ inline auto ColumnSlice<MT,CRAs...>::addAssign( const DenseMatrix<VT,SO>& rhs )
 // assignment operator.
 */
 template< typename MT       // Type of the dense tensor
-        , size_t... CRAs >  // Compile time rowslice arguments
-template< typename VT       // Type of the right-hand side dense matrix
-        , bool SO >         // Storage order
-inline auto ColumnSlice<MT,CRAs...>::subAssign( const DenseMatrix<VT,SO>& rhs )
+        , size_t... CRAs >  // Compile time columnslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void ColumnSlice<MT,CRAs...>::subAssign( const DenseMatrix<MT2,rowMajor>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -1790,6 +1869,46 @@ inline auto ColumnSlice<MT,CRAs...>::subAssign( const DenseMatrix<VT,SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// The elements of the dense columnslice are strided in both dimensions. In order to avoid
+// reading the column-major matrix with the stride of its columns, the matrix is traversed in
+// square blocks, which keeps the touched columns of the matrix in cache. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time columnslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void ColumnSlice<MT,CRAs...>::subAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t kk=0UL; kk<rows(); kk+=block ) {
+      const size_t kend( min( rows(), kk+block ) );
+      for( size_t ii=0UL; ii<columns(); ii+=block ) {
+         const size_t iend( min( columns(), ii+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t k=kk; k<kend; ++k ) {
+               tensor_(k,i,column()) -= (~rhs)(k,i);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the Schur product assignment of a row-major dense matrix.
@@ -1803,10 +1922,9 @@ inline auto ColumnSlice<MT,CRAs...>::subAssign( const DenseMatrix<VT,SO>& rhs )
 // assignment operator.
 */
 template< typename MT       // Type of the dense tensor
-        , size_t... CRAs >  // Compile time rowslice arguments
-template< typename MT2      // Type of the right-hand side dense matrix
-        , bool SO >         // Storage order
-inline auto ColumnSlice<MT,CRAs...>::schurAssign( const DenseMatrix<MT2,SO>& rhs )
+        , size_t... CRAs >  // Compile time columnslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void ColumnSlice<MT,CRAs...>::schurAssign( const DenseMatrix<MT2,rowMajor>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -1821,6 +1939,46 @@ inline auto ColumnSlice<MT,CRAs...>::schurAssign( const DenseMatrix<MT2,SO>& rhs
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked implementation of the Schur product assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// The elements of the dense columnslice are strided in both dimensions. In order to avoid
+// reading the column-major matrix with the stride of its columns, the matrix is traversed in
+// square blocks, which keeps the touched columns of the matrix in cache. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time columnslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void ColumnSlice<MT,CRAs...>::schurAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t kk=0UL; kk<rows(); kk+=block ) {
+      const size_t kend( min( rows(), kk+block ) );
+      for( size_t ii=0UL; ii<columns(); ii+=block ) {
+         const size_t iend( min( columns(), ii+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t k=kk; k<kend; ++k ) {
+               tensor_(k,i,column()) *= (~rhs)(k,i);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 } // namespace blaze
 
 #endif
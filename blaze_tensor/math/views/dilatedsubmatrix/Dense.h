@@ -68,6 +68,7 @@
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
@@ -110,6 +111,7 @@
 #include <blaze/util/typetraits/IsReference.h>
 
 #include <blaze_tensor/math/constraints/DilatedSubmatrix.h>
+#include <blaze_tensor/math/dense/StridedSIMD.h>
 #include <blaze_tensor/math/traits/DilatedSubmatrixTrait.h>
 #include <blaze_tensor/math/views/dilatedsubmatrix/BaseTemplate.h>
 #include <blaze_tensor/math/views/dilatedsubmatrix/DilatedSubmatrixData.h>
@@ -330,6 +332,125 @@ class DilatedSubmatrix<MT,false,true,CSAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a load of the current SIMD element of the DilatedSubmatrix
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType load() const noexcept {
+         return loadu();
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an aligned load of the current SIMD element of the
+      // DilatedSubmatrix iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType loada() const noexcept {
+         return loadu();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned load of the current SIMD element of the
+      // DilatedSubmatrix iterator. In case the column dilation is 1 the elements are loaded
+      // directly, else they are gathered from the underlying tensor. This function must \b NOT
+      // be called explicitly! It is used internally for the performance optimized evaluation
+      // of expression templates. Calling this function explicitly might result in erroneous
+      // results and/or in compilation errors.
+      */
+      inline SIMDType loadu() const noexcept {
+         if( columndilation_ == 1UL )
+            return iterator_.loadu();
+         return loadStrided( &*iterator_, columndilation_ );
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a store of the current SIMD element of the DilatedSubmatrix
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void store( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned store of the current SIMD element of the
+      // DilatedSubmatrix iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void storea( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned store of the current SIMD element of the
+      // DilatedSubmatrix iterator. In case the column dilation is 1 the elements are stored
+      // directly, else they are scattered to the underlying tensor. This function must \b NOT
+      // be called explicitly! It is used internally for the performance optimized evaluation
+      // of expression templates. Calling this function explicitly might result in erroneous
+      // results and/or in compilation errors.
+      */
+      inline void storeu( const SIMDType& value ) const {
+         if( columndilation_ == 1UL )
+            iterator_.storeu( value );
+         else
+            storeStrided( &*iterator_, columndilation_, value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the elements of a DilatedSubmatrix are in general not aligned, this function
+      // performs a regular unaligned store. This function must \b NOT be called explicitly!
+      // It is used internally for the performance optimized evaluation of expression templates.
+      // Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      inline void stream( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
       //**Equality operator************************************************************************
       /*!\brief Equality comparison between two DilatedSubmatrixIterator objects.
       //
@@ -494,7 +615,7 @@ class DilatedSubmatrix<MT,false,true,CSAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = MT::simdEnabled && HasConstDataAccess_v<MT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -606,6 +727,51 @@ class DilatedSubmatrix<MT,false,true,CSAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDAdd_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDSub_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDMult_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -625,17 +791,46 @@ class DilatedSubmatrix<MT,false,true,CSAs...>
    inline bool isAligned() const noexcept { return false; }
    inline bool canSMPAssign() const noexcept;
 
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< !VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>& rhs );
    template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>& rhs );
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT2> >;
+
    template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,true>& rhs );
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,false>& rhs );
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT2> >;
+
    template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,true>& rhs );
-   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,true>& rhs );
 
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT2> >;
 
+   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,true>& rhs );
    //@}
    //**********************************************************************************************
 
@@ -2124,6 +2319,204 @@ inline bool DilatedSubmatrix<MT,false,true,CSAs...>::canSMPAssign() const noexce
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the DilatedSubmatrix. The SIMD
+// element consists of \a SIMDSIZE elements of row \a i starting at column \a j.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,false,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,false,true,CSAs...>::load( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the DilatedSubmatrix.
+// Since the elements of a DilatedSubmatrix are in general not aligned, the load is performed
+// unaligned. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,false,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,false,true,CSAs...>::loada( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the DilatedSubmatrix.
+// In case the column dilation is 1 the elements are contiguous in memory and are loaded directly
+// from the underlying matrix. Else the elements are gathered with a strided load.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,false,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,false,true,CSAs...>::loadu( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()                , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= columns() , "Invalid column access index" );
+
+   const size_t ii( row()    + i*rowdilation()    );
+   const size_t jj( column() + j*columndilation() );
+
+   if( columndilation() == 1UL )
+      return matrix_.loadu( ii, jj );
+
+   const ElementType* ptr( &matrix_( ii, jj ) );
+   return loadStrided( ptr, columndilation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the DilatedSubmatrix.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,false,true,CSAs...>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the DilatedSubmatrix.
+// Since the elements of a DilatedSubmatrix are in general not aligned, the store is performed
+// unaligned. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,false,true,CSAs...>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the DilatedSubmatrix.
+// In case the column dilation is 1 the elements are contiguous in memory and are stored directly
+// to the underlying matrix. Else the elements are scattered with a strided store.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,false,true,CSAs...>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()                , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= columns() , "Invalid column access index" );
+
+   const size_t ii( row()    + i*rowdilation()    );
+   const size_t jj( column() + j*columndilation() );
+
+   if( columndilation() == 1UL )
+      matrix_.storeu( ii, jj, value );
+   else
+      storeStrided( &matrix_( ii, jj ), columndilation(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Since the elements of a DilatedSubmatrix are in general not aligned, this function performs
+// a regular unaligned store. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,false,true,CSAs...>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major dense matrix.
@@ -2139,7 +2532,8 @@ inline bool DilatedSubmatrix<MT,false,true,CSAs...>::canSMPAssign() const noexce
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -2160,6 +2554,71 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<M
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// In case the column dilation is 1 the rows of the DilatedSubmatrix are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t N( columns() );
+   const size_t d( columndilation() );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      ElementType* ptr( &matrix_( row()+i*rowdilation(), column() ) );
+      size_t j( 0UL );
+
+      if( d == 1UL )
+      {
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            blaze::storeu( ptr+j, (~rhs).load(i,j) );
+            blaze::storeu( ptr+j+SIMDSIZE, (~rhs).load(i,j+SIMDSIZE) );
+            blaze::storeu( ptr+j+SIMDSIZE*2UL, (~rhs).load(i,j+SIMDSIZE*2UL) );
+            blaze::storeu( ptr+j+SIMDSIZE*3UL, (~rhs).load(i,j+SIMDSIZE*3UL) );
+         }
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            blaze::storeu( ptr+j, (~rhs).load(i,j) );
+         }
+      }
+      else
+      {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            storeStrided( ptr+j*d, d, (~rhs).load(i,j) );
+         }
+      }
+      for( ; j<N; ++j ) {
+         ptr[j*d] = (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major dense matrix.
@@ -2215,7 +2674,8 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::assign( const DenseMatrix<M
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatrix<MT2,false>& rhs )
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -2245,38 +2705,63 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatri
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
+/*!\brief SIMD optimized implementation of the addition assignment of a row-major dense matrix.
 //
 // \param rhs The right-hand side dense matrix to be added.
 // \return void
 //
-// This function must \b NOT be called explicitly! It is used internally for the performance
-// optimized evaluation of expression templates. Calling this function explicitly might result
-// in erroneous results and/or in compilation errors. Instead of using this function use the
-// assignment operator.
+// In case the column dilation is 1 the rows of the DilatedSubmatrix are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
 */
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT2> >
 {
-   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t N( columns() );
+   const size_t d( columndilation() );
 
-   for( size_t ii=0UL; ii<rows(); ii+=block ) {
-      const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
-      for( size_t jj=0UL; jj<columns(); jj+=block ) {
-         const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
-         for( size_t i=ii; i<iend; i++ ) {
-            for( size_t j=jj; j<jend; j++ ) {
-               (*this)(i,j) += (~rhs)(i,j);
-            }
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      ElementType* ptr( &matrix_( row()+i*rowdilation(), column() ) );
+      size_t j( 0UL );
+
+      if( d == 1UL )
+      {
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            blaze::storeu( ptr+j, blaze::loadu( ptr+j ) + (~rhs).load(i,j) );
+            blaze::storeu( ptr+j+SIMDSIZE, blaze::loadu( ptr+j+SIMDSIZE ) + (~rhs).load(i,j+SIMDSIZE) );
+            blaze::storeu( ptr+j+SIMDSIZE*2UL, blaze::loadu( ptr+j+SIMDSIZE*2UL ) + (~rhs).load(i,j+SIMDSIZE*2UL) );
+            blaze::storeu( ptr+j+SIMDSIZE*3UL, blaze::loadu( ptr+j+SIMDSIZE*3UL ) + (~rhs).load(i,j+SIMDSIZE*3UL) );
+         }
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            blaze::storeu( ptr+j, blaze::loadu( ptr+j ) + (~rhs).load(i,j) );
          }
       }
+      else
+      {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            storeStrided( ptr+j*d, d, loadStrided( ptr+j*d, d ) + (~rhs).load(i,j) );
+         }
+      }
+      for( ; j<N; ++j ) {
+         ptr[j*d] += (~rhs)(i,j);
+      }
    }
 }
 /*! \endcond */
@@ -2285,9 +2770,9 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatri
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
+/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
 //
-// \param rhs The right-hand side dense matrix to be subtracted.
+// \param rhs The right-hand side dense matrix to be added.
 // \return void
 //
 // This function must \b NOT be called explicitly! It is used internally for the performance
@@ -2298,7 +2783,48 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatri
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatrix<MT2,false>& rhs )
+inline void DilatedSubmatrix<MT,false,true,CSAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t ii=0UL; ii<rows(); ii+=block ) {
+      const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
+      for( size_t jj=0UL; jj<columns(); jj+=block ) {
+         const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
+         for( size_t i=ii; i<iend; i++ ) {
+            for( size_t j=jj; j<jend; j++ ) {
+               (*this)(i,j) += (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -2326,6 +2852,71 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatri
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// In case the column dilation is 1 the rows of the DilatedSubmatrix are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t N( columns() );
+   const size_t d( columndilation() );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      ElementType* ptr( &matrix_( row()+i*rowdilation(), column() ) );
+      size_t j( 0UL );
+
+      if( d == 1UL )
+      {
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            blaze::storeu( ptr+j, blaze::loadu( ptr+j ) - (~rhs).load(i,j) );
+            blaze::storeu( ptr+j+SIMDSIZE, blaze::loadu( ptr+j+SIMDSIZE ) - (~rhs).load(i,j+SIMDSIZE) );
+            blaze::storeu( ptr+j+SIMDSIZE*2UL, blaze::loadu( ptr+j+SIMDSIZE*2UL ) - (~rhs).load(i,j+SIMDSIZE*2UL) );
+            blaze::storeu( ptr+j+SIMDSIZE*3UL, blaze::loadu( ptr+j+SIMDSIZE*3UL ) - (~rhs).load(i,j+SIMDSIZE*3UL) );
+         }
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            blaze::storeu( ptr+j, blaze::loadu( ptr+j ) - (~rhs).load(i,j) );
+         }
+      }
+      else
+      {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            storeStrided( ptr+j*d, d, loadStrided( ptr+j*d, d ) - (~rhs).load(i,j) );
+         }
+      }
+      for( ; j<N; ++j ) {
+         ptr[j*d] -= (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
@@ -2381,7 +2972,8 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::subAssign( const DenseMatri
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,false,true,CSAs...>::schurAssign( const DenseMatrix<MT2,false>& rhs )
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::schurAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -2403,6 +2995,71 @@ inline void DilatedSubmatrix<MT,false,true,CSAs...>::schurAssign( const DenseMat
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// In case the column dilation is 1 the rows of the DilatedSubmatrix are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time DilatedSubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,false,true,CSAs...>::schurAssign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t N( columns() );
+   const size_t d( columndilation() );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      ElementType* ptr( &matrix_( row()+i*rowdilation(), column() ) );
+      size_t j( 0UL );
+
+      if( d == 1UL )
+      {
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+            blaze::storeu( ptr+j, blaze::loadu( ptr+j ) * (~rhs).load(i,j) );
+            blaze::storeu( ptr+j+SIMDSIZE, blaze::loadu( ptr+j+SIMDSIZE ) * (~rhs).load(i,j+SIMDSIZE) );
+            blaze::storeu( ptr+j+SIMDSIZE*2UL, blaze::loadu( ptr+j+SIMDSIZE*2UL ) * (~rhs).load(i,j+SIMDSIZE*2UL) );
+            blaze::storeu( ptr+j+SIMDSIZE*3UL, blaze::loadu( ptr+j+SIMDSIZE*3UL ) * (~rhs).load(i,j+SIMDSIZE*3UL) );
+         }
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            blaze::storeu( ptr+j, blaze::loadu( ptr+j ) * (~rhs).load(i,j) );
+         }
+      }
+      else
+      {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            storeStrided( ptr+j*d, d, loadStrided( ptr+j*d, d ) * (~rhs).load(i,j) );
+         }
+      }
+      for( ; j<N; ++j ) {
+         ptr[j*d] *= (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the Schur product assignment of a column-major dense matrix.
@@ -2663,6 +3320,125 @@ class DilatedSubmatrix<MT,true,true,CSAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a load of the current SIMD element of the DilatedSubmatrix
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType load() const noexcept {
+         return loadu();
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an aligned load of the current SIMD element of the
+      // DilatedSubmatrix iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType loada() const noexcept {
+         return loadu();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned load of the current SIMD element of the
+      // DilatedSubmatrix iterator. In case the row dilation is 1 the elements are loaded
+      // directly, else they are gathered from the underlying tensor. This function must \b NOT
+      // be called explicitly! It is used internally for the performance optimized evaluation
+      // of expression templates. Calling this function explicitly might result in erroneous
+      // results and/or in compilation errors.
+      */
+      inline SIMDType loadu() const noexcept {
+         if( rowdilation_ == 1UL )
+            return iterator_.loadu();
+         return loadStrided( &*iterator_, rowdilation_ );
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a store of the current SIMD element of the DilatedSubmatrix
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void store( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned store of the current SIMD element of the
+      // DilatedSubmatrix iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void storea( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned store of the current SIMD element of the
+      // DilatedSubmatrix iterator. In case the row dilation is 1 the elements are stored
+      // directly, else they are scattered to the underlying tensor. This function must \b NOT
+      // be called explicitly! It is used internally for the performance optimized evaluation
+      // of expression templates. Calling this function explicitly might result in erroneous
+      // results and/or in compilation errors.
+      */
+      inline void storeu( const SIMDType& value ) const {
+         if( rowdilation_ == 1UL )
+            iterator_.storeu( value );
+         else
+            storeStrided( &*iterator_, rowdilation_, value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense DilatedSubmatrix.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the elements of a DilatedSubmatrix are in general not aligned, this function
+      // performs a regular unaligned store. This function must \b NOT be called explicitly!
+      // It is used internally for the performance optimized evaluation of expression templates.
+      // Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      inline void stream( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
       //**Equality operator************************************************************************
       /*!\brief Equality comparison between two DilatedSubmatrixIterator objects.
       //
@@ -2827,7 +3603,7 @@ class DilatedSubmatrix<MT,true,true,CSAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = MT::simdEnabled && HasConstDataAccess_v<MT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -2939,6 +3715,51 @@ class DilatedSubmatrix<MT,true,true,CSAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDAdd_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDSub_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDMult_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -2958,14 +3779,46 @@ class DilatedSubmatrix<MT,true,true,CSAs...>
    inline bool isAligned() const noexcept { return false; }
    inline bool canSMPAssign() const noexcept;
 
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< !VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
+
    template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT2> >;
+
    template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT2> >;
+
    template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,true>& rhs );
+
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT2> >;
+
    template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,false>& rhs );
-   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,true>& rhs );
    //@}
    //**********************************************************************************************
 
@@ -4416,6 +5269,203 @@ inline bool DilatedSubmatrix<MT,true,true,CSAs...>::canSMPAssign() const noexcep
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the DilatedSubmatrix. The SIMD
+// element consists of \a SIMDSIZE elements of column \a j starting at row \a i.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,true,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,true,true,CSAs...>::load( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the DilatedSubmatrix.
+// Since the elements of a DilatedSubmatrix are in general not aligned, the load is performed
+// unaligned. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,true,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,true,true,CSAs...>::loada( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the DilatedSubmatrix.
+// In case the row dilation is 1 the elements are contiguous in memory and are loaded directly
+// from the underlying matrix. Else the elements are gathered with a strided load.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubmatrix<MT,true,true,CSAs...>::SIMDType
+   DilatedSubmatrix<MT,true,true,CSAs...>::loadu( size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= rows() , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()          , "Invalid column access index" );
+
+   const size_t ii( row()    + i*rowdilation()    );
+   const size_t jj( column() + j*columndilation() );
+
+   if( rowdilation() == 1UL )
+      return matrix_.loadu( ii, jj );
+
+   const ElementType* ptr( &matrix_( ii, jj ) );
+   return loadStrided( ptr, rowdilation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the DilatedSubmatrix.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,true,true,CSAs...>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the DilatedSubmatrix.
+// Since the elements of a DilatedSubmatrix are in general not aligned, the store is performed
+// unaligned. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,true,true,CSAs...>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the DilatedSubmatrix.
+// In case the row dilation is 1 the elements are contiguous in memory and are stored directly
+// to the underlying matrix. Else the elements are scattered with a strided store.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,true,true,CSAs...>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= rows() , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()          , "Invalid column access index" );
+
+   const size_t ii( row()    + i*rowdilation()    );
+   const size_t jj( column() + j*columndilation() );
+
+   if( rowdilation() == 1UL )
+      matrix_.storeu( ii, jj, value );
+   else
+      storeStrided( &matrix_( ii, jj ), rowdilation(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the DilatedSubmatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Since the elements of a DilatedSubmatrix are in general not aligned, this function performs
+// a regular unaligned store. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubmatrix<MT,true,true,CSAs...>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major dense matrix.
@@ -4431,8 +5481,8 @@ inline bool DilatedSubmatrix<MT,true,true,CSAs...>::canSMPAssign() const noexcep
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
-
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -4454,6 +5504,71 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// In case the row dilation is 1 the columns of the DilatedSubmatrix are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( rows() );
+   const size_t d( rowdilation() );
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( M == 0UL ) return;
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      ElementType* ptr( &matrix_( row(), column()+j*columndilation() ) );
+      size_t i( 0UL );
+
+      if( d == 1UL )
+      {
+         for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+            blaze::storeu( ptr+i, (~rhs).load(i,j) );
+            blaze::storeu( ptr+i+SIMDSIZE, (~rhs).load(i+SIMDSIZE,j) );
+            blaze::storeu( ptr+i+SIMDSIZE*2UL, (~rhs).load(i+SIMDSIZE*2UL,j) );
+            blaze::storeu( ptr+i+SIMDSIZE*3UL, (~rhs).load(i+SIMDSIZE*3UL,j) );
+         }
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            blaze::storeu( ptr+i, (~rhs).load(i,j) );
+         }
+      }
+      else
+      {
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            storeStrided( ptr+i*d, d, (~rhs).load(i,j) );
+         }
+      }
+      for( ; i<M; ++i ) {
+         ptr[i*d] = (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major dense matrix.
@@ -4539,7 +5654,8 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::assign( const DenseMatrix<MT
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -4567,6 +5683,71 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// In case the row dilation is 1 the columns of the DilatedSubmatrix are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( rows() );
+   const size_t d( rowdilation() );
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( M == 0UL ) return;
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      ElementType* ptr( &matrix_( row(), column()+j*columndilation() ) );
+      size_t i( 0UL );
+
+      if( d == 1UL )
+      {
+         for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+            blaze::storeu( ptr+i, blaze::loadu( ptr+i ) + (~rhs).load(i,j) );
+            blaze::storeu( ptr+i+SIMDSIZE, blaze::loadu( ptr+i+SIMDSIZE ) + (~rhs).load(i+SIMDSIZE,j) );
+            blaze::storeu( ptr+i+SIMDSIZE*2UL, blaze::loadu( ptr+i+SIMDSIZE*2UL ) + (~rhs).load(i+SIMDSIZE*2UL,j) );
+            blaze::storeu( ptr+i+SIMDSIZE*3UL, blaze::loadu( ptr+i+SIMDSIZE*3UL ) + (~rhs).load(i+SIMDSIZE*3UL,j) );
+         }
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            blaze::storeu( ptr+i, blaze::loadu( ptr+i ) + (~rhs).load(i,j) );
+         }
+      }
+      else
+      {
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            storeStrided( ptr+i*d, d, loadStrided( ptr+i*d, d ) + (~rhs).load(i,j) );
+         }
+      }
+      for( ; i<M; ++i ) {
+         ptr[i*d] += (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a row-major dense matrix.
@@ -4680,7 +5861,8 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::addAssign( const DenseMatrix
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -4708,6 +5890,71 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// In case the row dilation is 1 the columns of the DilatedSubmatrix are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( rows() );
+   const size_t d( rowdilation() );
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( M == 0UL ) return;
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      ElementType* ptr( &matrix_( row(), column()+j*columndilation() ) );
+      size_t i( 0UL );
+
+      if( d == 1UL )
+      {
+         for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+            blaze::storeu( ptr+i, blaze::loadu( ptr+i ) - (~rhs).load(i,j) );
+            blaze::storeu( ptr+i+SIMDSIZE, blaze::loadu( ptr+i+SIMDSIZE ) - (~rhs).load(i+SIMDSIZE,j) );
+            blaze::storeu( ptr+i+SIMDSIZE*2UL, blaze::loadu( ptr+i+SIMDSIZE*2UL ) - (~rhs).load(i+SIMDSIZE*2UL,j) );
+            blaze::storeu( ptr+i+SIMDSIZE*3UL, blaze::loadu( ptr+i+SIMDSIZE*3UL ) - (~rhs).load(i+SIMDSIZE*3UL,j) );
+         }
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            blaze::storeu( ptr+i, blaze::loadu( ptr+i ) - (~rhs).load(i,j) );
+         }
+      }
+      else
+      {
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            storeStrided( ptr+i*d, d, loadStrided( ptr+i*d, d ) - (~rhs).load(i,j) );
+         }
+      }
+      for( ; i<M; ++i ) {
+         ptr[i*d] -= (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
@@ -4821,7 +6068,8 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::subAssign( const DenseMatrix
 template< typename MT       // Type of the dense matrix
         , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void DilatedSubmatrix<MT,true,true,CSAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
@@ -4843,6 +6091,71 @@ inline void DilatedSubmatrix<MT,true,true,CSAs...>::schurAssign( const DenseMatr
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// In case the row dilation is 1 the columns of the DilatedSubmatrix are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CSAs >  // Compile time dilatedsubmatrix arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto DilatedSubmatrix<MT,true,true,CSAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( rows() );
+   const size_t d( rowdilation() );
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( M == 0UL ) return;
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      ElementType* ptr( &matrix_( row(), column()+j*columndilation() ) );
+      size_t i( 0UL );
+
+      if( d == 1UL )
+      {
+         for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+            blaze::storeu( ptr+i, blaze::loadu( ptr+i ) * (~rhs).load(i,j) );
+            blaze::storeu( ptr+i+SIMDSIZE, blaze::loadu( ptr+i+SIMDSIZE ) * (~rhs).load(i+SIMDSIZE,j) );
+            blaze::storeu( ptr+i+SIMDSIZE*2UL, blaze::loadu( ptr+i+SIMDSIZE*2UL ) * (~rhs).load(i+SIMDSIZE*2UL,j) );
+            blaze::storeu( ptr+i+SIMDSIZE*3UL, blaze::loadu( ptr+i+SIMDSIZE*3UL ) * (~rhs).load(i+SIMDSIZE*3UL,j) );
+         }
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            blaze::storeu( ptr+i, blaze::loadu( ptr+i ) * (~rhs).load(i,j) );
+         }
+      }
+      else
+      {
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            storeStrided( ptr+i*d, d, loadStrided( ptr+i*d, d ) * (~rhs).load(i,j) );
+         }
+      }
+      for( ; i<M; ++i ) {
+         ptr[i*d] *= (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the Schur product assignment of a row-major dense matrix.
@@ -61,6 +61,7 @@
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
@@ -105,6 +106,7 @@
 #include <blaze_tensor/math/constraints/DilatedSubtensor.h>
 #include <blaze_tensor/math/constraints/RowMajorTensor.h>
 #include <blaze_tensor/math/dense/InitializerTensor.h>
+#include <blaze_tensor/math/dense/StridedSIMD.h>
 #include <blaze_tensor/math/expressions/DenseTensor.h>
 #include <blaze_tensor/math/traits/DilatedSubtensorTrait.h>
 #include <blaze_tensor/math/views/dilatedsubtensor/BaseTemplate.h>
@@ -330,6 +332,125 @@ class DilatedSubtensor<TT,true,CSAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense DilatedSubtensor.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a load of the current SIMD element of the DilatedSubtensor
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType load() const noexcept {
+         return loadu();
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense DilatedSubtensor.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an aligned load of the current SIMD element of the
+      // DilatedSubtensor iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType loada() const noexcept {
+         return loadu();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense DilatedSubtensor.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned load of the current SIMD element of the
+      // DilatedSubtensor iterator. In case the column dilation is 1 the elements are loaded
+      // directly, else they are gathered from the underlying tensor. This function must \b NOT
+      // be called explicitly! It is used internally for the performance optimized evaluation
+      // of expression templates. Calling this function explicitly might result in erroneous
+      // results and/or in compilation errors.
+      */
+      inline SIMDType loadu() const noexcept {
+         if( columndilation_ == 1UL )
+            return iterator_.loadu();
+         return loadStrided( &*iterator_, columndilation_ );
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense DilatedSubtensor.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a store of the current SIMD element of the DilatedSubtensor
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void store( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense DilatedSubtensor.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned store of the current SIMD element of the
+      // DilatedSubtensor iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void storea( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense DilatedSubtensor.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned store of the current SIMD element of the
+      // DilatedSubtensor iterator. In case the column dilation is 1 the elements are stored
+      // directly, else they are scattered to the underlying tensor. This function must \b NOT
+      // be called explicitly! It is used internally for the performance optimized evaluation
+      // of expression templates. Calling this function explicitly might result in erroneous
+      // results and/or in compilation errors.
+      */
+      inline void storeu( const SIMDType& value ) const {
+         if( columndilation_ == 1UL )
+            iterator_.storeu( value );
+         else
+            storeStrided( &*iterator_, columndilation_, value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense DilatedSubtensor.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the elements of a DilatedSubtensor are in general not aligned, this function
+      // performs a regular unaligned store. This function must \b NOT be called explicitly!
+      // It is used internally for the performance optimized evaluation of expression templates.
+      // Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      inline void stream( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
       //**Equality operator************************************************************************
       /*!\brief Equality comparison between two DilatedSubtensorIterator objects.
       //
@@ -505,7 +626,7 @@ class DilatedSubtensor<TT,true,CSAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = TT::simdEnabled && HasConstDataAccess_v<TT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = TT::smpAssignable;
@@ -620,6 +741,51 @@ class DilatedSubtensor<TT,true,CSAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && TT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<TT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && TT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<TT2> > &&
+        HasSIMDAdd_v< ElementType, ElementType_t<TT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && TT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<TT2> > &&
+        HasSIMDSub_v< ElementType, ElementType_t<TT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename TT2 >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && TT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<TT2> > &&
+        HasSIMDMult_v< ElementType, ElementType_t<TT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -639,13 +805,38 @@ class DilatedSubtensor<TT,true,CSAs...>
    inline bool isAligned() const noexcept { return false; }
    inline bool canSMPAssign() const noexcept;
 
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t k, size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t k, size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t k, size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename TT2 >
+   inline auto assign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< !VectorizedAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto assign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< VectorizedAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto addAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto addAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<TT2> >;
+
+   template< typename TT2 >
+   inline auto subAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<TT2> >;
 
-   template< typename TT2 > inline auto assign( const DenseTensor<TT2>& rhs );
-   template< typename TT2 > inline auto addAssign( const DenseTensor<TT2>& rhs );
-   template< typename TT2 > inline auto subAssign( const DenseTensor<TT2>& rhs );
-   template< typename TT2 > inline auto schurAssign( const DenseTensor<TT2>& rhs );
+   template< typename TT2 >
+   inline auto subAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<TT2> >;
 
+   template< typename TT2 >
+   inline auto schurAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< !VectorizedSchurAssign_v<TT2> >;
 
+   template< typename TT2 >
+   inline auto schurAssign( const DenseTensor<TT2>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<TT2> >;
    //@}
    //**********************************************************************************************
 
@@ -2117,6 +2308,216 @@ inline bool DilatedSubtensor<TT,true,CSAs...>::canSMPAssign() const noexcept
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the DilatedSubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the DilatedSubtensor. The
+// SIMD element consists of \a SIMDSIZE elements of row \a i of page \a k starting at
+// column \a j. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubtensor<TT,true,CSAs...>::SIMDType
+   DilatedSubtensor<TT,true,CSAs...>::load( size_t k, size_t i, size_t j ) const noexcept
+{
+   return loadu( k, i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the DilatedSubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the DilatedSubtensor.
+// Since the elements of a DilatedSubtensor are in general not aligned, the load is performed
+// unaligned. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubtensor<TT,true,CSAs...>::SIMDType
+   DilatedSubtensor<TT,true,CSAs...>::loada( size_t k, size_t i, size_t j ) const noexcept
+{
+   return loadu( k, i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the DilatedSubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the DilatedSubtensor.
+// In case the column dilation is 1 the elements are contiguous in memory and are loaded
+// directly from the underlying tensor. Else the elements are gathered with a strided load.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubtensor<TT,true,CSAs...>::SIMDType
+   DilatedSubtensor<TT,true,CSAs...>::loadu( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( k < pages()               , "Invalid page access index"   );
+   BLAZE_INTERNAL_ASSERT( i < rows()                , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= columns() , "Invalid column access index" );
+
+   const size_t kk( page() + k*pagedilation() );
+   const size_t ii( row()  + i*rowdilation()  );
+   const size_t jj( column() + j*columndilation() );
+
+   if( columndilation() == 1UL )
+      return tensor_.loadu( kk, ii, jj );
+
+   const ElementType* ptr( &tensor_( kk, ii, jj ) );
+   return loadStrided( ptr, columndilation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the DilatedSubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the DilatedSubtensor.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubtensor<TT,true,CSAs...>::store( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( k, i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the DilatedSubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the DilatedSubtensor.
+// Since the elements of a DilatedSubtensor are in general not aligned, the store is performed
+// unaligned. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubtensor<TT,true,CSAs...>::storea( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( k, i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the DilatedSubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the DilatedSubtensor.
+// In case the column dilation is 1 the elements are contiguous in memory and are stored
+// directly to the underlying tensor. Else the elements are scattered with a strided store.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubtensor<TT,true,CSAs...>::storeu( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( k < pages()               , "Invalid page access index"   );
+   BLAZE_INTERNAL_ASSERT( i < rows()                , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= columns() , "Invalid column access index" );
+
+   const size_t kk( page() + k*pagedilation() );
+   const size_t ii( row()  + i*rowdilation()  );
+   const size_t jj( column() + j*columndilation() );
+
+   if( columndilation() == 1UL )
+      tensor_.storeu( kk, ii, jj, value );
+   else
+      storeStrided( &tensor_( kk, ii, jj ), columndilation(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the DilatedSubtensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Since the elements of a DilatedSubtensor are in general not aligned, this function performs
+// a regular unaligned store. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubtensor<TT,true,CSAs...>::stream( size_t k, size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( k, i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major dense tensor.
@@ -2133,6 +2534,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 template< typename TT2 >    // Type of the right-hand side dense tensor
 inline auto DilatedSubtensor<TT,true,CSAs...>::assign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<TT2> >
 {
    BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
@@ -2157,6 +2559,75 @@ inline auto DilatedSubtensor<TT,true,CSAs...>::assign( const DenseTensor<TT2>& r
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense tensor.
+//
+// \param rhs The right-hand side dense tensor to be assigned.
+// \return void
+//
+// In case the column dilation is 1 the rows of the DilatedSubtensor are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+template< typename TT2 >    // Type of the right-hand side dense tensor
+inline auto DilatedSubtensor<TT,true,CSAs...>::assign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<TT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t N ( columns() );
+   const size_t cd( columndilation() );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   for( size_t k=0UL; k<pages(); ++k )
+   {
+      for( size_t i=0UL; i<rows(); ++i )
+      {
+         ElementType* ptr( &tensor_( page()+k*pagedilation(), row()+i*rowdilation(), column() ) );
+         size_t j( 0UL );
+
+         if( cd == 1UL )
+         {
+            for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+               blaze::storeu( ptr+j, (~rhs).load(k,i,j) );
+               blaze::storeu( ptr+j+SIMDSIZE, (~rhs).load(k,i,j+SIMDSIZE) );
+               blaze::storeu( ptr+j+SIMDSIZE*2UL, (~rhs).load(k,i,j+SIMDSIZE*2UL) );
+               blaze::storeu( ptr+j+SIMDSIZE*3UL, (~rhs).load(k,i,j+SIMDSIZE*3UL) );
+            }
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               blaze::storeu( ptr+j, (~rhs).load(k,i,j) );
+            }
+         }
+         else
+         {
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               storeStrided( ptr+j*cd, cd, (~rhs).load(k,i,j) );
+            }
+         }
+         for( ; j<N; ++j ) {
+            ptr[j*cd] = (~rhs)(k,i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a row-major dense tensor.
@@ -2173,6 +2644,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 template< typename TT2 >    // Type of the right-hand side dense tensor
 inline auto DilatedSubtensor<TT,true,CSAs...>::addAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<TT2> >
 {
    BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
@@ -2199,6 +2671,75 @@ inline auto DilatedSubtensor<TT,true,CSAs...>::addAssign( const DenseTensor<TT2>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a row-major dense tensor.
+//
+// \param rhs The right-hand side dense tensor to be added.
+// \return void
+//
+// In case the column dilation is 1 the rows of the DilatedSubtensor are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+template< typename TT2 >    // Type of the right-hand side dense tensor
+inline auto DilatedSubtensor<TT,true,CSAs...>::addAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<TT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t N ( columns() );
+   const size_t cd( columndilation() );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   for( size_t k=0UL; k<pages(); ++k )
+   {
+      for( size_t i=0UL; i<rows(); ++i )
+      {
+         ElementType* ptr( &tensor_( page()+k*pagedilation(), row()+i*rowdilation(), column() ) );
+         size_t j( 0UL );
+
+         if( cd == 1UL )
+         {
+            for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+               blaze::storeu( ptr+j, blaze::loadu( ptr+j ) + (~rhs).load(k,i,j) );
+               blaze::storeu( ptr+j+SIMDSIZE, blaze::loadu( ptr+j+SIMDSIZE ) + (~rhs).load(k,i,j+SIMDSIZE) );
+               blaze::storeu( ptr+j+SIMDSIZE*2UL, blaze::loadu( ptr+j+SIMDSIZE*2UL ) + (~rhs).load(k,i,j+SIMDSIZE*2UL) );
+               blaze::storeu( ptr+j+SIMDSIZE*3UL, blaze::loadu( ptr+j+SIMDSIZE*3UL ) + (~rhs).load(k,i,j+SIMDSIZE*3UL) );
+            }
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               blaze::storeu( ptr+j, blaze::loadu( ptr+j ) + (~rhs).load(k,i,j) );
+            }
+         }
+         else
+         {
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               storeStrided( ptr+j*cd, cd, loadStrided( ptr+j*cd, cd ) + (~rhs).load(k,i,j) );
+            }
+         }
+         for( ; j<N; ++j ) {
+            ptr[j*cd] += (~rhs)(k,i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a row-major dense tensor.
@@ -2215,6 +2756,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 template< typename TT2 >    // Type of the right-hand side dense tensor
 inline auto DilatedSubtensor<TT,true,CSAs...>::subAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<TT2> >
 {
    BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
@@ -2242,6 +2784,75 @@ inline auto DilatedSubtensor<TT,true,CSAs...>::subAssign( const DenseTensor<TT2>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a row-major dense tensor.
+//
+// \param rhs The right-hand side dense tensor to be subtracted.
+// \return void
+//
+// In case the column dilation is 1 the rows of the DilatedSubtensor are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+template< typename TT2 >    // Type of the right-hand side dense tensor
+inline auto DilatedSubtensor<TT,true,CSAs...>::subAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<TT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t N ( columns() );
+   const size_t cd( columndilation() );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   for( size_t k=0UL; k<pages(); ++k )
+   {
+      for( size_t i=0UL; i<rows(); ++i )
+      {
+         ElementType* ptr( &tensor_( page()+k*pagedilation(), row()+i*rowdilation(), column() ) );
+         size_t j( 0UL );
+
+         if( cd == 1UL )
+         {
+            for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+               blaze::storeu( ptr+j, blaze::loadu( ptr+j ) - (~rhs).load(k,i,j) );
+               blaze::storeu( ptr+j+SIMDSIZE, blaze::loadu( ptr+j+SIMDSIZE ) - (~rhs).load(k,i,j+SIMDSIZE) );
+               blaze::storeu( ptr+j+SIMDSIZE*2UL, blaze::loadu( ptr+j+SIMDSIZE*2UL ) - (~rhs).load(k,i,j+SIMDSIZE*2UL) );
+               blaze::storeu( ptr+j+SIMDSIZE*3UL, blaze::loadu( ptr+j+SIMDSIZE*3UL ) - (~rhs).load(k,i,j+SIMDSIZE*3UL) );
+            }
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               blaze::storeu( ptr+j, blaze::loadu( ptr+j ) - (~rhs).load(k,i,j) );
+            }
+         }
+         else
+         {
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               storeStrided( ptr+j*cd, cd, loadStrided( ptr+j*cd, cd ) - (~rhs).load(k,i,j) );
+            }
+         }
+         for( ; j<N; ++j ) {
+            ptr[j*cd] -= (~rhs)(k,i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the Schur product assignment of a row-major dense tensor.
@@ -2258,6 +2869,7 @@ template< typename TT       // Type of the dense tensor
         , size_t... CSAs >  // Compile time DilatedSubtensor arguments
 template< typename TT2 >    // Type of the right-hand side dense tensor
 inline auto DilatedSubtensor<TT,true,CSAs...>::schurAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< !VectorizedSchurAssign_v<TT2> >
 {
    BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"  );
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"   );
@@ -2282,6 +2894,75 @@ inline auto DilatedSubtensor<TT,true,CSAs...>::schurAssign( const DenseTensor<TT
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a row-major dense tensor.
+//
+// \param rhs The right-hand side dense tensor for the Schur product.
+// \return void
+//
+// In case the column dilation is 1 the rows of the DilatedSubtensor are contiguous in memory
+// and are processed with regular unaligned loads and stores. Else the SIMD elements are
+// gathered and scattered by means of strided loads and stores. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename TT       // Type of the dense tensor
+        , size_t... CSAs >  // Compile time DilatedSubtensor arguments
+template< typename TT2 >    // Type of the right-hand side dense tensor
+inline auto DilatedSubtensor<TT,true,CSAs...>::schurAssign( const DenseTensor<TT2>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<TT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( pages()   == (~rhs).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t N ( columns() );
+   const size_t cd( columndilation() );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   for( size_t k=0UL; k<pages(); ++k )
+   {
+      for( size_t i=0UL; i<rows(); ++i )
+      {
+         ElementType* ptr( &tensor_( page()+k*pagedilation(), row()+i*rowdilation(), column() ) );
+         size_t j( 0UL );
+
+         if( cd == 1UL )
+         {
+            for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL ) {
+               blaze::storeu( ptr+j, blaze::loadu( ptr+j ) * (~rhs).load(k,i,j) );
+               blaze::storeu( ptr+j+SIMDSIZE, blaze::loadu( ptr+j+SIMDSIZE ) * (~rhs).load(k,i,j+SIMDSIZE) );
+               blaze::storeu( ptr+j+SIMDSIZE*2UL, blaze::loadu( ptr+j+SIMDSIZE*2UL ) * (~rhs).load(k,i,j+SIMDSIZE*2UL) );
+               blaze::storeu( ptr+j+SIMDSIZE*3UL, blaze::loadu( ptr+j+SIMDSIZE*3UL ) * (~rhs).load(k,i,j+SIMDSIZE*3UL) );
+            }
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               blaze::storeu( ptr+j, blaze::loadu( ptr+j ) * (~rhs).load(k,i,j) );
+            }
+         }
+         else
+         {
+            for( ; j<jpos; j+=SIMDSIZE ) {
+               storeStrided( ptr+j*cd, cd, loadStrided( ptr+j*cd, cd ) * (~rhs).load(k,i,j) );
+            }
+         }
+         for( ; j<N; ++j ) {
+            ptr[j*cd] *= (~rhs)(k,i,j);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
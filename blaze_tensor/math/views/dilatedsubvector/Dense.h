@@ -60,6 +60,7 @@
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDDiv.h>
@@ -86,6 +87,7 @@
 #include <iterator>
 
 #include <blaze_tensor/math/constraints/DilatedSubvector.h>
+#include <blaze_tensor/math/dense/StridedSIMD.h>
 #include <blaze_tensor/math/traits/DilatedSubvectorTrait.h>
 #include <blaze_tensor/math/views/dilatedsubvector/BaseTemplate.h>
 #include <blaze_tensor/math/views/dilatedsubvector/DilatedSubvectorData.h>
@@ -296,6 +298,125 @@ class DilatedSubvector<VT,TF,true,CSAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense DilatedSubvector.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a load of the current SIMD element of the DilatedSubvector
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType load() const noexcept {
+         return loadu();
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense DilatedSubvector.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an aligned load of the current SIMD element of the
+      // DilatedSubvector iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline SIMDType loada() const noexcept {
+         return loadu();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense DilatedSubvector.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned load of the current SIMD element of the
+      // DilatedSubvector iterator. In case the dilation is 1 the elements are loaded
+      // directly, else they are gathered from the underlying tensor. This function must \b NOT
+      // be called explicitly! It is used internally for the performance optimized evaluation
+      // of expression templates. Calling this function explicitly might result in erroneous
+      // results and/or in compilation errors.
+      */
+      inline SIMDType loadu() const noexcept {
+         if( dilation_ == 1UL )
+            return iterator_.loadu();
+         return loadStrided( &*iterator_, dilation_ );
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense DilatedSubvector.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a store of the current SIMD element of the DilatedSubvector
+      // iterator. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void store( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense DilatedSubvector.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned store of the current SIMD element of the
+      // DilatedSubvector iterator. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline void storea( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense DilatedSubvector.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned store of the current SIMD element of the
+      // DilatedSubvector iterator. In case the dilation is 1 the elements are stored
+      // directly, else they are scattered to the underlying tensor. This function must \b NOT
+      // be called explicitly! It is used internally for the performance optimized evaluation
+      // of expression templates. Calling this function explicitly might result in erroneous
+      // results and/or in compilation errors.
+      */
+      inline void storeu( const SIMDType& value ) const {
+         if( dilation_ == 1UL )
+            iterator_.storeu( value );
+         else
+            storeStrided( &*iterator_, dilation_, value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense DilatedSubvector.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // Since the elements of a DilatedSubvector are in general not aligned, this function
+      // performs a regular unaligned store. This function must \b NOT be called explicitly!
+      // It is used internally for the performance optimized evaluation of expression templates.
+      // Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      inline void stream( const SIMDType& value ) const {
+         storeu( value );
+      }
+      //*******************************************************************************************
+
       //**Equality operator************************************************************************
       /*!\brief Equality comparison between two DilatedSubvectorIterator objects.
       //
@@ -447,7 +568,7 @@ class DilatedSubvector<VT,TF,true,CSAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = VT::simdEnabled && HasConstDataAccess_v<VT>;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = VT::smpAssignable;
@@ -527,6 +648,61 @@ class DilatedSubvector<VT,TF,true,CSAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT2> > &&
+        HasSIMDAdd_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT2> > &&
+        HasSIMDSub_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedMultAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT2> > &&
+        HasSIMDMult_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   static constexpr bool VectorizedDivAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT2> > &&
+        HasSIMDDiv_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
  public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
@@ -546,19 +722,48 @@ class DilatedSubvector<VT,TF,true,CSAs...>
    inline bool isAligned   () const noexcept { return false; }
    inline bool canSMPAssign() const noexcept;
 
-   template< typename VT2 > inline void assign( const DenseVector <VT2,TF>& rhs );
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t index ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t index, const SIMDType& value ) noexcept;
+
+   template< typename VT2 >
+   inline auto assign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto assign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedAssign_v<VT2> >;
 //    template< typename VT2 > inline void assign( const SparseVector<VT2,TF>& rhs );
 
-   template< typename VT2 > inline void addAssign( const DenseVector <VT2,TF>& rhs );
+   template< typename VT2 >
+   inline auto addAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto addAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<VT2> >;
 //    template< typename VT2 > inline void addAssign( const SparseVector<VT2,TF>& rhs );
 
-   template< typename VT2 > inline void subAssign( const DenseVector <VT2,TF>& rhs );
+   template< typename VT2 >
+   inline auto subAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto subAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<VT2> >;
 //    template< typename VT2 > inline void subAssign( const SparseVector<VT2,TF>& rhs );
 
-   template< typename VT2 > inline void multAssign( const DenseVector <VT2,TF>& rhs );
+   template< typename VT2 >
+   inline auto multAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedMultAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto multAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedMultAssign_v<VT2> >;
 //    template< typename VT2 > inline void multAssign( const SparseVector<VT2,TF>& rhs );
 
-   template< typename VT2 > inline void divAssign( const DenseVector <VT2,TF>& rhs );
+   template< typename VT2 >
+   inline auto divAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< !VectorizedDivAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto divAssign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedDivAssign_v<VT2> >;
    //@}
    //**********************************************************************************************
 
@@ -1633,6 +1838,198 @@ inline bool DilatedSubvector<VT,TF,true,CSAs...>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the dilatedsubvector.
+//
+// \param index Access index. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the dilatedsubvector. The SIMD
+// element consists of the \a SIMDSIZE elements starting at \a index.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubvector<VT,TF,true,CSAs...>::SIMDType
+   DilatedSubvector<VT,TF,true,CSAs...>::load( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dilatedsubvector.
+//
+// \param index Access index. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the dilatedsubvector.
+// Since the elements of a dilatedsubvector are in general not aligned, the load is performed
+// unaligned. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubvector<VT,TF,true,CSAs...>::SIMDType
+   DilatedSubvector<VT,TF,true,CSAs...>::loada( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dilatedsubvector.
+//
+// \param index Access index. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the dilatedsubvector.
+// In case the dilation is 1 the elements are contiguous in memory and are loaded directly from
+// the underlying vector. Else the elements are gathered with a strided load.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE typename DilatedSubvector<VT,TF,true,CSAs...>::SIMDType
+   DilatedSubvector<VT,TF,true,CSAs...>::loadu( size_t index ) const noexcept
+{
+   BLAZE_INTERNAL_ASSERT( index < size(), "Invalid dilatedsubvector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid dilatedsubvector access index" );
+
+   if( dilation() == 1UL )
+      return vector_.loadu( offset()+index );
+
+   const ElementType* ptr( &vector_[offset()+index*dilation()] );
+   return loadStrided( ptr, dilation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dilatedsubvector.
+//
+// \param index Access index. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the dilatedsubvector.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubvector<VT,TF,true,CSAs...>::store( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dilatedsubvector.
+//
+// \param index Access index. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the dilatedsubvector.
+// Since the elements of a dilatedsubvector are in general not aligned, the store is performed
+// unaligned. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubvector<VT,TF,true,CSAs...>::storea( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dilatedsubvector.
+//
+// \param index Access index. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the dilatedsubvector.
+// In case the dilation is 1 the elements are contiguous in memory and are stored directly to
+// the underlying vector. Else the elements are scattered with a strided store.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubvector<VT,TF,true,CSAs...>::storeu( size_t index, const SIMDType& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( index < size(), "Invalid dilatedsubvector access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid dilatedsubvector access index" );
+
+   if( dilation() == 1UL )
+      vector_.storeu( offset()+index, value );
+   else
+      storeStrided( &vector_[offset()+index*dilation()], dilation(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dilatedsubvector.
+//
+// \param index Access index. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// Since the elements of a dilatedsubvector are in general not aligned, this function performs
+// a regular unaligned store. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+BLAZE_ALWAYS_INLINE void
+   DilatedSubvector<VT,TF,true,CSAs...>::stream( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
@@ -1650,7 +2047,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::assign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::assign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1667,6 +2065,68 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::assign( const DenseVector<VT2,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// In case the dilation is 1 the elements of the dilatedsubvector are contiguous in memory and
+// are processed with regular unaligned loads and stores. Else the SIMD elements are gathered
+// and scattered by means of strided loads and stores. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::assign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( size() );
+   const size_t d( dilation() );
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   ElementType* ptr( &vector_[offset()] );
+   size_t i( 0UL );
+
+   if( d == 1UL )
+   {
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         blaze::storeu( ptr+i, (~rhs).load(i) );
+         blaze::storeu( ptr+i+SIMDSIZE, (~rhs).load(i+SIMDSIZE) );
+         blaze::storeu( ptr+i+SIMDSIZE*2UL, (~rhs).load(i+SIMDSIZE*2UL) );
+         blaze::storeu( ptr+i+SIMDSIZE*3UL, (~rhs).load(i+SIMDSIZE*3UL) );
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         blaze::storeu( ptr+i, (~rhs).load(i) );
+      }
+   }
+   else
+   {
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         storeStrided( ptr+i*d, d, (~rhs).load(i) );
+      }
+   }
+   for( ; i<N; ++i ) {
+      ptr[i*d] = (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
@@ -1711,7 +2171,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::addAssign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::addAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1728,6 +2189,68 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::addAssign( const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// In case the dilation is 1 the elements of the dilatedsubvector are contiguous in memory and
+// are processed with regular unaligned loads and stores. Else the SIMD elements are gathered
+// and scattered by means of strided loads and stores. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::addAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( size() );
+   const size_t d( dilation() );
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   ElementType* ptr( &vector_[offset()] );
+   size_t i( 0UL );
+
+   if( d == 1UL )
+   {
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         blaze::storeu( ptr+i, blaze::loadu( ptr+i ) + (~rhs).load(i) );
+         blaze::storeu( ptr+i+SIMDSIZE, blaze::loadu( ptr+i+SIMDSIZE ) + (~rhs).load(i+SIMDSIZE) );
+         blaze::storeu( ptr+i+SIMDSIZE*2UL, blaze::loadu( ptr+i+SIMDSIZE*2UL ) + (~rhs).load(i+SIMDSIZE*2UL) );
+         blaze::storeu( ptr+i+SIMDSIZE*3UL, blaze::loadu( ptr+i+SIMDSIZE*3UL ) + (~rhs).load(i+SIMDSIZE*3UL) );
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         blaze::storeu( ptr+i, blaze::loadu( ptr+i ) + (~rhs).load(i) );
+      }
+   }
+   else
+   {
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         storeStrided( ptr+i*d, d, loadStrided( ptr+i*d, d ) + (~rhs).load(i) );
+      }
+   }
+   for( ; i<N; ++i ) {
+      ptr[i*d] += (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a sparse vector.
@@ -1771,7 +2294,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::subAssign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::subAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1788,6 +2312,68 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::subAssign( const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// In case the dilation is 1 the elements of the dilatedsubvector are contiguous in memory and
+// are processed with regular unaligned loads and stores. Else the SIMD elements are gathered
+// and scattered by means of strided loads and stores. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::subAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( size() );
+   const size_t d( dilation() );
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   ElementType* ptr( &vector_[offset()] );
+   size_t i( 0UL );
+
+   if( d == 1UL )
+   {
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         blaze::storeu( ptr+i, blaze::loadu( ptr+i ) - (~rhs).load(i) );
+         blaze::storeu( ptr+i+SIMDSIZE, blaze::loadu( ptr+i+SIMDSIZE ) - (~rhs).load(i+SIMDSIZE) );
+         blaze::storeu( ptr+i+SIMDSIZE*2UL, blaze::loadu( ptr+i+SIMDSIZE*2UL ) - (~rhs).load(i+SIMDSIZE*2UL) );
+         blaze::storeu( ptr+i+SIMDSIZE*3UL, blaze::loadu( ptr+i+SIMDSIZE*3UL ) - (~rhs).load(i+SIMDSIZE*3UL) );
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         blaze::storeu( ptr+i, blaze::loadu( ptr+i ) - (~rhs).load(i) );
+      }
+   }
+   else
+   {
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         storeStrided( ptr+i*d, d, loadStrided( ptr+i*d, d ) - (~rhs).load(i) );
+      }
+   }
+   for( ; i<N; ++i ) {
+      ptr[i*d] -= (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a sparse vector.
@@ -1831,7 +2417,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::multAssign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::multAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedMultAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1848,6 +2435,68 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::multAssign( const DenseVector<
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// In case the dilation is 1 the elements of the dilatedsubvector are contiguous in memory and
+// are processed with regular unaligned loads and stores. Else the SIMD elements are gathered
+// and scattered by means of strided loads and stores. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::multAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedMultAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( size() );
+   const size_t d( dilation() );
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   ElementType* ptr( &vector_[offset()] );
+   size_t i( 0UL );
+
+   if( d == 1UL )
+   {
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         blaze::storeu( ptr+i, blaze::loadu( ptr+i ) * (~rhs).load(i) );
+         blaze::storeu( ptr+i+SIMDSIZE, blaze::loadu( ptr+i+SIMDSIZE ) * (~rhs).load(i+SIMDSIZE) );
+         blaze::storeu( ptr+i+SIMDSIZE*2UL, blaze::loadu( ptr+i+SIMDSIZE*2UL ) * (~rhs).load(i+SIMDSIZE*2UL) );
+         blaze::storeu( ptr+i+SIMDSIZE*3UL, blaze::loadu( ptr+i+SIMDSIZE*3UL ) * (~rhs).load(i+SIMDSIZE*3UL) );
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         blaze::storeu( ptr+i, blaze::loadu( ptr+i ) * (~rhs).load(i) );
+      }
+   }
+   else
+   {
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         storeStrided( ptr+i*d, d, loadStrided( ptr+i*d, d ) * (~rhs).load(i) );
+      }
+   }
+   for( ; i<N; ++i ) {
+      ptr[i*d] *= (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the multiplication assignment of a sparse vector.
@@ -1904,7 +2553,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CSAs >  // Compile time dilatedsubvector arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void DilatedSubvector<VT,TF,true,CSAs...>::divAssign( const DenseVector<VT2,TF>& rhs )
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::divAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< !VectorizedDivAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1919,6 +2569,68 @@ inline void DilatedSubvector<VT,TF,true,CSAs...>::divAssign( const DenseVector<V
 }
 /*! \endcond */
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// In case the dilation is 1 the elements of the dilatedsubvector are contiguous in memory and
+// are processed with regular unaligned loads and stores. Else the SIMD elements are gathered
+// and scattered by means of strided loads and stores. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors. Instead of using this function use the assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CSAs >  // Compile time dilatedsubvector arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto DilatedSubvector<VT,TF,true,CSAs...>::divAssign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedDivAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t N( size() );
+   const size_t d( dilation() );
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( N == 0UL ) return;
+
+   ElementType* ptr( &vector_[offset()] );
+   size_t i( 0UL );
+
+   if( d == 1UL )
+   {
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         blaze::storeu( ptr+i, blaze::loadu( ptr+i ) / (~rhs).load(i) );
+         blaze::storeu( ptr+i+SIMDSIZE, blaze::loadu( ptr+i+SIMDSIZE ) / (~rhs).load(i+SIMDSIZE) );
+         blaze::storeu( ptr+i+SIMDSIZE*2UL, blaze::loadu( ptr+i+SIMDSIZE*2UL ) / (~rhs).load(i+SIMDSIZE*2UL) );
+         blaze::storeu( ptr+i+SIMDSIZE*3UL, blaze::loadu( ptr+i+SIMDSIZE*3UL ) / (~rhs).load(i+SIMDSIZE*3UL) );
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         blaze::storeu( ptr+i, blaze::loadu( ptr+i ) / (~rhs).load(i) );
+      }
+   }
+   else
+   {
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         storeStrided( ptr+i*d, d, loadStrided( ptr+i*d, d ) / (~rhs).load(i) );
+      }
+   }
+   for( ; i<N; ++i ) {
+      ptr[i*d] /= (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
 } // namespace blaze
 
 #endif
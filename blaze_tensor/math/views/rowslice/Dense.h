@@ -74,14 +74,17 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Blocking.h>
 #include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Streaming.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
 #include <blaze/util/constraints/Vectorizable.h>
@@ -163,7 +166,7 @@ class RowSlice
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   static constexpr bool simdEnabled = MT::simdEnabled;
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -247,6 +250,46 @@ class RowSlice
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDAdd_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDSub_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > &&
+        HasSIMDMult_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
    //**SIMD properties*****************************************************************************
    //! The number of elements packed within a single SIMD element.
    static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
@@ -271,17 +314,46 @@ class RowSlice
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
-   template< typename VT, bool SO >
-   inline void assign( const DenseMatrix<VT,SO>& rhs );
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,columnMajor>& rhs ) -> EnableIf_t< !VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,columnMajor>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 > inline void assign( const DenseMatrix<MT2,rowMajor>& rhs );
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,columnMajor>& rhs ) -> EnableIf_t< !VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,columnMajor>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,rowMajor>& rhs );
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,columnMajor>& rhs ) -> EnableIf_t< !VectorizedSubAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,columnMajor>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT2> >;
 
-   template< typename VT, bool SO >
-   inline void addAssign( const DenseMatrix<VT, SO>& rhs );
+   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,rowMajor>& rhs );
 
-   template< typename VT, bool SO >
-   inline void subAssign( const DenseMatrix<VT,SO>& rhs );
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,columnMajor>& rhs ) -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >;
 
-   template< typename VT, bool SO >
-   inline void schurAssign( const DenseMatrix<VT,SO>& rhs );
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,columnMajor>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT2> >;
+
+   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,rowMajor>& rhs );
    //@}
    //**********************************************************************************************
 
@@ -1391,11 +1463,330 @@ inline bool RowSlice<MT,CRAs...>::canSMPAssign() const noexcept
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the assignment of a dense matrix.
+/*!\brief Load of a SIMD element of the dense rowslice.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the dense rowslice. Since
+// the rowslice is a column-major matrix, the SIMD element consists of the \a SIMDSIZE
+// consecutive elements of column \a j starting at row \a i, which are stored contiguously
+// in row \a row() of page \a j of the underlying tensor. This function must \b NOT be
+// called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+BLAZE_ALWAYS_INLINE typename RowSlice<MT,CRAs...>::SIMDType
+   RowSlice<MT,CRAs...>::load( size_t i, size_t j ) const noexcept
+{
+   return tensor_.load( j, row(), i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dense rowslice.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the dense rowslice.
+// This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+BLAZE_ALWAYS_INLINE typename RowSlice<MT,CRAs...>::SIMDType
+   RowSlice<MT,CRAs...>::loada( size_t i, size_t j ) const noexcept
+{
+   return tensor_.loada( j, row(), i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dense rowslice.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the dense rowslice.
+// This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+BLAZE_ALWAYS_INLINE typename RowSlice<MT,CRAs...>::SIMDType
+   RowSlice<MT,CRAs...>::loadu( size_t i, size_t j ) const noexcept
+{
+   return tensor_.loadu( j, row(), i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dense rowslice.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the dense rowslice.
+// This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+BLAZE_ALWAYS_INLINE void
+   RowSlice<MT,CRAs...>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   tensor_.store( j, row(), i, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dense rowslice.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the dense rowslice.
+// This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+BLAZE_ALWAYS_INLINE void
+   RowSlice<MT,CRAs...>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   tensor_.storea( j, row(), i, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dense rowslice.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the dense rowslice.
+// This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+BLAZE_ALWAYS_INLINE void
+   RowSlice<MT,CRAs...>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   tensor_.storeu( j, row(), i, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dense rowslice.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific SIMD element of the dense rowslice.
+// This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+BLAZE_ALWAYS_INLINE void
+   RowSlice<MT,CRAs...>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   tensor_.stream( j, row(), i, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline auto RowSlice<MT,CRAs...>::assign( const DenseMatrix<MT2,columnMajor>& rhs )
+   -> EnableIf_t< !VectorizedAssign_v<MT2> >
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j ) {
+      for( size_t i=0UL; i<ipos; i+=2UL ) {
+         tensor_(j,row(),i    ) = (~rhs)(i    ,j);
+         tensor_(j,row(),i+1UL) = (~rhs)(i+1UL,j);
+      }
+      if( ipos < rows() ) {
+         tensor_(j,row(),ipos) = (~rhs)(ipos,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline auto RowSlice<MT,CRAs...>::assign( const DenseMatrix<MT2,columnMajor>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !IsPadded_v<MT> || !IsPadded_v<MT2> );
+
+   const size_t M( rows() );
+   const size_t ipos( ( remainder )?( M & size_t(-SIMDSIZE) ):( M ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   const bool streaming( useStreaming &&
+                         M*columns() > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+                         !(~rhs).isAliased( &tensor_ ) );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT2> right( (~rhs).begin(j) );
+
+      if( streaming )
+      {
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+      }
+      else
+      {
+         for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         }
+      }
+      for( ; remainder && i<M; ++i ) {
+         *left = *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked implementation of the assignment of a row-major dense matrix.
 //
 // \param rhs The right-hand side dense matrix to be assigned.
 // \return void
 //
+// The row-major matrix is traversed in square blocks in order to keep both the rows of the
+// right-hand side matrix and the columns of the dense rowslice, i.e. the rows of the underlying
+// tensor, in cache. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors. Instead of using this function
+// use the assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void RowSlice<MT,CRAs...>::assign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t jj=0UL; jj<columns(); jj+=block ) {
+      const size_t jend( min( columns(), jj+block ) );
+      for( size_t ii=0UL; ii<rows(); ii+=block ) {
+         const size_t iend( min( rows(), ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               tensor_(j,row(),i) = (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -1403,21 +1794,24 @@ inline bool RowSlice<MT,CRAs...>::canSMPAssign() const noexcept
 */
 template< typename MT       // Type of the dense tensor
         , size_t... CRAs >  // Compile time rowslice arguments
-template< typename VT       // Type of the right-hand side dense matrix
-        , bool SO >         // Storage order
-inline void RowSlice<MT,CRAs...>::assign( const DenseMatrix<VT,SO>& rhs )
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline auto RowSlice<MT,CRAs...>::addAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+   -> EnableIf_t< !VectorizedAddAssign_v<MT2> >
 {
-   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows(), "Invalid matrix sizes" );
-   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid matrix sizes" );
-
-   for (size_t i = 0UL; i < (~rhs).rows(); ++i ) {
-      const size_t jpos( (~rhs).columns() & size_t(-2) );
-      for( size_t j=0UL; j<jpos; j+=2UL ) {
-         tensor_(j    ,row(),i) = (~rhs)(i,j);
-         tensor_(j+1UL,row(),i) = (~rhs)(i,j+1UL);
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j ) {
+      for( size_t i=0UL; i<ipos; i+=2UL ) {
+         tensor_(j,row(),i    ) += (~rhs)(i    ,j);
+         tensor_(j,row(),i+1UL) += (~rhs)(i+1UL,j);
+      }
+      if( ipos < rows() ) {
+         tensor_(j,row(),ipos) += (~rhs)(ipos,j);
       }
-      if( jpos < (~rhs).columns() )
-         tensor_(jpos,row(),i) = (~rhs)(i,jpos);
    }
 }
 /*! \endcond */
@@ -1426,7 +1820,7 @@ inline void RowSlice<MT,CRAs...>::assign( const DenseMatrix<VT,SO>& rhs )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the addition assignment of a dense matrix.
+/*!\brief SIMD optimized implementation of the addition assignment of a column-major dense matrix.
 //
 // \param rhs The right-hand side dense matrix to be added.
 // \return void
@@ -1438,21 +1832,117 @@ inline void RowSlice<MT,CRAs...>::assign( const DenseMatrix<VT,SO>& rhs )
 */
 template< typename MT       // Type of the dense tensor
         , size_t... CRAs >  // Compile time rowslice arguments
-template< typename VT       // Type of the right-hand side dense matrix
-        , bool SO >         // Storage order
-inline void RowSlice<MT,CRAs...>::addAssign( const DenseMatrix<VT,SO>& rhs )
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline auto RowSlice<MT,CRAs...>::addAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !IsPadded_v<MT> || !IsPadded_v<MT2> );
+
+   const size_t M( rows() );
+   const size_t ipos( ( remainder )?( M & size_t(-SIMDSIZE) ):( M ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT2> right( (~rhs).begin(j) );
+
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && i<M; ++i ) {
+         *left += *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// The row-major matrix is traversed in square blocks in order to keep both the rows of the
+// right-hand side matrix and the columns of the dense rowslice, i.e. the rows of the underlying
+// tensor, in cache. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors. Instead of using this function
+// use the assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void RowSlice<MT,CRAs...>::addAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t jj=0UL; jj<columns(); jj+=block ) {
+      const size_t jend( min( columns(), jj+block ) );
+      for( size_t ii=0UL; ii<rows(); ii+=block ) {
+         const size_t iend( min( rows(), ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               tensor_(j,row(),i) += (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline auto RowSlice<MT,CRAs...>::subAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+   -> EnableIf_t< !VectorizedSubAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   for (size_t i = 0UL; i < (~rhs).rows(); ++i ) {
-      const size_t jpos( (~rhs).columns() & size_t(-2) );
-      for( size_t j=0UL; j<jpos; j+=2UL ) {
-         tensor_(j    ,row(),i) += (~rhs)(i,j);
-         tensor_(j+1UL,row(),i) += (~rhs)(i,j+1UL);
+   const size_t ipos( rows() & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % 2UL ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j ) {
+      for( size_t i=0UL; i<ipos; i+=2UL ) {
+         tensor_(j,row(),i    ) -= (~rhs)(i    ,j);
+         tensor_(j,row(),i+1UL) -= (~rhs)(i+1UL,j);
+      }
+      if( ipos < rows() ) {
+         tensor_(j,row(),ipos) -= (~rhs)(ipos,j);
       }
-      if( jpos < (~rhs).columns() )
-         tensor_(jpos,row(),i) += (~rhs)(i,jpos);
    }
 }
 /*! \endcond */
@@ -1461,7 +1951,7 @@ inline void RowSlice<MT,CRAs...>::addAssign( const DenseMatrix<VT,SO>& rhs )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+/*!\brief SIMD optimized implementation of the subtraction assignment of a column-major dense matrix.
 //
 // \param rhs The right-hand side dense matrix to be subtracted.
 // \return void
@@ -1473,21 +1963,39 @@ inline void RowSlice<MT,CRAs...>::addAssign( const DenseMatrix<VT,SO>& rhs )
 */
 template< typename MT       // Type of the dense tensor
         , size_t... CRAs >  // Compile time rowslice arguments
-template< typename VT       // Type of the right-hand side dense matrix
-        , bool SO >         // Storage order
-inline void RowSlice<MT,CRAs...>::subAssign( const DenseMatrix<VT,SO>& rhs )
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline auto RowSlice<MT,CRAs...>::subAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT2> >
 {
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   for (size_t i = 0UL; i < (~rhs).rows(); ++i ) {
-      const size_t jpos( (~rhs).columns() & size_t(-2) );
-      for( size_t j=0UL; j<jpos; j+=2UL ) {
-         tensor_(j    ,row(),i) -= (~rhs)(i,j);
-         tensor_(j+1UL,row(),i) -= (~rhs)(i,j+1UL);
+   constexpr bool remainder( !IsPadded_v<MT> || !IsPadded_v<MT2> );
+
+   const size_t M( rows() );
+   const size_t ipos( ( remainder )?( M & size_t(-SIMDSIZE) ):( M ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT2> right( (~rhs).begin(j) );
+
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && i<M; ++i ) {
+         *left -= *right; ++left; ++right;
       }
-      if( jpos < (~rhs).columns() )
-         tensor_(jpos,row(),i) -= (~rhs)(i,jpos);
    }
 }
 /*! \endcond */
@@ -1496,7 +2004,47 @@ inline void RowSlice<MT,CRAs...>::subAssign( const DenseMatrix<VT,SO>& rhs )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Default implementation of the Schur product assignment of a row-major dense matrix.
+/*!\brief Blocked implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// The row-major matrix is traversed in square blocks in order to keep both the rows of the
+// right-hand side matrix and the columns of the dense rowslice, i.e. the rows of the underlying
+// tensor, in cache. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors. Instead of using this function
+// use the assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void RowSlice<MT,CRAs...>::subAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t jj=0UL; jj<columns(); jj+=block ) {
+      const size_t jend( min( columns(), jj+block ) );
+      for( size_t ii=0UL; ii<rows(); ii+=block ) {
+         const size_t iend( min( rows(), ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               tensor_(j,row(),i) -= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the Schur product assignment of a column-major dense matrix.
 //
 // \param rhs The right-hand side dense matrix for the Schur product.
 // \return void
@@ -1508,23 +2056,116 @@ inline void RowSlice<MT,CRAs...>::subAssign( const DenseMatrix<VT,SO>& rhs )
 */
 template< typename MT       // Type of the dense tensor
         , size_t... CRAs >  // Compile time rowslice arguments
-template< typename MT2      // Type of the right-hand side dense matrix
-        , bool SO >         // Storage order
-inline void RowSlice<MT,CRAs...>::schurAssign( const DenseMatrix<MT2,SO>& rhs )
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline auto RowSlice<MT,CRAs...>::schurAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+   -> EnableIf_t< !VectorizedSchurAssign_v<MT2> >
 {
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   const size_t jpos( columns() & size_t(-2) );
-   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % 2UL ) ) == jpos, "Invalid end calculation" );
+   const size_t ipos( rows() & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % 2UL ) ) == ipos, "Invalid end calculation" );
 
-   for( size_t i=0UL; i<rows(); ++i ) {
-      for( size_t j=0UL; j<jpos; j+=2UL ) {
-         tensor_(j    ,row(),i) *= (~rhs)(i,j    );
-         tensor_(j+1UL,row(),i) *= (~rhs)(i,j+1UL);
+   for( size_t j=0UL; j<columns(); ++j ) {
+      for( size_t i=0UL; i<ipos; i+=2UL ) {
+         tensor_(j,row(),i    ) *= (~rhs)(i    ,j);
+         tensor_(j,row(),i+1UL) *= (~rhs)(i+1UL,j);
       }
-      if( jpos < columns() ) {
-         tensor_(jpos,row(),i) *= (~rhs)(i,jpos);
+      if( ipos < rows() ) {
+         tensor_(j,row(),ipos) *= (~rhs)(ipos,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline auto RowSlice<MT,CRAs...>::schurAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr bool remainder( !IsPadded_v<MT> || !IsPadded_v<MT2> );
+
+   const size_t M( rows() );
+   const size_t ipos( ( remainder )?( M & size_t(-SIMDSIZE) ):( M ) );
+   BLAZE_INTERNAL_ASSERT( !remainder || ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      size_t i( 0UL );
+      Iterator left( begin(j) );
+      ConstIterator_t<MT2> right( (~rhs).begin(j) );
+
+      for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
+      }
+      for( ; remainder && i<M; ++i ) {
+         *left *= *right; ++left; ++right;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked implementation of the Schur product assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// The row-major matrix is traversed in square blocks in order to keep both the rows of the
+// right-hand side matrix and the columns of the dense rowslice, i.e. the rows of the underlying
+// tensor, in cache. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors. Instead of using this function
+// use the assignment operator.
+*/
+template< typename MT       // Type of the dense tensor
+        , size_t... CRAs >  // Compile time rowslice arguments
+template< typename MT2 >   // Type of the right-hand side dense matrix
+inline void RowSlice<MT,CRAs...>::schurAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t jj=0UL; jj<columns(); jj+=block ) {
+      const size_t jend( min( columns(), jj+block ) );
+      for( size_t ii=0UL; ii<rows(); ii+=block ) {
+         const size_t iend( min( rows(), ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               tensor_(j,row(),i) *= (~rhs)(i,j);
+            }
+         }
       }
    }
 }
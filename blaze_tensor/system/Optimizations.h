@@ -0,0 +1,90 @@
+//=================================================================================================
+/*!
+//  \file blaze_tensor/system/Optimizations.h
+//  \brief System settings for performance optimizations
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_TENSOR_SYSTEM_OPTIMIZATIONS_H_
+#define _BLAZE_TENSOR_SYSTEM_OPTIMIZATIONS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Types.h>
+#include <blaze_tensor/config/Optimizations.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DETERMINISTIC REDUCTION CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Configuration switch for deterministic parallel reductions.
+// \ingroup system
+//
+// This configuration switch enables/disables the deterministic mode of the parallel full
+// reductions of dense tensors and arrays. For more information see the configuration of the
+// BLAZE_USE_DETERMINISTIC_REDUCTION switch in <blaze_tensor/config/Optimizations.h>.
+*/
+constexpr bool useDeterministicReduction = BLAZE_USE_DETERMINISTIC_REDUCTION;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARALLEL REDUCTION SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Number of blocks of a deterministic parallel reduction.
+// \ingroup system
+//
+// This value specifies the (maximum) number of blocks a dense tensor or array is split into
+// by the deterministic parallel full reduction. The number of blocks must not depend on the
+// number of threads in order to guarantee reproducible results.
+*/
+constexpr size_t DETERMINISTIC_REDUCTION_BLOCKS = 64UL;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -39,6 +39,7 @@
 #include <array>
 #include <utility>
 
+#include <blaze/system/Inline.h>
 #include <blaze/util/SmallArray.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -69,16 +70,89 @@ std::array< size_t, N + 1 > mergeDims( std::array< size_t, N > const& dims, size
 
    result[M] = index;
 
-   for( size_t i = M + 1; i != N; ++i ) {
+   for( size_t i = M + 1; i != N + 1; ++i ) {
       result[i] = dims[i - 1];
    }
 
    return result;
 }
 
+//*************************************************************************************************
+/*!\brief Returns the number of rows of arbitrary dimension data.
+// \ingroup util
+//
+// \param dims The dimensions of the data (innermost dimension first).
+// \return The number of rows, i.e. the product of all but the innermost dimension.
+*/
+template< size_t N >
+BLAZE_ALWAYS_INLINE size_t ArrayRows( std::array< size_t, N > const& dims ) noexcept
+{
+   size_t rows = 1;
+   for( size_t d = 1; d < N; ++d ) {
+      rows *= dims[d];
+   }
+   return rows;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advances the given indices to the next row of arbitrary dimension data.
+// \ingroup util
+//
+// \param dims The dimensions of the data (innermost dimension first).
+// \param currdims The indices of the current row, updated in place.
+// \return void
+//
+// The indices of all outer dimensions are incremented like an odometer; the index of the
+// innermost dimension is left untouched.
+*/
+template< size_t N >
+BLAZE_ALWAYS_INLINE void ArrayNextRow( std::array< size_t, N > const& dims,
+   std::array< size_t, N >& currdims ) noexcept
+{
+   for( size_t d = 1; d < N && ++currdims[d] == dims[d]; ++d ) {
+      currdims[d] = 0;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Coalesces the dimensions of arbitrary dimension data.
+// \ingroup util
+//
+// \param dims The dimensions of the data (innermost dimension first).
+// \param nn The spacing between two consecutive rows (the padded innermost dimension).
+// \return The coalesced row length (index 0) and number of rows (index 1).
+//
+// Since the rows of arbitrary dimension data are stored consecutively with a spacing of \a nn,
+// all outer dimensions are merged into a single row dimension. In case the rows are not padded
+// (i.e. \a nn is equal to the innermost dimension), the rows are contiguous as well and all
+// dimensions are merged into a single row spanning all elements. Iterating over the coalesced
+// dimensions requires at most two flat loops, independent of the dimensionality of the data.
+*/
+template< size_t N >
+BLAZE_ALWAYS_INLINE std::array< size_t, 2 >
+   ArrayCoalesceDims( std::array< size_t, N > const& dims, size_t nn ) noexcept
+{
+   const size_t rows = ArrayRows( dims );
+
+   if( dims[0] == nn ) {
+      return {{ nn * rows, ( rows != 0 ) ? size_t( 1 ) : size_t( 0 ) }};
+   }
+   return {{ dims[0], rows }};
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief ArrayForEach function to iterate over arbitrary dimension data.
 // \ingroup util
+//
+// The dimensions are coalesced (see ArrayCoalesceDims()), such that the given function is called
+// from at most two flat loops, independent of the dimensionality of the data. In case the data is
+// not padded, all elements are visited by a single flat loop over consecutive offsets.
 */
 //    N == 4
 //
@@ -111,23 +185,13 @@ void ArrayForEach(
    }
 }
 
-template< typename F >
-void ArrayForEach(
-   std::array< size_t, 2 > const& dims, size_t nn, F const& f, size_t base = 0 )
-{
-   for( size_t i = base * nn, j = 0; j != dims[1]; i += nn, ++j) {
-      ArrayForEach( dims[0], f, i );
-   }
-}
-
 template< size_t N, typename F >
 void ArrayForEach(
-   std::array< size_t, N > const& dims, size_t nn, F const& f, size_t base = 0 )
+   std::array< size_t, N > const& dims, size_t nn, F const& f )
 {
-   BLAZE_STATIC_ASSERT( N >= 2 );
-   std::array< size_t, N - 1 > shifted_dims = shiftDims( dims );
-   for( size_t i = base * dims[N - 2], j = 0; j != dims[N - 1]; i += dims[N - 2], ++j) {
-      ArrayForEach( shifted_dims, nn, f, i );
+   const std::array< size_t, 2 > coalesced = ArrayCoalesceDims( dims, nn );
+   for( size_t i = 0, r = 0; r != coalesced[1]; i += nn, ++r ) {
+      ArrayForEach( coalesced[0], f, i );
    }
 }
 //*************************************************************************************************
@@ -135,6 +199,10 @@ void ArrayForEach(
 //*************************************************************************************************
 /*!\brief ArrayForEachPadded function to iterate over arbitrary dimension data.
 // \ingroup util
+//
+// All outer dimensions are merged into a single row dimension, such that the padding elements
+// of all rows are visited by two flat loops. In case the data is not padded, the function
+// returns immediately.
 */
 //    N == 4
 //
@@ -158,33 +226,19 @@ void ArrayForEach(
 //       }
 //    }
 //
-template< typename F >
-void ArrayForEachPadded(
-   std::array< size_t, 1 > const& dims, size_t nn, F const& f, size_t base = 0 )
-{
-   for( size_t i = dims[0]; i != nn; ++i ) {
-      f( i + base );
-   }
-}
-
-template< typename F >
+template< size_t N, typename F >
 void ArrayForEachPadded(
-   std::array< size_t, 2 > const& dims, size_t nn, F const& f, size_t base = 0 )
+   std::array< size_t, N > const& dims, size_t nn, F const& f )
 {
-   std::array< size_t, 1 > shifted_dims = shiftDims( dims );
-   for( size_t i = base * nn, j = 0; j != dims[1]; i += nn, ++j ) {
-      ArrayForEachPadded( shifted_dims, nn, f, i );
+   if( dims[0] == nn ) {
+      return;
    }
-}
 
-template< size_t N, typename F >
-void ArrayForEachPadded(
-   std::array< size_t, N > const& dims, size_t nn, F const& f, size_t base = 0 )
-{
-   BLAZE_STATIC_ASSERT( N >= 2 );
-   std::array< size_t, N - 1 > shifted_dims = shiftDims( dims );
-   for( size_t i = base * dims[N - 2], j = 0; j != dims[N - 1]; i += dims[N - 2], ++j ) {
-      ArrayForEachPadded( shifted_dims, nn, f, i );
+   const size_t rows = ArrayRows( dims );
+   for( size_t i = 0, r = 0; r != rows; i += nn, ++r ) {
+      for( size_t j = i + dims[0]; j != i + nn; ++j ) {
+         f( j );
+      }
    }
 }
 //*************************************************************************************************
@@ -192,6 +246,10 @@ void ArrayForEachPadded(
 //*************************************************************************************************
 /*!\brief ArrayForEachGrouped function to iterate over arbitrary dimension data.
 // \ingroup util
+//
+// All outer dimensions are merged into a single row dimension. The indices passed to the given
+// function are maintained incrementally per row (see ArrayNextRow()) instead of recursing over
+// the dimensions.
 */
 template< typename F, size_t M >
 void ArrayForEachGrouped(
@@ -202,32 +260,16 @@ void ArrayForEachGrouped(
    }
 }
 
-template< typename F, size_t M >
-void ArrayForEachGrouped(
-   std::array< size_t, 2 > const& dims, F const& f, std::array< size_t, M >& currdims )
-{
-   for( currdims[1] = 0; currdims[1] != dims[1]; ++currdims[1] ) {
-      ArrayForEachGrouped( dims[0], f, currdims );
-   }
-}
-
-template< size_t N, typename F, size_t M >
-void ArrayForEachGrouped(
-   std::array< size_t, N > const& dims, F const& f, std::array< size_t, M >& currdims )
-{
-   BLAZE_STATIC_ASSERT( N > 2 );
-   std::array< size_t, N - 1 > shifted_dims = shiftDims( dims );
-   for( currdims[N - 1] = 0; currdims[N - 1] != dims[N - 1]; ++currdims[N - 1] ) {
-      ArrayForEachGrouped( shifted_dims, f, currdims );
-   }
-}
-
 template< size_t N, typename F >
 void ArrayForEachGrouped(
    std::array< size_t, N > const& dims, F const& f )
 {
+   const size_t rows = ArrayRows( dims );
    std::array< size_t, N > currdims{};
-   ArrayForEachGrouped( dims, f, currdims );
+   for( size_t r = 0; r != rows; ++r ) {
+      ArrayForEachGrouped( dims[0], f, currdims );
+      ArrayNextRow( dims, currdims );
+   }
 }
 //*************************************************************************************************
 
@@ -326,6 +368,10 @@ void ArrayForEachGrouped(
 //*************************************************************************************************
 /*!\brief ArrayForEachGrouped function to iterate over arbitrary dimension data.
 // \ingroup util
+//
+// All outer dimensions are merged into a single row dimension. The given function is called
+// with the offset of the element and its indices, which are maintained incrementally per row
+// (see ArrayNextRow()) instead of recursing over the dimensions.
 */
 template< typename F, size_t M >
 void ArrayForEachGrouped(
@@ -336,41 +382,26 @@ void ArrayForEachGrouped(
    }
 }
 
-template< typename F, size_t M >
-void ArrayForEachGrouped(
-   std::array< size_t, 2 > const& dims, size_t nn, F const& f, std::array< size_t, M >& currdims, size_t base = 0 )
-{
-   std::array< size_t, 1 > shifted_dims = shiftDims( dims );
-   currdims[1] = 0;
-   for( size_t i = base * nn; currdims[1] != dims[1]; i += nn, ++currdims[1]) {
-      ArrayForEachGrouped( dims[0], f, currdims, i );
-   }
-}
-
-template< size_t N, typename F, size_t M >
-void ArrayForEachGrouped(
-   std::array< size_t, N > const& dims, size_t nn, F const& f, std::array< size_t, M >& currdims, size_t base = 0 )
-{
-   BLAZE_STATIC_ASSERT( N > 2 );
-   std::array< size_t, N - 1 > shifted_dims = shiftDims( dims );
-   currdims[N - 1] = 0;
-   for( size_t i = base * dims[N - 2]; currdims[N - 1] != dims[N - 1]; i += dims[N - 2], ++currdims[N - 1]) {
-      ArrayForEachGrouped( shifted_dims, nn, f, currdims, i );
-   }
-}
-
 template< size_t N, typename F >
 void ArrayForEachGrouped(
    std::array< size_t, N > const& dims, size_t nn, F const& f )
 {
+   const size_t rows = ArrayRows( dims );
    std::array< size_t, N > currdims{};
-   ArrayForEachGrouped( dims, nn, f, currdims );
+   for( size_t i = 0, r = 0; r != rows; i += nn, ++r ) {
+      ArrayForEachGrouped( dims[0], f, currdims, i );
+      ArrayNextRow( dims, currdims );
+   }
 }
 //*************************************************************************************************
 
 //*************************************************************************************************
 /*!\brief ArrayForEach2 function to iterate over arbitrary dimension data.
 // \ingroup util
+//
+// The dimensions are coalesced (see ArrayCoalesceDims()), such that the given function is called
+// with the offsets of the unpadded and the padded layout from at most two flat loops. In case the
+// data is not padded, all elements are visited by a single flat loop.
 */
 //    N == 4
 //
@@ -403,25 +434,13 @@ void ArrayForEach2(
    }
 }
 
-template< typename F >
-void ArrayForEach2(
-   std::array< size_t, 2 > const& dims, size_t nn, F const& f, size_t base )
-{
-   for( size_t i = 0; i != dims[1]; ++i ) {
-      size_t index1 = (i + base) * dims[0];
-      size_t index2 = (i + base) * nn;
-      ArrayForEach2( dims[0], f, index1, index2 );
-   }
-}
-
 template< size_t N, typename F >
 void ArrayForEach2(
-   std::array< size_t, N > const& dims, size_t nn, F const& f, size_t base = 0 )
+   std::array< size_t, N > const& dims, size_t nn, F const& f )
 {
-   BLAZE_STATIC_ASSERT( N > 2 );
-   std::array< size_t, N - 1 > shifted_dims = shiftDims( dims );
-   for( size_t i = base * dims[N - 2], j = 0; j != dims[N - 1]; i += dims[N - 2], ++j ) {
-      ArrayForEach2( shifted_dims, nn, f, i );
+   const std::array< size_t, 2 > coalesced = ArrayCoalesceDims( dims, nn );
+   for( size_t i = 0, j = 0, r = 0; r != coalesced[1]; i += coalesced[0], j += nn, ++r ) {
+      ArrayForEach2( coalesced[0], f, i, j );
    }
 }
 //*************************************************************************************************
@@ -429,29 +448,19 @@ void ArrayForEach2(
 //*************************************************************************************************
 /*!\brief ArrayForEachGroupedAnyOf function to iterate over arbitrary dimension data.
 // \ingroup util
+//
+// All outer dimensions are merged into a single row dimension and the indices passed to the
+// given predicate are maintained incrementally per row (see ArrayNextRow()). The iteration stops
+// at the first element for which the predicate returns \a true.
 */
 template< typename F, size_t M >
-bool ArrayForEachGroupedAnyOf( std::array< size_t, 1 > const& dims, F const& f,
-   std::array< size_t, M >& currdims )
-{
-   while( currdims[0] != dims[0] ) {
-      if( f( currdims ) )
-         return true;
-      ++currdims[0];
-   }
-   return false;
-}
-
-template< size_t N, typename F, size_t M >
-bool ArrayForEachGroupedAnyOf( std::array< size_t, N > const& dims, F const& f,
-   std::array< size_t, M >& currdims )
+bool ArrayForEachGroupedAnyOf(
+   size_t dim0, F const& f, std::array< size_t, M >& currdims )
 {
-   while( currdims[N - 1] != dims[N - 1] ) {
-      currdims[N - 2] = 0;
-      if( ArrayForEachGroupedAnyOf( shiftDims( dims ), f, currdims ) ) {
+   for( currdims[0] = 0; currdims[0] != dim0; ++currdims[0] ) {
+      if( f( currdims ) ) {
          return true;
       }
-      ++currdims[N - 1];
    }
    return false;
 }
@@ -460,39 +469,35 @@ template< size_t N, typename F >
 bool ArrayForEachGroupedAnyOf(
    std::array< size_t, N > const& dims, F const& f )
 {
-   BLAZE_STATIC_ASSERT( N >= 3 );
+   const size_t rows = ArrayRows( dims );
    std::array< size_t, N > currdims{};
-   return ArrayForEachGroupedAnyOf( dims, f, currdims );
+   for( size_t r = 0; r != rows; ++r ) {
+      if( ArrayForEachGroupedAnyOf( dims[0], f, currdims ) ) {
+         return true;
+      }
+      ArrayNextRow( dims, currdims );
+   }
+   return false;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief ArrayForEachGroupedAnyOf function to iterate over arbitrary dimension data.
+/*!\brief ArrayForEachGroupedAllOf function to iterate over arbitrary dimension data.
 // \ingroup util
+//
+// All outer dimensions are merged into a single row dimension and the indices passed to the
+// given predicate are maintained incrementally per row (see ArrayNextRow()). The iteration stops
+// at the first element for which the predicate returns \a false.
 */
 template< typename F, size_t M >
-bool ArrayForEachGroupedAllOf( std::array< size_t, 1 > const& dims, F const& f,
-   std::array< size_t, M >& currdims )
-{
-   while( currdims[0] != dims[0] ) {
-      if( !f( currdims ) )
-         return false;
-      ++currdims[0];
-   }
-   return true;
-}
-
-template< size_t N, typename F, size_t M >
-bool ArrayForEachGroupedAllOf( std::array< size_t, N > const& dims, F const& f,
-   std::array< size_t, M >& currdims )
+bool ArrayForEachGroupedAllOf(
+   size_t dim0, F const& f, std::array< size_t, M >& currdims )
 {
-   while( currdims[N - 1] != dims[N - 1] ) {
-      currdims[N - 2] = 0;
-      if( !ArrayForEachGroupedAllOf( shiftDims( dims ), f, currdims ) ) {
+   for( currdims[0] = 0; currdims[0] != dim0; ++currdims[0] ) {
+      if( !f( currdims ) ) {
          return false;
       }
-      ++currdims[N - 1];
    }
    return true;
 }
@@ -501,9 +506,15 @@ template< size_t N, typename F >
 bool ArrayForEachGroupedAllOf(
    std::array< size_t, N > const& dims, F const& f )
 {
-   BLAZE_STATIC_ASSERT( N >= 3 );
+   const size_t rows = ArrayRows( dims );
    std::array< size_t, N > currdims{};
-   return ArrayForEachGroupedAllOf( dims, f, currdims );
+   for( size_t r = 0; r != rows; ++r ) {
+      if( !ArrayForEachGroupedAllOf( dims[0], f, currdims ) ) {
+         return false;
+      }
+      ArrayNextRow( dims, currdims );
+   }
+   return true;
 }
 //*************************************************************************************************
 
@@ -572,6 +583,84 @@ bool ArrayDimNoneOf( std::array< size_t, N > const& dims, F const& f)
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief ArrayForEachRow function to iterate over a range of rows (the innermost dimension) of
+//        arbitrary dimension data.
+// \ingroup util
+//
+// The given function is called once per row in the range \f$[begin..end)\f$ of rows, where the
+// rows are numbered consecutively in memory order across all outer dimensions. The function
+// is passed the offset of the first element of the row (the row number times the row spacing
+// \a nn) and the indices of the row (with the index of the innermost dimension set to 0).
+*/
+template< size_t N, typename F >
+void ArrayForEachRow( std::array< size_t, N > const& dims, size_t nn,
+   size_t begin, size_t end, F const& f )
+{
+   BLAZE_STATIC_ASSERT( N >= 1 );
+
+   if( begin >= end ) {
+      return;
+   }
+
+   std::array< size_t, N > currdims{};
+   for( size_t d = 1, r = begin; d != N; ++d ) {
+      currdims[d] = r % dims[d];
+      r /= dims[d];
+   }
+
+   for( size_t r = begin, i = begin * nn; r != end; ++r, i += nn ) {
+      f( i, currdims );
+      ArrayNextRow( dims, currdims );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief ArrayForEachRow function to iterate over the rows (the innermost dimension) of
+//        arbitrary dimension data.
+// \ingroup util
+//
+// The given function is called once per row with the offset of the first element of the row
+// (the row number times the row spacing \a nn) and the indices of the row (with the index of
+// the innermost dimension set to 0). The rows are visited in memory order.
+*/
+template< size_t N, typename F >
+void ArrayForEachRow( std::array< size_t, N > const& dims, size_t nn, F const& f )
+{
+   BLAZE_STATIC_ASSERT( N >= 2 );
+
+   ArrayForEachRow( dims, nn, 0, ArrayRows( dims ), f );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief ArrayRowApply function to call a variadic element access function for an element
+//        of a row of arbitrary dimension data.
+// \ingroup util
+//
+// The given function is called with the indices of the given row (outermost dimension first)
+// followed by the column index \a j, i.e. in the order expected by the variadic access
+// functions (as for instance \c load()) of arrays.
+*/
+template< typename F, size_t N, size_t... Is >
+BLAZE_ALWAYS_INLINE decltype(auto) ArrayRowApply( F const& f,
+   std::array< size_t, N > const& dims, size_t j, std::index_sequence< Is... > )
+{
+   return f( dims[N - 1 - Is]..., j );
+}
+
+template< typename F, size_t N >
+BLAZE_ALWAYS_INLINE decltype(auto) ArrayRowApply( F const& f,
+   std::array< size_t, N > const& dims, size_t j )
+{
+   return ArrayRowApply( f, dims, j, std::make_index_sequence< N - 1 >() );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
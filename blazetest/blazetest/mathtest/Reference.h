@@ -0,0 +1,406 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/Reference.h
+//  \brief Header file for the reference computations of the dense tensor and dense array tests
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018-2019 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_REFERENCE_H_
+#define _BLAZETEST_MATHTEST_REFERENCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blazetest/mathtest/IsEqual.h>
+
+#include <blaze/math/ReductionFlag.h>
+#include <blaze_tensor/math/ReductionFlag.h>
+#include <blaze_tensor/math/dense/Moments.h>
+#include <blaze_tensor/math/expressions/DenseArray.h>
+#include <blaze_tensor/math/expressions/DenseTensor.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+//=================================================================================================
+//
+//  GENERAL CHECK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param test The label of the currently performed test.
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the computed result of an operation with the expected result. In case
+// the computed and the expected result differ in any way, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void checkResult( const std::string& test, const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MOMENTS REFERENCE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given statistical moments.
+//
+// \param test The label of the currently performed test.
+// \param result The computed moments.
+// \param expected The expected moments.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the element count and all moments of the given result with the
+// expected moments. In case any value differs, a \a std::runtime_error exception is thrown.
+*/
+inline void checkMoments( const std::string& test, const blaze::Moments<double>& result,
+                          const blaze::Moments<double>& expected )
+{
+   if( result.count != expected.count || !isEqual( result.mean, expected.mean ) ||
+       !isEqual( result.variance, expected.variance ) ||
+       !isEqual( result.min, expected.min ) || !isEqual( result.max, expected.max ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test << "\n"
+          << " Error: Moments computation failed\n"
+          << " Details:\n"
+          << "   Result: count=" << result.count << " mean=" << result.mean
+          << " variance=" << result.variance << " min=" << result.min
+          << " max=" << result.max << "\n"
+          << "   Expected result: count=" << expected.count << " mean=" << expected.mean
+          << " variance=" << expected.variance << " min=" << expected.min
+          << " max=" << expected.max << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the statistical moments of a sequence of values by means of naive loops.
+//
+// \param n The number of values (at least 2).
+// \param get The accessor returning the \a l-th value of the sequence.
+// \return The moments of the sequence, including the unbiased sample variance.
+*/
+template< typename Getter >  // Type of the value accessor
+blaze::Moments<double> referenceMoments( size_t n, Getter get )
+{
+   double mean( 0.0 ), min( get( 0UL ) ), max( get( 0UL ) );
+   for( size_t l=0UL; l<n; ++l ) {
+      mean += get( l );
+      min = std::min<double>( min, get( l ) );
+      max = std::max<double>( max, get( l ) );
+   }
+   mean /= n;
+
+   double variance( 0.0 );
+   for( size_t l=0UL; l<n; ++l ) {
+      variance += ( get( l ) - mean ) * ( get( l ) - mean );
+   }
+   variance /= ( n - 1UL );
+
+   return blaze::Moments<double>{ n, mean, variance, min, max };
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INDEX REFERENCE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given computed index.
+//
+// \param test The label of the currently performed test.
+// \param result The computed index.
+// \param expected The expected index.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given computed index with the expected index. In case the two
+// indices differ, a \a std::runtime_error exception is thrown.
+*/
+inline void checkIndex( const std::string& test, size_t result, size_t expected )
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test << "\n"
+          << " Error: Index computation failed\n"
+          << " Details:\n"
+          << "   Result: " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the index of the first extremal value of a sequence by means of naive loops.
+//
+// \param n The number of values (at least 1).
+// \param get The accessor returning the \a l-th value of the sequence.
+// \param precedes The comparison that decides whether a value replaces the current extremum.
+// \return The index of the first value that is not preceded by any other value.
+*/
+template< typename Getter     // Type of the value accessor
+        , typename Compare >  // Type of the comparison
+size_t referenceIndex( size_t n, Getter get, Compare precedes )
+{
+   size_t index( 0UL );
+   for( size_t l=1UL; l<n; ++l ) {
+      if( precedes( get( l ), get( index ) ) )
+         index = l;
+   }
+   return index;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCAN REFERENCE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the inclusive scan of arbitrary dimension data by means of naive loops.
+//
+// \param x The dense tensor or dense array to be scanned.
+// \param dims The dimensions of the data (innermost dimension first).
+// \param axis The scanned dimension (0 is the innermost dimension).
+// \param at The accessor returning the element at the given indices (innermost index first).
+// \param op The binary scan operation.
+// \return The scanned tensor or array.
+//
+// This function visits all elements of the given data with the innermost index running fastest,
+// such that the predecessor of each element along the scanned dimension is always final before
+// it is combined with the element.
+*/
+template< typename Type    // Type of the dense tensor or dense array
+        , size_t N         // Number of dimensions
+        , typename Access  // Type of the element accessor
+        , typename OP >    // Type of the scan operation
+Type referenceScan( const Type& x, const std::array<size_t,N>& dims, size_t axis,
+                    Access at, OP op )
+{
+   size_t total( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      total *= dims[d];
+   }
+
+   Type result( x );
+   std::array<size_t,N> idx{};
+
+   for( size_t count=0UL; count<total; ++count )
+   {
+      if( idx[axis] > 0UL ) {
+         std::array<size_t,N> prev( idx );
+         --prev[axis];
+         at( result, idx ) = op( at( result, prev ), at( x, idx ) );
+      }
+
+      for( size_t d=0UL; d<N; ++d ) {
+         if( ++idx[d] < dims[d] ) break;
+         idx[d] = 0UL;
+      }
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inclusive scan of the given dense tensor by means of naive loops.
+//
+// \param tensor The dense tensor to be scanned.
+// \param axis The scanned axis (\a blaze::columnwise, \a blaze::rowwise, or \a blaze::pagewise).
+// \param op The binary scan operation.
+// \return The scanned tensor.
+*/
+template< typename TT    // Type of the dense tensor
+        , typename OP >  // Type of the scan operation
+TT referenceScan( const blaze::DenseTensor<TT>& tensor, size_t axis, OP op )
+{
+   const std::array<size_t,3UL> dims{ { (~tensor).columns(), (~tensor).rows(),
+                                        (~tensor).pages() } };
+
+   const size_t dim( axis == blaze::rowwise ? 0UL : axis == blaze::columnwise ? 1UL : 2UL );
+
+   return referenceScan( ~tensor, dims, dim,
+      []( auto& t, const std::array<size_t,3UL>& idx ) -> decltype(auto) {
+         return t( idx[2], idx[1], idx[0] ); }, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inclusive scan of the given dense array by means of naive loops.
+//
+// \param array The dense array to be scanned.
+// \param axis The scanned dimension (0 is the innermost dimension).
+// \param op The binary scan operation.
+// \return The scanned array.
+*/
+template< typename AT    // Type of the dense array
+        , typename OP >  // Type of the scan operation
+AT referenceScan( const blaze::DenseArray<AT>& array, size_t axis, OP op )
+{
+   constexpr size_t N( AT::num_dimensions );
+
+   return referenceScan( ~array, (~array).dimensions(), axis,
+      []( auto& a, const std::array<size_t,N>& idx ) -> decltype(auto) {
+         return a( idx ); }, op );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NORM REFERENCE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single computed norm.
+//
+// \param test The label of the currently performed test.
+// \param norm The name of the checked norm.
+// \param result The computed norm.
+// \param expected The expected norm.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void checkNorm( const std::string& test, const std::string& norm,
+                       double result, double expected )
+{
+   if( !isEqual( result, expected ) ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test << "\n"
+          << " Error: " << norm << " computation failed\n"
+          << " Details:\n"
+          << "   Result: " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking all norms of the given dense tensor or dense array by means of naive loops.
+//
+// \param test The label of the currently performed test.
+// \param x The dense tensor or dense array operand.
+// \param n The total number of elements of the operand.
+// \param get The accessor returning the \a l-th element of the operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of \c norm(), \c sqrNorm(), \c l1Norm(), \c l2Norm(),
+// \c lpNorm() and \c maxNorm() for the given operand with the results of a naive loop over all
+// \a n elements. The norm functions are found via argument dependent lookup, such that the
+// function can be used for both dense tensors and dense arrays. In case any result differs, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type      // Type of the dense tensor or dense array
+        , typename Getter >  // Type of the element accessor
+void checkNorms( const std::string& test, const Type& x, size_t n, Getter get )
+{
+   double sqr( 0.0 ), l1( 0.0 ), l3( 0.0 ), max( 0.0 );
+   for( size_t l=0UL; l<n; ++l ) {
+      const double a( std::abs( get( l ) ) );
+      sqr += a * a;
+      l1  += a;
+      l3  += a * a * a;
+      max  = ( a > max ) ? a : max;
+   }
+
+   checkNorm( test, "Norm", norm( x ), std::sqrt( sqr ) );
+   checkNorm( test, "Squared norm", sqrNorm( x ), sqr );
+   checkNorm( test, "L1 norm", l1Norm( x ), l1 );
+   checkNorm( test, "L2 norm", l2Norm( x ), std::sqrt( sqr ) );
+   checkNorm( test, "Lp norm", lpNorm( x, 3 ), std::cbrt( l3 ) );
+   checkNorm( test, "Maximum norm", maxNorm( x ), max );
+}
+//*************************************************************************************************
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -41,6 +41,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -128,6 +129,10 @@ class AlignedPaddedTest
 
    template< typename Type >
    void checkNonZeros( const Type& tensor, size_t i, size_t k, size_t expectedNonZeros ) const;
+
+   template< typename Type1, typename Type2, size_t N >
+   void checkTranspose( const Type1& result, const Type2& original,
+                        const std::array<size_t,N>& perm ) const;
    //@}
    //**********************************************************************************************
 
@@ -401,6 +406,83 @@ void AlignedPaddedTest::checkNonZeros( const Type& tensor, size_t i, size_t k, s
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the axis permutation of the given dense array.
+//
+// \param result The permuted dense array to be checked.
+// \param original The original dense array.
+// \param perm The axis mapping (outermost axis first).
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the given permuted dense array, where
+// axis \a d of the result corresponds to axis \a perm[d] of the original array. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1  // Type of the permuted dense array
+        , typename Type2  // Type of the original dense array
+        , size_t N >      // Number of dimensions
+void AlignedPaddedTest::checkTranspose( const Type1& result, const Type2& original,
+                                        const std::array<size_t,N>& perm ) const
+{
+   const std::array<size_t,N> dims( result.dimensions() );
+
+   for( size_t d=0UL; d<N; ++d )
+   {
+      if( dims[N-1UL-d] != original.dimensions()[N-1UL-perm[d]] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid dimensions of the permuted array detected\n"
+             << " Details:\n"
+             << "   Axis " << d << " of the permuted array: " << dims[N-1UL-d] << "\n"
+             << "   Expected extent: " << original.dimensions()[N-1UL-perm[d]] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   size_t total( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      total *= dims[d];
+   }
+
+   std::array<size_t,N> idx{}, source{};
+
+   for( size_t count=0UL; count<total; ++count )
+   {
+      for( size_t d=0UL; d<N; ++d ) {
+         source[N-1UL-perm[N-1UL-d]] = idx[d];
+      }
+
+      if( result( idx ) != original( source ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Element " << count << " of the permuted array: " << result( idx ) << "\n"
+             << "   Expected value: " << original( source ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t d=0UL; d<N; ++d ) {
+         if( ++idx[d] < dims[d] ) break;
+         idx[d] = 0UL;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -41,9 +41,16 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/mathtest/Reference.h>
+
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sub.h>
 
 
 namespace blazetest {
@@ -111,6 +118,15 @@ class GeneralTest
    void testL3Norm();
    void testL4Norm();
    void testLpNorm();
+   void testNorms();
+   void testInner();
+   void testMoments();
+   void testArgMinMax();
+   void testScan();
+   void testTrans();
+   void testBroadcast();
+   void testPartialReduce();
+   void testAssign();
 
    template< typename Type >
    void checkRows( const Type& tensor, size_t expectedRows ) const;
@@ -129,6 +145,19 @@ class GeneralTest
 
    template< typename Type >
    void checkNonZeros( const Type& tensor, size_t i, size_t k, size_t expectedNonZeros ) const;
+
+   template< typename Type1, typename Type2, size_t N >
+   void checkTranspose( const Type1& result, const Type2& original,
+                        const std::array<size_t,N>& perm ) const;
+
+   template< typename Type1, typename Type2, typename Type3, typename OP >
+   void checkBroadcast( const Type1& result, const Type2& lhs, const Type3& rhs, OP op ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkAssign( const Type1& init, const Type2& rhs ) const;
+
+   template< typename Type1, typename Type2, typename OP >
+   void checkReduce( const Type1& result, const Type2& original, size_t R, OP op ) const;
    //@}
    //**********************************************************************************************
 
@@ -339,6 +368,266 @@ void GeneralTest::checkNonZeros( const Type& tensor, size_t i, size_t k, size_t
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the axis permutation of the given dense array.
+//
+// \param result The permuted dense array to be checked.
+// \param original The original dense array.
+// \param perm The axis mapping (outermost axis first).
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the given permuted dense array, where
+// axis \a d of the result corresponds to axis \a perm[d] of the original array. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1  // Type of the permuted dense array
+        , typename Type2  // Type of the original dense array
+        , size_t N >      // Number of dimensions
+void GeneralTest::checkTranspose( const Type1& result, const Type2& original,
+                                  const std::array<size_t,N>& perm ) const
+{
+   const std::array<size_t,N> dims( result.dimensions() );
+
+   for( size_t d=0UL; d<N; ++d )
+   {
+      if( dims[N-1UL-d] != original.dimensions()[N-1UL-perm[d]] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid dimensions of the permuted array detected\n"
+             << " Details:\n"
+             << "   Axis " << d << " of the permuted array: " << dims[N-1UL-d] << "\n"
+             << "   Expected extent: " << original.dimensions()[N-1UL-perm[d]] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   size_t total( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      total *= dims[d];
+   }
+
+   std::array<size_t,N> idx{}, source{};
+
+   for( size_t count=0UL; count<total; ++count )
+   {
+      for( size_t d=0UL; d<N; ++d ) {
+         source[N-1UL-perm[N-1UL-d]] = idx[d];
+      }
+
+      if( result( idx ) != original( source ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Element " << count << " of the permuted array: " << result( idx ) << "\n"
+             << "   Expected value: " << original( source ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t d=0UL; d<N; ++d ) {
+         if( ++idx[d] < dims[d] ) break;
+         idx[d] = 0UL;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the broadcast binary operation on the given dense arrays.
+//
+// \param result The result of the broadcast operation to be checked.
+// \param lhs The left-hand side dense array operand.
+// \param rhs The right-hand side dense array operand.
+// \param op The binary operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the given result of a broadcast
+// operation. The dimensions of the operands are aligned at the innermost dimension, and
+// missing outer dimensions and dimensions of size 1 are broadcast. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1  // Type of the resulting dense array
+        , typename Type2  // Type of the left-hand side dense array
+        , typename Type3  // Type of the right-hand side dense array
+        , typename OP >   // Type of the binary operation
+void GeneralTest::checkBroadcast( const Type1& result, const Type2& lhs, const Type3& rhs, OP op ) const
+{
+   constexpr size_t N ( Type1::num_dimensions );
+   constexpr size_t N1( Type2::num_dimensions );
+   constexpr size_t N2( Type3::num_dimensions );
+
+   const std::array<size_t,N> dims( result.dimensions() );
+
+   for( size_t d=0UL; d<N; ++d )
+   {
+      const size_t ldim( d < N1 ? lhs.dimensions()[d] : 1UL );
+      const size_t rdim( d < N2 ? rhs.dimensions()[d] : 1UL );
+
+      if( dims[d] != ( ldim == 1UL ? rdim : ldim ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid dimensions of the broadcast result detected\n"
+             << " Details:\n"
+             << "   Dimension " << d << " of the result: " << dims[d] << "\n"
+             << "   Expected extent: " << ( ldim == 1UL ? rdim : ldim ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   size_t total( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      total *= dims[d];
+   }
+
+   std::array<size_t,N > idx{};
+   std::array<size_t,N1> li{};
+   std::array<size_t,N2> ri{};
+
+   for( size_t count=0UL; count<total; ++count )
+   {
+      for( size_t d=0UL; d<N1; ++d ) {
+         li[d] = ( lhs.dimensions()[d] == 1UL ? 0UL : idx[d] );
+      }
+      for( size_t d=0UL; d<N2; ++d ) {
+         ri[d] = ( rhs.dimensions()[d] == 1UL ? 0UL : idx[d] );
+      }
+
+      if( result( idx ) != op( lhs( li ), rhs( ri ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Broadcast operation failed\n"
+             << " Details:\n"
+             << "   Element " << count << " of the result: " << result( idx ) << "\n"
+             << "   Expected value: " << op( lhs( li ), rhs( ri ) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t d=0UL; d<N; ++d ) {
+         if( ++idx[d] < dims[d] ) break;
+         idx[d] = 0UL;
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Checking the (compound) assignments of the given dense array.
+//
+// \param init The initial value of the target dense array.
+// \param rhs The right-hand side dense array to be assigned.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the assignment, addition assignment, subtraction assignment, and Schur
+// product assignment of the given right-hand side dense array to a copy of \a init. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the target dense array
+        , typename Type2 >  // Type of the right-hand side dense array
+void GeneralTest::checkAssign( const Type1& init, const Type2& rhs ) const
+{
+   Type1 result( init );
+
+   result = rhs;
+   checkBroadcast( result, init, rhs, []( const auto&, const auto& b ) { return b; } );
+
+   result = init;
+   result += rhs;
+   checkBroadcast( result, init, rhs, blaze::Add() );
+
+   result = init;
+   result -= rhs;
+   checkBroadcast( result, init, rhs, blaze::Sub() );
+
+   result = init;
+   result %= rhs;
+   checkBroadcast( result, init, rhs, blaze::Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the partial reduction of the given dense array.
+//
+// \param result The reduced dense array to be checked.
+// \param original The original dense array.
+// \param R The reduced dimension (0 is the innermost dimension).
+// \param op The reduction operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the given reduced dense array, which
+// is expected to have the dimensions of the original array without dimension \a R. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1  // Type of the reduced dense array
+        , typename Type2  // Type of the original dense array
+        , typename OP >   // Type of the reduction operation
+void GeneralTest::checkReduce( const Type1& result, const Type2& original, size_t R, OP op ) const
+{
+   constexpr size_t N( Type2::num_dimensions );
+
+   const std::array<size_t,N-1UL> dims( result.dimensions() );
+
+   for( size_t d=0UL; d<N-1UL; ++d )
+   {
+      if( dims[d] != original.dimensions()[d < R ? d : d+1UL] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid dimensions of the reduced array detected\n"
+             << " Details:\n"
+             << "   Reduced dimension: " << R << "\n"
+             << "   Dimension " << d << " of the result: " << dims[d] << "\n"
+             << "   Expected extent: " << original.dimensions()[d < R ? d : d+1UL] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   size_t total( 1UL );
+   for( size_t d=0UL; d<N-1UL; ++d ) {
+      total *= dims[d];
+   }
+
+   std::array<size_t,N-1UL> idx{};
+   std::array<size_t,N> source{};
+
+   for( size_t count=0UL; count<total; ++count )
+   {
+      for( size_t d=0UL; d<N-1UL; ++d ) {
+         source[d < R ? d : d+1UL] = idx[d];
+      }
+
+      source[R] = 0UL;
+      auto expected( original( source ) );
+
+      for( size_t k=1UL; k<original.dimensions()[R]; ++k ) {
+         source[R] = k;
+         expected = op( expected, original( source ) );
+      }
+
+      if( result( idx ) != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Partial reduction failed\n"
+             << " Details:\n"
+             << "   Reduced dimension: " << R << "\n"
+             << "   Element " << count << " of the result: " << result( idx ) << "\n"
+             << "   Expected value: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t d=0UL; d<N-1UL; ++d ) {
+         if( ++idx[d] < dims[d] ) break;
+         idx[d] = 0UL;
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
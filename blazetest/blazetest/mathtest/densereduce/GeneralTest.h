@@ -0,0 +1,325 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/densereduce/GeneralTest.h
+//  \brief Header file for the general dense reduction test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZETEST_MATHTEST_DENSEREDUCE_GENERALTEST_H_
+#define _BLAZETEST_MATHTEST_DENSEREDUCE_GENERALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blazetest/mathtest/IsEqual.h>
+
+#include <blaze_tensor/math/DynamicArray.h>
+#include <blaze_tensor/math/DynamicTensor.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace densereduce {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the general dense reduction test.
+//
+// This class represents a test suite for the total reductions of dense tensors and dense arrays
+// whose size exceeds the SMP thresholds for reductions (SMP_DTENSREDUCE_THRESHOLD and
+// SMP_DARRREDUCE_THRESHOLD). It compares the results of the parallel reductions with the result
+// of serial loops and checks that repeated reductions of the same operand are reproducible.
+*/
+class GeneralTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit GeneralTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testTensor();
+   void testArray();
+   void testReproducibility();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult ) const;
+
+   template< typename Type >
+   void checkReproducibility( const Type& operand ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename TT, typename OP >
+   blaze::ElementType_t<TT> reference( const blaze::DenseTensor<TT>& tens, OP op ) const;
+
+   template< typename AT, typename OP >
+   blaze::ElementType_t<AT> reference( const blaze::DenseArray<AT>& arr, OP op ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the computed result of a reduction with the expected result. Floating
+// point results are compared with the accuracy margin of the isEqual() function, since the
+// parallel reduction combines the elements in a different order than the serial loop. In case
+// the computed and the expected result differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void GeneralTest::checkResult( const T1& computedResult, const T2& expectedResult ) const
+{
+   if( !isEqual( computedResult, expectedResult ) ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result: " << computedResult << "\n"
+          << "   Expected result: " << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that repeated reductions of the given operand give bit-identical results.
+//
+// \param operand The dense tensor or dense array to be reduced.
+// \return void
+// \exception std::runtime_error Irreproducible result detected.
+//
+// This function repeatedly computes the sum, the product, and the maximum of the given operand
+// and compares the results bit by bit with the results of the first run. In case any result
+// differs, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the dense operand
+void GeneralTest::checkReproducibility( const Type& operand ) const
+{
+   const auto sum ( blaze::sum ( operand ) );
+   const auto prod( blaze::prod( operand ) );
+   const auto max ( blaze::max ( operand ) );
+
+   for( size_t run=1UL; run<8UL; ++run )
+   {
+      const auto sum2 ( blaze::sum ( operand ) );
+      const auto prod2( blaze::prod( operand ) );
+      const auto max2 ( blaze::max ( operand ) );
+
+      if( sum2 != sum || prod2 != prod || max2 != max ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test: " << test_ << "\n"
+             << " Error: Irreproducible reduction result detected\n"
+             << " Details:\n"
+             << "   Run: " << run << "\n"
+             << "   Sum    : " << sum2  << " (first run: " << sum  << ")\n"
+             << "   Product: " << prod2 << " (first run: " << prod << ")\n"
+             << "   Maximum: " << max2  << " (first run: " << max  << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense tensor by means of a serial loop.
+//
+// \param tens The dense tensor to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+*/
+template< typename TT    // Type of the dense tensor
+        , typename OP >  // Type of the reduction operation
+blaze::ElementType_t<TT>
+   GeneralTest::reference( const blaze::DenseTensor<TT>& tens, OP op ) const
+{
+   blaze::ElementType_t<TT> result( (~tens)(0UL,0UL,0UL) );
+
+   for( size_t k=0UL; k<(~tens).pages(); ++k ) {
+      for( size_t i=0UL; i<(~tens).rows(); ++i ) {
+         for( size_t j=0UL; j<(~tens).columns(); ++j ) {
+            if( k > 0UL || i > 0UL || j > 0UL )
+               result = op( result, (~tens)(k,i,j) );
+         }
+      }
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense array by means of a serial loop.
+//
+// \param arr The dense array to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// The elements of the array are visited with the innermost index running fastest.
+*/
+template< typename AT    // Type of the dense array
+        , typename OP >  // Type of the reduction operation
+blaze::ElementType_t<AT>
+   GeneralTest::reference( const blaze::DenseArray<AT>& arr, OP op ) const
+{
+   constexpr size_t N( AT::num_dimensions );
+
+   const std::array<size_t,N> dims( (~arr).dimensions() );
+
+   size_t total( 1UL );
+   for( size_t d=0UL; d<N; ++d ) {
+      total *= dims[d];
+   }
+
+   std::array<size_t,N> idx{};
+   blaze::ElementType_t<AT> result( (~arr)( idx ) );
+
+   for( size_t count=1UL; count<total; ++count )
+   {
+      for( size_t d=0UL; d<N; ++d ) {
+         if( ++idx[d] < dims[d] ) break;
+         idx[d] = 0UL;
+      }
+
+      result = op( result, (~arr)( idx ) );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel total reductions of dense tensors and dense arrays.
+//
+// \return void
+*/
+void runTest()
+{
+   GeneralTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the general dense reduction test.
+*/
+#define RUN_DENSEREDUCE_GENERAL_TEST \
+   blazetest::mathtest::densereduce::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace densereduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -41,9 +41,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <blazetest/mathtest/IsEqual.h>
+#include <blazetest/mathtest/Reference.h>
 
 
 namespace blazetest {
@@ -111,6 +114,14 @@ class GeneralTest
    void testL3Norm();
    void testL4Norm();
    void testLpNorm();
+   void testNorms();
+   void testInner();
+   void testReduce();
+   void testMoments();
+   void testArgMinMax();
+   void testScan();
+   void testTrans();
+   void testTransKernels();
 
    template< typename Type >
    void checkRows( const Type& tensor, size_t expectedRows ) const;
@@ -129,6 +140,16 @@ class GeneralTest
 
    template< typename Type >
    void checkNonZeros( const Type& tensor, size_t i, size_t k, size_t expectedNonZeros ) const;
+
+   template< typename T1, typename T2 >
+   void checkTranspose( const T1& result, const T2& original,
+                        const std::array<size_t,3UL>& perm ) const;
+
+   template< typename Type >
+   void checkIterators( const Type& tensor ) const;
+
+   template< typename Type >
+   void checkPermutations( size_t o, size_t m, size_t n ) const;
    //@}
    //**********************************************************************************************
 
@@ -339,6 +360,173 @@ void GeneralTest::checkNonZeros( const Type& tensor, size_t i, size_t k, size_t
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the axis permutation of the given dense tensor.
+//
+// \param result The permuted dense tensor to be checked.
+// \param original The original dense tensor.
+// \param perm The axis mapping.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the given permuted dense tensor,
+// where axis \a d of the result corresponds to axis \a perm[d] of the original tensor. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the permuted dense tensor
+        , typename T2 >  // Type of the original dense tensor
+void GeneralTest::checkTranspose( const T1& result, const T2& original,
+                                  const std::array<size_t,3UL>& perm ) const
+{
+   const std::array<size_t,3UL> dims{ { original.pages(), original.rows(), original.columns() } };
+
+   if( result.pages() != dims[perm[0]] || result.rows() != dims[perm[1]] ||
+       result.columns() != dims[perm[2]] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid dimensions of the permuted tensor detected\n"
+          << " Details:\n"
+          << "   Axis mapping   : ( " << perm[0] << " " << perm[1] << " " << perm[2] << " )\n"
+          << "   Permuted tensor: " << result.pages() << "x" << result.rows() << "x"
+          << result.columns() << "\n"
+          << "   Original tensor: " << dims[0] << "x" << dims[1] << "x" << dims[2] << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::array<size_t,3UL> index, source;
+
+   for( index[0]=0UL; index[0]<result.pages(); ++index[0] ) {
+      for( index[1]=0UL; index[1]<result.rows(); ++index[1] ) {
+         for( index[2]=0UL; index[2]<result.columns(); ++index[2] )
+         {
+            for( size_t d=0UL; d<3UL; ++d ) {
+               source[perm[d]] = index[d];
+            }
+
+            if( result(index[0],index[1],index[2]) != original(source[0],source[1],source[2]) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Transpose operation failed\n"
+                   << " Details:\n"
+                   << "   Axis mapping: ( " << perm[0] << " " << perm[1] << " " << perm[2] << " )\n"
+                   << "   Element (" << index[0] << "," << index[1] << "," << index[2] << "): "
+                   << result(index[0],index[1],index[2]) << "\n"
+                   << "   Expected value: " << original(source[0],source[1],source[2]) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the row iterators of the given dense tensor.
+//
+// \param tensor The dense tensor to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function traverses all rows of the given dense tensor by means of the begin() and end()
+// functions and compares the visited elements with the result of the function call operator.
+// In case an iterator visits a wrong element or the wrong number of elements, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the dense tensor
+void GeneralTest::checkIterators( const Type& tensor ) const
+{
+   for( size_t k=0UL; k<tensor.pages(); ++k ) {
+      for( size_t i=0UL; i<tensor.rows(); ++i )
+      {
+         size_t j( 0UL );
+
+         for( auto it=tensor.begin( i, k ); it!=tensor.end( i, k ); ++it, ++j )
+         {
+            if( j >= tensor.columns() || *it != tensor(k,i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid iterator traversal detected\n"
+                   << " Details:\n"
+                   << "   Row " << i << " of page " << k << ", column " << j << "\n"
+                   << "   Number of columns: " << tensor.columns() << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         if( j != tensor.columns() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of visited elements detected\n"
+                << " Details:\n"
+                << "   Row " << i << " of page " << k << "\n"
+                << "   Number of visited elements: " << j << "\n"
+                << "   Number of columns         : " << tensor.columns() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking all six axis permutations of a random dense tensor of the given size.
+//
+// \param o The number of pages of the dense tensor.
+// \param m The number of rows of the dense tensor.
+// \param n The number of columns of the dense tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns all six axis permutations of a random \a o x \a m x \a n dense tensor
+// with element type \a Type to dynamic tensors, both by means of compile time and runtime axis
+// mappings and both with the default (possibly parallel) and the serial assignment, and compares
+// the results element-wise with the original tensor. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the dense tensors
+void GeneralTest::checkPermutations( size_t o, size_t m, size_t n ) const
+{
+   using blaze::serial;
+   using blaze::trans;
+
+   using TT = blaze::DynamicTensor<Type>;
+
+   TT tens( o, m, n );
+   randomize( tens );
+
+   checkTranspose( TT( trans( tens, { 0UL, 1UL, 2UL } ) ), tens, {{ 0UL, 1UL, 2UL }} );
+   checkTranspose( TT( trans( tens, { 0UL, 2UL, 1UL } ) ), tens, {{ 0UL, 2UL, 1UL }} );
+   checkTranspose( TT( trans( tens, { 1UL, 0UL, 2UL } ) ), tens, {{ 1UL, 0UL, 2UL }} );
+   checkTranspose( TT( trans( tens, { 1UL, 2UL, 0UL } ) ), tens, {{ 1UL, 2UL, 0UL }} );
+   checkTranspose( TT( trans( tens, { 2UL, 0UL, 1UL } ) ), tens, {{ 2UL, 0UL, 1UL }} );
+   checkTranspose( TT( trans( tens, { 2UL, 1UL, 0UL } ) ), tens, {{ 2UL, 1UL, 0UL }} );
+
+   checkTranspose( TT( trans<0UL,2UL,1UL>( tens ) ), tens, {{ 0UL, 2UL, 1UL }} );
+   checkTranspose( TT( trans<1UL,0UL,2UL>( tens ) ), tens, {{ 1UL, 0UL, 2UL }} );
+   checkTranspose( TT( trans<1UL,2UL,0UL>( tens ) ), tens, {{ 1UL, 2UL, 0UL }} );
+   checkTranspose( TT( trans<2UL,0UL,1UL>( tens ) ), tens, {{ 2UL, 0UL, 1UL }} );
+   checkTranspose( TT( trans<2UL,1UL,0UL>( tens ) ), tens, {{ 2UL, 1UL, 0UL }} );
+
+   checkTranspose( TT( serial( trans( tens, { 0UL, 1UL, 2UL } ) ) ), tens, {{ 0UL, 1UL, 2UL }} );
+   checkTranspose( TT( serial( trans( tens, { 0UL, 2UL, 1UL } ) ) ), tens, {{ 0UL, 2UL, 1UL }} );
+   checkTranspose( TT( serial( trans( tens, { 1UL, 0UL, 2UL } ) ) ), tens, {{ 1UL, 0UL, 2UL }} );
+   checkTranspose( TT( serial( trans( tens, { 1UL, 2UL, 0UL } ) ) ), tens, {{ 1UL, 2UL, 0UL }} );
+   checkTranspose( TT( serial( trans( tens, { 2UL, 0UL, 1UL } ) ) ), tens, {{ 2UL, 0UL, 1UL }} );
+   checkTranspose( TT( serial( trans( tens, { 2UL, 1UL, 0UL } ) ) ), tens, {{ 2UL, 1UL, 0UL }} );
+
+   TT result( 1UL, 1UL, 1UL );
+
+   result = trans<2UL,0UL,1UL>( tens );
+   checkTranspose( result, tens, {{ 2UL, 0UL, 1UL }} );
+
+   result = serial( trans<1UL,2UL,0UL>( tens ) );
+   checkTranspose( result, tens, {{ 1UL, 2UL, 0UL }} );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
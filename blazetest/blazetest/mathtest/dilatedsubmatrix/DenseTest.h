@@ -116,6 +116,7 @@ class DenseTest
    void testColumn();
    void testColumns();
    void testBand();
+   void testSIMDAssign();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -128,6 +129,10 @@ class DenseTest
 
    template< typename Type >
    void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename Type, bool SO >
+   void checkSIMDAssign( size_t row, size_t column, size_t m, size_t n,
+                         size_t rowDilation, size_t columnDilation ) const;
    //@}
    //**********************************************************************************************
 
@@ -322,6 +327,100 @@ void DenseTest::checkNonZeros( const Type& matrix, size_t index, size_t expected
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the vectorized assignments to and from a dilated submatrix.
+//
+// \param row The index of the first row of the dilated submatrix.
+// \param column The index of the first column of the dilated submatrix.
+// \param m The number of rows of the dilated submatrix.
+// \param n The number of columns of the dilated submatrix.
+// \param rowDilation The step between two consecutive rows of the dilated submatrix.
+// \param columnDilation The step between two consecutive columns of the dilated submatrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs the assignment, the addition assignment, the subtraction assignment,
+// and the Schur product assignment of a dense matrix to a dilated submatrix with the given
+// element type and storage order, and evaluates an addition with the dilated submatrix as
+// operand. All results are compared to the results of scalar loops. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type of the dense matrices
+        , bool SO >      // Storage order of the dense matrices
+void DenseTest::checkSIMDAssign( size_t row, size_t column, size_t m, size_t n,
+                                 size_t rowDilation, size_t columnDilation ) const
+{
+   using MatT = blaze::DynamicMatrix<Type,SO>;
+
+   MatT mat( row + m*rowDilation + 2UL, column + n*columnDilation + 3UL );
+   randomize( mat );
+
+   MatT rhs( m, n );
+   randomize( rhs );
+
+   MatT expected( mat );
+
+   auto sm = blaze::dilatedsubmatrix( mat, row, column, m, n, rowDilation, columnDilation );
+
+   const auto check = [&]( const char* operation ) {
+      if( mat != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << operation << " failed\n"
+             << " Details:\n"
+             << "   Storage order: " << ( SO == blaze::rowMajor ? "row-major" : "column-major" ) << "\n"
+             << "   Size: " << m << "x" << n << ", dilations: " << rowDilation << "x" << columnDilation << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+   sm = rhs;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(row+i*rowDilation,column+j*columnDilation) = rhs(i,j);
+   check( "Assignment" );
+
+   sm += rhs;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(row+i*rowDilation,column+j*columnDilation) += rhs(i,j);
+   check( "Addition assignment" );
+
+   sm -= rhs;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(row+i*rowDilation,column+j*columnDilation) -= rhs(i,j);
+   check( "Subtraction assignment" );
+
+   sm %= rhs;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(row+i*rowDilation,column+j*columnDilation) *= rhs(i,j);
+   check( "Schur product assignment" );
+
+   const MatT sum( sm + rhs );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( sum(i,j) != mat(row+i*rowDilation,column+j*columnDilation) + rhs(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Vectorized read access failed\n"
+                << " Details:\n"
+                << "   Storage order: " << ( SO == blaze::rowMajor ? "row-major" : "column-major" ) << "\n"
+                << "   Size: " << m << "x" << n << ", dilations: " << rowDilation << "x" << columnDilation << "\n"
+                << "   Element (" << i << "," << j << "): " << sum(i,j) << "\n"
+                << "   Expected value: " << ( mat(row+i*rowDilation,column+j*columnDilation) + rhs(i,j) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
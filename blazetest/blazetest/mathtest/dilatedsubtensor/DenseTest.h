@@ -112,7 +112,7 @@ class DenseTest
    void testPageslice();
    void testRowslice();
    void testColumnslice();
-
+   void testSIMDAssign();
 
    template< typename Type >
    void checkPages( const Type& tensor, size_t expectedPages ) const;
@@ -128,6 +128,10 @@ class DenseTest
 
    template< typename Type >
    void checkNonZeros( const Type& tensor, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkSIMDAssign( size_t o, size_t m, size_t n, size_t pageDilation,
+                         size_t rowDilation, size_t columnDilation ) const;
    //@}
    //**********************************************************************************************
 
@@ -340,6 +344,114 @@ void DenseTest::checkNonZeros( const Type& tensor, size_t index, size_t expected
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the vectorized assignments to and from a dilated subtensor.
+//
+// \param o The number of pages of the dilated subtensor.
+// \param m The number of rows of the dilated subtensor.
+// \param n The number of columns of the dilated subtensor.
+// \param pageDilation The step between two consecutive pages of the dilated subtensor.
+// \param rowDilation The step between two consecutive rows of the dilated subtensor.
+// \param columnDilation The step between two consecutive columns of the dilated subtensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs the assignment, the addition assignment, the subtraction assignment,
+// and the Schur product assignment of a dense tensor to a dilated subtensor with the given
+// element type, and evaluates an addition with the dilated subtensor as operand. The dilated
+// subtensor starts at page 1, row 2, and column 3 of the underlying tensor. All results are
+// compared to the results of scalar loops. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Element type of the dense tensors
+void DenseTest::checkSIMDAssign( size_t o, size_t m, size_t n, size_t pageDilation,
+                                 size_t rowDilation, size_t columnDilation ) const
+{
+   using TensT = blaze::DynamicTensor<Type>;
+
+   const size_t page( 1UL ), row( 2UL ), column( 3UL );
+
+   TensT tens( page + o*pageDilation + 1UL, row + m*rowDilation + 2UL,
+               column + n*columnDilation + 3UL );
+   randomize( tens );
+
+   TensT rhs( o, m, n );
+   randomize( rhs );
+
+   TensT expected( tens );
+
+   auto st = blaze::dilatedsubtensor( tens, page, row, column, o, m, n,
+                                      pageDilation, rowDilation, columnDilation );
+
+   const auto check = [&]( const char* operation ) {
+      if( tens != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << operation << " failed\n"
+             << " Details:\n"
+             << "   Size: " << o << "x" << m << "x" << n << ", dilations: "
+             << pageDilation << "x" << rowDilation << "x" << columnDilation << "\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+   const auto target = [&]( size_t k, size_t i, size_t j ) -> Type& {
+      return expected( page+k*pageDilation, row+i*rowDilation, column+j*columnDilation );
+   };
+
+   st = rhs;
+   for( size_t k=0UL; k<o; ++k )
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            target(k,i,j) = rhs(k,i,j);
+   check( "Assignment" );
+
+   st += rhs;
+   for( size_t k=0UL; k<o; ++k )
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            target(k,i,j) += rhs(k,i,j);
+   check( "Addition assignment" );
+
+   st -= rhs;
+   for( size_t k=0UL; k<o; ++k )
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            target(k,i,j) -= rhs(k,i,j);
+   check( "Subtraction assignment" );
+
+   st %= rhs;
+   for( size_t k=0UL; k<o; ++k )
+      for( size_t i=0UL; i<m; ++i )
+         for( size_t j=0UL; j<n; ++j )
+            target(k,i,j) *= rhs(k,i,j);
+   check( "Schur product assignment" );
+
+   const TensT sum( st + rhs );
+
+   for( size_t k=0UL; k<o; ++k ) {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( sum(k,i,j) != target(k,i,j) + rhs(k,i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Vectorized read access failed\n"
+                   << " Details:\n"
+                   << "   Size: " << o << "x" << m << "x" << n << ", dilations: "
+                   << pageDilation << "x" << rowDilation << "x" << columnDilation << "\n"
+                   << "   Element (" << k << "," << i << "," << j << "): " << sum(k,i,j) << "\n"
+                   << "   Expected value: " << ( target(k,i,j) + rhs(k,i,j) ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -102,12 +102,16 @@ class DenseTest
    void testIsSame      ();
    void testDilatedSubvector   ();
    void testElements    ();
+   void testSIMDAssign  ();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
 
    template< typename Type >
    void checkNonZeros( const Type& vector, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkSIMDAssign( size_t offset, size_t size, size_t dilation ) const;
    //@}
    //**********************************************************************************************
 
@@ -220,6 +224,88 @@ void DenseTest::checkNonZeros( const Type& vector, size_t expectedNonZeros ) con
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the vectorized assignments to and from a dilated subvector.
+//
+// \param offset The index of the first element of the dilated subvector.
+// \param size The size of the dilated subvector.
+// \param dilation The step between two consecutive elements of the dilated subvector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs the assignment, the addition assignment, the subtraction assignment,
+// and the multiplication assignment of a dense vector to a dilated subvector with the given
+// element type, and evaluates an addition with the dilated subvector as operand. All results
+// are compared to the results of scalar loops. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the dense vectors
+void DenseTest::checkSIMDAssign( size_t offset, size_t size, size_t dilation ) const
+{
+   using VecT = blaze::DynamicVector<Type,blaze::rowVector>;
+
+   VecT vec( offset + size*dilation + 3UL );
+   randomize( vec );
+
+   VecT rhs( size );
+   randomize( rhs );
+
+   VecT expected( vec );
+
+   auto sv = blaze::dilatedsubvector( vec, offset, size, dilation );
+
+   const auto check = [&]( const char* operation ) {
+      if( vec != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << operation << " failed\n"
+             << " Details:\n"
+             << "   Offset: " << offset << ", size: " << size << ", dilation: " << dilation << "\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+   sv = rhs;
+   for( size_t i=0UL; i<size; ++i )
+      expected[offset+i*dilation] = rhs[i];
+   check( "Assignment" );
+
+   sv += rhs;
+   for( size_t i=0UL; i<size; ++i )
+      expected[offset+i*dilation] += rhs[i];
+   check( "Addition assignment" );
+
+   sv -= rhs;
+   for( size_t i=0UL; i<size; ++i )
+      expected[offset+i*dilation] -= rhs[i];
+   check( "Subtraction assignment" );
+
+   sv *= rhs;
+   for( size_t i=0UL; i<size; ++i )
+      expected[offset+i*dilation] *= rhs[i];
+   check( "Multiplication assignment" );
+
+   const VecT sum( sv + rhs );
+
+   for( size_t i=0UL; i<size; ++i )
+   {
+      if( sum[i] != vec[offset+i*dilation] + rhs[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Vectorized read access failed\n"
+             << " Details:\n"
+             << "   Offset: " << offset << ", size: " << size << ", dilation: " << dilation << "\n"
+             << "   Element " << i << ": " << sum[i] << "\n"
+             << "   Expected value: " << ( vec[offset+i*dilation] + rhs[i] ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
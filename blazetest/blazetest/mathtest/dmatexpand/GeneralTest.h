@@ -0,0 +1,262 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatexpand/GeneralTest.h
+//  \brief Header file for the general dense matrix expansion test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZETEST_MATHTEST_DMATEXPAND_GENERALTEST_H_
+#define _BLAZETEST_MATHTEST_DMATEXPAND_GENERALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+
+#include <blaze_tensor/math/DenseTensor.h>
+#include <blaze_tensor/math/DynamicTensor.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatexpand {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the general dense matrix expansion test.
+//
+// This class represents a test suite for the combination of dense tensors with expanded dense
+// matrices (as for instance in \c T + expand(M,O)), which are evaluated page by page. It
+// performs a series of runtime tests for row-major and column-major matrices, for matrix
+// operands that require an intermediate evaluation, and for the SMP evaluation.
+*/
+class GeneralTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DTens = blaze::DynamicTensor<int>;                  //!< Dense tensor type.
+   using DMat  = blaze::DynamicMatrix<int,blaze::rowMajor>;  //!< Row-major dense matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit GeneralTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testExpansion();
+   void testSMPExpansion();
+
+   template< typename MT >
+   void checkExpansion( const DTens& tens, const MT& mat );
+
+   void checkResult( const std::string& operation, const DTens& computed, const DTens& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the combination of the given dense tensor with the expanded dense matrix.
+//
+// \param tens The dense tensor operand.
+// \param mat The dense matrix to be expanded to the number of pages of the tensor.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the assignment of the expansion, the addition, subtraction and Schur
+// product of the tensor and the expansion with the expansion as either left-hand or right-hand
+// side operand, as well as the corresponding addition, subtraction and Schur product assignments
+// with the results of naive loops. In case any result differs, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix operand
+void GeneralTest::checkExpansion( const DTens& tens, const MT& mat )
+{
+   const size_t O( tens.pages() );
+
+   DTens expansion( O, mat.rows(), mat.columns() );
+   DTens sum      ( O, mat.rows(), mat.columns() );
+   DTens diff     ( O, mat.rows(), mat.columns() );
+   DTens prod     ( O, mat.rows(), mat.columns() );
+   DTens rdiff    ( O, mat.rows(), mat.columns() );
+
+   for( size_t k=0UL; k<O; ++k ) {
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            expansion(k,i,j) = mat(i,j);
+            sum      (k,i,j) = tens(k,i,j) + mat(i,j);
+            diff     (k,i,j) = tens(k,i,j) - mat(i,j);
+            prod     (k,i,j) = tens(k,i,j) * mat(i,j);
+            rdiff    (k,i,j) = mat(i,j) - tens(k,i,j);
+         }
+      }
+   }
+
+   checkResult( "expansion", DTens( blaze::expand( mat, O ) ), expansion );
+   checkResult( "addition", DTens( tens + blaze::expand( mat, O ) ), sum );
+   checkResult( "commuted addition", DTens( blaze::expand( mat, O ) + tens ), sum );
+   checkResult( "subtraction", DTens( tens - blaze::expand( mat, O ) ), diff );
+   checkResult( "Schur product", DTens( tens % blaze::expand( mat, O ) ), prod );
+   checkResult( "left-hand subtraction", DTens( blaze::expand( mat, O ) - tens ), rdiff );
+   checkResult( "commuted Schur product", DTens( blaze::expand( mat, O ) % tens ), prod );
+
+   DTens result( tens );
+   result += blaze::expand( mat, O );
+   checkResult( "addition assignment", result, sum );
+
+   result = tens;
+   result -= blaze::expand( mat, O );
+   checkResult( "subtraction assignment", result, diff );
+
+   result = tens;
+   result %= blaze::expand( mat, O );
+   checkResult( "Schur product assignment", result, prod );
+
+   result = tens;
+   result += tens + blaze::expand( mat, O );
+   checkResult( "addition assignment of the addition", result, DTens( tens + sum ) );
+
+   result = tens;
+   result -= blaze::expand( mat, O ) - tens;
+   checkResult( "subtraction assignment of the left-hand subtraction", result,
+                DTens( tens - rdiff ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed and an expected result.
+//
+// \param operation The label of the checked operation.
+// \param computed The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+inline void GeneralTest::checkResult( const std::string& operation, const DTens& computed,
+                                      const DTens& expected ) const
+{
+   if( computed != expected ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result of the " << operation << " detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computed << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix expansion.
+//
+// \return void
+*/
+void runTest()
+{
+   GeneralTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the general dense matrix expansion test.
+*/
+#define RUN_DMATEXPAND_GENERAL_TEST \
+   blazetest::mathtest::dmatexpand::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatexpand
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
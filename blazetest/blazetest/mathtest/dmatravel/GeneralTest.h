@@ -0,0 +1,251 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatravel/GeneralTest.h
+//  \brief Header file for the general dense matrix ravel test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZETEST_MATHTEST_DMATRAVEL_GENERALTEST_H_
+#define _BLAZETEST_MATHTEST_DMATRAVEL_GENERALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+#include <blaze_tensor/math/CustomArray.h>
+#include <blaze_tensor/math/CustomTensor.h>
+#include <blaze_tensor/math/DenseTensor.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatravel {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the general dense matrix ravel test.
+//
+// This class represents a test suite for the ravel() and reshape() functions of dense matrices.
+// It performs a series of runtime tests for padded and unpadded operands, for operands that
+// are resized after the creation of the ravel expression, and for the tensor and array reshape
+// views on constant matrices.
+*/
+class GeneralTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DMat  = blaze::DynamicMatrix<int,blaze::rowMajor>;  //!< Row-major dense matrix type.
+   using DVec  = blaze::DynamicVector<int,blaze::rowVector>;  //!< Dense row vector type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit GeneralTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPadded();
+   void testUnpadded();
+   void testResize();
+   void testReshape();
+
+   template< typename MT >
+   void checkRavel( const MT& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the ravel operation on the given dense matrix.
+//
+// \param mat The dense matrix operand.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the element-wise access of the ravel expression as well as the
+// assignment, the addition assignment, and the subtraction assignment of the expression with
+// the elements of the matrix in row-major order. In case any result differs, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix operand
+void GeneralTest::checkRavel( const MT& mat )
+{
+   const size_t size( mat.rows() * mat.columns() );
+
+   DVec expected( size );
+   for( size_t i=0UL; i<mat.rows(); ++i )
+      for( size_t j=0UL; j<mat.columns(); ++j )
+         expected[i*mat.columns() + j] = mat(i,j);
+
+   const auto expr( blaze::ravel( mat ) );
+
+   const auto error = [this]( const std::string& operation, const DVec& computedResult,
+                              const DVec& expectedResult ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result of the " << operation << " detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   };
+
+   if( expr.size() != size ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Invalid size of the ravel expression detected\n"
+          << " Details:\n"
+          << "   Computed size: " << expr.size() << "\n"
+          << "   Expected size: " << size << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   DVec element( size );
+   for( size_t i=0UL; i<size; ++i )
+      element[i] = expr[i];
+
+   if( element != expected ) {
+      error( "element access", element, expected );
+   }
+
+   DVec result( expr );
+
+   if( result != expected ) {
+      error( "assignment", result, expected );
+   }
+
+   DVec init( size );
+   for( size_t i=0UL; i<size; ++i )
+      init[i] = static_cast<int>( i % 7UL ) - 3;
+
+   result = init;
+   result += expr;
+
+   if( result != DVec( init + expected ) ) {
+      error( "addition assignment", result, DVec( init + expected ) );
+   }
+
+   result = init;
+   result -= expr;
+
+   if( result != DVec( init - expected ) ) {
+      error( "subtraction assignment", result, DVec( init - expected ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix ravel operation.
+//
+// \return void
+*/
+void runTest()
+{
+   GeneralTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the general dense matrix ravel test.
+*/
+#define RUN_DMATRAVEL_GENERAL_TEST \
+   blazetest::mathtest::dmatravel::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatravel
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
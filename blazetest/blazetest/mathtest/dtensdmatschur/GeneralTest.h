@@ -0,0 +1,251 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dtensdmatschur/GeneralTest.h
+//  \brief Header file for the general dense tensor/dense matrix Schur product test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZETEST_MATHTEST_DTENSDMATSCHUR_GENERALTEST_H_
+#define _BLAZETEST_MATHTEST_DTENSDMATSCHUR_GENERALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Submatrix.h>
+
+#include <blaze_tensor/math/DenseTensor.h>
+#include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/Subtensor.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dtensdmatschur {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the general dense tensor/dense matrix Schur product test.
+//
+// This class represents a test suite for the Schur product of a dense tensor with a dense
+// matrix (\c T % M), which multiplies each page of the tensor with the matrix. It performs a
+// series of runtime tests for row-major and column-major matrices, for operands that require
+// an intermediate evaluation, and for the SMP evaluation.
+*/
+class GeneralTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DTens = blaze::DynamicTensor<int>;                  //!< Dense tensor type.
+   using DMat  = blaze::DynamicMatrix<int,blaze::rowMajor>;  //!< Row-major dense matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit GeneralTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSchur();
+   void testSMPSchur();
+
+   template< typename TT, typename MT >
+   void checkSchur( const TT& tens, const MT& mat );
+
+   void checkResult( const std::string& operation, const DTens& computed, const DTens& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the Schur product of the given dense tensor and dense matrix.
+//
+// \param tens The dense tensor operand.
+// \param mat The dense matrix operand.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the element-wise access of the Schur product expression as well as
+// the assignment, the addition assignment, the subtraction assignment, and the Schur product
+// assignment of the expression with the results of naive loops. In case any result differs,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename TT    // Type of the dense tensor operand
+        , typename MT >  // Type of the dense matrix operand
+void GeneralTest::checkSchur( const TT& tens, const MT& mat )
+{
+   DTens init    ( tens.pages(), tens.rows(), tens.columns() );
+   DTens expected( tens.pages(), tens.rows(), tens.columns() );
+   randomize( init, -5, 5 );
+
+   for( size_t k=0UL; k<tens.pages(); ++k )
+      for( size_t i=0UL; i<tens.rows(); ++i )
+         for( size_t j=0UL; j<tens.columns(); ++j )
+            expected(k,i,j) = tens(k,i,j) * mat(i,j);
+
+   const auto expr( tens % mat );
+
+   DTens element( tens.pages(), tens.rows(), tens.columns() );
+   for( size_t k=0UL; k<tens.pages(); ++k )
+      for( size_t i=0UL; i<tens.rows(); ++i )
+         for( size_t j=0UL; j<tens.columns(); ++j )
+            element(k,i,j) = expr(k,i,j);
+
+   checkResult( "element access", element, expected );
+   checkResult( "assignment", DTens( expr ), expected );
+
+   DTens result( init );
+   result += expr;
+   checkResult( "addition assignment", result, DTens( init + expected ) );
+
+   result = init;
+   result -= expr;
+   checkResult( "subtraction assignment", result, DTens( init - expected ) );
+
+   result = init;
+   result %= expr;
+   checkResult( "Schur product assignment", result, DTens( init % expected ) );
+
+   result = init;
+   result = tens % mat + init;
+   checkResult( "assignment of the Schur product expression", result, DTens( expected + init ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed and an expected result.
+//
+// \param operation The label of the checked operation.
+// \param computed The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+inline void GeneralTest::checkResult( const std::string& operation, const DTens& computed,
+                                      const DTens& expected ) const
+{
+   if( computed != expected ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result of the " << operation << " detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computed << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense tensor/dense matrix Schur product.
+//
+// \return void
+*/
+void runTest()
+{
+   GeneralTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the general dense tensor/dense matrix Schur product test.
+*/
+#define RUN_DTENSDMATSCHUR_GENERAL_TEST \
+   blazetest::mathtest::dtensdmatschur::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dtensdmatschur
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
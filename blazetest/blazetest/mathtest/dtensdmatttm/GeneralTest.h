@@ -0,0 +1,350 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dtensdmatttm/GeneralTest.h
+//  \brief Header file for the general dense tensor/dense matrix mode-n multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DTENSDMATTTM_GENERALTEST_H_
+#define _BLAZETEST_MATHTEST_DTENSDMATTTM_GENERALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+
+#include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/StaticTensor.h>
+#include <blaze_tensor/math/Subtensor.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dtensdmatttm {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the general dense tensor/dense matrix mode-n multiplication test.
+//
+// This class represents a test suite for the mode-n multiplication of a dense tensor with a
+// dense matrix (see the ttm() function). It performs a series of runtime tests for all three
+// modes, for operands and targets with non-contiguous pages, for static operands, for the size
+// checks, and for the SMP evaluation of the multiplication.
+*/
+class GeneralTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DTens = blaze::DynamicTensor<double>;  //!< Dense tensor type.
+   using DMat  = blaze::DynamicMatrix<double>;  //!< Dense matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit GeneralTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMode0();
+   void testMode1();
+   void testMode2();
+   void testNonContiguous();
+   void testStatic();
+   void testSizeMismatch();
+   void testSMPMultiplication();
+
+   template< size_t MODE, typename TT, typename MT >
+   void checkResult( const TT& tens, const MT& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void initialize( DTens& tens );
+   void initialize( DMat& mat );
+
+   template< size_t MODE, typename TT, typename MT >
+   DTens reference( const TT& tens, const MT& mat ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the mode-n multiplication of the given operands.
+//
+// \param tens The dense tensor operand.
+// \param mat The dense matrix operand.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the element-wise access of the multiplication expression as well as
+// the assignment, the addition assignment, and the subtraction assignment of the expression
+// with the result of naive loops. In case any result differs, a \a std::runtime_error exception
+// is thrown.
+*/
+template< size_t MODE    // Mode of the multiplication
+        , typename TT    // Type of the dense tensor operand
+        , typename MT >  // Type of the dense matrix operand
+void GeneralTest::checkResult( const TT& tens, const MT& mat )
+{
+   const DTens expected( reference<MODE>( tens, mat ) );
+   const auto  expr( blaze::ttm<MODE>( tens, mat ) );
+
+   const auto error = [this]( const std::string& operation, const DTens& computedResult,
+                              const DTens& expectedResult ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result of the " << operation << " detected\n"
+          << " Details:\n"
+          << "   Mode: " << MODE << "\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   };
+
+   if( expr.pages() != expected.pages() || expr.rows() != expected.rows() ||
+       expr.columns() != expected.columns() ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Invalid size of the multiplication expression detected\n"
+          << " Details:\n"
+          << "   Mode: " << MODE << "\n"
+          << "   Computed size: "
+          << expr.pages() << "x" << expr.rows() << "x" << expr.columns() << "\n"
+          << "   Expected size: "
+          << expected.pages() << "x" << expected.rows() << "x" << expected.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   DTens element( expected.pages(), expected.rows(), expected.columns() );
+   for( size_t k=0UL; k<element.pages(); ++k )
+      for( size_t i=0UL; i<element.rows(); ++i )
+         for( size_t j=0UL; j<element.columns(); ++j )
+            element(k,i,j) = expr(k,i,j);
+
+   if( element != expected ) {
+      error( "element access", element, expected );
+   }
+
+   DTens result( expr );
+
+   if( result != expected ) {
+      error( "assignment", result, expected );
+   }
+
+   DTens init( expected.pages(), expected.rows(), expected.columns() );
+   initialize( init );
+
+   result = init;
+   result += expr;
+
+   if( result != DTens( init + expected ) ) {
+      error( "addition assignment", result, DTens( init + expected ) );
+   }
+
+   result = init;
+   result -= expr;
+
+   if( result != DTens( init - expected ) ) {
+      error( "subtraction assignment", result, DTens( init - expected ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense tensor with random integral values.
+//
+// \param tens The dense tensor to be initialized.
+// \return void
+//
+// This function initializes all elements of the given dense tensor with random integral values
+// in the range [-3..3]. Since all products and sums of such values are exactly representable,
+// the results of the multiplication kernels can be compared exactly to the reference results.
+*/
+inline void GeneralTest::initialize( DTens& tens )
+{
+   blaze::DynamicTensor<int> tmp( tens.pages(), tens.rows(), tens.columns() );
+   randomize( tmp, -3, 3 );
+   tens = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix with random integral values.
+//
+// \param mat The dense matrix to be initialized.
+// \return void
+*/
+inline void GeneralTest::initialize( DMat& mat )
+{
+   blaze::DynamicMatrix<int> tmp( mat.rows(), mat.columns() );
+   randomize( tmp, -3, 3 );
+   mat = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the mode-n multiplication of the given operands by means of naive loops.
+//
+// \param tens The dense tensor operand.
+// \param mat The dense matrix operand.
+// \return The result of the multiplication.
+*/
+template< size_t MODE    // Mode of the multiplication
+        , typename TT    // Type of the dense tensor operand
+        , typename MT >  // Type of the dense matrix operand
+GeneralTest::DTens GeneralTest::reference( const TT& tens, const MT& mat ) const
+{
+   const size_t O( ( MODE == 0UL )?( mat.rows() ):( tens.pages()   ) );
+   const size_t M( ( MODE == 1UL )?( mat.rows() ):( tens.rows()    ) );
+   const size_t N( ( MODE == 2UL )?( mat.rows() ):( tens.columns() ) );
+
+   DTens result( O, M, N, 0.0 );
+
+   for( size_t k=0UL; k<O; ++k ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            for( size_t l=0UL; l<mat.columns(); ++l ) {
+               if( MODE == 0UL )
+                  result(k,i,j) += mat(k,l) * tens(l,i,j);
+               else if( MODE == 1UL )
+                  result(k,i,j) += mat(i,l) * tens(k,l,j);
+               else
+                  result(k,i,j) += tens(k,i,l) * mat(j,l);
+            }
+         }
+      }
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense tensor/dense matrix mode-n multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   GeneralTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the general dense tensor/dense matrix mode-n multiplication
+//        test.
+*/
+#define RUN_DTENSDMATTTM_GENERAL_TEST \
+   blazetest::mathtest::dtensdmatttm::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dtensdmatttm
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,247 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dtensdtensmult/GeneralTest.h
+//  \brief Header file for the general dense tensor/dense tensor multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DTENSDTENSMULT_GENERALTEST_H_
+#define _BLAZETEST_MATHTEST_DTENSDTENSMULT_GENERALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+
+#include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/PageSlice.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dtensdtensmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the general dense tensor/dense tensor multiplication test.
+//
+// This class represents a test suite for the batched (page-wise) dense tensor/dense tensor
+// multiplication. It performs a series of runtime tests for the page-wise multiplication, the
+// broadcast of a single page, the size checks and the SMP evaluation of the multiplication.
+*/
+class GeneralTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DTens = blaze::DynamicTensor<double>;  //!< Dense tensor type.
+   using DMat  = blaze::DynamicMatrix<double>;  //!< Dense matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit GeneralTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMultiplication();
+   void testBroadcast();
+   void testSizeMismatch();
+   void testEmptyInnerDimension();
+   void testSMPMultiplication();
+
+   void checkResult( const DTens& result, const DTens& lhs, const DTens& rhs,
+                     double scale = 1.0, const DTens& init = DTens() );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void initialize( DTens& tens );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a batched multiplication.
+//
+// \param result The computed result.
+// \param lhs The left-hand side operand of the multiplication.
+// \param rhs The right-hand side operand of the multiplication.
+// \param scale The scaling factor applied to the product.
+// \param init The initial value of the target (empty in case of a plain assignment).
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares each page of the given result with the corresponding matrix product
+// \f$ init_k + scale \cdot lhs_k \cdot rhs_k \f$, where the single page of \a rhs is used for
+// all pages of \a lhs in case \a rhs consists of a single page. In case any page differs, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void GeneralTest::checkResult( const DTens& result, const DTens& lhs, const DTens& rhs,
+                                      double scale, const DTens& init )
+{
+   for( size_t k=0UL; k<lhs.pages(); ++k )
+   {
+      const size_t kb( ( rhs.pages() == 1UL )?( 0UL ):( k ) );
+
+      DMat expected( scale * ( blaze::pageslice( lhs, k ) * blaze::pageslice( rhs, kb ) ) );
+
+      if( init.pages() != 0UL ) {
+         expected += blaze::pageslice( init, k );
+      }
+
+      if( blaze::pageslice( result, k ) != expected ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test : " << test_ << "\n"
+             << " Error: Incorrect result detected in page " << k << "\n"
+             << " Details:\n"
+             << "   Computed result:\n" << blaze::pageslice( result, k ) << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense tensor with random integral values.
+//
+// \param tens The dense tensor to be initialized.
+// \return void
+//
+// This function initializes all elements of the given dense tensor with random integral values
+// in the range [-3..3]. Since all products and sums of such values are exactly representable,
+// the results of the multiplication kernels can be compared exactly to the reference results.
+*/
+inline void GeneralTest::initialize( DTens& tens )
+{
+   blaze::DynamicTensor<int> tmp( tens.pages(), tens.rows(), tens.columns() );
+   randomize( tmp, -3, 3 );
+   tens = tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the batched dense tensor/dense tensor multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   GeneralTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the general dense tensor/dense tensor multiplication test.
+*/
+#define RUN_DTENSDTENSMULT_GENERAL_TEST \
+   blazetest::mathtest::dtensdtensmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dtensdtensmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
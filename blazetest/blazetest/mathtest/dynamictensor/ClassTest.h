@@ -54,6 +54,7 @@
 #include <blazetest/system/Types.h>
 
 #include <blaze_tensor/math/constraints/DenseTensor.h>
+#include <blaze_tensor/math/DynamicArray.h>
 #include <blaze_tensor/math/DynamicTensor.h>
 
 namespace blazetest {
@@ -135,6 +136,14 @@ class ClassTest
 
    template< typename Type >
    void checkNonZeros( const Type& tensor, size_t index, size_t page, size_t expectedNonZeros ) const;
+
+   void checkTranspose( const blaze::DynamicTensor<int>& original,
+                        const blaze::DynamicTensor<int>& transposed,
+                        const std::array<size_t,3UL>& indices ) const;
+
+   void checkTranspose( const blaze::DynamicArray<4UL,int>& original,
+                        const blaze::DynamicArray<4UL,int>& transposed,
+                        const std::array<size_t,4UL>& indices ) const;
    //@}
    //**********************************************************************************************
 
@@ -517,6 +526,150 @@ void ClassTest::checkNonZeros( const Type& tensor, size_t index, size_t page, si
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Checking the in-place transposition of a dynamic tensor.
+//
+// \param original The tensor before the transposition.
+// \param transposed The tensor after the transposition.
+// \param indices The axis mapping of the transposition.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the transposed tensor, where axis
+// \a d of the transposed tensor corresponds to axis \a indices[d] of the original tensor. Also,
+// it checks that all padding elements of the transposed tensor are zero. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ClassTest::checkTranspose( const blaze::DynamicTensor<int>& original,
+                                       const blaze::DynamicTensor<int>& transposed,
+                                       const std::array<size_t,3UL>& indices ) const
+{
+   const std::array<size_t,3UL> dims{ { original.pages(), original.rows(), original.columns() } };
+
+   if( transposed.pages()   != dims[indices[0]] ||
+       transposed.rows()    != dims[indices[1]] ||
+       transposed.columns() != dims[indices[2]] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid dimensions of the transposed tensor detected\n"
+          << " Details:\n"
+          << "   Axis mapping       : ( " << indices[0] << " " << indices[1] << " " << indices[2] << " )\n"
+          << "   Original tensor    : " << dims[0] << "x" << dims[1] << "x" << dims[2] << "\n"
+          << "   Transposed tensor  : " << transposed.pages() << "x" << transposed.rows()
+          << "x" << transposed.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::array<size_t,3UL> index, source;
+
+   for( index[0]=0UL; index[0]<transposed.pages(); ++index[0] ) {
+      for( index[1]=0UL; index[1]<transposed.rows(); ++index[1] )
+      {
+         for( index[2]=0UL; index[2]<transposed.columns(); ++index[2] )
+         {
+            for( size_t d=0UL; d<3UL; ++d ) {
+               source[indices[d]] = index[d];
+            }
+
+            if( transposed(index[0],index[1],index[2]) != original(source[0],source[1],source[2]) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Transpose operation failed\n"
+                   << " Details:\n"
+                   << "   Axis mapping: ( " << indices[0] << " " << indices[1] << " " << indices[2] << " )\n"
+                   << "   Element (" << index[0] << "," << index[1] << "," << index[2] << "): "
+                   << transposed(index[0],index[1],index[2]) << "\n"
+                   << "   Expected value: " << original(source[0],source[1],source[2]) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         for( size_t j=transposed.columns(); j<transposed.spacing(); ++j )
+         {
+            if( transposed.data( index[1], index[0] )[j] != 0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Non-zero padding element detected\n"
+                   << " Details:\n"
+                   << "   Axis mapping: ( " << indices[0] << " " << indices[1] << " " << indices[2] << " )\n"
+                   << "   Row " << index[1] << " of page " << index[0] << ", padding element " << j << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the in-place transposition of a 4D dynamic array.
+//
+// \param original The array before the transposition.
+// \param transposed The array after the transposition.
+// \param indices The axis mapping of the transposition (outermost axis first).
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the dimensions and all elements of the transposed array, where axis
+// \a d of the transposed array corresponds to axis \a indices[d] of the original array. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void ClassTest::checkTranspose( const blaze::DynamicArray<4UL,int>& original,
+                                       const blaze::DynamicArray<4UL,int>& transposed,
+                                       const std::array<size_t,4UL>& indices ) const
+{
+   std::array<size_t,4UL> dims, dims2;
+
+   for( size_t d=0UL; d<4UL; ++d ) {
+      dims [d] = original.dimensions()[3UL-d];
+      dims2[d] = transposed.dimensions()[3UL-d];
+   }
+
+   for( size_t d=0UL; d<4UL; ++d )
+   {
+      if( dims2[d] != dims[indices[d]] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid dimensions of the transposed array detected\n"
+             << " Details:\n"
+             << "   Axis " << d << " of the transposed array: " << dims2[d] << "\n"
+             << "   Expected extent: " << dims[indices[d]] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::array<size_t,4UL> index, source;
+
+   for( index[0]=0UL; index[0]<dims2[0]; ++index[0] ) {
+      for( index[1]=0UL; index[1]<dims2[1]; ++index[1] ) {
+         for( index[2]=0UL; index[2]<dims2[2]; ++index[2] ) {
+            for( index[3]=0UL; index[3]<dims2[3]; ++index[3] )
+            {
+               for( size_t d=0UL; d<4UL; ++d ) {
+                  source[indices[d]] = index[d];
+               }
+
+               if( transposed(index[0],index[1],index[2],index[3]) !=
+                   original(source[0],source[1],source[2],source[3]) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transpose operation failed\n"
+                      << " Details:\n"
+                      << "   Axis mapping: ( " << indices[0] << " " << indices[1] << " "
+                      << indices[2] << " " << indices[3] << " )\n"
+                      << "   Element (" << index[0] << "," << index[1] << "," << index[2]
+                      << "," << index[3] << "): " << transposed(index[0],index[1],index[2],index[3]) << "\n"
+                      << "   Expected value: " << original(source[0],source[1],source[2],source[3]) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 
 
 
@@ -0,0 +1,304 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/einsum/GeneralTest.h
+//  \brief Header file for the general einsum test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_EINSUM_GENERALTEST_H_
+#define _BLAZETEST_MATHTEST_EINSUM_GENERALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+
+#include <blaze_tensor/math/DynamicArray.h>
+#include <blaze_tensor/math/DynamicTensor.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace einsum {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the general einsum test.
+//
+// This class represents a test suite for the einsum() contraction of dense matrices, tensors,
+// and arrays. It performs a series of runtime tests comparing several contractions against
+// naive loops, including matrix products, batched products, permutations, outer products,
+// traces and diagonals, as well as malformed index specifications.
+*/
+class GeneralTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using DMat  = blaze::DynamicMatrix<double>;   //!< Dense matrix type.
+   using DTens = blaze::DynamicTensor<double>;   //!< Dense tensor type.
+   using DArr4 = blaze::DynamicArray<4,double>;  //!< Dense 4D array type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit GeneralTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMatrixProduct();
+   void testBatchedProduct();
+   void testPermutation();
+   void testOuterProduct();
+   void testDiagonal();
+   void testSummation();
+   void testArray();
+   void testInvalid();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult ) const;
+
+   template< typename T1, typename T2, typename T3 >
+   void checkInvalid( const std::string& spec, const T1& A, const T2& B, T3& C ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void initialize( DMat& mat );
+   void initialize( DTens& tens );
+   void initialize( DArr4& arr );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a contraction.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function compares the computed result with the expected result. In case the results
+// differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void GeneralTest::checkResult( const T1& computedResult, const T2& expectedResult ) const
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that a contraction fails.
+//
+// \param spec The index specification of the contraction.
+// \param A The left-hand side operand.
+// \param B The right-hand side operand.
+// \param C The result.
+// \return void
+// \exception std::runtime_error Invalid contraction succeeded.
+//
+// This function checks that the contraction with the given specification fails with a
+// \a std::invalid_argument exception. In case the contraction succeeds, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Type of the left-hand side operand
+        , typename T2    // Type of the right-hand side operand
+        , typename T3 >  // Type of the result
+void GeneralTest::checkInvalid( const std::string& spec, const T1& A, const T2& B, T3& C ) const
+{
+   try {
+      blaze::einsum( spec, A, B, C );
+
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Contraction with invalid specification \"" << spec << "\" succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix with random integral values.
+//
+// \param mat The dense matrix to be initialized.
+// \return void
+//
+// This function initializes all elements of the given dense matrix with random integral values
+// in the range [-3..3]. Since all products and sums of such values are exactly representable,
+// the results of the contractions can be compared exactly to the reference results.
+*/
+inline void GeneralTest::initialize( DMat& mat )
+{
+   blaze::DynamicMatrix<int> tmp( mat.rows(), mat.columns() );
+   randomize( tmp, -3, 3 );
+   mat = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense tensor with random integral values.
+//
+// \param tens The dense tensor to be initialized.
+// \return void
+*/
+inline void GeneralTest::initialize( DTens& tens )
+{
+   blaze::DynamicTensor<int> tmp( tens.pages(), tens.rows(), tens.columns() );
+   randomize( tmp, -3, 3 );
+   tens = tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense 4D array with random integral values.
+//
+// \param arr The dense array to be initialized.
+// \return void
+*/
+inline void GeneralTest::initialize( DArr4& arr )
+{
+   blaze::DynamicArray<4,int> tmp( arr.dimensions() );
+   randomize( tmp, -3, 3 );
+   arr = tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the einsum() contraction.
+//
+// \return void
+*/
+void runTest()
+{
+   GeneralTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the general einsum test.
+*/
+#define RUN_EINSUM_GENERAL_TEST \
+   blazetest::mathtest::einsum::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace einsum
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -2471,6 +2471,56 @@ void AlignedPaddedTest::testTranspose()
           }
        }
    }
+
+   {
+      test_ = "Row-major transpose of padded arrays via trans() with runtime axis mappings";
+
+      // Transposition of a 3x5x7 array into padded targets
+      {
+         const std::array< std::array<size_t,3UL>, 6UL > perms{ {
+            { { 0, 1, 2 } }, { { 0, 2, 1 } }, { { 1, 0, 2 } },
+            { { 1, 2, 0 } }, { { 2, 0, 1 } }, { { 2, 1, 0 } } } };
+
+         std::unique_ptr<int[],blaze::Deallocate> memory1( blaze::allocate<int>( 240UL ) );
+         MT mat( memory1.get(), 3UL, 5UL, 7UL, 16UL );
+         randomize( mat );
+
+         for( const auto& perm : perms )
+         {
+            const std::array<size_t,3UL> dims{ { 3UL, 5UL, 7UL } };
+
+            std::unique_ptr<int[],blaze::Deallocate> memory2( blaze::allocate<int>( 560UL ) );
+            MT mat2( memory2.get(), dims[perm[0]], dims[perm[1]], dims[perm[2]], 16UL );
+
+            mat2 = trans( mat, perm.data(), perm.size() );
+
+            checkTranspose( mat2, mat, perm );
+         }
+      }
+
+      // Transposition and nested transposition of a 2x3x4x5 array
+      {
+         std::unique_ptr<int[],blaze::Deallocate> memory1( blaze::allocate<int>( 384UL ) );
+         QT mat( memory1.get(), 2UL, 3UL, 4UL, 5UL, 16UL );
+         randomize( mat );
+
+         const std::array<size_t,4UL> perm{ { 1, 0, 3, 2 } };
+
+         std::unique_ptr<int[],blaze::Deallocate> memory2( blaze::allocate<int>( 480UL ) );
+         QT mat2( memory2.get(), 3UL, 2UL, 5UL, 4UL, 16UL );
+
+         mat2 = trans( mat, perm.data(), perm.size() );
+
+         checkTranspose( mat2, mat, perm );
+
+         std::unique_ptr<int[],blaze::Deallocate> memory3( blaze::allocate<int>( 384UL ) );
+         QT mat3( memory3.get(), 2UL, 3UL, 4UL, 5UL, 16UL );
+
+         mat3 = trans( trans( mat, perm.data(), perm.size() ), perm.data(), perm.size() );
+
+         checkTranspose( mat3, mat, std::array<size_t,4UL>{ { 0, 1, 2, 3 } } );
+      }
+   }
 }
 //*************************************************************************************************
 
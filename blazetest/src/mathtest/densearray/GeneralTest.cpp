@@ -39,13 +39,20 @@
 //*************************************************************************************************
 
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <blaze/system/Platform.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blazetest/mathtest/IsEqual.h>
 
 #include <blaze_tensor/math/CustomArray.h>
 #include <blaze_tensor/math/DynamicArray.h>
 #include <blaze_tensor/math/dense/DenseArray.h>
+#include <blaze_tensor/util/ArrayForEach.h>
 
 #include <blazetest/mathtest/densearray/GeneralTest.h>
 
@@ -90,6 +97,15 @@ GeneralTest::GeneralTest()
    testL3Norm();
    testL4Norm();
    testLpNorm();
+   testNorms();
+   testInner();
+   testMoments();
+   testArgMinMax();
+   testScan();
+   testTrans();
+   testBroadcast();
+   testPartialReduce();
+   testAssign();
 }
 //*************************************************************************************************
 
@@ -185,6 +201,31 @@ void GeneralTest::testIsNan()
             throw std::runtime_error( oss.str() );
          }
       }
+
+      // isnan with a single NaN in the last row of a padded 2x3x4x5 array
+      {
+         blaze::DynamicArray<4, double> arr( blaze::init_from_value, 1.0, 2UL, 3UL, 4UL, 5UL );
+
+         if( blaze::isnan( arr ) != false ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isnan evaluation\n"
+                << " Details:\n"
+                << "   Array:\n" << arr << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         arr(1,2,3,4) = std::numeric_limits<double>::quiet_NaN();
+
+         if( blaze::isnan( arr ) != true ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isnan evaluation\n"
+                << " Details:\n"
+                << "   Array:\n" << arr << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
    }
 }
 //*************************************************************************************************
@@ -3105,6 +3146,1191 @@ void GeneralTest::testLpNorm()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the norm functions for large and narrow dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c norm(), \c sqrNorm(), \c l1Norm(), \c l2Norm(),
+// \c lpNorm() and \c maxNorm() functions for padded four-dimensional arrays whose rows are
+// shorter than four SIMD vectors, for arrays above the SMP reduction threshold, and for arrays
+// with a dominant first element. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void GeneralTest::testNorms()
+{
+   //=====================================================================================
+   // Row-major array tests
+   //=====================================================================================
+
+   {
+      test_ = "Norms of narrow padded arrays";
+
+      for( size_t n : { 1UL, 3UL, 5UL, 7UL, 9UL, 13UL, 15UL, 17UL, 31UL } )
+      {
+         blaze::DynamicArray<4, double> arr( 2UL, 3UL, 4UL, n );
+         randomize( arr, -5.0, 5.0 );
+
+         checkNorms( test_, arr, 2UL*3UL*4UL*n, [&]( size_t l ) {
+            return arr( l/(3UL*4UL*n), (l/(4UL*n))%3UL, (l/n)%4UL, l%n ); } );
+      }
+   }
+
+   {
+      test_ = "Norms of large arrays";
+
+      blaze::DynamicArray<4, double> arr( 3UL, 4UL, 101UL, 251UL );
+      randomize( arr, -1.0, 1.0 );
+
+      checkNorms( test_, arr, 3UL*4UL*101UL*251UL, [&]( size_t l ) {
+         return arr( l/(4UL*101UL*251UL), (l/(101UL*251UL))%4UL, (l/251UL)%101UL, l%251UL ); } );
+   }
+
+   {
+      test_ = "Norms of arrays with a dominant first element";
+
+      blaze::DynamicArray<4, double> arr( blaze::init_from_value, 1.0, 2UL, 3UL, 4UL, 5UL );
+      arr(0,0,0,0) = -100.0;
+
+      checkNorms( test_, arr, 2UL*3UL*4UL*5UL, [&]( size_t l ) {
+         return arr( l/(3UL*4UL*5UL), (l/(4UL*5UL))%3UL, (l/5UL)%4UL, l%5UL ); } );
+
+      blaze::DynamicArray<3, double> arr2( blaze::init_from_value, 1.0, 3UL, 4UL, 5UL );
+      arr2(0,0,0) = -100.0;
+
+      checkNorms( test_, arr2, 3UL*4UL*5UL, [&]( size_t l ) {
+         return arr2( l/(4UL*5UL), (l/5UL)%4UL, l%5UL ); } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c inner() and \c dot() functions for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c inner() and \c dot() functions for dense arrays.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testInner()
+{
+   //=====================================================================================
+   // Row-major array tests
+   //=====================================================================================
+
+   {
+      test_ = "inner() function";
+
+      {
+         blaze::DynamicArray<3, int> arr1, arr2;
+
+         const int scalar = blaze::inner( arr1, arr2 );
+
+         if( scalar != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product computation failed\n"
+                << " Details:\n"
+                << "   Result: " << scalar << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicArray<3, int> arr1{{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } }};
+         blaze::DynamicArray<3, int> arr2( blaze::init_from_value, 2, 2UL, 2UL, 2UL );
+
+         const int scalar = blaze::inner( arr1, arr2 );
+
+         if( scalar != 72 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product computation failed\n"
+                << " Details:\n"
+                << "   Result: " << scalar << "\n"
+                << "   Expected result: 72\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicArray<3, int> arr1( 3UL, 7UL, 19UL );
+         blaze::DynamicArray<3, int> arr2( 3UL, 7UL, 19UL );
+         randomize( arr1, -5, 5 );
+         randomize( arr2, -5, 5 );
+
+         int expected( 0 );
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t i=0UL; i<7UL; ++i ) {
+               for( size_t j=0UL; j<19UL; ++j ) {
+                  expected += arr1(k,i,j) * arr2(k,i,j);
+               }
+            }
+         }
+
+         const int scalar1 = blaze::inner( arr1, arr2 );
+         const int scalar2 = blaze::dot( arr1, arr2 );
+         const int scalar3 = blaze::sum( blaze::map( arr1, arr2, blaze::Mult() ) );
+
+         if( scalar1 != expected || scalar2 != expected || scalar3 != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product computation failed\n"
+                << " Details:\n"
+                << "   inner(): " << scalar1 << "\n"
+                << "   dot(): " << scalar2 << "\n"
+                << "   sum(map(A,B,Mult())): " << scalar3 << "\n"
+                << "   Expected result: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         for( size_t n : { 19UL, 129UL } )
+         {
+            const size_t o( n > 100UL ? 8UL : 3UL );
+            const size_t m( n > 100UL ? 64UL : 7UL );
+
+            blaze::DynamicArray<3, int> A( o, m, n ), D( o, m, n );
+            blaze::DynamicArray<4, int> E( 3UL, o, m, n );
+            randomize( A, -5, 5 );
+            randomize( D, -5, 5 );
+            randomize( E, -3, 3 );
+
+            int expected1( 0 ), expected2( 0 ), expected3( 0 );
+            for( size_t k=0UL; k<o; ++k ) {
+               for( size_t i=0UL; i<m; ++i ) {
+                  for( size_t j=0UL; j<n; ++j ) {
+                     const int partial( E(0,k,i,j) + E(1,k,i,j) + E(2,k,i,j) );
+                     expected1 += A(k,i,j) * partial;
+                     expected2 += ( A(k,i,j) - D(k,i,j) ) * ( A(k,i,j) - D(k,i,j) );
+                     expected3 += ( A(k,i,j) - partial ) * ( A(k,i,j) - partial );
+                  }
+               }
+            }
+
+            const auto P( blaze::sum<blaze::reduction<3>>( E ) );
+
+            const int scalar1 = blaze::sum( blaze::map( A, P, blaze::Mult() ) );
+            const int scalar2 = blaze::sum( blaze::map( blaze::map( A, D, blaze::Sub() ), blaze::Pow2() ) );
+            const int scalar3 = blaze::sum( blaze::map( blaze::map( A, P, blaze::Sub() ), blaze::Pow2() ) );
+
+            if( scalar1 != expected1 || scalar2 != expected2 || scalar3 != expected3 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Fused reduction failed\n"
+                   << " Details:\n"
+                   << "   sum(A % P): " << scalar1 << " (expected " << expected1 << ")\n"
+                   << "   sum(pow2(A - D)): " << scalar2 << " (expected " << expected2 << ")\n"
+                   << "   sum(pow2(A - P)): " << scalar3 << " (expected " << expected3 << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         blaze::DynamicArray<3, int> arr1( blaze::init_from_value, 1, 2UL, 3UL, 4UL );
+         blaze::DynamicArray<3, int> arr2( blaze::init_from_value, 1, 2UL, 4UL, 3UL );
+
+         try {
+            const int scalar = blaze::inner( arr1, arr2 );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product of arrays with different sizes succeeded\n"
+                << " Details:\n"
+                << "   Result: " << scalar << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c moments() function for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c moments() function for dense arrays. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMoments()
+{
+   //=====================================================================================
+   // Row-major array tests
+   //=====================================================================================
+
+   {
+      test_ = "moments() function";
+
+      {
+         blaze::DynamicArray<3, int> arr{{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } }};
+
+         checkMoments( test_, blaze::moments( arr ),
+                       blaze::Moments<double>{ 8UL, 4.5, 6.0, 1.0, 8.0 } );
+
+         const blaze::Moments< blaze::DynamicArray<2, double> > stats( blaze::moments<2>( arr ) );
+
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<2UL; ++j ) {
+               const double x( arr(0UL,i,j) );
+               checkMoments( test_,
+                             blaze::Moments<double>{ stats.count, stats.mean(i,j),
+                                                     stats.variance(i,j), stats.min(i,j),
+                                                     stats.max(i,j) },
+                             blaze::Moments<double>{ 2UL, x+2.0, 8.0, x, x+4.0 } );
+            }
+         }
+      }
+
+      {
+         blaze::DynamicArray<3, double> arr( 3UL, 7UL, 19UL );
+         randomize( arr, -5.0, 5.0 );
+
+         checkMoments( test_, blaze::moments( arr ),
+                       referenceMoments( 3UL*7UL*19UL, [&]( size_t l ) {
+            return arr( l/(7UL*19UL), (l/19UL)%7UL, l%19UL ); } ) );
+
+         const blaze::Moments< blaze::DynamicArray<2, double> > stats1( blaze::moments<0>( arr ) );
+
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t i=0UL; i<7UL; ++i ) {
+               checkMoments( test_,
+                             blaze::Moments<double>{ stats1.count, stats1.mean(k,i),
+                                                     stats1.variance(k,i), stats1.min(k,i),
+                                                     stats1.max(k,i) },
+                             referenceMoments( 19UL, [&]( size_t l ) { return arr(k,i,l); } ) );
+            }
+         }
+
+         const blaze::Moments< blaze::DynamicArray<2, double> > stats2( blaze::moments<1>( arr ) );
+
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t j=0UL; j<19UL; ++j ) {
+               checkMoments( test_,
+                             blaze::Moments<double>{ stats2.count, stats2.mean(k,j),
+                                                     stats2.variance(k,j), stats2.min(k,j),
+                                                     stats2.max(k,j) },
+                             referenceMoments( 7UL, [&]( size_t l ) { return arr(k,l,j); } ) );
+            }
+         }
+
+         const blaze::Moments< blaze::DynamicArray<2, double> > stats3( blaze::moments<2>( arr ) );
+
+         for( size_t i=0UL; i<7UL; ++i ) {
+            for( size_t j=0UL; j<19UL; ++j ) {
+               checkMoments( test_,
+                             blaze::Moments<double>{ stats3.count, stats3.mean(i,j),
+                                                     stats3.variance(i,j), stats3.min(i,j),
+                                                     stats3.max(i,j) },
+                             referenceMoments( 3UL, [&]( size_t l ) { return arr(l,i,j); } ) );
+            }
+         }
+      }
+
+      {
+         blaze::DynamicArray<2, double> arr( 5UL, 13UL );
+         randomize( arr, -5.0, 5.0 );
+
+         const blaze::Moments< blaze::DynamicArray<1, double> > stats1( blaze::moments<0>( arr ) );
+
+         for( size_t i=0UL; i<5UL; ++i ) {
+            checkMoments( test_,
+                          blaze::Moments<double>{ stats1.count, stats1.mean(i),
+                                                  stats1.variance(i), stats1.min(i),
+                                                  stats1.max(i) },
+                          referenceMoments( 13UL, [&]( size_t l ) { return arr(i,l); } ) );
+         }
+
+         const blaze::Moments< blaze::DynamicArray<1, double> > stats2( blaze::moments<1>( arr ) );
+
+         for( size_t j=0UL; j<13UL; ++j ) {
+            checkMoments( test_,
+                          blaze::Moments<double>{ stats2.count, stats2.mean(j),
+                                                  stats2.variance(j), stats2.min(j),
+                                                  stats2.max(j) },
+                          referenceMoments( 5UL, [&]( size_t l ) { return arr(l,j); } ) );
+         }
+      }
+
+      {
+         blaze::DynamicArray<3, int> arr( blaze::init_from_value, 1, 2UL, 1UL, 2UL );
+
+         try {
+            const blaze::Moments< blaze::DynamicArray<2, double> > stats(
+               blaze::moments<1>( arr ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Moments computation of a single element slice succeeded\n"
+                << " Details:\n"
+                << "   Result: count=" << stats.count << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c argmin() and \c argmax() functions for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c argmin() and \c argmax() functions for dense arrays.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testArgMinMax()
+{
+   //=====================================================================================
+   // Row-major array tests
+   //=====================================================================================
+
+   {
+      test_ = "argmin()/argmax() functions";
+
+      {
+         blaze::DynamicArray<3, int> arr{{ { { 1, -4 }, { 3, 4 } }, { { -4, 2 }, { 0, 4 } } }};
+
+         checkIndex( test_, blaze::argmin( arr ), 1UL );
+         checkIndex( test_, blaze::argmax( arr ), 3UL );
+
+         const blaze::DynamicArray<2, size_t> indices1( blaze::argmin<2>( arr ) );
+         const blaze::DynamicArray<2, size_t> indices2( blaze::argmax<0>( arr ) );
+
+         checkIndex( test_, indices1(0,0), 1UL );
+         checkIndex( test_, indices1(0,1), 0UL );
+         checkIndex( test_, indices1(1,0), 1UL );
+         checkIndex( test_, indices1(1,1), 0UL );
+         checkIndex( test_, indices2(0,0), 0UL );
+         checkIndex( test_, indices2(0,1), 1UL );
+         checkIndex( test_, indices2(1,0), 1UL );
+         checkIndex( test_, indices2(1,1), 1UL );
+      }
+
+      {
+         blaze::DynamicArray<3, double> arr( 3UL, 7UL, 1500UL );
+         randomize( arr, -5.0, 5.0 );
+         arr(2UL,6UL,1499UL) = arr(0UL,3UL,17UL) = 10.0;
+         arr(1UL,5UL,1400UL) = -10.0;
+
+         const auto flat = [&]( size_t l ) {
+            return arr( l/(7UL*1500UL), (l/1500UL)%7UL, l%1500UL );
+         };
+
+         checkIndex( test_, blaze::argmin( arr ),
+                     referenceIndex( 3UL*7UL*1500UL, flat, std::less<double>() ) );
+         checkIndex( test_, blaze::argmax( arr ),
+                     referenceIndex( 3UL*7UL*1500UL, flat, std::greater<double>() ) );
+
+         const blaze::DynamicArray<2, size_t> indices1( blaze::argmin<0>( arr ) );
+         const blaze::DynamicArray<2, size_t> indices2( blaze::argmax<0>( arr ) );
+
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t i=0UL; i<7UL; ++i ) {
+               const auto get = [&]( size_t l ) { return arr(k,i,l); };
+               checkIndex( test_, indices1(k,i),
+                           referenceIndex( 1500UL, get, std::less<double>() ) );
+               checkIndex( test_, indices2(k,i),
+                           referenceIndex( 1500UL, get, std::greater<double>() ) );
+            }
+         }
+
+         const blaze::DynamicArray<2, size_t> indices3( blaze::argmin<1>( arr ) );
+         const blaze::DynamicArray<2, size_t> indices4( blaze::argmax<1>( arr ) );
+
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t j=0UL; j<1500UL; ++j ) {
+               const auto get = [&]( size_t l ) { return arr(k,l,j); };
+               checkIndex( test_, indices3(k,j), referenceIndex( 7UL, get, std::less<double>() ) );
+               checkIndex( test_, indices4(k,j),
+                           referenceIndex( 7UL, get, std::greater<double>() ) );
+            }
+         }
+
+         const blaze::DynamicArray<2, size_t> indices5( blaze::argmin<2>( arr ) );
+         const blaze::DynamicArray<2, size_t> indices6( blaze::argmax<2>( arr ) );
+
+         for( size_t i=0UL; i<7UL; ++i ) {
+            for( size_t j=0UL; j<1500UL; ++j ) {
+               const auto get = [&]( size_t l ) { return arr(l,i,j); };
+               checkIndex( test_, indices5(i,j), referenceIndex( 3UL, get, std::less<double>() ) );
+               checkIndex( test_, indices6(i,j),
+                           referenceIndex( 3UL, get, std::greater<double>() ) );
+            }
+         }
+      }
+
+      {
+         blaze::DynamicArray<4, double> arr( 2UL, 3UL, 4UL, 5UL );
+         randomize( arr, -5.0, 5.0 );
+
+         const blaze::DynamicArray<3, size_t> indices( blaze::argmin<2>( arr ) );
+
+         for( size_t l=0UL; l<2UL; ++l ) {
+            for( size_t i=0UL; i<4UL; ++i ) {
+               for( size_t j=0UL; j<5UL; ++j ) {
+                  const auto get = [&]( size_t k ) { return arr(l,k,i,j); };
+                  checkIndex( test_, indices(l,i,j),
+                              referenceIndex( 3UL, get, std::less<double>() ) );
+               }
+            }
+         }
+      }
+
+      {
+         blaze::DynamicArray<3, int> arr( 2UL, 0UL, 3UL );
+
+         try {
+            const size_t index( blaze::argmax( arr ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Index computation of an empty array succeeded\n"
+                << " Details:\n"
+                << "   Result: " << index << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c scan(), \c cumsum(), and \c cumprod() functions for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c scan(), \c cumsum(), and \c cumprod() functions for
+// dense arrays. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testScan()
+{
+   //=====================================================================================
+   // Row-major array tests
+   //=====================================================================================
+
+   {
+      test_ = "scan()/cumsum()/cumprod() functions";
+
+      {
+         const blaze::DynamicArray<3, int> arr{{ { { 1, 2, 3 }, { 4, 5, 6 } },
+                                                 { { 7, 8, 9 }, { 1, 2, 3 } } }};
+
+         const blaze::DynamicArray<3, int> result1( blaze::cumsum<0>( arr ) );
+         const blaze::DynamicArray<3, int> result2( blaze::cumsum<1>( arr ) );
+         const blaze::DynamicArray<3, int> result3( blaze::cumprod<2>( arr ) );
+
+         checkResult( test_, result1,
+                      blaze::DynamicArray<3, int>{{ { { 1, 3, 6 }, { 4, 9, 15 } },
+                                                    { { 7, 15, 24 }, { 1, 3, 6 } } }} );
+         checkResult( test_, result2,
+                      blaze::DynamicArray<3, int>{{ { { 1, 2, 3 }, { 5, 7, 9 } },
+                                                    { { 7, 8, 9 }, { 8, 10, 12 } } }} );
+         checkResult( test_, result3,
+                      blaze::DynamicArray<3, int>{{ { { 1, 2, 3 }, { 4, 5, 6 } },
+                                                    { { 7, 16, 27 }, { 4, 10, 18 } } }} );
+      }
+
+      {
+         blaze::DynamicArray<3, double> arr( 3UL, 7UL, 1500UL );
+         randomize( arr, 0.0, 1.0 );
+
+         checkResult( test_, blaze::evaluate( blaze::cumsum<0>( arr ) ),
+                      referenceScan( arr, 0UL, blaze::Add() ) );
+         checkResult( test_, blaze::evaluate( blaze::cumsum<1>( arr ) ),
+                      referenceScan( arr, 1UL, blaze::Add() ) );
+         checkResult( test_, blaze::evaluate( blaze::cumsum<2>( arr ) ),
+                      referenceScan( arr, 2UL, blaze::Add() ) );
+
+         checkResult( test_, blaze::evaluate( blaze::scan<0>( arr, blaze::Max() ) ),
+                      referenceScan( arr, 0UL, blaze::Max() ) );
+         checkResult( test_, blaze::evaluate( blaze::scan<1>( arr, blaze::Max() ) ),
+                      referenceScan( arr, 1UL, blaze::Max() ) );
+         checkResult( test_, blaze::evaluate( blaze::scan<2>( arr, blaze::Max() ) ),
+                      referenceScan( arr, 2UL, blaze::Max() ) );
+      }
+
+      {
+         blaze::DynamicArray<3, double> arr( 2UL, 3UL, 250UL );
+         randomize( arr, 0.99, 1.01 );
+
+         checkResult( test_, blaze::evaluate( blaze::cumprod<0>( arr ) ),
+                      referenceScan( arr, 0UL, blaze::Mult() ) );
+         checkResult( test_, blaze::evaluate( blaze::cumprod<2>( arr ) ),
+                      referenceScan( arr, 2UL, blaze::Mult() ) );
+      }
+
+      {
+         blaze::DynamicArray<4, double> arr( 2UL, 3UL, 4UL, 5UL );
+         randomize( arr, 0.0, 1.0 );
+
+         checkResult( test_, blaze::evaluate( blaze::cumsum<2>( arr ) ),
+                      referenceScan( arr, 2UL, blaze::Add() ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c trans() function with runtime axis mappings for dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c trans() function with runtime axis mappings for dense
+// arrays of various ranks. It covers the permutation plan with merged axes, the blocked 2D
+// transposition, the SMP evaluation, and the folding of nested transpositions. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testTrans()
+{
+   //=====================================================================================
+   // Row-major array tests
+   //=====================================================================================
+
+   {
+      test_ = "trans() function (2D)";
+
+      const blaze::DynamicArray<2, int> arr{{ { 1, 2, 3 }, { 4, 5, 6 } }};
+
+      const std::array<size_t,2UL> perm{ { 1, 0 } };
+
+      const blaze::DynamicArray<2, int> result( blaze::trans( arr, perm.data(), perm.size() ) );
+
+      if( result.dimension<1>() != 3UL || result.dimension<0>() != 2UL ||
+          result(0,0) != 1 || result(0,1) != 4 || result(1,0) != 2 ||
+          result(1,1) != 5 || result(2,0) != 3 || result(2,1) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << result << "\n"
+             << "   Expected result:\n(( 1 4 )\n( 2 5 )\n( 3 6 ))\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicArray<2, int> arr2( 37UL, 45UL );
+      randomize( arr2 );
+
+      checkTranspose( blaze::evaluate( blaze::trans( arr2, perm.data(), perm.size() ) ), arr2, perm );
+   }
+
+   {
+      test_ = "trans() function (3D)";
+
+      const std::array< std::array<size_t,3UL>, 6UL > perms{ {
+         { { 0, 1, 2 } }, { { 0, 2, 1 } }, { { 1, 0, 2 } },
+         { { 1, 2, 0 } }, { { 2, 0, 1 } }, { { 2, 1, 0 } } } };
+
+      blaze::DynamicArray<3, int> arr( 5UL, 6UL, 7UL );
+      randomize( arr );
+
+      for( const auto& perm : perms )
+      {
+         blaze::DynamicArray<3, int> result( blaze::trans( arr, perm.data(), perm.size() ) );
+         checkTranspose( result, arr, perm );
+
+         result = 0;
+         result = blaze::trans( arr, perm.data(), perm.size() );
+         checkTranspose( result, arr, perm );
+
+         checkTranspose( blaze::trans( arr, perm.data(), perm.size() ), arr, perm );
+      }
+   }
+
+   {
+      test_ = "trans() function (3D, blocked transposition)";
+
+      blaze::DynamicArray<3, int> arr( 4UL, 64UL, 67UL );
+      randomize( arr );
+
+      const std::array<size_t,3UL> perm{ { 0, 2, 1 } };
+
+      checkTranspose( blaze::evaluate( blaze::trans( arr, perm.data(), perm.size() ) ), arr, perm );
+
+      blaze::DynamicArray<3, double> arr2( 3UL, 41UL, 29UL );
+      randomize( arr2 );
+
+      const std::array<size_t,3UL> perm2{ { 2, 0, 1 } };
+
+      checkTranspose( blaze::evaluate( blaze::trans( arr2, perm2.data(), perm2.size() ) ), arr2, perm2 );
+   }
+
+   {
+      test_ = "trans() function (5D, merged axes)";
+
+      const std::array< std::array<size_t,5UL>, 5UL > perms{ {
+         { { 4, 2, 0, 1, 3 } }, { { 0, 1, 2, 4, 3 } }, { { 1, 0, 2, 3, 4 } },
+         { { 3, 4, 0, 1, 2 } }, { { 2, 3, 4, 0, 1 } } } };
+
+      blaze::DynamicArray<5, int> arr( 2UL, 3UL, 4UL, 5UL, 6UL );
+      randomize( arr );
+
+      blaze::DynamicArray<5, int> arr2( 1UL, 3UL, 1UL, 5UL, 9UL );
+      randomize( arr2 );
+
+      for( const auto& perm : perms ) {
+         checkTranspose( blaze::evaluate( blaze::trans( arr , perm.data(), perm.size() ) ), arr , perm );
+         checkTranspose( blaze::evaluate( blaze::trans( arr2, perm.data(), perm.size() ) ), arr2, perm );
+      }
+   }
+
+   {
+      test_ = "trans() function (SMP assignment)";
+
+      blaze::DynamicArray<4, int> arr( 4UL, 128UL, 64UL, 65UL );
+      randomize( arr );
+
+      const std::array<size_t,4UL> perm{ { 0, 3, 1, 2 } };
+
+      blaze::DynamicArray<4, int> result( blaze::trans( arr, perm.data(), perm.size() ) );
+      checkTranspose( result, arr, perm );
+
+      blaze::DynamicArray<4, int> arr2( 1UL, 2UL, 512UL, 1025UL );
+      randomize( arr2 );
+
+      const std::array<size_t,4UL> perm2{ { 0, 1, 3, 2 } };
+
+      blaze::DynamicArray<4, int> result2( blaze::trans( arr2, perm2.data(), perm2.size() ) );
+      checkTranspose( result2, arr2, perm2 );
+   }
+
+   {
+      test_ = "trans() function (nested transpositions)";
+
+      blaze::DynamicArray<4, int> arr( 2UL, 3UL, 4UL, 5UL );
+      randomize( arr );
+
+      const std::array<size_t,4UL> perm1{ { 3, 1, 0, 2 } };
+      const std::array<size_t,4UL> perm2{ { 2, 0, 3, 1 } };
+      const std::array<size_t,4UL> combined{ { 0, 3, 2, 1 } };
+
+      using TransType  = blaze::DArrTransExpr< blaze::DynamicArray<4, int> >;
+      using NestedType = blaze::RemoveCV_t< decltype( blaze::trans( blaze::trans( arr, perm1.data(), 4UL ),
+                                                                    perm2.data(), 4UL ) ) >;
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( TransType, NestedType );
+
+      const blaze::DynamicArray<4, int> inner( blaze::trans( arr, perm1.data(), perm1.size() ) );
+      const blaze::DynamicArray<4, int> result(
+         blaze::trans( blaze::trans( arr, perm1.data(), perm1.size() ), perm2.data(), perm2.size() ) );
+
+      checkTranspose( result, inner, perm2 );
+      checkTranspose( result, arr, combined );
+   }
+
+   {
+      test_ = "trans() function (writable 4D transposition)";
+
+      blaze::DynamicArray<4, int> arr( 2UL, 3UL, 4UL, 5UL );
+      blaze::DynamicArray<4, int> src( 4UL, 2UL, 5UL, 3UL );
+      randomize( src );
+
+      const std::array<size_t,4UL> perm{ { 2, 0, 3, 1 } };
+
+      blaze::trans( arr, perm.data(), perm.size() ) = src;
+      checkTranspose( src, arr, perm );
+
+      randomize( src );
+
+      blaze::trans( arr, { 2, 0, 3, 1 } ) = src;
+      checkTranspose( src, arr, perm );
+
+      blaze::trans( arr, { 2, 0, 3, 1 } )( 3, 1, 4, 2 ) = 42;
+
+      if( arr( 1, 2, 3, 4 ) != 42 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element access via a transposed array failed\n"
+             << " Details:\n"
+             << "   Result: " << arr( 1, 2, 3, 4 ) << "\n"
+             << "   Expected result: 42\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "trans() function (invalid axis mappings)";
+
+      blaze::DynamicArray<4, int> arr( 2UL, 3UL, 4UL, 5UL );
+
+      const std::array< std::array<size_t,4UL>, 2UL > perms{ {
+         { { 0, 1, 2, 2 } }, { { 0, 1, 2, 4 } } } };
+
+      for( const auto& perm : perms )
+      {
+         try {
+            blaze::DynamicArray<4, int> result( blaze::trans( arr, perm.data(), perm.size() ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transposition with an invalid axis mapping succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << result << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+
+      try {
+         const std::array<size_t,3UL> perm{ { 0, 1, 2 } };
+         blaze::DynamicArray<4, int> result( blaze::trans( arr, perm.data(), perm.size() ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transposition with too few axis indices succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the broadcast operations of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the broadcast addition, subtraction and Schur product of
+// dense arrays with different dimensions. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testBroadcast()
+{
+   const auto add  = []( int a, int b ) { return a + b; };
+   const auto sub  = []( int a, int b ) { return a - b; };
+   const auto mult = []( int a, int b ) { return a * b; };
+
+   {
+      test_ = "Broadcast addition of a 2D array and a 1D array";
+
+      const blaze::DynamicArray<2, int> arr{{ { 1, 2, 3 }, { 4, 5, 6 } }};
+      const blaze::DynamicArray<1, int> vec{{ 10, 20, 30 }};
+
+      const blaze::DynamicArray<2, int> result( arr + vec );
+
+      if( result.dimension<1>() != 2UL || result.dimension<0>() != 3UL ||
+          result(0,0) != 11 || result(0,1) != 22 || result(0,2) != 33 ||
+          result(1,0) != 14 || result(1,1) != 25 || result(1,2) != 36 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Broadcast operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << result << "\n"
+             << "   Expected result:\n(( 11 22 33 )\n( 14 25 36 ))\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Broadcast of a 4D array with a 1D array (missing outer dimensions)";
+
+      blaze::DynamicArray<4, int> arr( 2UL, 3UL, 4UL, 37UL );
+      blaze::DynamicArray<1, int> vec( 37UL );
+      randomize( arr, -5, 5 );
+      randomize( vec, -5, 5 );
+
+      checkBroadcast( blaze::DynamicArray<4, int>( arr + vec ), arr, vec, add  );
+      checkBroadcast( blaze::DynamicArray<4, int>( vec - arr ), vec, arr, sub  );
+      checkBroadcast( blaze::DynamicArray<4, int>( arr % vec ), arr, vec, mult );
+   }
+
+   {
+      test_ = "Broadcast of a 4D array with a size-1 middle dimension";
+
+      blaze::DynamicArray<4, int> arr1( 3UL, 4UL, 5UL, 19UL );
+      blaze::DynamicArray<4, int> arr2( 3UL, 1UL, 5UL, 19UL );
+      blaze::DynamicArray<3, int> arr3( 4UL, 1UL, 19UL );
+      randomize( arr1, -5, 5 );
+      randomize( arr2, -5, 5 );
+      randomize( arr3, -5, 5 );
+
+      checkBroadcast( blaze::DynamicArray<4, int>( arr1 + arr2 ), arr1, arr2, add  );
+      checkBroadcast( blaze::DynamicArray<4, int>( arr2 - arr1 ), arr2, arr1, sub  );
+      checkBroadcast( blaze::DynamicArray<4, int>( arr1 % arr3 ), arr1, arr3, mult );
+   }
+
+   {
+      test_ = "Broadcast along the innermost dimension";
+
+      blaze::DynamicArray<4, int> arr1( 2UL, 3UL, 4UL, 37UL );
+      blaze::DynamicArray<4, int> arr2( 2UL, 3UL, 4UL, 1UL );
+      blaze::DynamicArray<2, int> arr3( 4UL, 1UL );
+      randomize( arr1, -5, 5 );
+      randomize( arr2, -5, 5 );
+      randomize( arr3, -5, 5 );
+
+      checkBroadcast( blaze::DynamicArray<4, int>( arr1 % arr2 ), arr1, arr2, mult );
+      checkBroadcast( blaze::DynamicArray<4, int>( arr2 + arr1 ), arr2, arr1, add  );
+      checkBroadcast( blaze::DynamicArray<4, int>( arr1 - arr3 ), arr1, arr3, sub  );
+   }
+
+   {
+      test_ = "Broadcast assignments";
+
+      blaze::DynamicArray<3, int> arr( 5UL, 7UL, 33UL );
+      blaze::DynamicArray<2, int> mat( 1UL, 33UL );
+      blaze::DynamicArray<3, int> init( 5UL, 7UL, 33UL );
+      randomize( arr, -5, 5 );
+      randomize( mat, -5, 5 );
+      randomize( init, -5, 5 );
+
+      const blaze::DynamicArray<3, int> expected( arr % mat );
+      checkBroadcast( expected, arr, mat, mult );
+
+      blaze::DynamicArray<3, int> result( init );
+      result += arr % mat;
+      checkBroadcast( result, init, expected, add );
+
+      result = init;
+      result -= arr % mat;
+      checkBroadcast( result, init, expected, sub );
+
+      result = init;
+      result %= arr % mat;
+      checkBroadcast( result, init, expected, mult );
+   }
+
+   {
+      test_ = "SMP broadcast of a 4D array";
+
+      blaze::DynamicArray<4, int> arr1( 8UL, 16UL, 32UL, 67UL );
+      blaze::DynamicArray<4, int> arr2( 8UL, 1UL, 32UL, 1UL );
+      blaze::DynamicArray<1, int> vec( 67UL );
+      blaze::DynamicArray<4, int> init( 8UL, 16UL, 32UL, 67UL );
+      randomize( arr1, -5, 5 );
+      randomize( arr2, -5, 5 );
+      randomize( vec, -5, 5 );
+      randomize( init, -5, 5 );
+
+      checkBroadcast( blaze::DynamicArray<4, int>( arr1 % vec  ), arr1, vec,  mult );
+      checkBroadcast( blaze::DynamicArray<4, int>( arr1 + arr2 ), arr1, arr2, add  );
+
+      const blaze::DynamicArray<4, int> expected( arr1 - arr2 );
+      checkBroadcast( expected, arr1, arr2, sub );
+
+      blaze::DynamicArray<4, int> result( init );
+      result += arr1 - arr2;
+      checkBroadcast( result, init, expected, add );
+   }
+
+   {
+      test_ = "Broadcast of incompatible arrays";
+
+      blaze::DynamicArray<4, int> arr1( 2UL, 3UL, 4UL, 5UL );
+      blaze::DynamicArray<1, int> vec( 4UL );
+      blaze::DynamicArray<3, int> arr2( 2UL, 4UL, 5UL );
+
+      try {
+         const auto expr( arr1 + vec );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Broadcast of an incompatible innermost dimension succeeded\n"
+             << " Details:\n"
+             << "   Dimensions of the expression: " << expr.dimensions()[0] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const auto expr( arr2 % arr1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Broadcast of an incompatible middle dimension succeeded\n"
+             << " Details:\n"
+             << "   Dimensions of the expression: " << expr.dimensions()[2] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partial reduction operations of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reduction of dense arrays along a single dimension,
+// which results in an array with one dimension less. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPartialReduce()
+{
+   using blaze::reduction;
+
+   {
+      test_ = "mergeDims() function";
+
+      const std::array<size_t,3UL> dims{ { 1UL, 2UL, 3UL } };
+
+      const std::array<size_t,4UL> result0( blaze::mergeDims<0UL>( dims, 7UL ) );
+      const std::array<size_t,4UL> result1( blaze::mergeDims<1UL>( dims, 7UL ) );
+      const std::array<size_t,4UL> result2( blaze::mergeDims<2UL>( dims, 7UL ) );
+      const std::array<size_t,4UL> result3( blaze::mergeDims<3UL>( dims, 7UL ) );
+
+      if( result0 != std::array<size_t,4UL>{ { 7UL, 1UL, 2UL, 3UL } } ||
+          result1 != std::array<size_t,4UL>{ { 1UL, 7UL, 2UL, 3UL } } ||
+          result2 != std::array<size_t,4UL>{ { 1UL, 2UL, 7UL, 3UL } } ||
+          result3 != std::array<size_t,4UL>{ { 1UL, 2UL, 3UL, 7UL } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Merging of dimensions failed\n"
+             << " Details:\n"
+             << "   Result for M=0: ( " << result0[0] << " " << result0[1] << " " << result0[2] << " " << result0[3] << " )\n"
+             << "   Result for M=1: ( " << result1[0] << " " << result1[1] << " " << result1[2] << " " << result1[3] << " )\n"
+             << "   Result for M=2: ( " << result2[0] << " " << result2[1] << " " << result2[2] << " " << result2[3] << " )\n"
+             << "   Result for M=3: ( " << result3[0] << " " << result3[1] << " " << result3[2] << " " << result3[3] << " )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "sum() function (2D)";
+
+      const blaze::DynamicArray<2, int> arr{{ { 1, 0, 2 }, { 1, 3, 4 } }};
+
+      const blaze::DynamicArray<1, int> rowsum( blaze::sum<reduction<0>>( arr ) );
+      const blaze::DynamicArray<1, int> colsum( blaze::sum<reduction<1>>( arr ) );
+
+      if( rowsum.dimension<0>() != 2UL || rowsum(0) != 3 || rowsum(1) != 8 ||
+          colsum.dimension<0>() != 3UL || colsum(0) != 2 || colsum(1) != 3 || colsum(2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Partial reduction failed\n"
+             << " Details:\n"
+             << "   Row sums:\n" << rowsum << "\n"
+             << "   Expected row sums:\n( 3 8 )\n"
+             << "   Column sums:\n" << colsum << "\n"
+             << "   Expected column sums:\n( 2 3 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Reduction along the innermost dimension";
+
+      for( size_t n : { 1UL, 7UL, 16UL, 67UL } ) {
+         blaze::DynamicArray<3, int> arr3( 3UL, 5UL, n );
+         blaze::DynamicArray<4, int> arr4( 2UL, 3UL, 4UL, n );
+         randomize( arr3, -5, 5 );
+         randomize( arr4, -5, 5 );
+
+         checkReduce( blaze::evaluate( blaze::sum<reduction<0>>( arr3 ) ), arr3, 0UL, blaze::Add() );
+         checkReduce( blaze::evaluate( blaze::sum<reduction<0>>( arr4 ) ), arr4, 0UL, blaze::Add() );
+         checkReduce( blaze::evaluate( blaze::reduce<reduction<0>>( arr4, blaze::Max() ) ), arr4, 0UL, blaze::Max() );
+
+         const blaze::DynamicArray<4, double> arr5( arr4 );
+         checkReduce( blaze::evaluate( blaze::sum<reduction<0>>( arr5 ) ), arr5, 0UL, blaze::Add() );
+      }
+   }
+
+   {
+      test_ = "Reduction along the outer dimensions";
+
+      for( size_t n : { 1UL, 7UL, 16UL, 67UL } ) {
+         blaze::DynamicArray<3, int> arr3( 3UL, 5UL, n );
+         blaze::DynamicArray<4, int> arr4( 5UL, 3UL, 4UL, n );
+         randomize( arr3, -5, 5 );
+         randomize( arr4, -5, 5 );
+
+         checkReduce( blaze::evaluate( blaze::sum<reduction<1>>( arr3 ) ), arr3, 1UL, blaze::Add() );
+         checkReduce( blaze::evaluate( blaze::sum<reduction<2>>( arr3 ) ), arr3, 2UL, blaze::Add() );
+         checkReduce( blaze::evaluate( blaze::sum<reduction<1>>( arr4 ) ), arr4, 1UL, blaze::Add() );
+         checkReduce( blaze::evaluate( blaze::sum<reduction<2>>( arr4 ) ), arr4, 2UL, blaze::Add() );
+         checkReduce( blaze::evaluate( blaze::sum<reduction<3>>( arr4 ) ), arr4, 3UL, blaze::Add() );
+         checkReduce( blaze::evaluate( blaze::reduce<reduction<3>>( arr4, blaze::Min() ) ), arr4, 3UL, blaze::Min() );
+
+         const blaze::DynamicArray<4, double> arr5( arr4 );
+         checkReduce( blaze::evaluate( blaze::sum<reduction<3>>( arr5 ) ), arr5, 3UL, blaze::Add() );
+      }
+   }
+
+   {
+      test_ = "Reduction assignments";
+
+      blaze::DynamicArray<4, int> arr( 5UL, 3UL, 4UL, 37UL );
+      blaze::DynamicArray<3, int> init( 3UL, 4UL, 37UL );
+      randomize( arr, -5, 5 );
+      randomize( init, -5, 5 );
+
+      const blaze::DynamicArray<3, int> expected( blaze::sum<reduction<3>>( arr ) );
+      checkReduce( expected, arr, 3UL, blaze::Add() );
+
+      blaze::DynamicArray<3, int> result( init );
+      result += blaze::sum<reduction<3>>( arr );
+      checkBroadcast( result, init, expected, blaze::Add() );
+
+      result = init;
+      result -= blaze::sum<reduction<3>>( arr );
+      checkBroadcast( result, init, expected, blaze::Sub() );
+   }
+
+   {
+      test_ = "SMP reduction along the innermost dimension";
+
+      blaze::DynamicArray<4, int> arr( 4UL, 8UL, 64UL, 257UL );
+      randomize( arr, -5, 5 );
+
+      checkReduce( blaze::evaluate( blaze::sum<reduction<0>>( arr ) ), arr, 0UL, blaze::Add() );
+      checkReduce( blaze::evaluate( blaze::reduce<reduction<0>>( arr, blaze::Max() ) ), arr, 0UL, blaze::Max() );
+   }
+
+   {
+      test_ = "SMP reduction along the outer dimensions";
+
+      blaze::DynamicArray<4, int> arr( 4UL, 8UL, 64UL, 257UL );
+      randomize( arr, -5, 5 );
+
+      checkReduce( blaze::evaluate( blaze::sum<reduction<1>>( arr ) ), arr, 1UL, blaze::Add() );
+      checkReduce( blaze::evaluate( blaze::sum<reduction<3>>( arr ) ), arr, 3UL, blaze::Add() );
+
+      blaze::DynamicArray<3, int> arr2( 1024UL, 2UL, 300UL );
+      randomize( arr2, -5, 5 );
+
+      checkReduce( blaze::evaluate( blaze::sum<reduction<2>>( arr2 ) ), arr2, 2UL, blaze::Add() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the (compound) assignment of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the vectorized assignment, addition assignment, subtraction
+// assignment, and Schur product assignment of dense arrays, including innermost dimensions that
+// are not a multiple of the SIMD width, unpadded right-hand side operands, and arrays that are
+// large enough to be assigned via streaming stores. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testAssign()
+{
+   {
+      test_ = "Assignment of double arrays with an innermost dimension of 13";
+
+      blaze::DynamicArray<2, double> init2( 5UL, 13UL ), rhs2( 5UL, 13UL );
+      blaze::DynamicArray<3, double> init3( 3UL, 7UL, 13UL ), rhs3( 3UL, 7UL, 13UL );
+      blaze::DynamicArray<4, double> init4( 2UL, 3UL, 5UL, 13UL ), rhs4( 2UL, 3UL, 5UL, 13UL );
+      randomize( init2 ); randomize( rhs2 );
+      randomize( init3 ); randomize( rhs3 );
+      randomize( init4 ); randomize( rhs4 );
+
+      checkAssign( init2, rhs2 );
+      checkAssign( init3, rhs3 );
+      checkAssign( init4, rhs4 );
+   }
+
+   {
+      test_ = "Assignment of float arrays with an innermost dimension of 13";
+
+      blaze::DynamicArray<2, float> init2( 5UL, 13UL ), rhs2( 5UL, 13UL );
+      blaze::DynamicArray<3, float> init3( 3UL, 7UL, 13UL ), rhs3( 3UL, 7UL, 13UL );
+      blaze::DynamicArray<4, float> init4( 2UL, 3UL, 5UL, 13UL ), rhs4( 2UL, 3UL, 5UL, 13UL );
+      randomize( init2 ); randomize( rhs2 );
+      randomize( init3 ); randomize( rhs3 );
+      randomize( init4 ); randomize( rhs4 );
+
+      checkAssign( init2, rhs2 );
+      checkAssign( init3, rhs3 );
+      checkAssign( init4, rhs4 );
+   }
+
+   {
+      test_ = "Assignment of an unpadded double custom array";
+
+      using UnalignedUnpadded = blaze::CustomArray<3, double, blaze::unaligned, blaze::unpadded>;
+
+      std::unique_ptr<double[]> memory( new double[3UL*7UL*13UL+1UL] );
+      for( size_t i=0UL; i<3UL*7UL*13UL+1UL; ++i ) {
+         memory[i] = blaze::rand<double>();
+      }
+
+      const UnalignedUnpadded rhs( memory.get()+1UL, 3UL, 7UL, 13UL );
+      blaze::DynamicArray<3, double> init( 3UL, 7UL, 13UL );
+      randomize( init );
+
+      checkAssign( init, rhs );
+   }
+
+   {
+      test_ = "Assignment of an unpadded float custom array";
+
+      using UnalignedUnpadded = blaze::CustomArray<4, float, blaze::unaligned, blaze::unpadded>;
+
+      std::unique_ptr<float[]> memory( new float[2UL*3UL*5UL*13UL+1UL] );
+      for( size_t i=0UL; i<2UL*3UL*5UL*13UL+1UL; ++i ) {
+         memory[i] = blaze::rand<float>();
+      }
+
+      const UnalignedUnpadded rhs( memory.get()+1UL, 2UL, 3UL, 5UL, 13UL );
+      blaze::DynamicArray<4, float> init( 2UL, 3UL, 5UL, 13UL );
+      randomize( init );
+
+      checkAssign( init, rhs );
+   }
+
+   {
+      test_ = "Streaming assignment of large double and float arrays";
+
+      // The capacity of both arrays exceeds cacheSize/(3*sizeof(Type)) for the default
+      // cache size, which selects the streaming branch of the vectorized assignment.
+      blaze::DynamicArray<3, double> initd( 5UL, 211UL, 251UL ), rhsd( 5UL, 211UL, 251UL );
+      blaze::DynamicArray<3, float > initf( 5UL, 211UL, 251UL ), rhsf( 5UL, 211UL, 251UL );
+      randomize( initd ); randomize( rhsd );
+      randomize( initf ); randomize( rhsf );
+
+      checkAssign( initd, rhsd );
+      checkAssign( initf, rhsf );
+   }
+
+   {
+      test_ = "SMP assignment of arrays with a prime number of rows";
+
+      // 509 rows cannot be split evenly across any number of threads smaller than 509, which
+      // leaves a partial row range for the last thread of the SMP (compound) assignments.
+      blaze::DynamicArray<3, double> initd( 1UL, 509UL, 127UL ), rhsd( 1UL, 509UL, 127UL );
+      blaze::DynamicArray<4, float > initf( 1UL, 1UL, 509UL, 101UL );
+      blaze::DynamicArray<4, float > rhsf ( 1UL, 1UL, 509UL, 101UL );
+      blaze::DynamicArray<3, int   > initi( 1UL, 509UL, 127UL ), rhsi( 1UL, 509UL, 127UL );
+      randomize( initd ); randomize( rhsd );
+      randomize( initf ); randomize( rhsf );
+      randomize( initi, -5, 5 ); randomize( rhsi, -5, 5 );
+
+      checkAssign( initd, rhsd );
+      checkAssign( initf, rhsf );
+      checkAssign( initi, rhsi );
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace densearray
 
 } // namespace mathtest
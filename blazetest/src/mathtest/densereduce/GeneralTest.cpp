@@ -0,0 +1,256 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/densereduce/GeneralTest.cpp
+//  \brief Source file for the general dense reduction test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/Functors.h>
+#include <blazetest/mathtest/densereduce/GeneralTest.h>
+
+#include <blaze_tensor/system/Optimizations.h>
+#include <blaze_tensor/system/Thresholds.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace densereduce {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GeneralTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+GeneralTest::GeneralTest()
+{
+   testTensor();
+   testArray();
+   testReproducibility();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel total reductions of dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum(), \c prod(), and \c max() functions for dense
+// tensors with at least SMP_DTENSREDUCE_THRESHOLD elements. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testTensor()
+{
+   const size_t M( 67UL );
+   const size_t N( 131UL );
+   const size_t O( blaze::SMP_DTENSREDUCE_THRESHOLD / ( M*N ) + 2UL );
+
+   {
+      test_ = "sum()/max() of a large dense tensor with element type int";
+
+      blaze::DynamicTensor<int> tens( O, M, N );
+      randomize( tens, -10, 10 );
+      tens(O-1UL,M-1UL,N-1UL) = 11;
+
+      checkResult( blaze::sum( tens ), reference( tens, blaze::Add() ) );
+      checkResult( blaze::max( tens ), reference( tens, blaze::Max() ) );
+      checkResult( blaze::max( tens ), 11 );
+   }
+
+   {
+      test_ = "sum()/prod()/max() of a large dense tensor with element type double";
+
+      blaze::DynamicTensor<double> tens( O, M, N );
+      randomize( tens, 0.99, 1.01 );
+
+      checkResult( blaze::sum ( tens ), reference( tens, blaze::Add()  ) );
+      checkResult( blaze::prod( tens ), reference( tens, blaze::Mult() ) );
+      checkResult( blaze::max ( tens ), reference( tens, blaze::Max()  ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel total reductions of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum(), \c prod(), and \c max() functions for three-
+// and four-dimensional dense arrays with at least SMP_DARRREDUCE_THRESHOLD elements. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testArray()
+{
+   {
+      test_ = "sum()/max() of a large three-dimensional dense array with element type int";
+
+      const size_t M( 67UL );
+      const size_t N( 131UL );
+      const size_t O( blaze::SMP_DARRREDUCE_THRESHOLD / ( M*N ) + 2UL );
+
+      blaze::DynamicArray<3, int> arr( O, M, N );
+      randomize( arr, -10, 10 );
+      arr(O-1UL,M-1UL,N-1UL) = 11;
+
+      checkResult( blaze::sum( arr ), reference( arr, blaze::Add() ) );
+      checkResult( blaze::max( arr ), reference( arr, blaze::Max() ) );
+      checkResult( blaze::max( arr ), 11 );
+   }
+
+   {
+      test_ = "sum()/prod()/max() of a large four-dimensional dense array with element type double";
+
+      const size_t M( 29UL );
+      const size_t N( 67UL );
+      const size_t O( 7UL );
+      const size_t L( blaze::SMP_DARRREDUCE_THRESHOLD / ( O*M*N ) + 2UL );
+
+      blaze::DynamicArray<4, double> arr( L, O, M, N );
+      randomize( arr, 0.99, 1.01 );
+
+      checkResult( blaze::sum ( arr ), reference( arr, blaze::Add()  ) );
+      checkResult( blaze::prod( arr ), reference( arr, blaze::Mult() ) );
+      checkResult( blaze::max ( arr ), reference( arr, blaze::Max()  ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reproducibility of the parallel total reductions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that repeated parallel reductions of the same dense tensor or dense
+// array give bit-identical results. In case the deterministic reduction mode is active (see
+// BLAZE_USE_DETERMINISTIC_REDUCTION), this is guaranteed independent of the number of threads.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testReproducibility()
+{
+   {
+      test_ = blaze::useDeterministicReduction
+              ? "Reproducibility of dense tensor reductions (deterministic mode)"
+              : "Reproducibility of dense tensor reductions";
+
+      const size_t M( 67UL );
+      const size_t N( 131UL );
+      const size_t O( blaze::SMP_DTENSREDUCE_THRESHOLD / ( M*N ) + 2UL );
+
+      blaze::DynamicTensor<double> tens( O, M, N );
+      randomize( tens, 0.99, 1.01 );
+
+      checkReproducibility( tens );
+   }
+
+   {
+      test_ = blaze::useDeterministicReduction
+              ? "Reproducibility of dense array reductions (deterministic mode)"
+              : "Reproducibility of dense array reductions";
+
+      const size_t M( 29UL );
+      const size_t N( 67UL );
+      const size_t O( 7UL );
+      const size_t L( blaze::SMP_DARRREDUCE_THRESHOLD / ( O*M*N ) + 2UL );
+
+      blaze::DynamicArray<4, double> arr( L, O, M, N );
+      randomize( arr, 0.99, 1.01 );
+
+      checkReproducibility( arr );
+   }
+}
+//*************************************************************************************************
+
+} // namespace densereduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running general dense reduction test"
+             << ( blaze::useDeterministicReduction ? " (deterministic mode)" : "" )
+             << "..." << std::endl;
+
+   try
+   {
+      RUN_DENSEREDUCE_GENERAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during general dense reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -39,11 +39,16 @@
 //*************************************************************************************************
 
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <blaze/system/Platform.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/typetraits/Decay.h>
 #include <blazetest/mathtest/IsEqual.h>
 
 #include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/PageSlice.h>
+#include <blaze_tensor/math/Subtensor.h>
 #include <blaze_tensor/math/dense/DenseTensor.h>
 
 #include <blazetest/mathtest/densetensor/GeneralTest.h>
@@ -89,6 +94,14 @@ GeneralTest::GeneralTest()
    testL3Norm();
    testL4Norm();
    testLpNorm();
+   testNorms();
+   testInner();
+   testReduce();
+   testMoments();
+   testArgMinMax();
+   testScan();
+   testTrans();
+   testTransKernels();
 }
 //*************************************************************************************************
 
@@ -3104,6 +3117,851 @@ void GeneralTest::testLpNorm()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the norm functions for large and narrow dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c norm(), \c sqrNorm(), \c l1Norm(), \c l2Norm(),
+// \c lpNorm() and \c maxNorm() functions for padded tensors whose rows are shorter than four
+// SIMD vectors, for non-contiguous subtensors and for tensors above the SMP reduction
+// threshold. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNorms()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "Norms of narrow padded tensors";
+
+      for( size_t n : { 1UL, 3UL, 5UL, 7UL, 9UL, 13UL, 15UL, 17UL, 31UL } )
+      {
+         blaze::DynamicTensor<double> tens( 3UL, 5UL, n );
+         randomize( tens, -5.0, 5.0 );
+
+         checkNorms( test_, tens, 3UL*5UL*n, [&]( size_t l ) {
+            return tens( l/(5UL*n), (l/n)%5UL, l%n ); } );
+      }
+   }
+
+   {
+      test_ = "Norms of narrow subtensors";
+
+      for( size_t n : { 1UL, 2UL, 5UL, 9UL, 14UL } )
+      {
+         blaze::DynamicTensor<double> tens( 4UL, 7UL, n+3UL );
+         randomize( tens, -5.0, 5.0 );
+
+         const auto sub( blaze::subtensor( tens, 1UL, 2UL, 1UL, 3UL, 5UL, n ) );
+
+         checkNorms( test_, sub, 3UL*5UL*n, [&]( size_t l ) {
+            return sub( l/(5UL*n), (l/n)%5UL, l%n ); } );
+      }
+   }
+
+   {
+      test_ = "Norms of large tensors";
+
+      blaze::DynamicTensor<double> tens( 6UL, 300UL, 251UL );
+      randomize( tens, -1.0, 1.0 );
+
+      checkNorms( test_, tens, 6UL*300UL*251UL, [&]( size_t l ) {
+         return tens( l/(300UL*251UL), (l/251UL)%300UL, l%251UL ); } );
+
+      const auto sub( blaze::subtensor( tens, 1UL, 3UL, 2UL, 5UL, 290UL, 247UL ) );
+
+      checkNorms( test_, sub, 5UL*290UL*247UL, [&]( size_t l ) {
+         return sub( l/(290UL*247UL), (l/247UL)%290UL, l%247UL ); } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c inner() and \c dot() functions for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c inner() and \c dot() functions for dense tensors.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testInner()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "inner() function";
+
+      {
+         blaze::DynamicTensor<int> tens1, tens2;
+
+         const int scalar = blaze::inner( tens1, tens2 );
+
+         if( scalar != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product computation failed\n"
+                << " Details:\n"
+                << "   Result: " << scalar << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens1{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } };
+         blaze::DynamicTensor<int> tens2( 2UL, 2UL, 2UL, 2 );
+
+         const int scalar = blaze::inner( tens1, tens2 );
+
+         if( scalar != 72 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product computation failed\n"
+                << " Details:\n"
+                << "   Result: " << scalar << "\n"
+                << "   Expected result: 72\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens1( 3UL, 7UL, 19UL );
+         blaze::DynamicTensor<int> tens2( 3UL, 7UL, 19UL );
+         randomize( tens1, -5, 5 );
+         randomize( tens2, -5, 5 );
+
+         int expected( 0 );
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t i=0UL; i<7UL; ++i ) {
+               for( size_t j=0UL; j<19UL; ++j ) {
+                  expected += tens1(k,i,j) * tens2(k,i,j);
+               }
+            }
+         }
+
+         const int scalar1 = blaze::inner( tens1, tens2 );
+         const int scalar2 = blaze::dot( tens1, tens2 );
+         const int scalar3 = blaze::sum( tens1 % tens2 );
+
+         if( scalar1 != expected || scalar2 != expected || scalar3 != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product computation failed\n"
+                << " Details:\n"
+                << "   inner(): " << scalar1 << "\n"
+                << "   dot(): " << scalar2 << "\n"
+                << "   sum(A % B): " << scalar3 << "\n"
+                << "   Expected result: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         for( size_t n : { 19UL, 129UL } )
+         {
+            const size_t o( n > 100UL ? 8UL : 3UL );
+            const size_t m( n > 100UL ? 64UL : 7UL );
+
+            blaze::DynamicTensor<int> A( o, m, n ), B( o, m, 5UL ), C( o, 5UL, n ), D( o, m, n );
+            randomize( A, -5, 5 );
+            randomize( B, -3, 3 );
+            randomize( C, -3, 3 );
+            randomize( D, -5, 5 );
+
+            int expected1( 0 ), expected2( 0 ), expected3( 0 );
+            for( size_t k=0UL; k<o; ++k ) {
+               for( size_t i=0UL; i<m; ++i ) {
+                  for( size_t j=0UL; j<n; ++j ) {
+                     int product( 0 );
+                     for( size_t l=0UL; l<5UL; ++l ) {
+                        product += B(k,i,l) * C(k,l,j);
+                     }
+                     expected1 += A(k,i,j) * product;
+                     expected2 += ( A(k,i,j) - D(k,i,j) ) * ( A(k,i,j) - D(k,i,j) );
+                     expected3 += ( A(k,i,j) - product ) * ( A(k,i,j) - product );
+                  }
+               }
+            }
+
+            const int scalar1 = blaze::sum( A % ( B * C ) );
+            const int scalar2 = blaze::sum( blaze::map( A - D, blaze::Pow2() ) );
+            const int scalar3 = blaze::sum( blaze::map( A - B * C, blaze::Pow2() ) );
+
+            if( scalar1 != expected1 || scalar2 != expected2 || scalar3 != expected3 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Fused reduction failed\n"
+                   << " Details:\n"
+                   << "   sum(A % (B*C)): " << scalar1 << " (expected " << expected1 << ")\n"
+                   << "   sum(pow2(A - D)): " << scalar2 << " (expected " << expected2 << ")\n"
+                   << "   sum(pow2(A - B*C)): " << scalar3 << " (expected " << expected3 << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens1( 2UL, 3UL, 4UL, 1 );
+         blaze::DynamicTensor<int> tens2( 2UL, 4UL, 3UL, 1 );
+
+         try {
+            const int scalar = blaze::inner( tens1, tens2 );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inner product of tensors with different sizes succeeded\n"
+                << " Details:\n"
+                << "   Result: " << scalar << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partial \c reduce() functions for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the column-wise, row-wise and page-wise \c reduce() functions
+// for dense tensors. The column-wise reduction of an \f$ O \times M \times N \f$ tensor results
+// in an \f$ O \times N \f$ matrix, the row-wise reduction in an \f$ O \times M \f$ matrix and the
+// page-wise reduction in an \f$ M \times N \f$ matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testReduce()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-wise reduce() functions";
+
+      const blaze::DynamicTensor<int> tens{ { { 1, 0, 2 }, { 1, 3, 4 } },
+                                            { { 2, 1, 3 }, { 1, 1, 2 } } };
+
+      const blaze::DynamicMatrix<int> colsum( blaze::sum<blaze::columnwise>( tens ) );
+
+      checkRows   ( colsum, 2UL );
+      checkColumns( colsum, 3UL );
+      checkResult ( colsum, blaze::DynamicMatrix<int>{ { 2, 3, 6 }, { 3, 2, 5 } } );
+
+      checkResult( test_, blaze::prod<blaze::columnwise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 1, 0, 8 }, { 2, 1, 6 } } );
+      checkResult( test_, blaze::min<blaze::columnwise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 1, 0, 2 }, { 1, 1, 2 } } );
+      checkResult( test_, blaze::max<blaze::columnwise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 1, 3, 4 }, { 2, 1, 3 } } );
+
+      if( blaze::sum<blaze::columnwise>( tens )(1,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element access failed\n"
+             << " Details:\n"
+             << "   Result: " << blaze::sum<blaze::columnwise>( tens )(1,2) << "\n"
+             << "   Expected result: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         const int value = blaze::sum<blaze::columnwise>( tens ).at( 0UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n"
+             << " Details:\n"
+             << "   Result: " << value << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, 1, 1 }, { 2, 2, 2 } };
+
+      mat += blaze::sum<blaze::columnwise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 3, 4, 7 }, { 5, 4, 7 } } );
+
+      mat -= blaze::sum<blaze::columnwise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 1, 1, 1 }, { 2, 2, 2 } } );
+
+      mat %= blaze::sum<blaze::columnwise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 2, 3, 6 }, { 6, 4, 10 } } );
+   }
+
+   {
+      test_ = "Row-wise reduce() functions";
+
+      const blaze::DynamicTensor<int> tens{ { { 1, 0, 2 }, { 1, 3, 4 } },
+                                            { { 2, 1, 3 }, { 1, 1, 2 } } };
+
+      const blaze::DynamicMatrix<int> rowsum( blaze::sum<blaze::rowwise>( tens ) );
+
+      checkRows   ( rowsum, 2UL );
+      checkColumns( rowsum, 2UL );
+      checkResult ( rowsum, blaze::DynamicMatrix<int>{ { 3, 8 }, { 6, 4 } } );
+
+      checkResult( test_, blaze::prod<blaze::rowwise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 0, 12 }, { 6, 2 } } );
+      checkResult( test_, blaze::min<blaze::rowwise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 0, 1 }, { 1, 1 } } );
+      checkResult( test_, blaze::max<blaze::rowwise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 2, 4 }, { 3, 2 } } );
+
+      blaze::DynamicMatrix<int> mat{ { 1, 1 }, { 2, 2 } };
+
+      mat += blaze::sum<blaze::rowwise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 4, 9 }, { 8, 6 } } );
+
+      mat -= blaze::sum<blaze::rowwise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 1, 1 }, { 2, 2 } } );
+
+      mat %= blaze::sum<blaze::rowwise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 3, 8 }, { 12, 8 } } );
+   }
+
+   {
+      test_ = "Page-wise reduce() functions";
+
+      const blaze::DynamicTensor<int> tens{ { { 1, 0, 2 }, { 1, 3, 4 } },
+                                            { { 2, 1, 3 }, { 1, 1, 2 } },
+                                            { { 0, 2, 1 }, { 3, 0, 1 } } };
+
+      const blaze::DynamicMatrix<int> pagesum( blaze::sum<blaze::pagewise>( tens ) );
+
+      checkRows   ( pagesum, 2UL );
+      checkColumns( pagesum, 3UL );
+      checkResult ( pagesum, blaze::DynamicMatrix<int>{ { 3, 3, 6 }, { 5, 4, 7 } } );
+
+      checkResult( test_, blaze::prod<blaze::pagewise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 0, 0, 6 }, { 3, 0, 8 } } );
+      checkResult( test_, blaze::min<blaze::pagewise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 0, 0, 1 }, { 1, 0, 1 } } );
+      checkResult( test_, blaze::max<blaze::pagewise>( tens ),
+                   blaze::DynamicMatrix<int>{ { 2, 2, 3 }, { 3, 3, 4 } } );
+      checkResult( test_,
+                   blaze::reduce<blaze::pagewise>( tens, []( int a, int b ){ return a + b; } ),
+                   pagesum );
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, 1, 1 }, { 2, 2, 2 } };
+
+      mat += blaze::sum<blaze::pagewise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 4, 4, 7 }, { 7, 6, 9 } } );
+
+      mat -= blaze::sum<blaze::pagewise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 1, 1, 1 }, { 2, 2, 2 } } );
+
+      mat %= blaze::sum<blaze::pagewise>( tens );
+      checkResult( test_, mat, blaze::DynamicMatrix<int>{ { 3, 3, 6 }, { 10, 8, 14 } } );
+   }
+
+   {
+      test_ = "Partial reduce() functions of large tensors";
+
+      blaze::DynamicTensor<int> tens( 4UL, 300UL, 261UL );
+      randomize( tens, -5, 5 );
+
+      const blaze::DynamicTensor<double> dtens( tens );
+
+      const blaze::DynamicMatrix<int>    colsum ( blaze::sum<blaze::columnwise>( tens ) );
+      const blaze::DynamicMatrix<double> colmax ( blaze::max<blaze::columnwise>( dtens ) );
+      const blaze::DynamicMatrix<int>    rowsum ( blaze::sum<blaze::rowwise>( tens ) );
+      const blaze::DynamicMatrix<double> rowmin ( blaze::min<blaze::rowwise>( dtens ) );
+      const blaze::DynamicMatrix<double> pagesum( blaze::sum<blaze::pagewise>( dtens ) );
+      const blaze::DynamicMatrix<int>    pagemax( blaze::max<blaze::pagewise>( tens ) );
+
+      checkRows   ( colsum , 4UL   );
+      checkColumns( colsum , 261UL );
+      checkRows   ( rowsum , 4UL   );
+      checkColumns( rowsum , 300UL );
+      checkRows   ( pagesum, 300UL );
+      checkColumns( pagesum, 261UL );
+
+      blaze::DynamicMatrix<int> sumref( blaze::pageslice( tens, 0UL ) );
+      blaze::DynamicMatrix<int> maxref( blaze::pageslice( tens, 0UL ) );
+
+      for( size_t k=0UL; k<4UL; ++k )
+      {
+         const auto page( blaze::pageslice( tens, k ) );
+
+         checkResult( test_, blaze::row( colsum, k ), blaze::sum<blaze::columnwise>( page ) );
+         checkResult( test_, blaze::row( colmax, k ), blaze::max<blaze::columnwise>( page ) );
+         checkResult( test_, blaze::trans( blaze::row( rowsum, k ) ),
+                      blaze::sum<blaze::rowwise>( page ) );
+         checkResult( test_, blaze::trans( blaze::row( rowmin, k ) ),
+                      blaze::min<blaze::rowwise>( page ) );
+
+         if( k > 0UL ) {
+            sumref += page;
+            maxref  = blaze::max( maxref, page );
+         }
+      }
+
+      checkResult( test_, pagesum, sumref );
+      checkResult( test_, pagemax, maxref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c moments() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c moments() function for dense tensors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMoments()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "moments() function";
+
+      {
+         blaze::DynamicTensor<int> tens{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } };
+
+         checkMoments( test_, blaze::moments( tens ),
+                       blaze::Moments<double>{ 8UL, 4.5, 6.0, 1.0, 8.0 } );
+
+         const blaze::Moments< blaze::DynamicMatrix<double> > stats(
+            blaze::moments<blaze::pagewise>( tens ) );
+
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<2UL; ++j ) {
+               const double x( tens(0UL,i,j) );
+               checkMoments( test_,
+                             blaze::Moments<double>{ stats.count, stats.mean(i,j),
+                                                     stats.variance(i,j), stats.min(i,j),
+                                                     stats.max(i,j) },
+                             blaze::Moments<double>{ 2UL, x+2.0, 8.0, x, x+4.0 } );
+            }
+         }
+      }
+
+      {
+         blaze::DynamicTensor<double> tens( 3UL, 7UL, 19UL );
+         randomize( tens, -5.0, 5.0 );
+
+         checkMoments( test_, blaze::moments( tens ),
+                       referenceMoments( 3UL*7UL*19UL, [&]( size_t l ) {
+            return tens( l/(7UL*19UL), (l/19UL)%7UL, l%19UL ); } ) );
+
+         const blaze::Moments< blaze::DynamicMatrix<double> > stats1(
+            blaze::moments<blaze::columnwise>( tens ) );
+
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t j=0UL; j<19UL; ++j ) {
+               checkMoments( test_,
+                             blaze::Moments<double>{ stats1.count, stats1.mean(k,j),
+                                                     stats1.variance(k,j), stats1.min(k,j),
+                                                     stats1.max(k,j) },
+                             referenceMoments( 7UL, [&]( size_t l ) { return tens(k,l,j); } ) );
+            }
+         }
+
+         const blaze::Moments< blaze::DynamicMatrix<double> > stats2(
+            blaze::moments<blaze::rowwise>( tens ) );
+
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t i=0UL; i<7UL; ++i ) {
+               checkMoments( test_,
+                             blaze::Moments<double>{ stats2.count, stats2.mean(k,i),
+                                                     stats2.variance(k,i), stats2.min(k,i),
+                                                     stats2.max(k,i) },
+                             referenceMoments( 19UL, [&]( size_t l ) { return tens(k,i,l); } ) );
+            }
+         }
+
+         const blaze::Moments< blaze::DynamicMatrix<double> > stats3(
+            blaze::moments<blaze::pagewise>( tens ) );
+
+         for( size_t i=0UL; i<7UL; ++i ) {
+            for( size_t j=0UL; j<19UL; ++j ) {
+               checkMoments( test_,
+                             blaze::Moments<double>{ stats3.count, stats3.mean(i,j),
+                                                     stats3.variance(i,j), stats3.min(i,j),
+                                                     stats3.max(i,j) },
+                             referenceMoments( 3UL, [&]( size_t l ) { return tens(l,i,j); } ) );
+            }
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 1UL, 1UL, 1UL, 1 );
+
+         try {
+            const blaze::Moments<double> stats( blaze::moments( tens ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Moments computation of a single element succeeded\n"
+                << " Details:\n"
+                << "   Result: mean=" << stats.mean << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c argmin() and \c argmax() functions for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c argmin() and \c argmax() functions for dense tensors.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testArgMinMax()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "argmin()/argmax() functions";
+
+      {
+         blaze::DynamicTensor<int> tens{ { { 1, -4 }, { 3, 4 } }, { { -4, 2 }, { 0, 4 } } };
+
+         checkIndex( test_, blaze::argmin( tens ), 1UL );
+         checkIndex( test_, blaze::argmax( tens ), 3UL );
+
+         const blaze::DynamicMatrix<size_t> indices1( blaze::argmin<blaze::pagewise>( tens ) );
+         const blaze::DynamicMatrix<size_t> indices2( blaze::argmax<blaze::rowwise>( tens ) );
+
+         checkIndex( test_, indices1(0,0), 1UL );
+         checkIndex( test_, indices1(0,1), 0UL );
+         checkIndex( test_, indices1(1,0), 1UL );
+         checkIndex( test_, indices1(1,1), 0UL );
+         checkIndex( test_, indices2(0,0), 0UL );
+         checkIndex( test_, indices2(0,1), 1UL );
+         checkIndex( test_, indices2(1,0), 1UL );
+         checkIndex( test_, indices2(1,1), 1UL );
+      }
+
+      {
+         blaze::DynamicTensor<double> tens( 3UL, 7UL, 1500UL );
+         randomize( tens, -5.0, 5.0 );
+         tens(2UL,6UL,1499UL) = tens(0UL,3UL,17UL) = 10.0;
+         tens(1UL,5UL,1400UL) = -10.0;
+
+         const auto flat = [&]( size_t l ) {
+            return tens( l/(7UL*1500UL), (l/1500UL)%7UL, l%1500UL );
+         };
+
+         checkIndex( test_, blaze::argmin( tens ),
+                     referenceIndex( 3UL*7UL*1500UL, flat, std::less<double>() ) );
+         checkIndex( test_, blaze::argmax( tens ),
+                     referenceIndex( 3UL*7UL*1500UL, flat, std::greater<double>() ) );
+
+         const blaze::DynamicMatrix<size_t> indices1( blaze::argmin<blaze::columnwise>( tens ) );
+         const blaze::DynamicMatrix<size_t> indices2( blaze::argmax<blaze::columnwise>( tens ) );
+
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t j=0UL; j<1500UL; ++j ) {
+               const auto get = [&]( size_t l ) { return tens(k,l,j); };
+               checkIndex( test_, indices1(k,j), referenceIndex( 7UL, get, std::less<double>() ) );
+               checkIndex( test_, indices2(k,j),
+                           referenceIndex( 7UL, get, std::greater<double>() ) );
+            }
+         }
+
+         const blaze::DynamicMatrix<size_t> indices3( blaze::argmin<blaze::rowwise>( tens ) );
+         const blaze::DynamicMatrix<size_t> indices4( blaze::argmax<blaze::rowwise>( tens ) );
+
+         for( size_t k=0UL; k<3UL; ++k ) {
+            for( size_t i=0UL; i<7UL; ++i ) {
+               const auto get = [&]( size_t l ) { return tens(k,i,l); };
+               checkIndex( test_, indices3(k,i),
+                           referenceIndex( 1500UL, get, std::less<double>() ) );
+               checkIndex( test_, indices4(k,i),
+                           referenceIndex( 1500UL, get, std::greater<double>() ) );
+            }
+         }
+
+         const blaze::DynamicMatrix<size_t> indices5( blaze::argmin<blaze::pagewise>( tens ) );
+         const blaze::DynamicMatrix<size_t> indices6( blaze::argmax<blaze::pagewise>( tens ) );
+
+         for( size_t i=0UL; i<7UL; ++i ) {
+            for( size_t j=0UL; j<1500UL; ++j ) {
+               const auto get = [&]( size_t l ) { return tens(l,i,j); };
+               checkIndex( test_, indices5(i,j), referenceIndex( 3UL, get, std::less<double>() ) );
+               checkIndex( test_, indices6(i,j),
+                           referenceIndex( 3UL, get, std::greater<double>() ) );
+            }
+         }
+      }
+
+      {
+         blaze::DynamicTensor<int> tens( 2UL, 0UL, 3UL );
+
+         try {
+            const size_t index( blaze::argmin( tens ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Index computation of an empty tensor succeeded\n"
+                << " Details:\n"
+                << "   Result: " << index << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c scan(), \c cumsum(), and \c cumprod() functions for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c scan(), \c cumsum(), and \c cumprod() functions for
+// dense tensors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testScan()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "scan()/cumsum()/cumprod() functions";
+
+      {
+         const blaze::DynamicTensor<int> tens{ { { 1, 2, 3 }, { 4, 5, 6 } },
+                                               { { 7, 8, 9 }, { 1, 2, 3 } } };
+
+         const blaze::DynamicTensor<int> result1( blaze::cumsum<blaze::rowwise>( tens ) );
+         const blaze::DynamicTensor<int> result2( blaze::cumsum<blaze::columnwise>( tens ) );
+         const blaze::DynamicTensor<int> result3( blaze::cumprod<blaze::pagewise>( tens ) );
+
+         checkResult( test_, result1,
+                      blaze::DynamicTensor<int>{ { { 1, 3, 6 }, { 4, 9, 15 } },
+                                                 { { 7, 15, 24 }, { 1, 3, 6 } } } );
+         checkResult( test_, result2,
+                      blaze::DynamicTensor<int>{ { { 1, 2, 3 }, { 5, 7, 9 } },
+                                                 { { 7, 8, 9 }, { 8, 10, 12 } } } );
+         checkResult( test_, result3,
+                      blaze::DynamicTensor<int>{ { { 1, 2, 3 }, { 4, 5, 6 } },
+                                                 { { 7, 16, 27 }, { 4, 10, 18 } } } );
+      }
+
+      {
+         blaze::DynamicTensor<double> tens( 3UL, 7UL, 1500UL );
+         randomize( tens, 0.0, 1.0 );
+
+         checkResult( test_, blaze::evaluate( blaze::cumsum<blaze::columnwise>( tens ) ),
+                      referenceScan( tens, blaze::columnwise, blaze::Add() ) );
+         checkResult( test_, blaze::evaluate( blaze::cumsum<blaze::rowwise>( tens ) ),
+                      referenceScan( tens, blaze::rowwise, blaze::Add() ) );
+         checkResult( test_, blaze::evaluate( blaze::cumsum<blaze::pagewise>( tens ) ),
+                      referenceScan( tens, blaze::pagewise, blaze::Add() ) );
+
+         checkResult( test_,
+                      blaze::evaluate( blaze::scan<blaze::columnwise>( tens, blaze::Max() ) ),
+                      referenceScan( tens, blaze::columnwise, blaze::Max() ) );
+         checkResult( test_, blaze::evaluate( blaze::scan<blaze::rowwise>( tens, blaze::Max() ) ),
+                      referenceScan( tens, blaze::rowwise, blaze::Max() ) );
+         checkResult( test_, blaze::evaluate( blaze::scan<blaze::pagewise>( tens, blaze::Max() ) ),
+                      referenceScan( tens, blaze::pagewise, blaze::Max() ) );
+      }
+
+      {
+         blaze::DynamicTensor<double> tens( 2UL, 3UL, 250UL );
+         randomize( tens, 0.99, 1.01 );
+
+         checkResult( test_, blaze::evaluate( blaze::cumprod<blaze::rowwise>( tens ) ),
+                      referenceScan( tens, blaze::rowwise, blaze::Mult() ) );
+         checkResult( test_, blaze::evaluate( blaze::cumprod<blaze::pagewise>( tens ) ),
+                      referenceScan( tens, blaze::pagewise, blaze::Mult() ) );
+      }
+
+      {
+         blaze::DynamicTensor<double> tens( 2UL, 3UL, 5UL );
+         randomize( tens, 0.0, 1.0 );
+
+         blaze::DynamicTensor<double> result( tens );
+         result += blaze::cumsum<blaze::rowwise>( tens );
+
+         const blaze::DynamicTensor<double> expected(
+            referenceScan( tens, blaze::rowwise, blaze::Add() ) + tens );
+
+         checkResult( test_, result, expected );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c trans() function for dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c trans() function for dense tensors with compile time
+// and runtime axis mappings. It checks the CRTP type of compile time transpositions, the row
+// iterators of transpositions that move the column axis, and the composition of nested
+// transpositions. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testTrans()
+{
+   using blaze::trans;
+
+   using TT = blaze::DynamicTensor<int>;
+
+
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "trans() function (compile time axis mappings)";
+
+      TT tens( 3UL, 4UL, 5UL );
+      randomize( tens );
+
+      checkTranspose( TT( trans<0UL,2UL,1UL>( tens ) ), tens, {{ 0UL, 2UL, 1UL }} );
+      checkTranspose( TT( trans<1UL,0UL,2UL>( tens ) ), tens, {{ 1UL, 0UL, 2UL }} );
+      checkTranspose( TT( trans<1UL,2UL,0UL>( tens ) ), tens, {{ 1UL, 2UL, 0UL }} );
+      checkTranspose( TT( trans<2UL,0UL,1UL>( tens ) ), tens, {{ 2UL, 0UL, 1UL }} );
+      checkTranspose( TT( trans<2UL,1UL,0UL>( tens ) ), tens, {{ 2UL, 1UL, 0UL }} );
+      checkTranspose( TT( trans( tens ) ), tens, {{ 2UL, 1UL, 0UL }} );
+
+      using IdentityType = decltype( trans<0UL,1UL,2UL>( tens ) );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( IdentityType, const TT& );
+   }
+
+   {
+      test_ = "trans() function (CRTP type of compile time transpositions)";
+
+      TT tens( 3UL, 4UL, 5UL );
+      randomize( tens );
+
+      using ExprType = blaze::DTensTransExpr<TT,2UL,0UL,1UL>;
+      using CRTPType = blaze::Decay_t< decltype( ~trans<2UL,0UL,1UL>( tens ) ) >;
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ExprType, CRTPType );
+
+      const auto expr( trans<2UL,0UL,1UL>( tens ) );
+      const blaze::DenseTensor<ExprType>& base( expr );
+
+      checkTranspose( ~base, tens, {{ 2UL, 0UL, 1UL }} );
+      checkTranspose( TT( ~base ), tens, {{ 2UL, 0UL, 1UL }} );
+   }
+
+   {
+      test_ = "trans() function (row iterators)";
+
+      TT tens( 3UL, 4UL, 5UL );
+      randomize( tens );
+
+      checkIterators( trans<0UL,2UL,1UL>( tens ) );
+      checkIterators( trans<1UL,0UL,2UL>( tens ) );
+      checkIterators( trans<1UL,2UL,0UL>( tens ) );
+      checkIterators( trans<2UL,0UL,1UL>( tens ) );
+      checkIterators( trans<2UL,1UL,0UL>( tens ) );
+      checkIterators( trans( tens, { 0UL, 2UL, 1UL } ) );
+      checkIterators( trans( tens, { 1UL, 0UL, 2UL } ) );
+      checkIterators( trans( tens, { 2UL, 1UL, 0UL } ) );
+   }
+
+   {
+      test_ = "trans() function (nested transpositions)";
+
+      TT tens( 3UL, 4UL, 5UL );
+      randomize( tens );
+
+      using IdentityType = decltype( trans<1UL,2UL,0UL>( trans<2UL,0UL,1UL>( tens ) ) );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( IdentityType, const TT& );
+
+      checkResult( test_, trans<1UL,2UL,0UL>( trans<2UL,0UL,1UL>( tens ) ), tens );
+      checkResult( test_, trans<0UL,2UL,1UL>( trans<0UL,2UL,1UL>( tens ) ), tens );
+
+      using NestedType = blaze::Decay_t< decltype( trans<0UL,2UL,1UL>( trans<1UL,0UL,2UL>( tens ) ) ) >;
+      using ExprType   = blaze::DTensTransExpr<TT,1UL,2UL,0UL>;
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( NestedType, ExprType );
+
+      checkTranspose( trans<0UL,2UL,1UL>( trans<1UL,0UL,2UL>( tens ) ), tens, {{ 1UL, 2UL, 0UL }} );
+      checkTranspose( trans( trans<1UL,0UL,2UL>( tens ), { 2UL, 0UL, 1UL } ), tens, {{ 2UL, 1UL, 0UL }} );
+      checkTranspose( trans<2UL,0UL,1UL>( trans( tens, { 1UL, 0UL, 2UL } ) ), tens, {{ 2UL, 1UL, 0UL }} );
+      checkTranspose( trans( trans<2UL,0UL,1UL>( tens ) ), tens, {{ 1UL, 0UL, 2UL }} );
+      checkTranspose( trans( trans( tens, { 1UL, 2UL, 0UL } ), { 1UL, 2UL, 0UL } ), tens, {{ 2UL, 0UL, 1UL }} );
+
+      const TT inner( trans<1UL,0UL,2UL>( tens ) );
+
+      checkTranspose( TT( trans( trans<1UL,0UL,2UL>( tens ), { 2UL, 0UL, 1UL } ) ), inner, {{ 2UL, 0UL, 1UL }} );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the cache-blocked permutation kernels of the \c trans() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the permutation kernels used for the assignment of dense
+// tensor transpositions. The tensor sizes exceed the cache block size of the kernels and are no
+// multiples of the size of the vectorized micro tiles. The large tensors exceed the cache, such
+// that the targets are written by means of streaming stores, and exceed the SMP threshold, such
+// that the parallel permutation is used. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testTransKernels()
+{
+   //=====================================================================================
+   // Row-major tensor tests
+   //=====================================================================================
+
+   {
+      test_ = "trans() function (permutation kernels with element type int)";
+
+      checkPermutations<int>( 3UL, 67UL, 70UL );
+   }
+
+   {
+      test_ = "trans() function (permutation kernels with element type double)";
+
+      checkPermutations<double>( 2UL, 3UL, 5UL );
+      checkPermutations<double>( 5UL, 67UL, 130UL );
+      checkPermutations<double>( 67UL, 70UL, 73UL );
+   }
+
+   {
+      test_ = "trans() function (permutation kernels with element type float)";
+
+      checkPermutations<float>( 2UL, 3UL, 5UL );
+      checkPermutations<float>( 5UL, 67UL, 130UL );
+      checkPermutations<float>( 67UL, 70UL, 73UL );
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace densetensor
 
 } // namespace mathtest
@@ -98,6 +98,7 @@ DenseTest::DenseTest()
    testColumn();
    testColumns();
    testBand();
+   testSIMDAssign();
 }
 //*************************************************************************************************
 
@@ -5521,6 +5522,74 @@ void DenseTest::testBand()
       catch( std::invalid_argument& ) {}
    }
 }
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the vectorized assignments of the DilatedSubmatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the vectorized assignments to and from the DilatedSubmatrix
+// specialization. It uses sizes that are not a multiple of the SIMD width and covers the strided
+// kernels for dilations greater than 1 along the contiguous axis as well as the contiguous
+// kernels for a dilation of 1. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void DenseTest::testSIMDAssign()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Row-major dilated submatrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DilatedSubmatrix vectorized assignment (unit column dilation)";
+
+      checkSIMDAssign<int,rowMajor>   ( 1UL, 3UL, 5UL, 37UL, 1UL, 1UL );
+      checkSIMDAssign<int,rowMajor>   ( 2UL, 0UL, 7UL, 67UL, 3UL, 1UL );
+      checkSIMDAssign<double,rowMajor>( 1UL, 5UL, 6UL, 37UL, 2UL, 1UL );
+   }
+
+   {
+      test_ = "Row-major DilatedSubmatrix vectorized assignment (column dilation > 1)";
+
+      for( size_t dilation : { 2UL, 3UL, 7UL } ) {
+         checkSIMDAssign<int,rowMajor>   ( 1UL, 3UL, 5UL, 37UL, 1UL, dilation );
+         checkSIMDAssign<int,rowMajor>   ( 2UL, 0UL, 7UL, 67UL, 2UL, dilation );
+         checkSIMDAssign<double,rowMajor>( 1UL, 5UL, 6UL, 37UL, 3UL, dilation );
+         checkSIMDAssign<float,rowMajor> ( 0UL, 1UL, 4UL, 69UL, 1UL, dilation );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major dilated submatrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DilatedSubmatrix vectorized assignment (unit row dilation)";
+
+      checkSIMDAssign<int,columnMajor>   ( 3UL, 1UL, 37UL, 5UL, 1UL, 1UL );
+      checkSIMDAssign<int,columnMajor>   ( 0UL, 2UL, 67UL, 7UL, 1UL, 3UL );
+      checkSIMDAssign<double,columnMajor>( 5UL, 1UL, 37UL, 6UL, 1UL, 2UL );
+   }
+
+   {
+      test_ = "Column-major DilatedSubmatrix vectorized assignment (row dilation > 1)";
+
+      for( size_t dilation : { 2UL, 3UL, 7UL } ) {
+         checkSIMDAssign<int,columnMajor>   ( 3UL, 1UL, 37UL, 5UL, dilation, 1UL );
+         checkSIMDAssign<int,columnMajor>   ( 0UL, 2UL, 67UL, 7UL, dilation, 2UL );
+         checkSIMDAssign<double,columnMajor>( 5UL, 1UL, 37UL, 6UL, dilation, 3UL );
+         checkSIMDAssign<float,columnMajor> ( 1UL, 0UL, 69UL, 4UL, dilation, 1UL );
+      }
+   }
+}
+//*************************************************************************************************
 ////*************************************************************************************************
 //
 //
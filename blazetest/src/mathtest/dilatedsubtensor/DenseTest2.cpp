@@ -96,6 +96,7 @@ DenseTest::DenseTest()
    testPageslice();
    testRowslice();
    testColumnslice();
+   testSIMDAssign();
    //testPageslices();
    //testRowslices();
    //testColumnslices();
@@ -2213,6 +2214,40 @@ void DenseTest::testColumnslice()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the vectorized assignments of the DilatedSubtensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the vectorized assignments to and from the DilatedSubtensor
+// specialization. It uses sizes that are not a multiple of the SIMD width and covers the strided
+// kernels for column dilations greater than 1 as well as the contiguous kernels for a column
+// dilation of 1. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testSIMDAssign()
+{
+   {
+      test_ = "DilatedSubtensor vectorized assignment (unit column dilation)";
+
+      checkSIMDAssign<int>   ( 3UL, 5UL, 37UL, 1UL, 1UL, 1UL );
+      checkSIMDAssign<int>   ( 2UL, 4UL, 67UL, 2UL, 3UL, 1UL );
+      checkSIMDAssign<double>( 3UL, 3UL, 37UL, 3UL, 2UL, 1UL );
+   }
+
+   {
+      test_ = "DilatedSubtensor vectorized assignment (column dilation > 1)";
+
+      for( size_t dilation : { 2UL, 3UL, 7UL } ) {
+         checkSIMDAssign<int>   ( 3UL, 5UL, 37UL, 1UL, 1UL, dilation );
+         checkSIMDAssign<int>   ( 2UL, 4UL, 67UL, 2UL, 3UL, dilation );
+         checkSIMDAssign<double>( 3UL, 3UL, 37UL, 3UL, 2UL, dilation );
+         checkSIMDAssign<float> ( 2UL, 2UL, 69UL, 1UL, 2UL, dilation );
+      }
+   }
+}
+//*************************************************************************************************
+
 
 
 
@@ -95,6 +95,7 @@ DenseTest::DenseTest()
    testIsSame();
    testDilatedSubvector();
    testElements();
+   testSIMDAssign();
 }
 //*************************************************************************************************
 
@@ -3183,6 +3184,37 @@ void DenseTest::testElements()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the vectorized assignments of the DilatedSubvector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the vectorized assignments to and from the DilatedSubvector
+// specialization. It uses sizes that are not a multiple of the SIMD width and covers the strided
+// kernels for dilations greater than 1 as well as the contiguous kernels for a dilation of 1.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testSIMDAssign()
+{
+   test_ = "DilatedSubvector vectorized assignment (unit dilation)";
+
+   checkSIMDAssign<int>   ( 3UL, 37UL, 1UL );
+   checkSIMDAssign<int>   ( 0UL, 128UL, 1UL );
+   checkSIMDAssign<double>( 5UL, 37UL, 1UL );
+   checkSIMDAssign<float> ( 1UL, 69UL, 1UL );
+
+   test_ = "DilatedSubvector vectorized assignment (dilation > 1)";
+
+   for( size_t dilation : { 2UL, 3UL, 7UL } ) {
+      checkSIMDAssign<int>   ( 3UL, 37UL, dilation );
+      checkSIMDAssign<int>   ( 0UL, 128UL, dilation );
+      checkSIMDAssign<double>( 5UL, 37UL, dilation );
+      checkSIMDAssign<float> ( 1UL, 69UL, dilation );
+   }
+}
+//*************************************************************************************************
+
 
 
 
@@ -0,0 +1,206 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dmatexpand/GeneralTest.cpp
+//  \brief Source file for the general dense matrix expansion test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dmatexpand/GeneralTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatexpand {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GeneralTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+GeneralTest::GeneralTest()
+{
+   testExpansion();
+   testSMPExpansion();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the combination of dense tensors with expanded dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition, subtraction and Schur product of dense tensors
+// with expanded dense matrices below the SMP threshold. The sizes cover the vectorized and the
+// remainder loops as well as more than one block of matrix rows. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testExpansion()
+{
+   {
+      test_ = "Expansion of a 2x3 matrix";
+
+      const DMat  M{ { 1, 2, 3 }, { 4, 5, 6 } };
+      const DTens T{ { { 1, 1, 1 }, { 2, 2, 2 } }, { { 0, 1, 0 }, { 1, 0, 1 } } };
+
+      const DTens expected{ { { 2, 3, 4 }, { 6, 7, 8 } }, { { 1, 3, 3 }, { 5, 5, 7 } } };
+
+      checkResult( "addition", DTens( T + blaze::expand( M, 2UL ) ), expected );
+   }
+
+   {
+      test_ = "Expansion of row-major and column-major matrices";
+
+      for( size_t n : { 1UL, 3UL, 16UL, 37UL } ) {
+         for( size_t m : { 1UL, 5UL, 64UL } ) {
+            for( size_t o : { 1UL, 3UL } ) {
+               DTens T( o, m, n );
+               DMat  M( m, n );
+               randomize( T, -5, 5 );
+               randomize( M, -5, 5 );
+
+               checkExpansion( T, M );
+               checkExpansion( T, blaze::DynamicMatrix<int,blaze::columnMajor>( M ) );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Expansion of matrix expressions";
+
+      DTens T( 3UL, 31UL, 45UL );
+      DMat  M( 31UL, 45UL );
+      randomize( T, -5, 5 );
+      randomize( M, -5, 5 );
+
+      checkExpansion( T, M + M );
+      checkExpansion( T, blaze::trans( DMat( blaze::trans( M ) ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP combination of dense tensors with expanded dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition, subtraction and Schur product of dense tensors
+// with expanded dense matrices above the SMP assignment threshold. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSMPExpansion()
+{
+   test_ = "SMP expansion of dense matrices";
+
+   for( size_t o : { 1UL, 4UL, 7UL } ) {
+      DTens T( o, 100UL, 130UL );
+      DMat  M( 100UL, 130UL );
+      randomize( T, -5, 5 );
+      randomize( M, -5, 5 );
+
+      checkExpansion( T, M );
+      checkExpansion( T, blaze::DynamicMatrix<int,blaze::columnMajor>( M ) );
+   }
+
+   {
+      DTens T( 2UL, 250UL, 130UL );
+      DMat  M( 250UL, 130UL );
+      randomize( T, -5, 5 );
+      randomize( M, -5, 5 );
+
+      checkExpansion( T, M );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dmatexpand
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running general dense matrix expansion test..." << std::endl;
+
+   try
+   {
+      RUN_DMATEXPAND_GENERAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during general dense matrix expansion test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,351 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dmatravel/GeneralTest.cpp
+//  \brief Source file for the general dense matrix ravel test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blazetest/mathtest/dmatravel/GeneralTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatravel {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GeneralTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+GeneralTest::GeneralTest()
+{
+   testPadded();
+   testUnpadded();
+   testResize();
+   testReshape();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ravel operation on padded dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the ravel operation on dense matrices whose rows are padded,
+// i.e. whose elements are not stored contiguously. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPadded()
+{
+   test_ = "Ravel of padded dense matrices";
+
+   using RavelType = blaze::Decay_t< decltype( blaze::ravel( std::declval<DMat>() ) ) >;
+
+   static_assert( !blaze::IsPadded_v<DMat> || !RavelType::simdEnabled,
+                  "Invalid SIMD evaluation of a padded operand detected" );
+
+   for( size_t n : { 1UL, 5UL, 13UL, 31UL, 67UL } ) {
+      for( size_t m : { 1UL, 3UL, 7UL, 64UL } ) {
+         DMat M( m, n );
+         randomize( M, -5, 5 );
+
+         checkRavel( M );
+         checkRavel( M + M );
+         checkRavel( blaze::DynamicMatrix<int,blaze::columnMajor>( M ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ravel operation on unpadded dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the ravel operation on unpadded custom matrices, both with
+// contiguously stored elements and with an explicitly specified row spacing. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testUnpadded()
+{
+   using UnalignedUnpadded = blaze::CustomMatrix<int,blaze::unaligned,blaze::unpadded,blaze::rowMajor>;
+   using RavelType = blaze::Decay_t< decltype( blaze::ravel( std::declval<UnalignedUnpadded>() ) ) >;
+
+   static_assert( RavelType::simdEnabled == UnalignedUnpadded::simdEnabled,
+                  "Invalid SIMD evaluation of an unpadded operand detected" );
+
+   {
+      test_ = "Ravel of contiguous unpadded dense matrices";
+
+      for( size_t n : { 1UL, 5UL, 16UL, 67UL } ) {
+         for( size_t m : { 1UL, 3UL, 8UL, 64UL } ) {
+            std::unique_ptr<int[]> memory( new int[m*n] );
+            UnalignedUnpadded M( memory.get(), m, n );
+            randomize( M, -5, 5 );
+
+            checkRavel( M );
+         }
+      }
+   }
+
+   {
+      test_ = "Ravel of non-contiguous unpadded dense matrices";
+
+      for( size_t n : { 1UL, 5UL, 16UL, 67UL } ) {
+         for( size_t m : { 1UL, 3UL, 8UL, 64UL } ) {
+            std::unique_ptr<int[]> memory( new int[m*(n+3UL)] );
+            UnalignedUnpadded M( memory.get(), m, n, n+3UL );
+            randomize( M, -5, 5 );
+
+            checkRavel( M );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ravel operation on a dense matrix that is resized after its creation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a ravel expression refers to the current elements of its operand
+// in case the operand is resized and therefore reallocated after the creation of the
+// expression. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testResize()
+{
+   test_ = "Ravel of a resized dense matrix";
+
+   DMat M( 3UL, 4UL );
+   randomize( M, -5, 5 );
+
+   const auto expr( blaze::ravel( M ) );
+
+   for( const auto& dims : { std::array<size_t,2UL>{ 7UL, 67UL }
+                           , std::array<size_t,2UL>{ 2UL, 3UL }
+                           , std::array<size_t,2UL>{ 9UL, 128UL } } )
+   {
+      M.resize( dims[0], dims[1], false );
+      randomize( M, -5, 5 );
+
+      const DVec result( expr );
+
+      bool mismatch( result.size() != M.rows() * M.columns() );
+
+      for( size_t i=0UL; !mismatch && i<M.rows(); ++i )
+         for( size_t j=0UL; !mismatch && j<M.columns(); ++j )
+            mismatch = ( result[i*M.columns() + j] != M(i,j) || expr[i*M.columns() + j] != M(i,j) );
+
+      if( mismatch ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Ravel operation does not reflect the resized operand\n"
+             << " Details:\n"
+             << "   Matrix:\n" << M << "\n"
+             << "   Result:\n" << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the tensor and array reshape views on constant dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reshape() function on constant row-major matrices,
+// which yields custom tensors and arrays of constant elements. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testReshape()
+{
+   std::unique_ptr<int[]> memory( new int[24UL] );
+   for( size_t i=0UL; i<24UL; ++i ) {
+      memory[i] = static_cast<int>( i ) - 11;
+   }
+
+   const blaze::CustomMatrix<int,blaze::unaligned,blaze::unpadded,blaze::rowMajor> M( memory.get(), 6UL, 4UL );
+
+   using ConstTensor = blaze::CustomTensor<const int,blaze::unaligned,blaze::unpadded>;
+   using ConstArray  = blaze::CustomArray<4UL,const int,blaze::unaligned,blaze::unpadded>;
+
+   {
+      test_ = "Reshape of a constant custom matrix";
+
+      const auto R1( blaze::reshape<3UL>( M, 2UL, 3UL, 4UL ) );
+      const auto R2( blaze::reshape<4UL>( M, 2UL, 3UL, 2UL, 2UL ) );
+
+      using R1Type = blaze::RemoveCV_t< decltype( R1 ) >;
+      using R2Type = blaze::RemoveCV_t< decltype( R2 ) >;
+
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( R1Type, ConstTensor );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( R2Type, ConstArray  );
+
+      bool mismatch( R1.data() != memory.get() || R2.data() != memory.get() );
+
+      for( size_t k=0UL; k<2UL; ++k )
+         for( size_t i=0UL; i<3UL; ++i )
+            for( size_t j=0UL; j<4UL; ++j )
+               mismatch = mismatch || R1(k,i,j) != M(k*3UL+i,j);
+
+      for( size_t l=0UL; l<2UL; ++l )
+         for( size_t k=0UL; k<3UL; ++k )
+            for( size_t i=0UL; i<2UL; ++i )
+               for( size_t j=0UL; j<2UL; ++j )
+                  mismatch = mismatch || R2(l,k,i,j) != memory[( ( l*3UL + k )*2UL + i )*2UL + j];
+
+      if( mismatch ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid reshape view detected\n"
+             << " Details:\n"
+             << "   Matrix:\n" << M << "\n"
+             << "   Reshaped matrix:\n" << R1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRavel( M );
+   }
+
+   {
+      test_ = "Reshape of a constant padded dense matrix";
+
+      const DMat P( 3UL, 5UL, 1 );
+
+      if( P.spacing() != P.columns() ) {
+         try {
+            const auto R( blaze::reshape<3UL>( P, 1UL, 3UL, 5UL ) );
+
+            std::ostringstream oss;
+            oss << " Test : " << test_ << "\n"
+                << " Error: Reshape of a padded matrix succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << R << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+
+   {
+      test_ = "Reshape with invalid dimensions";
+
+      try {
+         const auto R( blaze::reshape<4UL>( M, 2UL, 2UL, 2UL, 2UL ) );
+
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Reshape with invalid dimensions succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace dmatravel
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running general dense matrix ravel test..." << std::endl;
+
+   try
+   {
+      RUN_DMATRAVEL_GENERAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during general dense matrix ravel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,492 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dtensdmatttm/GeneralTest.cpp
+//  \brief Source file for the general dense tensor/dense matrix mode-n multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/constraints/SameType.h>
+#include <blazetest/mathtest/dtensdmatttm/GeneralTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dtensdmatttm {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GeneralTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+GeneralTest::GeneralTest()
+{
+   testMode0();
+   testMode1();
+   testMode2();
+   testNonContiguous();
+   testStatic();
+   testSizeMismatch();
+   testSMPMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the mode-0 multiplication of a dense tensor and a dense matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication along the pages of a dense tensor. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMode0()
+{
+   {
+      test_ = "Mode-0 multiplication of a 2x2x2 tensor";
+
+      const DTens T{ { { 1, 2 }, { 3, 4 } }, { { 0, 1 }, { 1, 0 } } };
+      const DMat  M{ { 1, 1 }, { 2, 0 }, { 0, 3 } };
+
+      const DTens C( blaze::ttm<0UL>( T, M ) );
+
+      const DTens expected{ { { 1, 3 }, { 4, 4 } },
+                            { { 2, 4 }, { 6, 8 } },
+                            { { 0, 3 }, { 3, 0 } } };
+
+      if( C != expected ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Incorrect result detected\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mode-0 multiplication of a 4x5x6 tensor";
+
+      DTens T( 4UL, 5UL, 6UL );
+      DMat  M( 3UL, 4UL );
+      initialize( T );
+      initialize( M );
+
+      checkResult<0UL>( T, M );
+      checkResult<0UL>( T, blaze::DynamicMatrix<double,blaze::columnMajor>( M ) );
+      checkResult<0UL>( T + T, M );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mode-1 multiplication of a dense tensor and a dense matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication along the rows of a dense tensor. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMode1()
+{
+   {
+      test_ = "Mode-1 multiplication of a 2x2x2 tensor";
+
+      const DTens T{ { { 1, 2 }, { 3, 4 } }, { { 0, 1 }, { 1, 0 } } };
+      const DMat  M{ { 1, 1 }, { 2, 0 }, { 0, 3 } };
+
+      const DTens C( blaze::ttm<1UL>( T, M ) );
+
+      const DTens expected{ { { 4, 6 }, { 2, 4 }, { 9, 12 } },
+                            { { 1, 1 }, { 0, 2 }, { 3,  0 } } };
+
+      if( C != expected ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Incorrect result detected\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mode-1 multiplication of a 4x5x6 tensor";
+
+      DTens T( 4UL, 5UL, 6UL );
+      DMat  M( 7UL, 5UL );
+      initialize( T );
+      initialize( M );
+
+      checkResult<1UL>( T, M );
+      checkResult<1UL>( T, blaze::DynamicMatrix<double,blaze::columnMajor>( M ) );
+      checkResult<1UL>( T + T, M );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mode-2 multiplication of a dense tensor and a dense matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication along the columns of a dense tensor. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMode2()
+{
+   {
+      test_ = "Mode-2 multiplication of a 2x2x2 tensor";
+
+      const DTens T{ { { 1, 2 }, { 3, 4 } }, { { 0, 1 }, { 1, 0 } } };
+      const DMat  M{ { 1, 1 }, { 2, 0 }, { 0, 3 } };
+
+      const DTens C( blaze::ttm<2UL>( T, M ) );
+
+      const DTens expected{ { { 3, 2, 6 }, { 7, 6, 12 } },
+                            { { 1, 0, 3 }, { 1, 2,  0 } } };
+
+      if( C != expected ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Incorrect result detected\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Mode-2 multiplication of a 4x5x6 tensor";
+
+      DTens T( 4UL, 5UL, 6UL );
+      DMat  M( 9UL, 6UL );
+      initialize( T );
+      initialize( M );
+
+      checkResult<2UL>( T, M );
+      checkResult<2UL>( T, blaze::DynamicMatrix<double,blaze::columnMajor>( M ) );
+      checkResult<2UL>( T + T, M );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mode-n multiplication with non-contiguous pages.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the mode-n multiplication of subtensors, whose pages are
+// not stored contiguously, as well as of the assignment to such subtensors. For mode 2 this
+// selects the page-wise kernel instead of the single product of the flattened tensors. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testNonContiguous()
+{
+   test_ = "Mode-n multiplication with non-contiguous pages";
+
+   DTens T( 5UL, 9UL, 11UL );
+   DMat  M0( 3UL, 4UL ), M1( 6UL, 5UL ), M2( 7UL, 6UL );
+   initialize( T );
+   initialize( M0 );
+   initialize( M1 );
+   initialize( M2 );
+
+   const auto S( blaze::subtensor( T, 1UL, 2UL, 3UL, 4UL, 5UL, 6UL ) );
+
+   checkResult<0UL>( S, M0 );
+   checkResult<1UL>( S, M1 );
+   checkResult<2UL>( S, M2 );
+
+   DTens C( 6UL, 9UL, 11UL );
+   initialize( C );
+
+   const DTens init( C );
+   const DTens expected( reference<2UL>( S, M2 ) );
+
+   auto R( blaze::subtensor( C, 1UL, 2UL, 3UL, 4UL, 5UL, 7UL ) );
+   R = blaze::ttm<2UL>( S, M2 );
+
+   for( size_t k=0UL; k<C.pages(); ++k ) {
+      for( size_t i=0UL; i<C.rows(); ++i ) {
+         for( size_t j=0UL; j<C.columns(); ++j )
+         {
+            const bool inside( k >= 1UL && k < 5UL && i >= 2UL && i < 7UL &&
+                               j >= 3UL && j < 10UL );
+            const double value( inside ? expected(k-1UL,i-2UL,j-3UL) : init(k,i,j) );
+
+            if( C(k,i,j) != value ) {
+               std::ostringstream oss;
+               oss << " Test : " << test_ << "\n"
+                   << " Error: Incorrect assignment to a subtensor detected\n"
+                   << " Details:\n"
+                   << "   Result:\n" << C << "\n"
+                   << "   Expected subtensor:\n" << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mode-n multiplication of static operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the result type of the mode-n multiplication of a static tensor
+// reflects the extents of the result, i.e. that the extent of the multiplied mode is replaced
+// by the number of rows of the matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testStatic()
+{
+   using STens = blaze::StaticTensor<double,2UL,3UL,4UL>;
+
+   test_ = "Mode-n multiplication of static operands";
+
+   DTens T( 2UL, 3UL, 4UL );
+   initialize( T );
+
+   const STens S( T );
+
+   {
+      using MT = blaze::StaticMatrix<double,5UL,2UL>;
+      using ET = blaze::StaticTensor<double,5UL,3UL,4UL>;
+      using RT = decltype( blaze::ttm<0UL>( std::declval<STens>(), std::declval<MT>() ) );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( blaze::ResultType_t<RT>, ET );
+
+      DMat M( 5UL, 2UL );
+      initialize( M );
+
+      checkResult<0UL>( S, MT( M ) );
+   }
+
+   {
+      using MT = blaze::StaticMatrix<double,6UL,3UL>;
+      using ET = blaze::StaticTensor<double,2UL,6UL,4UL>;
+      using RT = decltype( blaze::ttm<1UL>( std::declval<STens>(), std::declval<MT>() ) );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( blaze::ResultType_t<RT>, ET );
+
+      DMat M( 6UL, 3UL );
+      initialize( M );
+
+      checkResult<1UL>( S, MT( M ) );
+   }
+
+   {
+      using MT = blaze::StaticMatrix<double,7UL,4UL>;
+      using ET = blaze::StaticTensor<double,2UL,3UL,7UL>;
+      using RT = decltype( blaze::ttm<2UL>( std::declval<STens>(), std::declval<MT>() ) );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( blaze::ResultType_t<RT>, ET );
+
+      DMat M( 7UL, 4UL );
+      initialize( M );
+
+      checkResult<2UL>( S, MT( M ) );
+   }
+
+   {
+      using RT = decltype( blaze::ttm<2UL>( std::declval<STens>(), std::declval<DMat>() ) );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( blaze::ResultType_t<RT>, DTens );
+
+      DMat M( 9UL, 4UL );
+      initialize( M );
+
+      checkResult<2UL>( S, M );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the size checks of the mode-n multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the mode-n multiplication of a dense tensor and a dense matrix with
+// a non-matching number of columns fails with a \a std::invalid_argument exception. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSizeMismatch()
+{
+   test_ = "Mode-n multiplication with non-matching sizes";
+
+   const DTens T( 4UL, 5UL, 6UL, 1.0 );
+   const DMat  M( 3UL, 7UL, 1.0 );
+
+   try {
+      const DTens C( blaze::ttm<0UL>( T, M ) );
+
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Mode-0 multiplication of a 4x5x6 tensor and a 3x7 matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << C << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      const DTens C( blaze::ttm<1UL>( T, M ) );
+
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Mode-1 multiplication of a 4x5x6 tensor and a 3x7 matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << C << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      const DTens C( blaze::ttm<2UL>( T, M ) );
+
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Mode-2 multiplication of a 4x5x6 tensor and a 3x7 matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << C << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP evaluation of the mode-n multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the mode-n multiplication with result sizes that exceed
+// the SMP threshold for all three modes, including the page-wise mode-2 kernel for tensors
+// with non-contiguous pages. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void GeneralTest::testSMPMultiplication()
+{
+   test_ = "SMP mode-n multiplication";
+
+   DTens T( 20UL, 30UL, 40UL );
+   DMat  M0( 21UL, 20UL ), M1( 31UL, 30UL ), M2( 41UL, 40UL );
+   initialize( T );
+   initialize( M0 );
+   initialize( M1 );
+   initialize( M2 );
+
+   checkResult<0UL>( T, M0 );
+   checkResult<1UL>( T, M1 );
+   checkResult<2UL>( T, M2 );
+
+   DTens U( 22UL, 33UL, 40UL );
+   initialize( U );
+
+   checkResult<2UL>( blaze::subtensor( U, 1UL, 2UL, 0UL, 20UL, 30UL, 40UL ), M2 );
+}
+//*************************************************************************************************
+
+} // namespace dtensdmatttm
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running general dense tensor/dense matrix mode-n multiplication test..."
+             << std::endl;
+
+   try
+   {
+      RUN_DTENSDMATTTM_GENERAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during general dense tensor/dense matrix mode-n "
+                   "multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
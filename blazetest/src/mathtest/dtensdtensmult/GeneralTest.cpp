@@ -0,0 +1,408 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dtensdtensmult/GeneralTest.cpp
+//  \brief Source file for the general dense tensor/dense tensor multiplication test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dtensdtensmult/GeneralTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dtensdtensmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GeneralTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+GeneralTest::GeneralTest()
+{
+   testMultiplication();
+   testBroadcast();
+   testSizeMismatch();
+   testEmptyInnerDimension();
+   testSMPMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the page-wise dense tensor/dense tensor multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the page-wise multiplication of two dense tensors with the
+// same number of pages. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void GeneralTest::testMultiplication()
+{
+   {
+      test_ = "Page-wise multiplication of 2x2x2 tensors";
+
+      const DTens A{ { { 1, 2 }, { 3, 4 } }, { { 0, 1 }, { 1, 0 } } };
+      const DTens B{ { { 1, 0 }, { 0, 1 } }, { { 2, 3 }, { 4, 5 } } };
+
+      const DTens C( A * B );
+
+      const DTens expected{ { { 1, 2 }, { 3, 4 } }, { { 4, 5 }, { 2, 3 } } };
+
+      if( C != expected ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Incorrect result detected\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Page-wise multiplication of 3x5x7 and 3x7x13 tensors";
+
+      DTens A( 3UL, 5UL, 7UL ), B( 3UL, 7UL, 13UL ), C( 3UL, 5UL, 13UL );
+      initialize( A );
+      initialize( B );
+      initialize( C );
+
+      const DTens init( C );
+
+      C = A * B;
+      checkResult( C, A, B );
+
+      C = init;
+      C += A * B;
+      checkResult( C, A, B, 1.0, init );
+
+      C = init;
+      C -= A * B;
+      checkResult( C, A, B, -1.0, init );
+
+      C = 2.0 * ( A * B );
+      checkResult( C, A, B, 2.0 );
+
+      C = init;
+      C += ( A * B ) * 3.0;
+      checkResult( C, A, B, 3.0, init );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the broadcast of a single right-hand side page.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a dense tensor with a dense tensor
+// consisting of a single page, which is multiplied with all pages of the left-hand side tensor.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testBroadcast()
+{
+   {
+      test_ = "Broadcast of a single 2x2 page";
+
+      const DTens A{ { { 1, 2 }, { 3, 4 } }, { { 0, 1 }, { 1, 0 } }, { { 2, 0 }, { 0, 2 } } };
+      const DTens B{ { { 2, 3 }, { 4, 5 } } };
+
+      const DTens C( A * B );
+
+      const DTens expected{ { { 10, 13 }, { 22, 29 } },
+                            { {  4,  5 }, {  2,  3 } },
+                            { {  4,  6 }, {  8, 10 } } };
+
+      if( C != expected ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Incorrect result detected\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Broadcast of a single 7x13 page";
+
+      DTens A( 5UL, 6UL, 7UL ), B( 1UL, 7UL, 13UL ), C( 5UL, 6UL, 13UL );
+      initialize( A );
+      initialize( B );
+      initialize( C );
+
+      const DTens init( C );
+
+      C = A * B;
+      checkResult( C, A, B );
+
+      C = init;
+      C += A * B;
+      checkResult( C, A, B, 1.0, init );
+
+      C = init;
+      C -= 2.0 * ( A * B );
+      checkResult( C, A, B, -2.0, init );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the size checks of the dense tensor/dense tensor multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the multiplication of two dense tensors with non-matching inner
+// dimensions or with non-matching numbers of pages fails with a \a std::invalid_argument
+// exception. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSizeMismatch()
+{
+   {
+      test_ = "Multiplication with non-matching number of pages";
+
+      const DTens A( 3UL, 2UL, 4UL, 1.0 ), B( 2UL, 4UL, 5UL, 1.0 );
+
+      try {
+         const DTens C( A * B );
+
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Multiplication of tensors with 3 and 2 pages succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Multiplication with non-matching inner dimension";
+
+      const DTens A( 2UL, 2UL, 4UL, 1.0 ), B( 2UL, 3UL, 5UL, 1.0 );
+
+      try {
+         const DTens C( A * B );
+
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Multiplication of 2x4 and 3x5 pages succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense tensor/dense tensor multiplication with an empty inner dimension.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a 2x3x0 and a 2x0x13 tensor. The
+// result has to be a zero tensor in case of an assignment and must leave the target unchanged
+// in case of an addition assignment. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testEmptyInnerDimension()
+{
+   {
+      test_ = "Multiplication with an empty inner dimension";
+
+      const DTens A( 2UL, 3UL, 0UL ), B( 2UL, 0UL, 13UL ), B1( 1UL, 0UL, 13UL );
+      DTens C( 2UL, 3UL, 13UL, 1.0 );
+
+      C = A * B;
+      checkResult( C, A, B );
+
+      C = DTens( 2UL, 3UL, 13UL, 1.0 );
+      C = A * B1;
+      checkResult( C, A, B1 );
+
+      const DTens init( 2UL, 3UL, 13UL, 1.0 );
+
+      C = init;
+      C += A * B;
+      checkResult( C, A, B, 1.0, init );
+
+      C = init;
+      C = 2.0 * ( A * B );
+      checkResult( C, A, B, 2.0 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP evaluation of the dense tensor/dense tensor multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dense tensor/dense tensor multiplication with sizes
+// that exceed the SMP threshold, both for a few large pages and for many small pages, as well
+// as for the broadcast of a single page. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testSMPMultiplication()
+{
+   {
+      test_ = "SMP multiplication of few large pages";
+
+      DTens A( 3UL, 70UL, 65UL ), B( 3UL, 65UL, 71UL ), C( 3UL, 70UL, 71UL );
+      initialize( A );
+      initialize( B );
+      initialize( C );
+
+      const DTens init( C );
+
+      C = A * B;
+      checkResult( C, A, B );
+
+      C = init;
+      C += A * B;
+      checkResult( C, A, B, 1.0, init );
+
+      C = init;
+      C -= A * B;
+      checkResult( C, A, B, -1.0, init );
+   }
+
+   {
+      test_ = "SMP multiplication of many small pages";
+
+      DTens A( 80UL, 9UL, 11UL ), B( 80UL, 11UL, 10UL ), C( 80UL, 9UL, 10UL );
+      initialize( A );
+      initialize( B );
+      initialize( C );
+
+      const DTens init( C );
+
+      C = A * B;
+      checkResult( C, A, B );
+
+      C = init;
+      C += 2.0 * ( A * B );
+      checkResult( C, A, B, 2.0, init );
+   }
+
+   {
+      test_ = "SMP multiplication with a single broadcast page";
+
+      DTens A( 80UL, 9UL, 11UL ), B( 1UL, 11UL, 10UL ), C( 80UL, 9UL, 10UL );
+      initialize( A );
+      initialize( B );
+      initialize( C );
+
+      const DTens init( C );
+
+      C = A * B;
+      checkResult( C, A, B );
+
+      C = init;
+      C -= A * B;
+      checkResult( C, A, B, -1.0, init );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dtensdtensmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running general dense tensor/dense tensor multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_DTENSDTENSMULT_GENERAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during general dense tensor/dense tensor "
+                   "multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
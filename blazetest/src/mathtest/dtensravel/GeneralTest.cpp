@@ -0,0 +1,450 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dtensravel/GeneralTest.cpp
+//  \brief Source file for the general dense tensor ravel test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blazetest/mathtest/dtensravel/GeneralTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dtensravel {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GeneralTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+GeneralTest::GeneralTest()
+{
+   testPadded();
+   testUnpadded();
+   testResize();
+   testReshape();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ravel operation on padded dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the ravel operation on dense tensors whose rows are padded,
+// i.e. whose elements are not stored contiguously. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPadded()
+{
+   test_ = "Ravel of padded dense tensors";
+
+   using RavelType = blaze::Decay_t< decltype( blaze::ravel( std::declval<DTens>() ) ) >;
+
+   static_assert( !blaze::IsPadded_v<DTens> || !RavelType::simdEnabled,
+                  "Invalid SIMD evaluation of a padded operand detected" );
+
+   for( size_t n : { 1UL, 5UL, 13UL, 31UL, 67UL } ) {
+      for( size_t m : { 1UL, 3UL, 7UL } ) {
+         for( size_t o : { 1UL, 2UL, 5UL } ) {
+            DTens T( o, m, n );
+            randomize( T, -5, 5 );
+
+            checkRavel( T );
+            checkRavel( T + T );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ravel operation on unpadded dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the ravel operation on unpadded custom tensors, both with
+// contiguously stored elements and with an explicitly specified row spacing. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testUnpadded()
+{
+   using UnalignedUnpadded = blaze::CustomTensor<int,blaze::unaligned,blaze::unpadded>;
+   using RavelType = blaze::Decay_t< decltype( blaze::ravel( std::declval<UnalignedUnpadded>() ) ) >;
+
+   static_assert( RavelType::simdEnabled == UnalignedUnpadded::simdEnabled,
+                  "Invalid SIMD evaluation of an unpadded operand detected" );
+
+   {
+      test_ = "Ravel of contiguous unpadded dense tensors";
+
+      for( size_t n : { 1UL, 5UL, 16UL, 67UL } ) {
+         for( size_t m : { 1UL, 3UL, 8UL } ) {
+            for( size_t o : { 1UL, 2UL, 5UL } ) {
+               std::unique_ptr<int[]> memory( new int[o*m*n] );
+               UnalignedUnpadded T( memory.get(), o, m, n );
+               randomize( T, -5, 5 );
+
+               checkRavel( T );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Ravel of non-contiguous unpadded dense tensors";
+
+      for( size_t n : { 1UL, 5UL, 16UL, 67UL } ) {
+         for( size_t m : { 1UL, 3UL, 8UL } ) {
+            for( size_t o : { 1UL, 2UL, 5UL } ) {
+               std::unique_ptr<int[]> memory( new int[o*m*(n+3UL)] );
+               UnalignedUnpadded T( memory.get(), o, m, n, n+3UL );
+               randomize( T, -5, 5 );
+
+               checkRavel( T );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ravel operation on a dense tensor that is resized after its creation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a ravel expression refers to the current elements of its operand
+// in case the operand is resized and therefore reallocated after the creation of the
+// expression. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testResize()
+{
+   test_ = "Ravel of a resized dense tensor";
+
+   DTens T( 2UL, 3UL, 4UL );
+   randomize( T, -5, 5 );
+
+   const auto expr( blaze::ravel( T ) );
+
+   for( const auto& dims : { std::array<size_t,3UL>{ 5UL, 7UL, 67UL }
+                           , std::array<size_t,3UL>{ 1UL, 2UL, 3UL }
+                           , std::array<size_t,3UL>{ 3UL, 9UL, 128UL } } )
+   {
+      T.resize( dims[0], dims[1], dims[2], false );
+      randomize( T, -5, 5 );
+
+      const DVec result( expr );
+
+      bool mismatch( result.size() != T.pages() * T.rows() * T.columns() );
+
+      for( size_t k=0UL; !mismatch && k<T.pages(); ++k )
+         for( size_t i=0UL; !mismatch && i<T.rows(); ++i )
+            for( size_t j=0UL; !mismatch && j<T.columns(); ++j )
+               mismatch = ( result[( k*T.rows() + i )*T.columns() + j] != T(k,i,j) ||
+                            expr[( k*T.rows() + i )*T.columns() + j] != T(k,i,j) );
+
+      if( mismatch ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Ravel operation does not reflect the resized operand\n"
+             << " Details:\n"
+             << "   Tensor:\n" << T << "\n"
+             << "   Result:\n" << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reshape views on constant dense tensors and arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reshape() function on constant dense vectors, tensors
+// and arrays, which yields custom tensors and arrays of constant elements. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testReshape()
+{
+   std::unique_ptr<int[]> memory( new int[24UL] );
+   for( size_t i=0UL; i<24UL; ++i ) {
+      memory[i] = static_cast<int>( i ) - 11;
+   }
+
+   const blaze::CustomTensor<int,blaze::unaligned,blaze::unpadded> T( memory.get(), 2UL, 3UL, 4UL );
+   const blaze::CustomArray<3UL,int,blaze::unaligned,blaze::unpadded> A( memory.get(), 2UL, 3UL, 4UL );
+
+   using ConstTensor = blaze::CustomTensor<const int,blaze::unaligned,blaze::unpadded>;
+   using ConstArray  = blaze::CustomArray<4UL,const int,blaze::unaligned,blaze::unpadded>;
+   using ConstMatrix = blaze::CustomMatrix<const int,blaze::unaligned,blaze::unpadded,blaze::rowMajor>;
+
+   {
+      test_ = "Reshape of a constant custom tensor";
+
+      const auto R1( blaze::reshape<3UL>( T, 4UL, 3UL, 2UL ) );
+      const auto R2( blaze::reshape<4UL>( T, 2UL, 1UL, 3UL, 4UL ) );
+      const auto R3( blaze::reshape<2UL>( T, 6UL, 4UL ) );
+
+      using R1Type = blaze::RemoveCV_t< decltype( R1 ) >;
+      using R2Type = blaze::RemoveCV_t< decltype( R2 ) >;
+      using R3Type = blaze::RemoveCV_t< decltype( R3 ) >;
+
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( R1Type, ConstTensor );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( R2Type, ConstArray  );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( R3Type, ConstMatrix );
+
+      bool mismatch( R1.data() != memory.get() || R2.data() != memory.get() || R3.data() != memory.get() );
+
+      for( size_t k=0UL; k<4UL; ++k )
+         for( size_t i=0UL; i<3UL; ++i )
+            for( size_t j=0UL; j<2UL; ++j )
+               mismatch = mismatch || R1(k,i,j) != memory[( k*3UL + i )*2UL + j];
+
+      for( size_t l=0UL; l<2UL; ++l )
+         for( size_t i=0UL; i<3UL; ++i )
+            for( size_t j=0UL; j<4UL; ++j )
+               mismatch = mismatch || R2(l,0UL,i,j) != T(l,i,j);
+
+      for( size_t i=0UL; i<6UL; ++i )
+         for( size_t j=0UL; j<4UL; ++j )
+            mismatch = mismatch || R3(i,j) != memory[i*4UL + j];
+
+      if( mismatch ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid reshape view detected\n"
+             << " Details:\n"
+             << "   Tensor:\n" << T << "\n"
+             << "   Reshaped tensor:\n" << R1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRavel( R1 );
+   }
+
+   {
+      test_ = "Reshape of a constant custom array";
+
+      const auto R1( blaze::reshape<3UL>( A, 3UL, 2UL, 4UL ) );
+      const auto R2( blaze::reshape<4UL>( A, 1UL, 2UL, 3UL, 4UL ) );
+
+      using R1Type = blaze::RemoveCV_t< decltype( R1 ) >;
+      using R2Type = blaze::RemoveCV_t< decltype( R2 ) >;
+
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( R1Type, ConstTensor );
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( R2Type, ConstArray  );
+
+      bool mismatch( R1.data() != memory.get() || R2.data() != memory.get() );
+
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t i=0UL; i<2UL; ++i )
+            for( size_t j=0UL; j<4UL; ++j )
+               mismatch = mismatch || R1(k,i,j) != memory[( k*2UL + i )*4UL + j];
+
+      for( size_t k=0UL; k<2UL; ++k )
+         for( size_t i=0UL; i<3UL; ++i )
+            for( size_t j=0UL; j<4UL; ++j )
+               mismatch = mismatch || R2(0UL,k,i,j) != A(k,i,j);
+
+      if( mismatch ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid reshape view detected\n"
+             << " Details:\n"
+             << "   Array:\n" << A << "\n"
+             << "   Reshaped array:\n" << R1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRavel( R1 );
+   }
+
+   {
+      test_ = "Reshape of a constant dense vector";
+
+      const DVec v( 24UL, memory.get() );
+
+      const auto R( blaze::reshape<3UL>( v, 2UL, 3UL, 4UL ) );
+
+      using RType = blaze::RemoveCV_t< decltype( R ) >;
+      BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RType, ConstTensor );
+
+      if( R != T ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid reshape view detected\n"
+             << " Details:\n"
+             << "   Result:\n" << R << "\n"
+             << "   Expected result:\n" << T << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRavel( R );
+   }
+
+   {
+      test_ = "Reshape with invalid dimensions";
+
+      try {
+         const auto R( blaze::reshape<3UL>( T, 2UL, 3UL, 3UL ) );
+
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Reshape with invalid dimensions succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Reshape of a padded dense tensor";
+
+      const DTens P( 2UL, 3UL, 5UL, 1 );
+
+      if( P.spacing() != P.columns() ) {
+         try {
+            const auto R( blaze::reshape<1UL>( P, 30UL ) );
+
+            std::ostringstream oss;
+            oss << " Test : " << test_ << "\n"
+                << " Error: Reshape of a padded tensor succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << R << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+
+   {
+      test_ = "Reshape of a padded single-row dense array";
+
+      const blaze::DynamicArray<3UL,int> P{{ { { 1, 2, 3, 4, 5 } } }};
+
+      const auto R( blaze::reshape<2UL>( P, 5UL, 1UL ) );
+
+      bool mismatch( R.data() != P.data() );
+
+      for( size_t i=0UL; i<5UL; ++i )
+         mismatch = mismatch || R(i,0UL) != P(0UL,0UL,i);
+
+      if( mismatch ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid reshape view detected\n"
+             << " Details:\n"
+             << "   Array:\n" << P << "\n"
+             << "   Reshaped array:\n" << R << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace dtensravel
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running general dense tensor ravel test..." << std::endl;
+
+   try
+   {
+      RUN_DTENSRAVEL_GENERAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during general dense tensor ravel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -2911,6 +2911,166 @@ void ClassTest::testTranspose()
             }
          }
       }
+
+      {
+         test_ = "Row-major transpose of non-cubic tensors";
+
+         const std::array< std::array<size_t,3UL>, 6UL > indices{ {
+            { { 0, 1, 2 } }, { { 0, 2, 1 } }, { { 1, 0, 2 } },
+            { { 1, 2, 0 } }, { { 2, 0, 1 } }, { { 2, 1, 0 } } } };
+
+         const std::array< std::array<size_t,3UL>, 6UL > sizes{ {
+            { { 3, 5, 7 } }, { { 4, 6, 13 } }, { { 5, 1, 9 } },
+            { { 1, 17, 2 } }, { { 0, 3, 4 } }, { { 2, 2, 33 } } } };
+
+         for( const auto& size : sizes )
+         {
+            blaze::DynamicTensor<int> mat1( size[0], size[1], size[2], 0 );
+            randomize( mat1 );
+
+            for( const auto& idx : indices )
+            {
+               blaze::DynamicTensor<int> mat2( mat1 );
+               mat2.transpose( idx.data(), idx.size() );
+
+               checkTranspose( mat1, mat2, idx );
+            }
+         }
+      }
+
+      {
+         test_ = "Row-major transpose of tensors with large slabs (square tiles)";
+
+         blaze::DynamicTensor<int> mat1( 4UL, 300UL, 300UL, 0 );
+         randomize( mat1 );
+
+         const std::array<size_t,3UL> idx{ { 0, 2, 1 } };
+
+         blaze::DynamicTensor<int> mat2( mat1 );
+         mat2.transpose( idx.data(), idx.size() );
+
+         checkTranspose( mat1, mat2, idx );
+      }
+
+      {
+         test_ = "Row-major transpose of tensors with large slabs (cycles)";
+
+         const std::array< std::array<size_t,3UL>, 6UL > indices{ {
+            { { 0, 1, 2 } }, { { 0, 2, 1 } }, { { 1, 0, 2 } },
+            { { 1, 2, 0 } }, { { 2, 0, 1 } }, { { 2, 1, 0 } } } };
+
+         blaze::DynamicTensor<int> mat1( 2UL, 300UL, 500UL, 0 );
+         randomize( mat1 );
+
+         for( const auto& idx : indices )
+         {
+            blaze::DynamicTensor<int> mat2( mat1 );
+            mat2.transpose( idx.data(), idx.size() );
+
+            checkTranspose( mat1, mat2, idx );
+         }
+
+         blaze::DynamicTensor<int> mat3( 300UL, 500UL, 3UL, 0 );
+         randomize( mat3 );
+
+         const std::array<size_t,3UL> idx{ { 1, 0, 2 } };
+
+         blaze::DynamicTensor<int> mat4( mat3 );
+         mat4.transpose( idx.data(), idx.size() );
+
+         checkTranspose( mat3, mat4, idx );
+      }
+
+      {
+         test_ = "Row-major transpose of a tensor without spare capacity";
+
+         blaze::DynamicTensor<int> mat1( 2UL, 3UL, 8UL, 0 );
+         randomize( mat1 );
+
+         const std::array<size_t,3UL> idx{ { 2, 1, 0 } };
+
+         blaze::DynamicTensor<int> mat2( mat1 );
+         mat2.transpose( idx.data(), idx.size() );
+
+         checkTranspose( mat1, mat2, idx );
+      }
+
+      {
+         test_ = "Row-major transpose with invalid indices";
+
+         const std::array< std::vector<size_t>, 4UL > indices{ {
+            { 0, 1 }, { 0, 1, 2, 0 }, { 0, 1, 1 }, { 0, 1, 3 } } };
+
+         for( const auto& idx : indices )
+         {
+            for( size_t n : { 3UL, 4UL } )
+            {
+               blaze::DynamicTensor<int> mat( n, n+1UL, n+2UL, 0 );
+
+               try {
+                  mat.transpose( idx.data(), idx.size() );
+
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Transposition with invalid indices succeeded\n"
+                      << " Details:\n"
+                      << "   Number of indices: " << idx.size() << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+               catch( std::invalid_argument& ) {}
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Array tests
+   //=====================================================================================
+
+   {
+      test_ = "Transpose of 4D arrays";
+
+      const std::array< std::array<size_t,4UL>, 6UL > indices{ {
+         { { 0, 1, 2, 3 } }, { { 3, 2, 1, 0 } }, { { 0, 1, 3, 2 } },
+         { { 1, 0, 2, 3 } }, { { 2, 3, 0, 1 } }, { { 1, 3, 0, 2 } } } };
+
+      const std::array< std::array<size_t,4UL>, 3UL > sizes{ {
+         { { 2, 3, 4, 5 } }, { { 3, 1, 7, 2 } }, { { 2, 2, 150, 301 } } } };
+
+      for( const auto& size : sizes )
+      {
+         blaze::DynamicArray<4UL,int> arr1( size[0], size[1], size[2], size[3] );
+         randomize( arr1 );
+
+         for( const auto& idx : indices )
+         {
+            blaze::DynamicArray<4UL,int> arr2( arr1 );
+            arr2.transpose( idx.data(), idx.size() );
+
+            checkTranspose( arr1, arr2, idx );
+         }
+      }
+   }
+
+   {
+      test_ = "Transpose of 4D arrays with invalid indices";
+
+      blaze::DynamicArray<4UL,int> arr( 2UL, 3UL, 4UL, 5UL );
+
+      const std::array<size_t,3UL> idx{ { 0, 1, 2 } };
+
+      try {
+         arr.transpose( idx.data(), idx.size() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transposition with invalid indices succeeded\n"
+             << " Details:\n"
+             << "   Number of indices: " << idx.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
    }
 }
 //*************************************************************************************************
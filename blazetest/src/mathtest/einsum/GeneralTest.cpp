@@ -0,0 +1,674 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/einsum/GeneralTest.cpp
+//  \brief Source file for the general einsum test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/einsum/GeneralTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace einsum {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GeneralTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+GeneralTest::GeneralTest()
+{
+   testMatrixProduct();
+   testBatchedProduct();
+   testPermutation();
+   testOuterProduct();
+   testDiagonal();
+   testSummation();
+   testArray();
+   testInvalid();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of contractions corresponding to a single matrix product.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests contractions of two dense matrices, including transposed operands, a
+// transposed result, column-major operands, and an expression operand. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMatrixProduct()
+{
+   {
+      test_ = "Matrix product (\"ij,jk->ik\")";
+
+      DMat A( 5UL, 7UL ), B( 7UL, 9UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "ij,jk->ik", A, B, C );
+      checkResult( C, DMat( A * B ) );
+   }
+
+   {
+      test_ = "Matrix product with transposed operands (\"ji,kj->ik\")";
+
+      DMat A( 7UL, 5UL ), B( 9UL, 7UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "ji,kj->ik", A, B, C );
+      checkResult( C, DMat( blaze::trans( A ) * blaze::trans( B ) ) );
+   }
+
+   {
+      test_ = "Matrix product with transposed result (\"ij,jk->ki\")";
+
+      DMat A( 5UL, 7UL ), B( 7UL, 9UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "ij,jk->ki", A, B, C );
+      checkResult( C, DMat( blaze::trans( A * B ) ) );
+   }
+
+   {
+      test_ = "Matrix product of column-major matrices (\"ij,jk->ik\")";
+
+      DMat A( 5UL, 7UL ), B( 7UL, 9UL );
+      initialize( A );
+      initialize( B );
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> A2( A ), B2( B );
+      blaze::DynamicMatrix<double,blaze::columnMajor> C;
+
+      blaze::einsum( "ij,jk->ik", A2, B2, C );
+      checkResult( C, DMat( A * B ) );
+   }
+
+   {
+      test_ = "Matrix product with an expression operand (\"ij,jk->ik\")";
+
+      DMat A( 5UL, 7UL ), B( 7UL, 9UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "ij,jk->ik", A + A, B, C );
+      checkResult( C, DMat( 2.0 * ( A * B ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of batched contractions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests batched, GEMM-like contractions of dense tensors and matrices, including
+// a permuted result and a contraction over the batch index. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testBatchedProduct()
+{
+   {
+      test_ = "Batched product of tensors (\"kil,klj->kij\")";
+
+      DTens A( 4UL, 5UL, 6UL ), B( 4UL, 6UL, 7UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kil,klj->kij", A, B, C );
+
+      DTens expected( 4UL, 5UL, 7UL, 0.0 );
+      for( size_t k=0UL; k<4UL; ++k )
+         for( size_t i=0UL; i<5UL; ++i )
+            for( size_t j=0UL; j<7UL; ++j )
+               for( size_t l=0UL; l<6UL; ++l )
+                  expected(k,i,j) += A(k,i,l) * B(k,l,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Batched product of a tensor and a matrix (\"kil,lj->kij\")";
+
+      DTens A( 4UL, 5UL, 6UL ), C;
+      DMat B( 6UL, 7UL );
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kil,lj->kij", A, B, C );
+
+      DTens expected( 4UL, 5UL, 7UL, 0.0 );
+      for( size_t k=0UL; k<4UL; ++k )
+         for( size_t i=0UL; i<5UL; ++i )
+            for( size_t j=0UL; j<7UL; ++j )
+               for( size_t l=0UL; l<6UL; ++l )
+                  expected(k,i,j) += A(k,i,l) * B(l,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Batched product with permuted result (\"kil,lj->jki\")";
+
+      DTens A( 4UL, 5UL, 6UL ), C;
+      DMat B( 6UL, 7UL );
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kil,lj->jki", A, B, C );
+
+      DTens expected( 7UL, 4UL, 5UL, 0.0 );
+      for( size_t k=0UL; k<4UL; ++k )
+         for( size_t i=0UL; i<5UL; ++i )
+            for( size_t j=0UL; j<7UL; ++j )
+               for( size_t l=0UL; l<6UL; ++l )
+                  expected(j,k,i) += A(k,i,l) * B(l,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Contraction over the batch index (\"kia,kib->ab\")";
+
+      DTens A( 4UL, 5UL, 6UL ), B( 4UL, 5UL, 3UL );
+      DMat C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kia,kib->ab", A, B, C );
+
+      DMat expected( 6UL, 3UL, 0.0 );
+      for( size_t k=0UL; k<4UL; ++k )
+         for( size_t i=0UL; i<5UL; ++i )
+            for( size_t a=0UL; a<6UL; ++a )
+               for( size_t b=0UL; b<3UL; ++b )
+                  expected(a,b) += A(k,i,a) * B(k,i,b);
+
+      checkResult( C, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of contractions that only permute an operand.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests contractions of a dense tensor with a 1x1 matrix of value 1, which only
+// permute the dimensions of the tensor. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testPermutation()
+{
+   const DMat one( 1UL, 1UL, 1.0 );
+
+   {
+      test_ = "Permutation of a tensor (\"kij,xy->jki\")";
+
+      DTens A( 4UL, 5UL, 6UL ), C;
+      initialize( A );
+
+      blaze::einsum( "kij,xy->jki", A, one, C );
+
+      DTens expected( 6UL, 4UL, 5UL );
+      for( size_t k=0UL; k<4UL; ++k )
+         for( size_t i=0UL; i<5UL; ++i )
+            for( size_t j=0UL; j<6UL; ++j )
+               expected(j,k,i) = A(k,i,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Permutation of a large tensor (\"kij,xy->ikj\")";
+
+      DTens A( 33UL, 70UL, 41UL ), C;
+      initialize( A );
+
+      blaze::einsum( "kij,xy->ikj", A, one, C );
+
+      DTens expected( 70UL, 33UL, 41UL );
+      for( size_t k=0UL; k<33UL; ++k )
+         for( size_t i=0UL; i<70UL; ++i )
+            for( size_t j=0UL; j<41UL; ++j )
+               expected(i,k,j) = A(k,i,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Identity permutation of a tensor (\"kij,xy->kij\")";
+
+      DTens A( 4UL, 5UL, 6UL ), C;
+      initialize( A );
+
+      blaze::einsum( "kij,xy->kij", A, one, C );
+
+      checkResult( C, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of contractions without contracted indices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests outer products of dense matrices into dense tensors and arrays. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testOuterProduct()
+{
+   {
+      test_ = "Batched outer product (\"ki,kj->kij\")";
+
+      DMat A( 4UL, 5UL ), B( 4UL, 6UL );
+      DTens C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "ki,kj->kij", A, B, C );
+
+      DTens expected( 4UL, 5UL, 6UL );
+      for( size_t k=0UL; k<4UL; ++k )
+         for( size_t i=0UL; i<5UL; ++i )
+            for( size_t j=0UL; j<6UL; ++j )
+               expected(k,i,j) = A(k,i) * B(k,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Outer product (\"ij,kl->ikjl\")";
+
+      DMat A( 2UL, 3UL ), B( 4UL, 5UL );
+      DArr4 C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "ij,kl->ikjl", A, B, C );
+
+      DArr4 expected( 2UL, 4UL, 3UL, 5UL );
+      for( size_t i=0UL; i<2UL; ++i )
+         for( size_t j=0UL; j<3UL; ++j )
+            for( size_t k=0UL; k<4UL; ++k )
+               for( size_t l=0UL; l<5UL; ++l )
+                  expected(i,k,j,l) = A(i,j) * B(k,l);
+
+      checkResult( C, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of contractions with repeated indices within an operand.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests contractions involving traces and diagonals of dense tensors. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testDiagonal()
+{
+   {
+      test_ = "Batched trace (\"kii,kj->kj\")";
+
+      DTens A( 3UL, 5UL, 5UL );
+      DMat B( 3UL, 4UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kii,kj->kj", A, B, C );
+
+      DMat expected( 3UL, 4UL, 0.0 );
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t j=0UL; j<4UL; ++j )
+            for( size_t i=0UL; i<5UL; ++i )
+               expected(k,j) += A(k,i,i) * B(k,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Batched diagonal (\"kii,kj->kij\")";
+
+      DTens A( 3UL, 5UL, 5UL ), C;
+      DMat B( 3UL, 4UL );
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kii,kj->kij", A, B, C );
+
+      DTens expected( 3UL, 5UL, 4UL );
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t i=0UL; i<5UL; ++i )
+            for( size_t j=0UL; j<4UL; ++j )
+               expected(k,i,j) = A(k,i,i) * B(k,j);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Product of a diagonal (\"iij,jk->ik\")";
+
+      DTens A( 5UL, 5UL, 6UL );
+      DMat B( 6UL, 4UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "iij,jk->ik", A, B, C );
+
+      DMat expected( 5UL, 4UL, 0.0 );
+      for( size_t i=0UL; i<5UL; ++i )
+         for( size_t k=0UL; k<4UL; ++k )
+            for( size_t j=0UL; j<6UL; ++j )
+               expected(i,k) += A(i,i,j) * B(j,k);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Product of a non-adjacent diagonal (\"kik,ij->kj\")";
+
+      DTens A( 5UL, 3UL, 5UL );
+      DMat B( 3UL, 4UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kik,ij->kj", A, B, C );
+
+      DMat expected( 5UL, 4UL, 0.0 );
+      for( size_t k=0UL; k<5UL; ++k )
+         for( size_t j=0UL; j<4UL; ++j )
+            for( size_t i=0UL; i<3UL; ++i )
+               expected(k,j) += A(k,i,k) * B(i,j);
+
+      checkResult( C, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of contractions with indices that appear in a single operand only.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests contractions in which indices that appear in a single operand only and
+// not in the result are summed over. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testSummation()
+{
+   {
+      test_ = "Summation over a left-hand side index (\"kij,jl->il\")";
+
+      DTens A( 3UL, 4UL, 5UL );
+      DMat B( 5UL, 6UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kij,jl->il", A, B, C );
+
+      DMat expected( 4UL, 6UL, 0.0 );
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t i=0UL; i<4UL; ++i )
+            for( size_t l=0UL; l<6UL; ++l )
+               for( size_t j=0UL; j<5UL; ++j )
+                  expected(i,l) += A(k,i,j) * B(j,l);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Summation over indices of both operands (\"ij,kl->ik\")";
+
+      DMat A( 4UL, 5UL ), B( 3UL, 6UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "ij,kl->ik", A, B, C );
+
+      DMat expected( 4UL, 3UL, 0.0 );
+      for( size_t i=0UL; i<4UL; ++i )
+         for( size_t k=0UL; k<3UL; ++k )
+            for( size_t j=0UL; j<5UL; ++j )
+               for( size_t l=0UL; l<6UL; ++l )
+                  expected(i,k) += A(i,j) * B(k,l);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Summation over a diagonal and a right-hand side index (\"kii,jl->kj\")";
+
+      DTens A( 3UL, 5UL, 5UL );
+      DMat B( 4UL, 6UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "kii,jl->kj", A, B, C );
+
+      DMat expected( 3UL, 4UL, 0.0 );
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t j=0UL; j<4UL; ++j )
+            for( size_t i=0UL; i<5UL; ++i )
+               for( size_t l=0UL; l<6UL; ++l )
+                  expected(k,j) += A(k,i,i) * B(j,l);
+
+      checkResult( C, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of contractions of dense arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests contractions of 4D dense arrays with dense tensors and matrices as well
+// as the permutation of a 4D dense array. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void GeneralTest::testArray()
+{
+   {
+      test_ = "Contraction of an array and a tensor (\"abcd,dce->abe\")";
+
+      DArr4 A( 2UL, 3UL, 4UL, 5UL );
+      DTens B( 5UL, 4UL, 6UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "abcd,dce->abe", A, B, C );
+
+      DTens expected( 2UL, 3UL, 6UL, 0.0 );
+      for( size_t a=0UL; a<2UL; ++a )
+         for( size_t b=0UL; b<3UL; ++b )
+            for( size_t e=0UL; e<6UL; ++e )
+               for( size_t c=0UL; c<4UL; ++c )
+                  for( size_t d=0UL; d<5UL; ++d )
+                     expected(a,b,e) += A(a,b,c,d) * B(d,c,e);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Contraction of an array and a matrix (\"abcd,bd->ac\")";
+
+      DArr4 A( 2UL, 3UL, 4UL, 5UL );
+      DMat B( 3UL, 5UL ), C;
+      initialize( A );
+      initialize( B );
+
+      blaze::einsum( "abcd,bd->ac", A, B, C );
+
+      DMat expected( 2UL, 4UL, 0.0 );
+      for( size_t a=0UL; a<2UL; ++a )
+         for( size_t c=0UL; c<4UL; ++c )
+            for( size_t b=0UL; b<3UL; ++b )
+               for( size_t d=0UL; d<5UL; ++d )
+                  expected(a,c) += A(a,b,c,d) * B(b,d);
+
+      checkResult( C, expected );
+   }
+
+   {
+      test_ = "Permutation of an array (\"abcd,xy->dbca\")";
+
+      const DMat one( 1UL, 1UL, 1.0 );
+
+      DArr4 A( 2UL, 3UL, 4UL, 5UL ), C;
+      initialize( A );
+
+      blaze::einsum( "abcd,xy->dbca", A, one, C );
+
+      DArr4 expected( 5UL, 3UL, 4UL, 2UL );
+      for( size_t a=0UL; a<2UL; ++a )
+         for( size_t b=0UL; b<3UL; ++b )
+            for( size_t c=0UL; c<4UL; ++c )
+               for( size_t d=0UL; d<5UL; ++d )
+                  expected(d,b,c,a) = A(a,b,c,d);
+
+      checkResult( C, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of malformed index specifications and non-matching operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that contractions with malformed index specifications, with a wrong
+// number of indices, or with non-matching operand sizes fail with a \a std::invalid_argument
+// exception. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testInvalid()
+{
+   test_ = "Invalid einsum specifications";
+
+   const DMat A( 3UL, 4UL, 1.0 ), B( 4UL, 5UL, 1.0 );
+   DMat C;
+   DArr4 D;
+
+   checkInvalid( "ij,jk",       A, B, C );  // Missing arrow
+   checkInvalid( "ij->ik,jk",   A, B, C );  // Arrow before comma
+   checkInvalid( "ij,jk->",     A, B, C );  // Wrong number of result indices
+   checkInvalid( "i1,1k->ik",   A, B, C );  // Invalid label
+   checkInvalid( "ij,jk->ii",   A, B, C );  // Repeated result label
+   checkInvalid( "ij,jk->iz",   A, B, C );  // Result label not in any operand
+   checkInvalid( "ijk,jk->ik",  A, B, C );  // Wrong number of operand indices
+   checkInvalid( "ij,jk->ik",   A, B, D );  // Wrong number of result indices
+   checkInvalid( "ij,ik->jk",   A, B, C );  // Non-matching sizes
+   checkInvalid( "ii,jk->jk",   A, B, C );  // Non-square diagonal
+}
+//*************************************************************************************************
+
+} // namespace einsum
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running general einsum test..." << std::endl;
+
+   try
+   {
+      RUN_EINSUM_GENERAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during general einsum test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
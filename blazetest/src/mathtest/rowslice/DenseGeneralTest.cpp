@@ -38,6 +38,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <array>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
@@ -719,6 +720,88 @@ void DenseGeneralTest::testAssignment()
          throw std::runtime_error( oss.str() );
       }
    }
+
+   {
+      test_ = "dense matrix assignment (column-major, unaligned/unpadded)";
+
+      using blaze::unaligned;
+      using blaze::unpadded;
+      using blaze::columnMajor;
+
+      using UnalignedUnpadded = blaze::CustomMatrix<int,unaligned,unpadded,columnMajor>;
+
+      // Sizes of the tensors (pages, rows, columns); the rowslices are columns x pages
+      const std::array< std::array<size_t,3UL>, 3UL > sizes{ {
+         { { 7UL, 3UL, 13UL } }, { { 37UL, 2UL, 131UL } }, { { 600UL, 2UL, 1031UL } } } };
+
+      for( const auto& size : sizes )
+      {
+         MT tens( size[0], size[1], size[2] );
+         randomize( tens );
+
+         const MT orig( tens );
+
+         std::unique_ptr<int[]> memory( new int[size[2]*size[0]+1UL] );
+         UnalignedUnpadded m1( memory.get()+1UL, size[2], size[0] );
+         randomize( m1 );
+
+         blaze::DynamicMatrix<int,columnMajor> expected( m1 );
+
+         RT rowslice1 = blaze::rowslice( tens, 1UL );
+         rowslice1 = m1;
+
+         if( rowslice1 != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment failed\n"
+                << " Details:\n"
+                << "   Size of the rowslice: " << size[2] << "x" << size[0] << "\n"
+                << "   Result:\n" << rowslice1 << "\n"
+                << "   Expected result:\n" << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         rowslice1 += m1;
+         expected  += m1;
+
+         if( rowslice1 != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Addition assignment failed\n"
+                << " Details:\n"
+                << "   Size of the rowslice: " << size[2] << "x" << size[0] << "\n"
+                << "   Result:\n" << rowslice1 << "\n"
+                << "   Expected result:\n" << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         rowslice1 -= m1;
+         expected  -= m1;
+
+         if( rowslice1 != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Subtraction assignment failed\n"
+                << " Details:\n"
+                << "   Size of the rowslice: " << size[2] << "x" << size[0] << "\n"
+                << "   Result:\n" << rowslice1 << "\n"
+                << "   Expected result:\n" << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<size[1]; ++i )
+         {
+            if( i != 1UL && blaze::rowslice( tens, i ) != blaze::rowslice( orig, i ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Assignment modified row " << i << " of the tensor\n"
+                   << " Details:\n"
+                   << "   Size of the rowslice: " << size[2] << "x" << size[0] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
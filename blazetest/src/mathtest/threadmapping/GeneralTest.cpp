@@ -0,0 +1,303 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/threadmapping/GeneralTest.cpp
+//  \brief Source file for the general thread mapping test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//  Copyright (C) 2018 Hartmut Kaiser - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <tuple>
+#include <blaze/util/algorithms/Min.h>
+#include <blazetest/mathtest/threadmapping/GeneralTest.h>
+
+#include <blaze_tensor/math/DynamicTensor.h>
+#include <blaze_tensor/math/smp/TensorThreadMapping.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace threadmapping {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the GeneralTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+GeneralTest::GeneralTest()
+{
+   testFewPages();
+   testManyPages();
+   testPrimeThreads();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the thread mapping of tensors with fewer pages than threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the thread mapping for tensors with fewer pages than threads, in which
+// case the remaining threads are distributed among the rows and columns of the tensor. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testFewPages()
+{
+   test_ = "Thread mapping of tensors with fewer pages than threads";
+
+   for( size_t threads : { 2UL, 4UL, 6UL, 8UL, 12UL, 16UL } ) {
+      for( size_t simdsize : { 1UL, 4UL, 8UL } ) {
+         checkMapping( threads, 1UL, 57UL,  83UL, simdsize );
+         checkMapping( threads, 2UL, 83UL,  57UL, simdsize );
+         checkMapping( threads, 3UL,  5UL, 131UL, simdsize );
+         checkMapping( threads, 5UL, 17UL,   3UL, simdsize );
+         checkMapping( threads+1UL, threads-1UL, 19UL, 23UL, simdsize );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread mapping of tensors with at least as many pages as threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the thread mapping for tensors with at least as many pages as threads,
+// in which case the tensor is split across its pages only. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testManyPages()
+{
+   test_ = "Thread mapping of tensors with at least as many pages as threads";
+
+   for( size_t threads : { 1UL, 2UL, 4UL, 6UL, 8UL, 12UL, 16UL } ) {
+      for( size_t simdsize : { 1UL, 4UL, 8UL } ) {
+         checkMapping( threads, threads,      7UL, 13UL, simdsize );
+         checkMapping( threads, threads+1UL, 11UL,  5UL, simdsize );
+         checkMapping( threads, 3UL*threads-1UL, 3UL, 37UL, simdsize );
+         checkMapping( threads, 64UL, 1UL, 1UL, simdsize );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread mapping for a prime number of threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the thread mapping for prime numbers of threads, which cannot be split
+// across pages unless the tensor has at least as many pages as threads. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPrimeThreads()
+{
+   test_ = "Thread mapping for a prime number of threads";
+
+   for( size_t threads : { 3UL, 5UL, 7UL, 11UL, 13UL } ) {
+      for( size_t simdsize : { 1UL, 4UL, 8UL } ) {
+         checkMapping( threads, 1UL,         67UL, 71UL, simdsize );
+         checkMapping( threads, threads-1UL, 29UL,  7UL, simdsize );
+         checkMapping( threads, threads,      2UL, 97UL, simdsize );
+         checkMapping( threads, 2UL*threads+1UL, 3UL, 3UL, simdsize );
+         checkMapping( threads, 2UL,          1UL, 53UL, simdsize );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the thread mapping for the given number of threads and tensor dimensions.
+//
+// \param threads The number of threads.
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+// \param simdsize The SIMD size the columns per thread are rounded up to (1 for no rounding).
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates the thread mapping for the given number of threads and a tensor of the
+// given dimensions and derives the subtensor blocks in the same way as the SMP backends of the
+// dense tensor assignment. It checks that the mapping uses exactly the given number of threads,
+// that the tensor is split across its pages only in case there are at least as many pages as
+// threads, and that the blocks cover every element of the tensor exactly once. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::checkMapping( size_t threads, size_t o, size_t m, size_t n,
+                                size_t simdsize ) const
+{
+   using blaze::min;
+
+   const blaze::DynamicTensor<int> tens( o, m, n, 0 );
+
+   const blaze::TensorThreadMapping threadmap( blaze::createTensorThreadMapping( threads, tens ) );
+
+   const size_t pageThreads( std::get<0>( threadmap ) );
+   const size_t rowThreads ( std::get<1>( threadmap ) );
+   const size_t colThreads ( std::get<2>( threadmap ) );
+
+   if( pageThreads * rowThreads * colThreads != threads ||
+       ( o >= threads && ( pageThreads != threads || rowThreads != 1UL || colThreads != 1UL ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread mapping detected\n"
+          << " Details:\n"
+          << "   Number of threads = " << threads << "\n"
+          << "   Tensor dimensions = (" << o << "," << m << "," << n << ")\n"
+          << "   Thread mapping    = (" << pageThreads << "," << rowThreads << ","
+                                     << colThreads << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const size_t addon0        ( ( ( o % pageThreads ) != 0UL )? 1UL : 0UL );
+   const size_t pagesPerThread( o / pageThreads + addon0 );
+
+   const size_t addon1       ( ( ( m % rowThreads ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerThread( m / rowThreads + addon1 );
+
+   const size_t addon2     ( ( ( n % colThreads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( n / colThreads + addon2 );
+   const size_t rest2      ( equalShare2 & ( simdsize - 1UL ) );
+   const size_t colsPerThread( ( rest2 )?( equalShare2 - rest2 + simdsize ):( equalShare2 ) );
+
+   blaze::DynamicTensor<size_t> coverage( o, m, n, 0UL );
+
+   for( size_t i=0UL; i<pageThreads*rowThreads*colThreads; ++i )
+   {
+      const size_t page  ( ( i / ( rowThreads * colThreads ) ) * pagesPerThread );
+      const size_t row   ( ( ( i / colThreads ) % rowThreads ) * rowsPerThread );
+      const size_t column( ( i % colThreads ) * colsPerThread );
+
+      if( page >= o || row >= m || column >= n )
+         continue;
+
+      const size_t po( min( pagesPerThread, o - page   ) );
+      const size_t pm( min( rowsPerThread,  m - row    ) );
+      const size_t pn( min( colsPerThread,  n - column ) );
+
+      for( size_t k=page; k<page+po; ++k ) {
+         for( size_t r=row; r<row+pm; ++r ) {
+            for( size_t c=column; c<column+pn; ++c ) {
+               ++coverage(k,r,c);
+            }
+         }
+      }
+   }
+
+   for( size_t k=0UL; k<o; ++k ) {
+      for( size_t r=0UL; r<m; ++r ) {
+         for( size_t c=0UL; c<n; ++c )
+         {
+            if( coverage(k,r,c) != 1UL ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Subtensor blocks do not tile the tensor\n"
+                   << " Details:\n"
+                   << "   Number of threads = " << threads << "\n"
+                   << "   SIMD size         = " << simdsize << "\n"
+                   << "   Tensor dimensions = (" << o << "," << m << "," << n << ")\n"
+                   << "   Thread mapping    = (" << pageThreads << "," << rowThreads << ","
+                                              << colThreads << ")\n"
+                   << "   Element (" << k << "," << r << "," << c << ") is covered "
+                   << coverage(k,r,c) << " times\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadmapping
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running general thread mapping test..." << std::endl;
+
+   try
+   {
+      RUN_THREADMAPPING_GENERAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during general thread mapping test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************